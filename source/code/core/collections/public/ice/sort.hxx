@@ -4,7 +4,9 @@
 #pragma once
 #include <ice/base.hxx>
 #include <ice/span.hxx>
+#include <ice/stringid.hxx>
 #include <algorithm>
+#include <concepts>
 
 namespace ice
 {
@@ -64,6 +66,57 @@ namespace ice
     inline auto sort_linked_list(Node* left_list, ice::u32 size, Pred&& pred) noexcept -> Node*;
 
 
+    namespace detail
+    {
+
+        template<std::unsigned_integral T>
+        constexpr auto radix_key(T key) noexcept -> T
+        {
+            return key;
+        }
+
+        //! \brief Flips the sign bit so negative values are ordered before positive values.
+        template<std::signed_integral T>
+        constexpr auto radix_key(T key) noexcept -> std::make_unsigned_t<T>
+        {
+            using Unsigned = std::make_unsigned_t<T>;
+            return static_cast<Unsigned>(key) ^ (Unsigned{ 1 } << (sizeof(T) * 8 - 1));
+        }
+
+        //! \brief StringIDs are ordered by their hash value.
+        template<bool HasDebugInfo>
+        constexpr auto radix_key(ice::BaseStringID<HasDebugInfo> key) noexcept -> ice::u64
+        {
+            return ice::stringid_hash(key).value;
+        }
+
+    } // namespace detail
+
+    namespace concepts
+    {
+
+        template<typename T>
+        concept RadixSortKey = requires(T key) {
+            { ice::detail::radix_key(key) } -> std::unsigned_integral;
+        };
+
+    } // namespace concepts
+
+    //! \brief Stable LSD radix sort, for unsigned and signed integral or \ref ice::StringID keys.
+    //! \details Sorts 8 bits per pass, passes where all keys share the same byte are skipped.
+    //! \param[in,out] keys The keys to be sorted.
+    //! \param[in] scratch Temporary storage with at least the same number of elements as 'keys'.
+    template<typename Key> requires ice::concepts::RadixSortKey<Key>
+    inline void radix_sort(ice::Span<Key> keys, ice::Span<Key> scratch) noexcept;
+
+    //! \brief Stable LSD radix sort of values, ordered by the key returned from 'key_fn'.
+    //! \param[in,out] values The values to be sorted.
+    //! \param[in] scratch Temporary storage with at least the same number of elements as 'values'.
+    //! \param[in] key_fn Function returning an unsigned or signed integral or \ref ice::StringID key for a value.
+    template<typename T, typename KeyFn> requires ice::concepts::RadixSortKey<std::invoke_result_t<KeyFn&, T const&>>
+    inline void radix_sort(ice::Span<T> values, ice::Span<T> scratch, KeyFn&& key_fn) noexcept;
+
+
     template<typename T, typename U> requires (std::convertible_to<T, U>)
     constexpr auto lower_bound(ice::Span<T> values, U const& value) noexcept -> ice::ucount
     {
@@ -268,7 +321,7 @@ namespace ice
     template<typename T>
     inline void sort(ice::Span<T> span) noexcept
     {
-        std::sort(span.begin(), span.end());
+        std::sort(ice::span::begin(span), ice::span::end(span));
     }
 
     template<typename T, typename Pred>
@@ -359,6 +412,71 @@ namespace ice
         return result.next;
     }
 
+    template<typename Key> requires ice::concepts::RadixSortKey<Key>
+    inline void radix_sort(ice::Span<Key> keys, ice::Span<Key> scratch) noexcept
+    {
+        ice::radix_sort(keys, scratch, [](Key const& key) noexcept -> Key const& { return key; });
+    }
+
+    template<typename T, typename KeyFn> requires ice::concepts::RadixSortKey<std::invoke_result_t<KeyFn&, T const&>>
+    inline void radix_sort(ice::Span<T> values, ice::Span<T> scratch, KeyFn&& key_fn) noexcept
+    {
+        using RadixKey = decltype(ice::detail::radix_key(key_fn(std::declval<T const&>())));
+        static constexpr ice::u32 Constant_PassCount = sizeof(RadixKey);
+
+        ice::ucount const count = ice::span::count(values);
+        if (count < 2)
+        {
+            return;
+        }
+
+        ICE_ASSERT_CORE(ice::span::count(scratch) >= count);
+
+        // Histograms for all passes are gathered at once, so we only need a single read over all keys.
+        ice::ucount offsets[Constant_PassCount][256]{ };
+        for (T const& value : values)
+        {
+            RadixKey const key = ice::detail::radix_key(key_fn(value));
+            for (ice::u32 pass = 0; pass < Constant_PassCount; ++pass)
+            {
+                offsets[pass][(key >> (pass * 8)) & 0xff] += 1;
+            }
+        }
+
+        ice::Span<T> source = values;
+        ice::Span<T> target = ice::span::head(scratch, count);
+        RadixKey const first_key = ice::detail::radix_key(key_fn(values[0]));
+        for (ice::u32 pass = 0; pass < Constant_PassCount; ++pass)
+        {
+            ice::u32 const shift = pass * 8;
+
+            // All keys have the same byte value, nothing would change.
+            ice::ucount* const pass_offsets = offsets[pass];
+            if (pass_offsets[(first_key >> shift) & 0xff] == count)
+            {
+                continue;
+            }
+
+            ice::ucount offset = 0;
+            for (ice::u32 bucket = 0; bucket < 256; ++bucket)
+            {
+                offset += ice::exchange(pass_offsets[bucket], offset);
+            }
+
+            for (T& value : source)
+            {
+                RadixKey const key = ice::detail::radix_key(key_fn(value));
+                target[pass_offsets[(key >> shift) & 0xff]++] = ice::move(value);
+            }
+            ice::swap(source, target);
+        }
+
+        if (ice::span::data(source) != ice::span::data(values))
+        {
+            std::move(ice::span::begin(source), ice::span::end(source), ice::span::begin(values));
+        }
+    }
+
     template<typename T>
     constexpr auto constexpr_sort_stdarray(T const& arr, ice::u32 start_offset) noexcept -> T
     {
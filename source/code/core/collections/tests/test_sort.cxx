@@ -0,0 +1,139 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/container/array.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/sort.hxx>
+#include <random>
+
+namespace
+{
+
+    struct TestDrawKey
+    {
+        ice::u32 key;
+        ice::u32 order;
+    };
+
+} // namespace
+
+SCENARIO("collections 'ice/sort.hxx' (radix sort)", "[collection][sort]")
+{
+    ice::HostAllocator alloc;
+    std::mt19937_64 gen{ 0x1ce'5047 };
+
+    GIVEN("random unsigned 64-bit keys")
+    {
+        ice::Array<ice::u64> keys{ alloc };
+        ice::Array<ice::u64> scratch{ alloc };
+        ice::array::resize(keys, 10'000);
+        ice::array::resize(scratch, 10'000);
+        for (ice::u64& key : keys)
+        {
+            key = gen();
+        }
+
+        ice::Array<ice::u64> expected = keys;
+        ice::sort(ice::array::slice(expected));
+        ice::radix_sort(ice::array::slice(keys), ice::array::slice(scratch));
+
+        THEN("they are sorted the same as with a comparison sort")
+        {
+            for (ice::u32 idx = 0; idx < ice::array::count(keys); ++idx)
+            {
+                REQUIRE(keys[idx] == expected[idx]);
+            }
+        }
+    }
+
+    GIVEN("signed keys with negative values")
+    {
+        ice::i32 keys[]{ 5, -1, 0, ice::i32_min, 42, -42, ice::i32_max, 1 };
+        ice::i32 scratch[ice::count(keys)];
+        ice::radix_sort(ice::Span{ keys }, ice::Span{ scratch });
+
+        THEN("negative values are ordered first")
+        {
+            ice::i32 const expected[]{ ice::i32_min, -42, -1, 0, 1, 5, 42, ice::i32_max };
+            for (ice::u32 idx = 0; idx < ice::count(keys); ++idx)
+            {
+                CHECK(keys[idx] == expected[idx]);
+            }
+        }
+    }
+
+    GIVEN("values with many duplicate keys")
+    {
+        ice::Array<TestDrawKey> values{ alloc };
+        ice::Array<TestDrawKey> scratch{ alloc };
+        ice::array::resize(scratch, 5'000);
+        for (ice::u32 idx = 0; idx < 5'000; ++idx)
+        {
+            // Only the upper byte changes, so lower passes are skipped.
+            ice::array::push_back(values, TestDrawKey{ .key = ice::u32(gen() % 16) << 24, .order = idx });
+        }
+
+        ice::radix_sort(
+            ice::array::slice(values),
+            ice::array::slice(scratch),
+            [](TestDrawKey const& value) noexcept { return value.key; }
+        );
+
+        THEN("the sort is stable")
+        {
+            for (ice::u32 idx = 1; idx < ice::array::count(values); ++idx)
+            {
+                TestDrawKey const& prev = values[idx - 1];
+                TestDrawKey const& curr = values[idx];
+                REQUIRE(prev.key <= curr.key);
+                if (prev.key == curr.key)
+                {
+                    REQUIRE(prev.order < curr.order);
+                }
+            }
+        }
+    }
+
+    GIVEN("values with only equal keys")
+    {
+        ice::Array<TestDrawKey> values{ alloc };
+        ice::Array<TestDrawKey> scratch{ alloc };
+        ice::array::resize(scratch, 1'000);
+        for (ice::u32 idx = 0; idx < 1'000; ++idx)
+        {
+            ice::array::push_back(values, TestDrawKey{ .key = 0x1ce5'0048, .order = idx });
+        }
+
+        ice::radix_sort(
+            ice::array::slice(values),
+            ice::array::slice(scratch),
+            [](TestDrawKey const& value) noexcept { return value.key; }
+        );
+
+        THEN("the original order is kept")
+        {
+            for (ice::u32 idx = 0; idx < ice::array::count(values); ++idx)
+            {
+                REQUIRE(values[idx].order == idx);
+            }
+        }
+    }
+
+    GIVEN("StringID keys")
+    {
+        using ice::operator""_sid;
+        ice::StringID keys[]{ "c"_sid, "a"_sid, "b"_sid, "a"_sid };
+        ice::StringID scratch[ice::count(keys)];
+        ice::radix_sort(ice::Span{ keys }, ice::Span{ scratch });
+
+        THEN("they are ordered by hash value")
+        {
+            for (ice::u32 idx = 1; idx < ice::count(keys); ++idx)
+            {
+                CHECK(ice::hash(keys[idx - 1]) <= ice::hash(keys[idx]));
+            }
+            CHECK((keys[0] == keys[1] || keys[1] == keys[2] || keys[2] == keys[3]));
+        }
+    }
+}
@@ -3,8 +3,10 @@
 
 #pragma once
 #include <ice/constants.hxx>
+#include <ice/assert_core.hxx>
 #include <ice/hash/murmur2.hxx>
 #include <ice/hash/murmur3.hxx>
+#include <span>
 
 namespace ice
 {
@@ -45,6 +47,25 @@ namespace ice
     template<typename T>
     constexpr auto hash_from_ptr(T* ptr) noexcept -> ice::u64;
 
+    //! \brief Mixes 'value' into 'seed', the same way 'boost::hash_combine' does for 64bit values.
+    //! \note The result depends on the order values are combined in.
+    constexpr auto hash_combine(ice::u64 seed, ice::u64 value) noexcept -> ice::u64;
+
+
+    //! \brief Hashes all values at once, results are the same as calling 'ice::hash' on each value.
+    //! \param[in] values The strings to be hashed.
+    //! \param[out] out_hashes Receives the hash of each value, needs at least the same size as 'values'.
+    inline void hash_batch(std::span<std::string_view const> values, std::span<ice::u64> out_hashes) noexcept;
+
+    inline void hash_batch(std::span<std::u8string_view const> values, std::span<ice::u64> out_hashes) noexcept;
+
+    //! \brief Hashes all values at once, results are the same as calling 'ice::hash32' on each value.
+    //! \param[in] values The strings to be hashed.
+    //! \param[out] out_hashes Receives the hash of each value, needs at least the same size as 'values'.
+    inline void hash32_batch(std::span<std::string_view const> values, std::span<ice::u32> out_hashes) noexcept;
+
+    inline void hash32_batch(std::span<std::u8string_view const> values, std::span<ice::u32> out_hashes) noexcept;
+
 
     // IMPLEMENTATION DETAILS
 
@@ -129,6 +150,44 @@ namespace ice
         return hash(reinterpret_cast<ice::uptr>(ptr));
     }
 
+    constexpr auto hash_combine(ice::u64 seed, ice::u64 value) noexcept -> ice::u64
+    {
+        return seed ^ (value + 0x9e37'79b9'7f4a'7c15 + (seed << 6) + (seed >> 2));
+    }
+
+
+    inline void hash_batch(std::span<std::string_view const> values, std::span<ice::u64> out_hashes) noexcept
+    {
+        ICE_ASSERT_CORE(out_hashes.size() >= values.size());
+        ice::detail::murmur2_hash::rt_murmur2_x64_64_batch(
+            values.data(), out_hashes.data(), values.size(), ice::build::Constant_Hash64_DefaultSeed
+        );
+    }
+
+    inline void hash_batch(std::span<std::u8string_view const> values, std::span<ice::u64> out_hashes) noexcept
+    {
+        ICE_ASSERT_CORE(out_hashes.size() >= values.size());
+        ice::detail::murmur2_hash::rt_murmur2_x64_64_batch(
+            values.data(), out_hashes.data(), values.size(), ice::build::Constant_Hash64_DefaultSeed
+        );
+    }
+
+    inline void hash32_batch(std::span<std::string_view const> values, std::span<ice::u32> out_hashes) noexcept
+    {
+        ICE_ASSERT_CORE(out_hashes.size() >= values.size());
+        ice::detail::murmur3_hash::detail::rt_murmur3_x86_32_batch(
+            values.data(), out_hashes.data(), values.size(), ice::build::Constant_Hash32_DefaultSeed
+        );
+    }
+
+    inline void hash32_batch(std::span<std::u8string_view const> values, std::span<ice::u32> out_hashes) noexcept
+    {
+        ICE_ASSERT_CORE(out_hashes.size() >= values.size());
+        ice::detail::murmur3_hash::detail::rt_murmur3_x86_32_batch(
+            values.data(), out_hashes.data(), values.size(), ice::build::Constant_Hash32_DefaultSeed
+        );
+    }
+
 
     // COMPILE TILE CHECKS
 
@@ -165,6 +224,9 @@ namespace ice
         static_assert(ice::hash(u8"") == ice::hash(u8""));
         static_assert(ice::hash(std::u8string_view{}) == ice::hash(std::u8string_view{}));
 
+        // Check combining hashes depends on the order of values.
+        static_assert(ice::hash_combine(ice::hash(u8"a"), ice::hash(u8"b")) != ice::hash_combine(ice::hash(u8"b"), ice::hash(u8"a")));
+
     } // namespace _validation
 
 } // namespace ice
@@ -37,6 +37,9 @@
 #pragma once
 #include <ice/types.hxx>
 #include <string_view>
+#include <type_traits>
+#include <cstring>
+#include <bit>
 
 namespace ice::detail::murmur2_hash
 {
@@ -98,14 +101,136 @@ namespace ice::detail::murmur2_hash
             : cmix<CharType>(data, len, cmix_h<CharType>(data, h, offset), offset + 8);
     }
 
+    // Runtime implementation, loads whole 64 bit blocks at once and does not rely on recursion.
+    // The results are bit-identical to the constexpr version above.
+
+    //! \brief Loads a 64 bit block the same way 'cblock' does.
+    //! \note For signed characters 'cblock' sign-extends each byte before or-ing it in, so a negative byte sets all bits
+    //!   above itself. We replicate this, since changing it would change the value of every existing hash.
+    template<typename CharType>
+    inline auto rt_block(CharType const* data) noexcept -> ice::u64
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            ice::u64 result;
+            std::memcpy(&result, data, sizeof(ice::u64));
+
+            if constexpr (std::is_signed_v<CharType>)
+            {
+                ice::u64 const negative_bytes = result & 0x8080'8080'8080'8080;
+                ice::u32 const first_negative_bit = static_cast<ice::u32>(std::countr_zero(negative_bytes));
+                if (first_negative_bit < 56)
+                {
+                    result |= ~ice::u64{ 0 } << (first_negative_bit + 1);
+                }
+            }
+            return result;
+        }
+        else
+        {
+            return cblock<CharType>(data);
+        }
+    }
+
+    inline auto rt_mix(ice::u64 h, ice::u64 block) noexcept -> ice::u64
+    {
+        return (h ^ (crotate(block * m) * m)) * m;
+    }
+
+    //! \brief Mixes the remaining blocks and the tail, starting at 'offset' which needs to be a multiple of 8.
+    template<typename CharType>
+    inline auto rt_murmur2_x64_64_finish(CharType const* data, size_t len, size_t offset, ice::u64 h) noexcept -> ice::u64
+    {
+        CharType const* const blocks_end = data + (len & ~size_t(7));
+        for (CharType const* block = data + offset; block != blocks_end; block += 8)
+        {
+            h = rt_mix(h, rt_block<CharType>(block));
+        }
+
+        size_t const tail_len = len & 7;
+        if (tail_len != 0)
+        {
+            // Same expression as 'cfinalize_h', including the sign extension of signed characters.
+            for (size_t idx = tail_len; idx > 0; --idx)
+            {
+                h ^= ice::u64(blocks_end[idx - 1]) << (8 * (idx - 1));
+            }
+            h *= m;
+        }
+        return crotate(crotate(h) * m);
+    }
+
+    template<typename CharType>
+    inline auto rt_murmur2_x64_64(CharType const* data, size_t len, ice::u64 seed) noexcept -> ice::u64
+    {
+        return rt_murmur2_x64_64_finish<CharType>(data, len, 0, seed ^ (len * m));
+    }
+
+    //! \brief Hashes multiple keys, processing four keys in lock-step so the independent multiply chains can overlap.
+    template<typename CharType>
+    inline void rt_murmur2_x64_64_batch(
+        std::basic_string_view<CharType> const* keys,
+        ice::u64* out_hashes,
+        size_t count,
+        ice::u64 seed
+    ) noexcept
+    {
+        static constexpr size_t Constant_Lanes = 4;
+
+        size_t idx = 0;
+        for (; idx + Constant_Lanes <= count; idx += Constant_Lanes)
+        {
+            std::basic_string_view<CharType> const* const lane_keys = keys + idx;
+
+            ice::u64 h[Constant_Lanes];
+            size_t common_len = lane_keys[0].length();
+            for (size_t lane = 0; lane < Constant_Lanes; ++lane)
+            {
+                h[lane] = seed ^ (lane_keys[lane].length() * m);
+                common_len = lane_keys[lane].length() < common_len ? lane_keys[lane].length() : common_len;
+            }
+
+            size_t const common_end = common_len & ~size_t(7);
+            for (size_t offset = 0; offset != common_end; offset += 8)
+            {
+                for (size_t lane = 0; lane < Constant_Lanes; ++lane)
+                {
+                    h[lane] = rt_mix(h[lane], rt_block<CharType>(lane_keys[lane].data() + offset));
+                }
+            }
+
+            for (size_t lane = 0; lane < Constant_Lanes; ++lane)
+            {
+                out_hashes[idx + lane] = rt_murmur2_x64_64_finish<CharType>(
+                    lane_keys[lane].data(), lane_keys[lane].length(), common_end, h[lane]
+                );
+            }
+        }
+
+        for (; idx < count; ++idx)
+        {
+            out_hashes[idx] = rt_murmur2_x64_64<CharType>(keys[idx].data(), keys[idx].length(), seed);
+        }
+    }
+
     constexpr auto cexpr_murmur2_x64_64(std::string_view key, ice::u64 seed) noexcept -> mm2_x64_64
     {
+        if (std::is_constant_evaluated() == false)
+        {
+            return mm2_x64_64{ .h = { rt_murmur2_x64_64<char>(key.data(), key.length(), seed) } };
+        }
+
         ice::u64 const h = cmix<char>(key.data(), key.length(), seed ^ (key.length() * m));
         return mm2_x64_64{ .h = { h } };
     }
 
     constexpr auto cexpr_murmur2_x64_64(std::u8string_view key, ice::u64 seed) noexcept -> mm2_x64_64
     {
+        if (std::is_constant_evaluated() == false)
+        {
+            return mm2_x64_64{ .h = { rt_murmur2_x64_64<ice::utf8>(key.data(), key.length(), seed) } };
+        }
+
         ice::u64 const h = cmix<ice::utf8>(key.data(), key.length(), seed ^ (key.length() * m));
         return mm2_x64_64{ .h = { h } };
     }
@@ -13,6 +13,8 @@
 #pragma once
 #include <ice/types.hxx>
 #include <string_view>
+#include <cstring>
+#include <bit>
 
 namespace ice::detail::murmur3_hash
 {
@@ -177,6 +179,113 @@ namespace ice::detail::murmur3_hash
             return mm3_x86_h32{ .h = { hash_r1 } };
         }
 
+        //-----------------------------------------------------------------------------
+        // Runtime implementation of the x86_32 variant, loads whole blocks at once.
+        // The results are bit-identical to the constexpr version above.
+
+        template<typename Char>
+        inline auto rt_block_x32(Char const* data) noexcept -> ice::u32
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                ice::u32 result;
+                std::memcpy(&result, data, sizeof(ice::u32));
+                return result;
+            }
+            else
+            {
+                return cexpr_block_x32(data);
+            }
+        }
+
+        inline auto rt_mix_x86_32(ice::u32 hash_r1, ice::u32 k1) noexcept -> ice::u32
+        {
+            k1 = cexpr_rotl32(k1 * 0xcc9e2d51, 15) * 0x1b873593;
+            hash_r1 ^= k1;
+            return cexpr_rotl32(hash_r1, 13) * 5 + 0xe6546b64;
+        }
+
+        //! \brief Mixes the remaining blocks, tail and finalizes the hash, 'offset' needs to be a multiple of 4.
+        template<typename Char>
+        inline auto rt_murmur3_x86_32_finish(Char const* data, ice::u32 length, ice::u32 offset, ice::u32 hash_r1) noexcept -> ice::u32
+        {
+            Char const* const blocks_end = data + (length & ~3u);
+            for (Char const* block = data + offset; block != blocks_end; block += 4)
+            {
+                hash_r1 = rt_mix_x86_32(hash_r1, rt_block_x32(block));
+            }
+
+            ice::u32 k1 = 0;
+            switch (length & 3)
+            {
+            case 3:
+                k1 ^= static_cast<ice::u8 const>(blocks_end[2]) << 16;
+                [[fallthrough]];
+            case 2:
+                k1 ^= static_cast<ice::u8 const>(blocks_end[1]) << 8;
+                [[fallthrough]];
+            case 1:
+                k1 ^= static_cast<ice::u8 const>(blocks_end[0]);
+            };
+
+            hash_r1 ^= cexpr_rotl32(k1 * 0xcc9e2d51, 15) * 0x1b873593;
+            hash_r1 ^= length;
+            return cexpr_fmix32(hash_r1);
+        }
+
+        template<typename Char>
+        inline auto rt_murmur3_x86_32(Char const* data, size_t length, ice::u32 seed) noexcept -> ice::u32
+        {
+            return rt_murmur3_x86_32_finish(data, static_cast<ice::u32>(length), 0, seed);
+        }
+
+        //! \brief Hashes multiple keys, processing four keys in lock-step so the independent multiply chains can overlap.
+        template<typename Char>
+        inline void rt_murmur3_x86_32_batch(
+            std::basic_string_view<Char> const* keys,
+            ice::u32* out_hashes,
+            size_t count,
+            ice::u32 seed
+        ) noexcept
+        {
+            static constexpr size_t Constant_Lanes = 4;
+
+            size_t idx = 0;
+            for (; idx + Constant_Lanes <= count; idx += Constant_Lanes)
+            {
+                std::basic_string_view<Char> const* const lane_keys = keys + idx;
+
+                ice::u32 common_len = static_cast<ice::u32>(lane_keys[0].length());
+                for (size_t lane = 1; lane < Constant_Lanes; ++lane)
+                {
+                    ice::u32 const lane_len = static_cast<ice::u32>(lane_keys[lane].length());
+                    common_len = lane_len < common_len ? lane_len : common_len;
+                }
+
+                ice::u32 hash_r1[Constant_Lanes]{ seed, seed, seed, seed };
+                ice::u32 const common_end = common_len & ~3u;
+                for (ice::u32 offset = 0; offset != common_end; offset += 4)
+                {
+                    for (size_t lane = 0; lane < Constant_Lanes; ++lane)
+                    {
+                        hash_r1[lane] = rt_mix_x86_32(hash_r1[lane], rt_block_x32(lane_keys[lane].data() + offset));
+                    }
+                }
+
+                for (size_t lane = 0; lane < Constant_Lanes; ++lane)
+                {
+                    out_hashes[idx + lane] = rt_murmur3_x86_32_finish(
+                        lane_keys[lane].data(), static_cast<ice::u32>(lane_keys[lane].length()), common_end, hash_r1[lane]
+                    );
+                }
+            }
+
+            for (; idx < count; ++idx)
+            {
+                out_hashes[idx] = rt_murmur3_x86_32(keys[idx].data(), keys[idx].length(), seed);
+            }
+        }
+
         //-----------------------------------------------------------------------------
 
         template<typename Char>
@@ -427,6 +536,10 @@ namespace ice::detail::murmur3_hash
 
     constexpr auto cexpr_murmur3_x86_32(std::u8string_view key, ice::u32 seed) noexcept -> mm3_x86_h32
     {
+        if (std::is_constant_evaluated() == false)
+        {
+            return mm3_x86_h32{ .h = { detail::rt_murmur3_x86_32<ice::utf8>(key.data(), key.length(), seed) } };
+        }
         return detail::cexpr_murmur3_x86_32<ice::utf8>(key, seed);
     }
 
@@ -442,6 +555,10 @@ namespace ice::detail::murmur3_hash
 
     constexpr auto cexpr_murmur3_x86_32(std::string_view key, ice::u32 seed) noexcept -> mm3_x86_h32
     {
+        if (std::is_constant_evaluated() == false)
+        {
+            return mm3_x86_h32{ .h = { detail::rt_murmur3_x86_32<char>(key.data(), key.length(), seed) } };
+        }
         return detail::cexpr_murmur3_x86_32<char>(key, seed);
     }
 
@@ -89,6 +89,48 @@ namespace ice
 
     static constexpr ice::StringID StringID_Invalid{ .value = StringID_Hash{ } };
 
+    namespace detail::stringid_type_v3
+    {
+
+        //! \brief Creates a runtime StringID with a debug name hint, keeping the last 24 characters of the value.
+        inline auto runtime_stringid(std::string_view value, ice::u64 hash_value) noexcept -> ice::BaseStringID<true>
+        {
+            BaseStringID<true> result{
+                .value = { .value = hash_value },
+                .debug_info = {.name_value = {.consteval_flag = '\0'}}
+            };
+
+            size_t const cstr_size = value.size();
+            size_t const origin_size = std::size(result.debug_info.name_hint);
+
+            size_t const copy_count = std::min(origin_size, cstr_size);
+            size_t const copy_offset = std::max(size_t{ 0 }, cstr_size - copy_count);
+
+
+            ice::i32 i = 0;
+            for (auto& v : result.debug_info.name_hint)
+            {
+                if (i < copy_count)
+                {
+                    v = value[copy_offset + i];
+                }
+                else
+                {
+                    v = char{};
+                }
+
+                i += 1;
+            }
+
+            if (copy_offset > 0)
+            {
+                result.debug_info.name_hint[0] = '~';
+            }
+            return result;
+        }
+
+    } // namespace detail::stringid_type_v3
+
     constexpr auto stringid(std::string_view value) noexcept
     {
         using namespace ice::detail::murmur2_hash;
@@ -105,46 +147,49 @@ namespace ice
             }
             else
             {
-                BaseStringID<true> result{
-                    .value = { .value = hash_result.h[0] },
-                    .debug_info = {.name_value = {.consteval_flag = '\0'}}
-                };
+                return ice::detail::stringid_type_v3::runtime_stringid(value, hash_result.h[0]);
+            }
+        }
+        else
+        {
+            return BaseStringID<false> {
+                .value = { .value = hash_result.h[0] }
+            };
+        }
+    }
 
-                size_t const cstr_size = value.size();
-                size_t const origin_size = std::size(result.debug_info.name_hint);
+    //! \brief Creates StringID values for all given strings at once.
+    //! \details Strings are hashed in groups, which is notably faster than calling 'ice::stringid' in a loop when
+    //!   creating many identifiers, like when loading asset names or resource URIs.
+    //!
+    //! \param[in] values The strings to create identifiers for.
+    //! \param[out] out_ids Receives the identifier of each value, needs at least the same size as 'values'.
+    inline void stringid_batch(std::span<std::string_view const> values, std::span<ice::StringID> out_ids) noexcept
+    {
+        ICE_ASSERT_CORE(out_ids.size() >= values.size());
 
-                size_t const copy_count = std::min(origin_size, cstr_size);
-                size_t const copy_offset = std::max(size_t{ 0 }, cstr_size - copy_count);
+        static constexpr size_t Constant_BatchSize = 32;
+        ice::u64 hashes[Constant_BatchSize];
 
+        for (size_t offset = 0; offset < values.size(); offset += Constant_BatchSize)
+        {
+            size_t const count = std::min(Constant_BatchSize, values.size() - offset);
+            ice::detail::murmur2_hash::rt_murmur2_x64_64_batch(
+                values.data() + offset, hashes, count, ice::build::Constant_StringID_DefaultSeed
+            );
 
-                ice::i32 i = 0;
-                for (auto& v : result.debug_info.name_hint)
+            for (size_t idx = 0; idx < count; ++idx)
+            {
+                if constexpr (ice::build::Constant_StringID_DebugInfoEnabled)
                 {
-                    if (i < copy_count)
-                    {
-                        v = value[copy_offset + i];
-                    }
-                    else
-                    {
-                        v = char{};
-                    }
-
-                    i += 1;
+                    out_ids[offset + idx] = ice::detail::stringid_type_v3::runtime_stringid(values[offset + idx], hashes[idx]);
                 }
-
-                if (copy_offset > 0)
+                else
                 {
-                    result.debug_info.name_hint[0] = '~';
+                    out_ids[offset + idx] = ice::StringID{ .value = { .value = hashes[idx] } };
                 }
-                return result;
             }
         }
-        else
-        {
-            return BaseStringID<false> {
-                .value = { .value = hash_result.h[0] }
-            };
-        }
     }
 
     constexpr auto stringid(const char* string, size_t size) noexcept
@@ -4,6 +4,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <ice/hash/murmur2.hxx>
 #include <ice/hash/murmur3.hxx>
+#include <ice/stringid.hxx>
+#include <string>
 
 uint32_t constexpr test_seed_1 = 0xD00D00;
 uint32_t constexpr test_seed_2 = 0xDAADAA;
@@ -107,3 +109,80 @@ TEST_CASE("core 'ice/hash/murmur3.hxx' (128bit)", "[hash][128bit_hash]")
         CHECK(hash_result_large.h[1] != hash_result2_large.h[1]);
     }
 }
+
+TEST_CASE("core 'ice/hash.hxx' (runtime and batch hashing)", "[hash][batch_hash]")
+{
+    namespace mm2h = ice::detail::murmur2_hash;
+    namespace mm3h = ice::detail::murmur3_hash;
+
+    // Contains bytes above 0x7f, to validate the runtime versions handle signed characters the same way.
+    std::string_view constexpr test_string_signed = "Z\xc5\xbc\xc3\xb3\xc5\x82w \xe2\x80\x94 the quick brown fox.";
+
+    std::string_view constexpr test_values[]{
+        "",
+        "Fox",
+        "The quick brown fox.",
+        "The quick brown fox jumps over the lazy dog.",
+        test_string_signed,
+        "urn:core/shaders/color.frag",
+        "urn:core/shaders/color.vert",
+        "a",
+        "The quick brown fox jumps over the lazy dog and keeps on running for a few more blocks.",
+    };
+    ice::u32 constexpr test_count = static_cast<ice::u32>(std::size(test_values));
+
+    // Forcing constant evaluation, so we compare the runtime results against the constexpr implementation.
+    ice::u64 constexpr expected_hashes[]{
+        ice::hash(test_values[0]), ice::hash(test_values[1]), ice::hash(test_values[2]),
+        ice::hash(test_values[3]), ice::hash(test_values[4]), ice::hash(test_values[5]),
+        ice::hash(test_values[6]), ice::hash(test_values[7]), ice::hash(test_values[8]),
+    };
+    ice::u32 constexpr expected_hashes32[]{
+        ice::hash32(test_values[0]), ice::hash32(test_values[1]), ice::hash32(test_values[2]),
+        ice::hash32(test_values[3]), ice::hash32(test_values[4]), ice::hash32(test_values[5]),
+        ice::hash32(test_values[6]), ice::hash32(test_values[7]), ice::hash32(test_values[8]),
+    };
+    mm2h::mm2_x64_64 constexpr expected_signed = mm2h::cexpr_murmur2_x64_64(test_string_signed, test_seed_1);
+
+    SECTION("Runtime hashing matches constexpr values")
+    {
+        for (ice::u32 idx = 0; idx < test_count; ++idx)
+        {
+            // Copy the value so the hash can only be calculated at runtime.
+            std::string const runtime_value{ test_values[idx] };
+
+            CHECK(ice::hash(std::string_view{ runtime_value }) == expected_hashes[idx]);
+            CHECK(ice::hash32(std::string_view{ runtime_value }) == expected_hashes32[idx]);
+        }
+
+        std::string const runtime_signed{ test_string_signed };
+        CHECK(mm2h::cexpr_murmur2_x64_64(runtime_signed, test_seed_1).h[0] == expected_signed.h[0]);
+    }
+
+    SECTION("Batch hashing matches constexpr values")
+    {
+        ice::u64 hashes[test_count]{};
+        ice::u32 hashes32[test_count]{};
+        ice::hash_batch(test_values, hashes);
+        ice::hash32_batch(test_values, hashes32);
+
+        for (ice::u32 idx = 0; idx < test_count; ++idx)
+        {
+            CHECK(hashes[idx] == expected_hashes[idx]);
+            CHECK(hashes32[idx] == expected_hashes32[idx]);
+        }
+    }
+
+    SECTION("Batch StringID creation matches 'ice::stringid'")
+    {
+        ice::StringID ids[test_count]{};
+        ice::stringid_batch(test_values, ids);
+
+        for (ice::u32 idx = 0; idx < test_count; ++idx)
+        {
+            ice::StringID const expected = ice::stringid(test_values[idx]);
+            CHECK(ids[idx] == expected);
+            CHECK(ice::stringid_hint(ids[idx]) == ice::stringid_hint(expected));
+        }
+    }
+}
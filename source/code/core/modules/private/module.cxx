@@ -12,13 +12,15 @@ namespace ice
 
     ModulesEntry::ModulesEntry(
         ice::FnModuleLoad* fn_load,
-        ice::FnModuleUnload* fn_unload
+        ice::FnModuleUnload* fn_unload,
+        ice::FnModuleReload* fn_reload
     ) noexcept
-        : ModuleInfo{ fn_load, fn_unload }
+        : ModuleInfo{ fn_load, fn_unload, fn_reload }
         , next{ ice::exchange(Global_ModulesList, this) }
     {
         ICE_ASSERT_CORE(fn_load != nullptr);
         ICE_ASSERT_CORE(fn_unload != nullptr);
+        ICE_ASSERT_CORE(fn_reload != nullptr);
     }
 
 } // namespace ice
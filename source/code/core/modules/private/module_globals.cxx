@@ -24,6 +24,20 @@ namespace ice
         return loaded_modules;
     }
 
+    void detail::reload_global_modules(
+        ice::Allocator* alloc,
+        ice::ModuleNegotiatorAPIContext* ctx,
+        ice::ModuleNegotiatorAPI* negotiator
+    ) noexcept
+    {
+        ice::ModulesEntry const* module_entry = Global_ModulesList;
+        while(module_entry != nullptr)
+        {
+            module_entry->fn_reload(alloc, ctx, negotiator);
+            module_entry = module_entry->next;
+        }
+    }
+
 } // namespace ice
 
 #if ISP_WINDOWS
@@ -5,6 +5,11 @@
 #include <ice/string/heap_string.hxx>
 #include <ice/mem_allocator_stack.hxx>
 
+#if ISP_UNIX
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+
 namespace ice::native_module
 {
 
@@ -55,6 +60,39 @@ namespace ice::native_module
         return ::GetProcAddress(module.native(), ice::string::begin(symbol_name));
     }
 
+    auto module_timestamp(ice::String path) noexcept -> ice::u64
+    {
+        ice::StackAllocator<512_B> temp_alloc;
+        ice::HeapString<ice::wchar> wide_path{ temp_alloc };
+
+        WIN32_FILE_ATTRIBUTE_DATA file_data;
+        if (utf8_to_wide_append_module(path, wide_path)
+            && GetFileAttributesExW(ice::string::begin(wide_path), GetFileExInfoStandard, &file_data))
+        {
+            return (ice::u64{ file_data.ftLastWriteTime.dwHighDateTime } << 32) | file_data.ftLastWriteTime.dwLowDateTime;
+        }
+        return 0;
+    }
+
+    bool module_copy(ice::String from_path, ice::String to_path) noexcept
+    {
+        ice::StackAllocator<512_B> temp_alloc_from;
+        ice::StackAllocator<512_B> temp_alloc_to;
+        ice::HeapString<ice::wchar> wide_from_path{ temp_alloc_from };
+        ice::HeapString<ice::wchar> wide_to_path{ temp_alloc_to };
+
+        return utf8_to_wide_append_module(from_path, wide_from_path)
+            && utf8_to_wide_append_module(to_path, wide_to_path)
+            && CopyFileW(ice::string::begin(wide_from_path), ice::string::begin(wide_to_path), FALSE);
+    }
+
+    bool module_remove(ice::String path) noexcept
+    {
+        ice::StackAllocator<512_B> temp_alloc;
+        ice::HeapString<ice::wchar> wide_path{ temp_alloc };
+        return utf8_to_wide_append_module(path, wide_path) && DeleteFileW(ice::string::begin(wide_path));
+    }
+
 #elif ISP_UNIX
 
     auto module_open(ice::String path) noexcept -> ice::native_module::ModuleHandle
@@ -72,6 +110,49 @@ namespace ice::native_module
         return ::dlsym(module.native(), ice::string::begin(symbol_name));
     }
 
+    auto module_timestamp(ice::String path) noexcept -> ice::u64
+    {
+        struct stat file_stat;
+        if (::stat(ice::string::begin(path), &file_stat) == 0)
+        {
+            return ice::u64(file_stat.st_mtim.tv_sec) * 1'000'000'000 + ice::u64(file_stat.st_mtim.tv_nsec);
+        }
+        return 0;
+    }
+
+    bool module_copy(ice::String from_path, ice::String to_path) noexcept
+    {
+        ice::unix_::FileHandle const source{ ::open(ice::string::begin(from_path), O_RDONLY) };
+        ice::unix_::FileHandle const target{ ::open(ice::string::begin(to_path), O_WRONLY | O_CREAT | O_TRUNC, 0755) };
+        if (source == false || target == false)
+        {
+            return false;
+        }
+
+        char buffer[4096];
+        ssize_t bytes_read = ::read(source.native(), buffer, sizeof(buffer));
+        while (bytes_read > 0)
+        {
+            ssize_t bytes_written = 0;
+            while (bytes_written < bytes_read)
+            {
+                ssize_t const result = ::write(target.native(), buffer + bytes_written, bytes_read - bytes_written);
+                if (result < 0)
+                {
+                    return false;
+                }
+                bytes_written += result;
+            }
+            bytes_read = ::read(source.native(), buffer, sizeof(buffer));
+        }
+        return bytes_read == 0;
+    }
+
+    bool module_remove(ice::String path) noexcept
+    {
+        return ::unlink(ice::string::begin(path)) == 0;
+    }
+
 #endif
 
 } // namespace ice
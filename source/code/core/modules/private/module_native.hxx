@@ -24,4 +24,13 @@ namespace ice::native_module
 
     auto module_find_address(ice::native_module::ModuleHandle const& module, ice::String symbol_name) noexcept -> void*;
 
+    //! \returns Last write time of the module file in platform specific units, or '0' if the file cannot be accessed.
+    auto module_timestamp(ice::String path) noexcept -> ice::u64;
+
+    //! \brief Copies a module file, so the original can be overwritten while the copy stays loaded.
+    bool module_copy(ice::String from_path, ice::String to_path) noexcept;
+
+    //! \brief Removes a module file copy, the module needs to be closed first.
+    bool module_remove(ice::String path) noexcept;
+
 } // namespace ice
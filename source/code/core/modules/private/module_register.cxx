@@ -17,6 +17,10 @@ namespace ice
 
     class DefaultModuleRegister;
 
+    //! \brief Module hot-reload is only available in non-release builds on platforms with shared libraries.
+    static constexpr bool Constant_ModuleHotReload = (ice::build::is_debug || ice::build::is_develop)
+        && ice::build::is_webapp == false;
+
     struct DefaultModuleEntry
     {
         ice::StringID_Hash name;
@@ -25,6 +29,33 @@ namespace ice
         ice::FnModuleUnload* unload_proc;
     };
 
+    struct DefaultModuleReloadEntry
+    {
+        ice::Allocator* module_allocator;
+        ice::FnModuleReload* reload_proc;
+    };
+
+    //! \brief A single loaded instance of a shared library.
+    struct DefaultModuleBinary
+    {
+        //! \brief Path of the loaded file, a copy of the library if hot-reload is enabled.
+        ice::HeapString<> loaded_path;
+        ice::native_module::ModuleHandle handle;
+        ice::u64 timestamp;
+
+        ice::FnModuleLoad* load_proc;
+        ice::FnModuleUnload* unload_proc;
+        ice::FnModuleReload* reload_proc;
+    };
+
+    struct DefaultModuleLibrary
+    {
+        ice::HeapString<> path;
+        ice::Allocator* module_allocator;
+        ice::u32 reload_count;
+        ice::DefaultModuleBinary binary;
+    };
+
     struct ModuleNegotiatorAPIContext
     {
         DefaultModuleRegister* module_register;
@@ -35,6 +66,7 @@ namespace ice
         static bool get_module_api(ModuleNegotiatorAPIContext*, ice::StringID_Hash, ice::u32, ice::ModuleAPI*) noexcept;
         static bool get_module_apis(ModuleNegotiatorAPIContext*, ice::StringID_Hash, ice::u32, ice::ModuleAPI*, ice::ucount*) noexcept;
         static bool register_module(ModuleNegotiatorAPIContext*, ice::StringID_Hash, FnModuleSelectAPI*) noexcept;
+        static bool register_module_rejected(ModuleNegotiatorAPIContext*, ice::StringID_Hash, FnModuleSelectAPI*) noexcept;
     };
 
     class DefaultModuleRegister final : public ModuleRegister
@@ -52,7 +84,8 @@ namespace ice
             ice::Allocator& alloc,
             ice::FnModuleLoad* load_fn,
             ice::FnModuleUnload* unload_fn,
-            bool from_shared_library
+            bool from_shared_library,
+            ice::FnModuleReload* reload_fn
         ) noexcept override;
 
         auto api_count(
@@ -71,16 +104,63 @@ namespace ice
             ice::DefaultModuleEntry const& entry
         ) noexcept;
 
+        auto generation() const noexcept -> ice::u32 override;
+
+        bool has_changed_modules() const noexcept override;
+
+        auto reload_changed_modules() noexcept -> ice::ucount override;
+
+    private:
+        bool open_binary(
+            ice::String path,
+            ice::u32 reload_count,
+            ice::DefaultModuleBinary& out_binary
+        ) noexcept;
+
+        void close_binary(ice::DefaultModuleBinary& binary) noexcept;
+
+        void remove_module_entries(ice::FnModuleUnload* unload_proc) noexcept;
+
+        void notify_reloaded() noexcept;
+
     private:
         ice::Allocator& _allocator;
         ice::HashMap<DefaultModuleEntry> _modules;
-        ice::Array<ice::native_module::ModuleHandle> _module_handles;
+        ice::Array<ice::DefaultModuleLibrary> _libraries;
+        ice::Array<ice::DefaultModuleReloadEntry> _reload_entries;
+        ice::u32 _generation;
     };
 
+    namespace detail
+    {
+
+        //! \brief Each reload uses a new file name, so we never get back a library that was not fully unloaded yet.
+        void append_module_copy_suffix(ice::HeapString<>& path, ice::u32 reload_count) noexcept
+        {
+            char digits[10];
+            ice::u32 digit_count = 0;
+            do
+            {
+                digits[digit_count++] = static_cast<char>('0' + (reload_count % 10));
+                reload_count /= 10;
+            } while (reload_count > 0);
+
+            ice::string::push_back(path, '.');
+            while (digit_count > 0)
+            {
+                ice::string::push_back(path, digits[--digit_count]);
+            }
+            ice::string::push_back(path, ice::String{ ".hot" });
+        }
+
+    } // namespace detail
+
     DefaultModuleRegister::DefaultModuleRegister(ice::Allocator& alloc) noexcept
         : _allocator{ alloc }
         , _modules{ _allocator }
-        , _module_handles{ _allocator }
+        , _libraries{ _allocator }
+        , _reload_entries{ _allocator }
+        , _generation{ 0 }
     { }
 
     DefaultModuleRegister::~DefaultModuleRegister() noexcept
@@ -94,9 +174,9 @@ namespace ice
                 fn_unload_prev = entry.unload_proc;
             }
         }
-        for (ice::native_module::ModuleHandle& handle : _module_handles)
+        for (ice::DefaultModuleLibrary& library : _libraries)
         {
-            ice::native_module::module_close(ice::move(handle));
+            close_binary(library.binary);
         }
     }
 
@@ -108,36 +188,44 @@ namespace ice
         IPT_ZONE_SCOPED;
         IPT_ZONE_TEXT_STR(path);
 
-        ice::HeapString<> utf8_path{ _allocator, path };
-        ice::native_module::ModuleHandle module_handle = ice::native_module::module_open(utf8_path);
-        if (module_handle)
-        {
-            void* const load_proc = ice::native_module::module_find_address(module_handle, "ice_module_load");
-            void* const unload_proc = ice::native_module::module_find_address(module_handle, "ice_module_unload");
+        ice::DefaultModuleLibrary library{
+            .path = ice::HeapString<>{ _allocator, path },
+            .module_allocator = &alloc,
+            .reload_count = 0,
+            .binary = { .loaded_path = ice::HeapString<>{ _allocator } },
+        };
 
-            if (load_proc != nullptr && unload_proc != nullptr)
-            {
-                load_module(
-                    alloc,
-                    reinterpret_cast<ice::FnModuleLoad*>(load_proc),
-                    reinterpret_cast<ice::FnModuleUnload*>(unload_proc),
-                    /* is_app_context */ false
-                );
-
-                ice::array::push_back(_module_handles, ice::move(module_handle));
-                return true;
-            }
+        if (open_binary(library.path, library.reload_count, library.binary) == false)
+        {
+            return false;
         }
-        return false;
+
+        load_module(
+            alloc,
+            library.binary.load_proc,
+            library.binary.unload_proc,
+            /* is_app_context */ false,
+            /* reload_fn */ nullptr
+        );
+
+        ice::array::push_back(_libraries, ice::move(library));
+        return true;
     }
 
     bool DefaultModuleRegister::load_module(
         ice::Allocator& alloc,
         ice::FnModuleLoad* load_fn,
         ice::FnModuleUnload* unload_fn,
-        bool from_shared_library
+        bool from_shared_library,
+        ice::FnModuleReload* reload_fn
     ) noexcept
     {
+        // Shared libraries are notified trough their library entry, since the function changes with each reload.
+        if (reload_fn != nullptr)
+        {
+            ice::array::push_back(_reload_entries, DefaultModuleReloadEntry{ &alloc, reload_fn });
+        }
+
         DefaultModuleEntry module_entry{
             .module_allocator = &alloc,
             .select_api = nullptr,
@@ -227,6 +315,211 @@ namespace ice
         return true;
     }
 
+    auto DefaultModuleRegister::generation() const noexcept -> ice::u32
+    {
+        return _generation;
+    }
+
+    bool DefaultModuleRegister::has_changed_modules() const noexcept
+    {
+        if constexpr (Constant_ModuleHotReload)
+        {
+            for (ice::DefaultModuleLibrary const& library : _libraries)
+            {
+                // Libraries that did not opt-in into hot-reloading are never swapped.
+                if (library.binary.reload_proc == nullptr)
+                {
+                    continue;
+                }
+
+                ice::u64 const timestamp = ice::native_module::module_timestamp(library.path);
+                if (timestamp != 0 && timestamp != library.binary.timestamp)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    auto DefaultModuleRegister::reload_changed_modules() noexcept -> ice::ucount
+    {
+        IPT_ZONE_SCOPED;
+
+        if constexpr (Constant_ModuleHotReload == false)
+        {
+            return 0;
+        }
+
+        ice::ucount reloaded_count = 0;
+        for (ice::DefaultModuleLibrary& library : _libraries)
+        {
+            // Objects created by libraries not exporting 'ice_module_reload' may still be alive, so we never swap them.
+            if (library.binary.reload_proc == nullptr)
+            {
+                continue;
+            }
+
+            ice::u64 const timestamp = ice::native_module::module_timestamp(library.path);
+            if (timestamp == 0 || timestamp == library.binary.timestamp)
+            {
+                continue;
+            }
+
+            IPT_ZONE_SCOPED_NAMED("Reload Module");
+            IPT_ZONE_TEXT_STR(library.path);
+
+            // The new library is opened first, so we keep the old one if it's not fully written yet. We will retry later.
+            ice::DefaultModuleBinary new_binary{ .loaded_path = ice::HeapString<>{ _allocator } };
+            if (open_binary(library.path, library.reload_count + 1, new_binary) == false)
+            {
+                continue;
+            }
+
+            // The rebuilt library no longer opts-in, keep the old binary and don't try this file again.
+            if (new_binary.reload_proc == nullptr)
+            {
+                library.binary.timestamp = new_binary.timestamp;
+                close_binary(new_binary);
+                continue;
+            }
+
+            // Unload the old binary and drop all APIs it registered, before any code of it becomes unavailable.
+            library.binary.unload_proc(library.module_allocator);
+            remove_module_entries(library.binary.unload_proc);
+            close_binary(library.binary);
+
+            library.reload_count += 1;
+            library.binary = ice::move(new_binary);
+
+            load_module(
+                *library.module_allocator,
+                library.binary.load_proc,
+                library.binary.unload_proc,
+                /* is_app_context */ false,
+                /* reload_fn */ nullptr
+            );
+            reloaded_count += 1;
+        }
+
+        if (reloaded_count > 0)
+        {
+            _generation += 1;
+            notify_reloaded();
+        }
+        return reloaded_count;
+    }
+
+    bool DefaultModuleRegister::open_binary(
+        ice::String path,
+        ice::u32 reload_count,
+        ice::DefaultModuleBinary& out_binary
+    ) noexcept
+    {
+        ice::HeapString<>& loaded_path = out_binary.loaded_path;
+        loaded_path = path;
+
+        out_binary.timestamp = ice::native_module::module_timestamp(loaded_path);
+        if constexpr (Constant_ModuleHotReload)
+        {
+            // Loading a copy allows the build to replace the original file, which is locked on some platforms.
+            detail::append_module_copy_suffix(loaded_path, reload_count);
+            if (ice::native_module::module_copy(path, loaded_path) == false)
+            {
+                ice::native_module::module_remove(loaded_path);
+                ice::string::clear(loaded_path);
+                return false;
+            }
+        }
+
+        out_binary.handle = ice::native_module::module_open(loaded_path);
+        if (out_binary.handle)
+        {
+            out_binary.load_proc = reinterpret_cast<ice::FnModuleLoad*>(
+                ice::native_module::module_find_address(out_binary.handle, "ice_module_load")
+            );
+            out_binary.unload_proc = reinterpret_cast<ice::FnModuleUnload*>(
+                ice::native_module::module_find_address(out_binary.handle, "ice_module_unload")
+            );
+            out_binary.reload_proc = reinterpret_cast<ice::FnModuleReload*>(
+                ice::native_module::module_find_address(out_binary.handle, "ice_module_reload")
+            );
+
+            if (out_binary.load_proc != nullptr && out_binary.unload_proc != nullptr)
+            {
+                return true;
+            }
+        }
+
+        close_binary(out_binary);
+        return false;
+    }
+
+    void DefaultModuleRegister::close_binary(ice::DefaultModuleBinary& binary) noexcept
+    {
+        if (binary.handle)
+        {
+            ice::native_module::module_close(ice::move(binary.handle));
+        }
+        if (Constant_ModuleHotReload && ice::string::any(binary.loaded_path))
+        {
+            ice::native_module::module_remove(binary.loaded_path);
+        }
+
+        ice::string::clear(binary.loaded_path);
+        binary.load_proc = nullptr;
+        binary.unload_proc = nullptr;
+        binary.reload_proc = nullptr;
+    }
+
+    void DefaultModuleRegister::remove_module_entries(ice::FnModuleUnload* unload_proc) noexcept
+    {
+        ice::HashMap<DefaultModuleEntry> remaining_modules{ _allocator };
+        ice::hashmap::reserve(remaining_modules, ice::hashmap::count(_modules));
+
+        for (DefaultModuleEntry const& entry : ice::hashmap::values(_modules))
+        {
+            if (entry.unload_proc != unload_proc)
+            {
+                ice::multi_hashmap::insert(remaining_modules, ice::hash(entry.name), entry);
+            }
+        }
+        _modules = ice::move(remaining_modules);
+    }
+
+    void DefaultModuleRegister::notify_reloaded() noexcept
+    {
+        // Modules can only query APIs while being notified, all registrations are rejected.
+        ModuleNegotiatorAPI negotiator{
+            .fn_is_app_context = ModuleNegotiatorAPIContext::from_app,
+            .fn_select_apis = ModuleNegotiatorAPIContext::get_module_apis,
+            .fn_register_api = ModuleNegotiatorAPIContext::register_module_rejected,
+        };
+
+        for (DefaultModuleReloadEntry const& entry : _reload_entries)
+        {
+            ModuleNegotiatorAPIContext negotiator_context{
+                .module_register = this,
+                .current_module = { .module_allocator = entry.module_allocator },
+                .in_app_context = true
+            };
+            entry.reload_proc(entry.module_allocator, &negotiator_context, &negotiator);
+        }
+
+        for (DefaultModuleLibrary const& library : _libraries)
+        {
+            if (library.binary.reload_proc != nullptr)
+            {
+                ModuleNegotiatorAPIContext negotiator_context{
+                    .module_register = this,
+                    .current_module = { .module_allocator = library.module_allocator },
+                    .in_app_context = false
+                };
+                library.binary.reload_proc(library.module_allocator, &negotiator_context, &negotiator);
+            }
+        }
+    }
+
     bool ModuleNegotiatorAPIContext::from_app(ModuleNegotiatorAPIContext* ctx) noexcept
     {
         return ctx->in_app_context;
@@ -258,6 +551,15 @@ namespace ice
         return false;
     }
 
+    bool ModuleNegotiatorAPIContext::register_module_rejected(
+        ice::ModuleNegotiatorAPIContext*,
+        ice::StringID_Hash,
+        ice::FnModuleSelectAPI*
+    ) noexcept
+    {
+        return false;
+    }
+
     auto create_default_module_register(
         ice::Allocator& alloc,
         bool load_global_modules /*= true*/
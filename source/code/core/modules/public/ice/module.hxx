@@ -50,10 +50,24 @@ namespace ice
             }
         }
 
+        static inline void internal_reload(
+            ice::Allocator* alloc,
+            ice::ModuleNegotiatorAPIContext* context,
+            ice::ModuleNegotiatorAPI* negotiator
+        ) noexcept
+        {
+            // Only modules keeping copies of other module APIs need to be notified.
+            if constexpr (ice::concepts::ModuleReloadable<Type>)
+            {
+                ice::ModuleNegotiatorTagged<Type> const negotiator_instance{ negotiator, context };
+                Type::on_reload(*alloc, negotiator_instance);
+            }
+        }
+
         //! \brief This entry allows to register module load/unload functions without additional marcos or register functions.
         //! \details "static inline" forces the variable to be always instantiated, and the constructor will register the module
         //!   in a global list. This also acts as the "ModuleInfo" object.
-        static inline ModulesEntry const _module_info{ &internal_load, &internal_unload };
+        static inline ModulesEntry const _module_info{ &internal_load, &internal_unload, &internal_reload };
     };
 
 #if ISP_COMPILER_CLANG || ISP_COMPILER_GCC \
@@ -65,4 +79,33 @@ namespace ice
 #endif
 #define ICE_WORKAROUND_MODULE_INITIALIZATION(type) IS_WORKAROUND_MODULE_INITIALIZATION(type)
 
+    namespace detail
+    {
+
+        //! \brief Calls 'on_reload' on every module registered in the current binary.
+        void reload_global_modules(
+            ice::Allocator* alloc,
+            ice::ModuleNegotiatorAPIContext* ctx,
+            ice::ModuleNegotiatorAPI* negotiator
+        ) noexcept;
+
+    } // namespace detail
+
+//! \brief Opts the current shared library into hot-reloading by exporting 'ice_module_reload'.
+//! \details The module register only swaps libraries that export this entry point. Only opt-in if no objects created
+//!   by this library are kept alive by the engine (world traits, asset loaders, resource compiler functions),
+//!   or if the library recreates all of them in its 'on_reload' handlers.
+//! \note Use this macro once, at global scope, in a single translation unit of the shared library.
+#if ISP_WINDOWS
+#   define ICE_MODULE_HOT_RELOAD() \
+        extern "C" __declspec(dllexport) void ice_module_reload( \
+            ice::Allocator* alloc, ice::ModuleNegotiatorAPIContext* ctx, ice::ModuleNegotiatorAPI* negotiator \
+        ) { ice::detail::reload_global_modules(alloc, ctx, negotiator); }
+#else
+#   define ICE_MODULE_HOT_RELOAD() \
+        extern "C" __attribute__((visibility("default"))) void ice_module_reload( \
+            ice::Allocator* alloc, ice::ModuleNegotiatorAPIContext* ctx, ice::ModuleNegotiatorAPI* negotiator \
+        ) { ice::detail::reload_global_modules(alloc, ctx, negotiator); }
+#endif
+
 } // namespace ice
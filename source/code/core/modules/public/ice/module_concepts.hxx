@@ -49,6 +49,12 @@ namespace ice::concepts
         { T::on_unload(alloc) } -> std::convertible_to<void>;
     };
 
+    template<typename T>
+    concept ModuleReloadable = requires(T t, ice::Allocator& alloc, ice::ModuleNegotiatorTagged<T> const& negotiator)
+    {
+        { T::on_reload(alloc, negotiator) } -> std::convertible_to<void>;
+    };
+
     // Currently this can be seen as an alias.
     template<typename T>
     concept ModuleType = ModuleLoadable<T>;
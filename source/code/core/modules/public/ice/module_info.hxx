@@ -7,11 +7,14 @@
 namespace ice
 {
 
-    //! \brief Stores information of module load and unload functions.
+    //! \brief Stores information of module load, unload and reload functions.
     struct ModuleInfo
     {
         ice::FnModuleLoad* const fn_load;
         ice::FnModuleUnload* const fn_unload;
+
+        //! \brief Called after other modules where reloaded, so API copies can be queried again.
+        ice::FnModuleReload* const fn_reload;
     };
 
     //! \brief Helper type to register modules globally.
@@ -20,7 +23,8 @@ namespace ice
     {
         ModulesEntry(
             ice::FnModuleLoad* fn_load,
-            ice::FnModuleUnload* fn_unload
+            ice::FnModuleUnload* fn_unload,
+            ice::FnModuleReload* fn_reload
         ) noexcept;
 
         //! \brief Allows to setup a list of modules without allocation before entering the "main" routine.
@@ -35,17 +35,19 @@ namespace ice
         //! \param[in] alloc The allocator to use for the module.
         //! \param[in] load_fn The function to call when loading the module.
         //! \param[in] unload_fn The function to call when unloading the module.
+        //! \param[in] reload_fn The function to call after other modules where reloaded, can be null.
         virtual bool load_module(
             ice::Allocator& alloc,
             ice::FnModuleLoad* load_fn,
             ice::FnModuleUnload* unload_fn,
-            bool from_shared_library
+            bool from_shared_library,
+            ice::FnModuleReload* reload_fn = nullptr
         ) noexcept = 0;
 
         //! \brief Loads a module using a module info structure.
         virtual bool load_module(ice::Allocator& alloc, ice::ModuleInfo const& module_info) noexcept
         {
-            return this->load_module(alloc, module_info.fn_load, module_info.fn_unload, true);
+            return this->load_module(alloc, module_info.fn_load, module_info.fn_unload, true, module_info.fn_reload);
         }
 
         //! \brief Loads a module using a module type. This is the preferred way of loading modules implicitly.
@@ -54,6 +56,75 @@ namespace ice
         {
             return this->load_module(alloc, T::module_info());
         }
+
+        //! \returns Number of times modules where reloaded, can be used to detect outdated API copies.
+        virtual auto generation() const noexcept -> ice::u32 = 0;
+
+        //! \returns 'true' if any hot-reloadable shared library was rebuilt since it was loaded.
+        //! \note Always returns 'false' in builds without module hot-reload support.
+        virtual bool has_changed_modules() const noexcept = 0;
+
+        //! \brief Reloads all modules where the shared library was rebuilt since it was loaded.
+        //! \details Only libraries that opted-in using 'ICE_MODULE_HOT_RELOAD()' are considered, all others stay loaded
+        //!   as they where. Each changed module is unloaded and loaded again from the new library, replacing all APIs it
+        //!   registered. Afterwards the app and all hot-reloadable libraries are notified, so they can query APIs again.
+        //!   Other libraries should access APIs of hot-reloadable libraries only through 'ModuleAPIRef'.
+        //!
+        //! \pre No code of the changed modules can be executing and no task created by them can be running or suspended.
+        //! \returns Number of reloaded modules.
+        virtual auto reload_changed_modules() noexcept -> ice::ucount = 0;
+    };
+
+    //! \brief Stable reference to an API, that stays valid when the module providing it is reloaded.
+    //! \details API structs returned from queries are copies pointing into the providing module. Instead of keeping such a
+    //!   copy, this type checks the register generation on access and queries the API again if modules where reloaded.
+    //!
+    //! \note Accessing is only safe on the same thread the register is reloaded on, or while reloading is not possible.
+    template<typename Type> requires (ice::concepts::APIType<Type>)
+    class ModuleAPIRef
+    {
+    public:
+        ModuleAPIRef(ice::ModuleRegister const& modules) noexcept
+            : _modules{ &modules }
+            , _generation{ modules.generation() }
+            , _api{ }
+            , _valid{ modules.query_api(_api) }
+        { }
+
+        //! \returns 'true' if the API is available, queries it again if modules where reloaded.
+        bool valid() noexcept
+        {
+            refresh();
+            return _valid;
+        }
+
+        auto operator->() noexcept -> Type const*
+        {
+            refresh();
+            return &_api;
+        }
+
+        auto operator*() noexcept -> Type const&
+        {
+            refresh();
+            return _api;
+        }
+
+    private:
+        void refresh() noexcept
+        {
+            if (ice::u32 const generation = _modules->generation(); generation != _generation)
+            {
+                _generation = generation;
+                _valid = _modules->query_api(_api);
+            }
+        }
+
+    private:
+        ice::ModuleRegister const* _modules;
+        ice::u32 _generation;
+        Type _api;
+        bool _valid;
     };
 
     //! \brief Loads all modules available in the current executable.
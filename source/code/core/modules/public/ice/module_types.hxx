@@ -22,6 +22,7 @@ namespace ice
 
     using FnModuleLoad = void (ice::Allocator*, ice::ModuleNegotiatorAPIContext*, ice::ModuleNegotiatorAPI*);
     using FnModuleUnload = void (ice::Allocator*);
+    using FnModuleReload = void (ice::Allocator*, ice::ModuleNegotiatorAPIContext*, ice::ModuleNegotiatorAPI*);
     using FnModuleSelectAPI = bool (ice::StringID_Hash, ice::u32, ice::ModuleAPI*);
 
     template <typename T>
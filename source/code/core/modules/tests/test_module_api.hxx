@@ -0,0 +1,21 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/stringid.hxx>
+
+namespace ice::test
+{
+
+    //! \brief API provided by the 'modules_test_module' shared library.
+    struct TestModuleAPI
+    {
+        static constexpr ice::StringID Constant_APIName = "iceshard.test.module-api"_sid;
+        static constexpr ice::u32 Constant_APIVersion = 1;
+
+        auto (*fn_value)() noexcept -> ice::u32;
+    };
+
+    static constexpr ice::u32 Constant_TestModuleValue = 42;
+
+} // namespace ice::test
@@ -0,0 +1,106 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/module_register.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/string/string.hxx>
+#include <ice/os/windows.hxx>
+#include <ice/os/unix.hxx>
+#include "test_module_api.hxx"
+
+#include <filesystem>
+
+namespace
+{
+
+    auto test_module_path(char const* file_name) noexcept -> std::filesystem::path
+    {
+        std::filesystem::path executable_path;
+#if ISP_WINDOWS
+        wchar_t buffer[MAX_PATH];
+        DWORD const length = GetModuleFileNameW(nullptr, buffer, MAX_PATH);
+        executable_path = std::wstring{ buffer, length };
+#else
+        std::error_code ec;
+        executable_path = std::filesystem::read_symlink("/proc/self/exe", ec);
+#endif
+        return executable_path.parent_path() / file_name;
+    }
+
+} // namespace
+
+SCENARIO("modules 'ice/module_register.hxx'", "[modules][hot_reload]")
+{
+    using ice::test::TestModuleAPI;
+
+    ice::HostAllocator alloc{ };
+
+#if ISP_WINDOWS
+    std::filesystem::path const source_path = test_module_path("modules_test_module.dll");
+    std::filesystem::path const module_path = test_module_path("modules_test_module_reload.dll");
+#else
+    std::filesystem::path const source_path = test_module_path("libmodules_test_module.so");
+    std::filesystem::path const module_path = test_module_path("libmodules_test_module_reload.so");
+#endif
+
+    // We work on a copy, so we can modify the file without affecting other test runs.
+    std::error_code ec;
+    REQUIRE(std::filesystem::copy_file(source_path, module_path, std::filesystem::copy_options::overwrite_existing, ec));
+    std::string const module_path_str = module_path.string();
+
+    GIVEN("a module register with a hot-reloadable shared library")
+    {
+        ice::UniquePtr<ice::ModuleRegister> modules = ice::create_default_module_register(alloc, false);
+        REQUIRE(modules->load_module(alloc, ice::String{ std::string_view{ module_path_str } }));
+
+        TestModuleAPI api{ };
+        REQUIRE(modules->query_api(api));
+        CHECK(api.fn_value() == ice::test::Constant_TestModuleValue);
+
+        ice::ModuleAPIRef<TestModuleAPI> api_ref{ *modules };
+        CHECK(modules->has_changed_modules() == false);
+        CHECK(modules->reload_changed_modules() == 0);
+
+        WHEN("the library file is rebuilt")
+        {
+            std::filesystem::last_write_time(
+                module_path,
+                std::filesystem::last_write_time(module_path) + std::chrono::hours{ 1 }
+            );
+
+            if constexpr (ice::build::is_debug || ice::build::is_develop)
+            {
+                THEN("the library is reloaded and APIs can be queried again")
+                {
+                    ice::u32 const generation = modules->generation();
+                    CHECK(modules->has_changed_modules());
+                    CHECK(modules->reload_changed_modules() == 1);
+                    CHECK(modules->generation() == generation + 1);
+                    CHECK(modules->has_changed_modules() == false);
+
+                    TestModuleAPI reloaded_api{ };
+                    REQUIRE(modules->query_api(reloaded_api));
+                    CHECK(reloaded_api.fn_value() == ice::test::Constant_TestModuleValue);
+
+                    REQUIRE(api_ref.valid());
+                    CHECK(api_ref->fn_value() == ice::test::Constant_TestModuleValue);
+                }
+            }
+            else
+            {
+                THEN("the library is not reloaded in builds without hot-reload support")
+                {
+                    CHECK(modules->has_changed_modules() == false);
+                    CHECK(modules->reload_changed_modules() == 0);
+
+                    TestModuleAPI same_api{ };
+                    REQUIRE(modules->query_api(same_api));
+                    CHECK(same_api.fn_value() == ice::test::Constant_TestModuleValue);
+                }
+            }
+        }
+    }
+
+    std::filesystem::remove(module_path, ec);
+}
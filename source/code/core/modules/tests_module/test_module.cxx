@@ -0,0 +1,33 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <ice/module.hxx>
+#include "../tests/test_module_api.hxx"
+
+namespace ice::test
+{
+
+    struct TestModule : ice::Module<TestModule>
+    {
+        static auto value() noexcept -> ice::u32
+        {
+            return Constant_TestModuleValue;
+        }
+
+        static void v1_test_api(ice::test::TestModuleAPI& api) noexcept
+        {
+            api.fn_value = value;
+        }
+
+        static bool on_load(ice::Allocator& alloc, ice::ModuleNegotiator auto const& negotiator) noexcept
+        {
+            return negotiator.register_api(v1_test_api);
+        }
+
+        IS_WORKAROUND_MODULE_INITIALIZATION(TestModule);
+    };
+
+} // namespace ice::test
+
+// This library does not keep any objects alive in the host, so it can be safely swapped.
+ICE_MODULE_HOT_RELOAD();
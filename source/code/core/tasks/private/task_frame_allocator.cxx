@@ -0,0 +1,269 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <ice/task_frame_allocator.hxx>
+#include <ice/mem.hxx>
+#include <ice/assert_core.hxx>
+#include <atomic>
+#include <mutex>
+#include <bit>
+
+namespace ice
+{
+
+    namespace
+    {
+
+        static constexpr ice::u32 Constant_SizeClassCount = TaskFramePool::Constant_SizeClassCount;
+        static constexpr ice::u32 Constant_BatchSize = TaskFramePool::Constant_BatchSize;
+
+        //! \brief Blocks are carved from chunks, the first block sized slot of each chunk stores the chunk list.
+        static constexpr ice::usize Constant_ChunkSize = 64_KiB;
+        static constexpr ice::usize Constant_ChunkHeaderSize = ice::usize{ TaskFramePool::Constant_MinBlockSize };
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct FreeList
+        {
+            FreeBlock* head;
+            ice::u32 count;
+        };
+
+        //! \brief Free blocks cached by a single thread, only valid for the pool with the same identifier.
+        //! \note Trivially destructible on purpose, so it's safe to access from threads that outlive the pool owner.
+        struct ThreadCache
+        {
+            ice::u64 pool_id;
+            FreeList free_lists[Constant_SizeClassCount];
+        };
+
+        inline auto size_class_index(size_t size) noexcept -> ice::u32
+        {
+            return static_cast<ice::u32>(std::bit_width((size - 1) / TaskFramePool::Constant_MinBlockSize));
+        }
+
+        inline auto size_class_block_size(ice::u32 size_class) noexcept -> ice::usize
+        {
+            return ice::usize{ TaskFramePool::Constant_MinBlockSize << size_class };
+        }
+
+        //! \brief Moves up to 'count' blocks from the given list into a new list.
+        inline auto pop_blocks(FreeList& list, ice::u32 count) noexcept -> FreeList
+        {
+            FreeList result{ list.head, 0 };
+
+            FreeBlock* tail = nullptr;
+            while (list.head != nullptr && result.count < count)
+            {
+                tail = list.head;
+                list.head = tail->next;
+                list.count -= 1;
+                result.count += 1;
+            }
+
+            if (tail != nullptr)
+            {
+                tail->next = nullptr;
+            }
+            else
+            {
+                result.head = nullptr;
+            }
+            return result;
+        }
+
+        inline void push_blocks(FreeList& list, FreeList blocks) noexcept
+        {
+            FreeBlock* tail = blocks.head;
+            while (tail != nullptr && tail->next != nullptr)
+            {
+                tail = tail->next;
+            }
+
+            if (tail != nullptr)
+            {
+                tail->next = list.head;
+                list.head = blocks.head;
+                list.count += blocks.count;
+            }
+        }
+
+        class TaskFramePoolImplementation;
+
+        //! \brief The pool used for new frames, there is one for each binary linking the tasks library.
+        std::atomic<TaskFramePoolImplementation*> Global_FramePool{ nullptr };
+
+        //! \brief Pools get unique identifiers, so thread caches left over from a destroyed pool are never reused.
+        std::atomic<ice::u64> Global_FramePoolIdentifier{ 0 };
+
+        thread_local ThreadCache Global_ThreadCache{ };
+
+        class TaskFramePoolImplementation final : public ice::TaskFramePool
+        {
+        public:
+            TaskFramePoolImplementation(ice::Allocator& alloc) noexcept
+                : _backing_allocator{ alloc }
+                , _identifier{ Global_FramePoolIdentifier.fetch_add(1, std::memory_order_relaxed) + 1 }
+            {
+                TaskFramePoolImplementation* const previous = Global_FramePool.exchange(this, std::memory_order_acq_rel);
+                ICE_ASSERT_CORE(previous == nullptr);
+            }
+
+            ~TaskFramePoolImplementation() noexcept override
+            {
+                TaskFramePoolImplementation* const installed = Global_FramePool.exchange(nullptr, std::memory_order_acq_rel);
+                ICE_ASSERT_CORE(installed == this);
+
+                while (_chunks != nullptr)
+                {
+                    _backing_allocator.deallocate(ice::exchange(_chunks, _chunks->next));
+                }
+            }
+
+            auto backing_allocator() noexcept -> ice::Allocator& override
+            {
+                return _backing_allocator;
+            }
+
+            auto allocate(size_t size) noexcept -> void*
+            {
+                if (size > Constant_MaxBlockSize)
+                {
+                    return _backing_allocator.allocate({ ice::usize{ size }, ice::ualign::b_16 }).memory;
+                }
+
+                ice::u32 const size_class = size_class_index(size);
+                FreeList& cache = thread_cache().free_lists[size_class];
+                if (cache.head == nullptr)
+                {
+                    cache = acquire_batch(size_class);
+                }
+
+                FreeBlock* const block = cache.head;
+                cache.head = block->next;
+                cache.count -= 1;
+                return block;
+            }
+
+            void deallocate(void* pointer, size_t size) noexcept
+            {
+                if (size > Constant_MaxBlockSize)
+                {
+                    _backing_allocator.deallocate(pointer);
+                    return;
+                }
+
+                ice::u32 const size_class = size_class_index(size);
+                FreeList& cache = thread_cache().free_lists[size_class];
+
+                FreeBlock* const block = reinterpret_cast<FreeBlock*>(pointer);
+                block->next = cache.head;
+                cache.head = block;
+                cache.count += 1;
+
+                // Keep a single batch cached, so threads releasing frames allocated on other threads don't hoard memory.
+                if (cache.count >= Constant_BatchSize * 2)
+                {
+                    release_batch(size_class, pop_blocks(cache, Constant_BatchSize));
+                }
+            }
+
+        private:
+            auto thread_cache() noexcept -> ThreadCache&
+            {
+                // Blocks cached for a previous pool where already released together with it.
+                ThreadCache& cache = Global_ThreadCache;
+                if (cache.pool_id != _identifier)
+                {
+                    cache = ThreadCache{ .pool_id = _identifier };
+                }
+                return cache;
+            }
+
+            auto acquire_batch(ice::u32 size_class) noexcept -> FreeList
+            {
+                std::lock_guard<std::mutex> lock{ _mutex };
+                if (_free_lists[size_class].count == 0)
+                {
+                    allocate_chunk(size_class);
+                }
+                return pop_blocks(_free_lists[size_class], Constant_BatchSize);
+            }
+
+            void release_batch(ice::u32 size_class, FreeList blocks) noexcept
+            {
+                std::lock_guard<std::mutex> lock{ _mutex };
+                push_blocks(_free_lists[size_class], blocks);
+            }
+
+            //! \note Needs to be called with the mutex locked.
+            void allocate_chunk(ice::u32 size_class) noexcept
+            {
+                ice::AllocResult const chunk = _backing_allocator.allocate({ Constant_ChunkSize, ice::ualign::b_16 });
+                ICE_ASSERT_CORE(chunk.memory != nullptr);
+
+                FreeBlock* const chunk_header = reinterpret_cast<FreeBlock*>(chunk.memory);
+                chunk_header->next = _chunks;
+                _chunks = chunk_header;
+
+                ice::usize const block_size = size_class_block_size(size_class);
+                ice::usize offset = Constant_ChunkHeaderSize;
+
+                FreeList& free_list = _free_lists[size_class];
+                while (offset + block_size <= Constant_ChunkSize)
+                {
+                    FreeBlock* const block = reinterpret_cast<FreeBlock*>(ice::ptr_add(chunk.memory, offset));
+                    block->next = free_list.head;
+                    free_list.head = block;
+                    free_list.count += 1;
+                    offset += block_size;
+                }
+            }
+
+        private:
+            ice::Allocator& _backing_allocator;
+            ice::u64 const _identifier;
+            std::mutex _mutex;
+            FreeList _free_lists[Constant_SizeClassCount]{ };
+            FreeBlock* _chunks = nullptr;
+        };
+
+    } // namespace
+
+    auto create_task_frame_pool(ice::Allocator& alloc) noexcept -> ice::UniquePtr<ice::TaskFramePool>
+    {
+        return ice::make_unique<TaskFramePoolImplementation>(alloc, alloc);
+    }
+
+    auto detail::TaskFrameAllocator::allocate(size_t size) noexcept -> void*
+    {
+        size_t const frame_size = size + Constant_FrameHeaderSize.value;
+
+        TaskFramePoolImplementation* const pool = Global_FramePool.load(std::memory_order_acquire);
+        void* const memory = pool != nullptr
+            ? pool->allocate(frame_size)
+            : ice::alloc_aligned(ice::usize{ frame_size }, ice::ualign::b_16).memory;
+
+        *reinterpret_cast<TaskFramePoolImplementation**>(memory) = pool;
+        return ice::ptr_add(memory, Constant_FrameHeaderSize);
+    }
+
+    void detail::TaskFrameAllocator::deallocate(void* pointer, size_t size) noexcept
+    {
+        void* const memory = ice::ptr_sub(pointer, Constant_FrameHeaderSize);
+
+        TaskFramePoolImplementation* const pool = *reinterpret_cast<TaskFramePoolImplementation**>(memory);
+        if (pool != nullptr)
+        {
+            pool->deallocate(memory, size + Constant_FrameHeaderSize.value);
+        }
+        else
+        {
+            ice::release_aligned(memory);
+        }
+    }
+
+} // namespace ice
@@ -73,7 +73,7 @@ namespace ice
 
     bool NativeTaskThread::is_busy() const noexcept
     {
-        return is_running() && estimated_task_count() > 0;
+        return is_running() && _runtime._processing.load();
     }
 
     bool NativeTaskThread::is_running() const noexcept
@@ -99,8 +99,17 @@ namespace ice
 
         do
         {
-            // Run the selected routine
-            result = (this->*routine)();
+            // Run the selected routine, custom routines are blocking so we don't consider them as processing tasks.
+            if constexpr (BusyWait)
+            {
+                _processing.store(true);
+                result = (this->*routine)();
+                _processing.store(false);
+            }
+            else
+            {
+                result = (this->*routine)();
+            }
 
             if constexpr (BusyWait)
             {
@@ -5,6 +5,7 @@
 #include <ice/task_thread.hxx>
 #include <ice/task_awaitable.hxx>
 #include <ice/container/linked_queue.hxx>
+#include <atomic>
 
 namespace ice
 {
@@ -47,6 +48,9 @@ namespace ice
         ice::ThreadState _state = ThreadState::Invalid;
         ice::ThreadRequest _request = ThreadRequest::Destroy;
 
+        //! \brief Set while the thread executes tasks, used to detect if a thread pool is idle.
+        std::atomic<bool> _processing = false;
+
         using RoutineFn = auto (ThreadRuntime::*)() noexcept -> ice::u32;
 
         template<bool BusyWait>
@@ -2,6 +2,7 @@
 /// SPDX-License-Identifier: MIT
 
 #include "task_thread_pool_impl.hxx"
+#include <ice/task_queue.hxx>
 #include <ice/string/static_string.hxx>
 #include <ice/string/string.hxx>
 #include <ice/assert.hxx>
@@ -121,6 +122,39 @@ namespace ice
         return 0; // TODO:
     }
 
+    bool TaskThreadPoolImplementation::is_idle() const noexcept
+    {
+        if (_queue.empty() == false)
+        {
+            return false;
+        }
+
+        for (ice::UniquePtr<ice::NativeTaskThread> const& thread : _managed_threads)
+        {
+            if (thread->is_busy())
+            {
+                return false;
+            }
+        }
+        for (ice::UniquePtr<ice::NativeTaskThread> const& thread : ice::hashmap::values(_created_threads))
+        {
+            if (thread->is_busy())
+            {
+                return false;
+            }
+        }
+        for (ice::UniquePtr<ice::TaskThread> const& thread : ice::hashmap::values(_user_threads))
+        {
+            if (thread->is_busy())
+            {
+                return false;
+            }
+        }
+
+        // A finishing task might have queued another one after we checked the queue.
+        return _queue.empty();
+    }
+
     auto TaskThreadPoolImplementation::create_thread(ice::StringID name) noexcept -> ice::TaskThread&
     {
         ICE_ASSERT(
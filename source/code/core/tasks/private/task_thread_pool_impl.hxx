@@ -24,6 +24,7 @@ namespace ice
         auto thread_count() const noexcept -> ice::ucount override;
         auto managed_thread_count() const noexcept -> ice::ucount override;
         auto estimated_task_count() const noexcept -> ice::ucount override;
+        bool is_idle() const noexcept override;
 
         auto create_thread(ice::StringID name) noexcept -> ice::TaskThread& override;
         auto find_thread(ice::StringID name) noexcept -> ice::TaskThread* override;
@@ -5,6 +5,7 @@
 #include <ice/module.hxx>
 #include <ice/mem_allocator_host.hxx>
 #include <ice/mem_allocator_proxy.hxx>
+#include <ice/task_frame_allocator.hxx>
 
 namespace ice::detail
 {
@@ -26,20 +27,36 @@ namespace ice::detail
             return ice::string::any(_allocator_pool) ? _allocator_pool : "Tasks";
         }
 
-        static auto allocator() noexcept -> ice::Allocator&
-        {
-            static HostAllocator fallback_alloc;
-            return _allocator_ptr ? *_allocator_ptr : fallback_alloc;
-        }
+        //! \brief Frames are prefixed with the allocator they where allocated from, since the tracking allocator can be
+        //!   provided after the first tasks where already created. Without a tracking allocator the frame pool is used.
+        static constexpr ice::usize Constant_FrameHeaderSize = 16_B;
 
         static auto allocate(size_t size) noexcept -> void*
         {
-            return allocator().allocate(ice::usize{ size }).memory;
+            size_t const frame_size = size + Constant_FrameHeaderSize.value;
+
+            ice::Allocator* const allocator = _allocator_ptr;
+            void* const memory = allocator != nullptr
+                ? allocator->allocate(ice::usize{ frame_size }).memory
+                : ice::detail::TaskFrameAllocator::allocate(frame_size);
+
+            *reinterpret_cast<ice::Allocator**>(memory) = allocator;
+            return ice::ptr_add(memory, Constant_FrameHeaderSize);
         }
 
-        static void deallocate(void* pointer) noexcept
+        static void deallocate(void* pointer, size_t size) noexcept
         {
-            allocator().deallocate(pointer);
+            void* const memory = ice::ptr_sub(pointer, Constant_FrameHeaderSize);
+
+            ice::Allocator* const allocator = *reinterpret_cast<ice::Allocator**>(memory);
+            if (allocator != nullptr)
+            {
+                allocator->deallocate(memory);
+            }
+            else
+            {
+                ice::detail::TaskFrameAllocator::deallocate(memory, size + Constant_FrameHeaderSize.value);
+            }
         }
 
         static bool on_load(ice::Allocator& alloc, ice::ModuleNegotiator auto const& negotiator) noexcept
@@ -0,0 +1,61 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/mem_allocator.hxx>
+#include <ice/mem_unique_ptr.hxx>
+
+namespace ice
+{
+
+    //! \brief Pooled memory used for all task coroutine frames created while the pool exists.
+    //! \details Frames are rounded up to one of the power-of-two size classes and served from fixed size blocks.
+    //!   Each thread keeps a small cache of free blocks for every size class and only exchanges whole batches with the
+    //!   shared pool, so allocating and releasing short-lived tasks does not require any locking most of the time.
+    //!
+    //! \note Frames larger than the biggest size class are allocated directly from the backing allocator.
+    //! \note Memory is never returned to the backing allocator before the pool is destroyed. Blocks cached by a thread
+    //!   that exited are only released with the pool.
+    class TaskFramePool
+    {
+    public:
+        static constexpr ice::u32 Constant_SizeClassCount = 6;
+        static constexpr ice::u32 Constant_MinBlockSize = 64;
+        static constexpr ice::u32 Constant_MaxBlockSize = Constant_MinBlockSize << (Constant_SizeClassCount - 1);
+
+        //! \brief Number of blocks moved between the thread cache and the shared pool at once.
+        static constexpr ice::u32 Constant_BatchSize = 32;
+
+        virtual ~TaskFramePool() noexcept = default;
+
+        //! \brief The allocator used for pool chunks and frames larger than the biggest size class.
+        virtual auto backing_allocator() noexcept -> ice::Allocator& = 0;
+    };
+
+    //! \brief Creates the frame pool for all tasks created afterwards by this binary.
+    //! \details Only a single pool can exist at a time. Frames created while no pool exists, or by other binaries, are
+    //!   allocated with 'ice::alloc_aligned' instead.
+    //!
+    //! \note The owner needs to destroy the pool after all threads executing tasks where joined and all frames allocated
+    //!   from it where released, since the pool releases its memory on destruction.
+    auto create_task_frame_pool(ice::Allocator& alloc) noexcept -> ice::UniquePtr<ice::TaskFramePool>;
+
+} // namespace ice
+
+namespace ice::detail
+{
+
+    //! \brief Allocates task coroutine frames from the current frame pool.
+    //! \details Frames are prefixed with the pool they where allocated from, so frames created before the pool or
+    //!   released after it was replaced always return to where they came from.
+    struct TaskFrameAllocator
+    {
+        static constexpr ice::usize Constant_FrameHeaderSize = 16_B;
+
+        static auto allocate(size_t size) noexcept -> void*;
+
+        //! \param[in] size The same size that was passed to 'allocate'.
+        static void deallocate(void* pointer, size_t size) noexcept;
+    };
+
+} // namespace ice::detail
@@ -4,6 +4,7 @@
 #pragma once
 #include <ice/task_types.hxx>
 #include <ice/task_debug_allocator.hxx>
+#include <ice/task_frame_allocator.hxx>
 #include <ice/profiler.hxx>
 
 namespace ice
@@ -36,8 +37,18 @@ namespace ice
     private:
         ice::coroutine_handle<> _continuation;
 
-#if !ICE_RELEASE
-    public: // Override to track allocations of task objects
+    public: // Coroutine frames are allocated from a dedicated pool, see 'ice::detail::TaskFrameAllocator'.
+#if ICE_RELEASE
+        inline auto operator new(size_t size) noexcept -> void*
+        {
+            return ice::detail::TaskFrameAllocator::allocate(size);
+        }
+
+        inline void operator delete(void* ptr, size_t size) noexcept
+        {
+            ice::detail::TaskFrameAllocator::deallocate(ptr, size);
+        }
+#else // Allows to track allocations of task objects
         using TaskDebugAllocator = ice::detail::TaskDebugAllocator;
 
         inline auto operator new(size_t size) noexcept -> void*
@@ -47,10 +58,10 @@ namespace ice
             return ptr;
         }
 
-        inline void operator delete(void* ptr) noexcept
+        inline void operator delete(void* ptr, size_t size) noexcept
         {
             IPT_DEALLOC_POOL(ptr, TaskDebugAllocator::pool());
-            TaskDebugAllocator::deallocate(ptr);
+            TaskDebugAllocator::deallocate(ptr, size);
         }
 #endif
     };
@@ -0,0 +1,194 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/sort.hxx>
+#include <ice/task_utils.hxx>
+
+namespace ice
+{
+
+    //! \brief Maximum number of tasks created by a single parallel sort stage.
+    static constexpr ice::u32 Constant_ParallelSortMaxChunks = 32;
+
+    //! \brief Default for the smallest number of elements sorted by a single task.
+    static constexpr ice::ucount Constant_ParallelSortMinChunkSize = 4096;
+
+    //! \brief Sorts values in parallel on the given scheduler, using a merge sort over individually sorted chunks.
+    //! \details The span is split into chunks sorted by separate tasks. Sorted runs are then merged pairwise, where each
+    //!   merge is again split between multiple tasks, so all rounds can make use of the available threads.
+    //!
+    //! \note The sort is not stable, use 'ice::radix_sort' if the order of equal elements needs to be kept.
+    //! \param[in,out] values The values to be sorted.
+    //! \param[in] scratch Temporary storage with at least the same number of elements as 'values'.
+    //! \param[in] pred Comparison function, needs to be safe to call from multiple threads.
+    //! \param[in] scheduler The scheduler sorting tasks are scheduled on. The task resumes on an unspecified thread.
+    //! \param[in] chunk_count Number of tasks to split the work into, usually the number of worker threads.
+    //! \param[in] min_chunk_size Smallest number of elements sorted by a single task. Spans smaller than twice this size
+    //!   are sorted on the calling thread.
+    template<typename T, typename Pred>
+    inline auto parallel_sort(
+        ice::Span<T> values,
+        ice::Span<T> scratch,
+        Pred pred,
+        ice::TaskScheduler& scheduler,
+        ice::u32 chunk_count,
+        ice::ucount min_chunk_size = Constant_ParallelSortMinChunkSize
+    ) noexcept -> ice::Task<>;
+
+
+    namespace detail
+    {
+
+        //! \returns Number of elements from the left run that are part of the first 'position' elements of a stable merge.
+        template<typename T, typename Pred>
+        inline auto merge_corank(
+            ice::ucount position,
+            ice::Span<T const> left,
+            ice::Span<T const> right,
+            Pred const& pred
+        ) noexcept -> ice::ucount
+        {
+            ice::ucount const left_count = ice::span::count(left);
+            ice::ucount const right_count = ice::span::count(right);
+
+            ice::ucount low = position > right_count ? position - right_count : 0;
+            ice::ucount high = ice::min(position, left_count);
+            while (low < high)
+            {
+                ice::ucount const left_idx = low + (high - low) / 2;
+                ice::ucount const right_idx = position - left_idx;
+
+                // Equal elements are taken from the left run first, to keep the merge stable.
+                if (right_idx > 0 && pred(right[right_idx - 1], left[left_idx]) == false)
+                {
+                    low = left_idx + 1;
+                }
+                else
+                {
+                    high = left_idx;
+                }
+            }
+            return low;
+        }
+
+        template<typename T, typename Pred>
+        inline auto parallel_sort_chunk(ice::Span<T> chunk, Pred const& pred) noexcept -> ice::Task<>
+        {
+            std::sort(ice::span::begin(chunk), ice::span::end(chunk), pred);
+            co_return;
+        }
+
+        //! \brief Merges the part of two sorted runs that ends up between 'from' and 'to' in the target span.
+        template<typename T, typename Pred>
+        inline auto parallel_merge_runs(
+            ice::Span<T const> left,
+            ice::Span<T const> right,
+            ice::Span<T> target,
+            ice::ucount from,
+            ice::ucount to,
+            Pred const& pred
+        ) noexcept -> ice::Task<>
+        {
+            ice::ucount const left_from = merge_corank(from, left, right, pred);
+            ice::ucount const left_to = merge_corank(to, left, right, pred);
+
+            std::merge(
+                ice::span::begin(left) + left_from, ice::span::begin(left) + left_to,
+                ice::span::begin(right) + (from - left_from), ice::span::begin(right) + (to - left_to),
+                ice::span::begin(target) + from,
+                pred
+            );
+            co_return;
+        }
+
+    } // namespace detail
+
+    template<typename T, typename Pred>
+    inline auto parallel_sort(
+        ice::Span<T> values,
+        ice::Span<T> scratch,
+        Pred pred,
+        ice::TaskScheduler& scheduler,
+        ice::u32 chunk_count,
+        ice::ucount min_chunk_size
+    ) noexcept -> ice::Task<>
+    {
+        IPT_ZONE_SCOPED;
+
+        ice::ucount const count = ice::span::count(values);
+        chunk_count = ice::min(chunk_count, ice::min(Constant_ParallelSortMaxChunks, count / ice::max(min_chunk_size, 1u)));
+        if (chunk_count < 2)
+        {
+            std::sort(ice::span::begin(values), ice::span::end(values), pred);
+            co_return;
+        }
+
+        ICE_ASSERT_CORE(ice::span::count(scratch) >= count);
+
+        // Run boundaries, after each merge round the number of runs is halved.
+        ice::ucount run_bounds[Constant_ParallelSortMaxChunks + 1];
+        for (ice::u32 idx = 0; idx <= chunk_count; ++idx)
+        {
+            run_bounds[idx] = static_cast<ice::ucount>((ice::u64{ count } * idx) / chunk_count);
+        }
+
+        ice::Task<> tasks[Constant_ParallelSortMaxChunks];
+        for (ice::u32 idx = 0; idx < chunk_count; ++idx)
+        {
+            tasks[idx] = detail::parallel_sort_chunk(
+                ice::span::subspan(values, run_bounds[idx], run_bounds[idx + 1] - run_bounds[idx]),
+                pred
+            );
+        }
+        co_await ice::await_scheduled(ice::Span<ice::Task<>>{ tasks, chunk_count }, scheduler);
+
+        ice::Span<T> source = values;
+        ice::Span<T> target = ice::span::head(scratch, count);
+
+        ice::u32 run_count = chunk_count;
+        while (run_count > 1)
+        {
+            ice::u32 const merge_count = (run_count + 1) / 2;
+            ice::u32 const tasks_per_merge = ice::max(1u, chunk_count / merge_count);
+
+            ice::u32 task_count = 0;
+            for (ice::u32 merge_idx = 0; merge_idx < merge_count; ++merge_idx)
+            {
+                ice::ucount const run_begin = run_bounds[merge_idx * 2];
+                ice::ucount const run_middle = run_bounds[ice::min(merge_idx * 2 + 1, run_count)];
+                ice::ucount const run_end = run_bounds[ice::min(merge_idx * 2 + 2, run_count)];
+
+                ice::Span<T const> const left = ice::span::subspan(source, run_begin, run_middle - run_begin);
+                ice::Span<T const> const right = ice::span::subspan(source, run_middle, run_end - run_middle);
+                ice::Span<T> const merge_target = ice::span::subspan(target, run_begin, run_end - run_begin);
+
+                ice::ucount const merge_size = run_end - run_begin;
+                for (ice::u32 part = 0; part < tasks_per_merge; ++part)
+                {
+                    tasks[task_count++] = detail::parallel_merge_runs(
+                        left,
+                        right,
+                        merge_target,
+                        static_cast<ice::ucount>((ice::u64{ merge_size } * part) / tasks_per_merge),
+                        static_cast<ice::ucount>((ice::u64{ merge_size } * (part + 1)) / tasks_per_merge),
+                        pred
+                    );
+                }
+                run_bounds[merge_idx] = run_begin;
+            }
+
+            run_count = merge_count;
+            run_bounds[run_count] = count;
+
+            co_await ice::await_scheduled(ice::Span<ice::Task<>>{ tasks, task_count }, scheduler);
+            ice::swap(source, target);
+        }
+
+        if (ice::span::data(source) != ice::span::data(values))
+        {
+            std::move(ice::span::begin(source), ice::span::end(source), ice::span::begin(values));
+        }
+    }
+
+} // namespace ice
@@ -31,6 +31,10 @@ namespace ice
         virtual auto managed_thread_count() const noexcept -> ice::ucount = 0;
         virtual auto estimated_task_count() const noexcept -> ice::ucount = 0;
 
+        //! \returns 'true' if the pool queue is empty and no thread of the pool is executing a task.
+        //! \note Suspended tasks, for example waiting on IO, are not tracked by the pool and are not considered.
+        virtual bool is_idle() const noexcept = 0;
+
         //! \brief Creates an additonal thread with the given name (ID).
         //!
         //! \note This allows you to go over the initial thread count.
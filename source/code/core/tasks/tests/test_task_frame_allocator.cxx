@@ -0,0 +1,145 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/task_frame_allocator.hxx>
+#include <ice/mem.hxx>
+#include <thread>
+
+namespace
+{
+
+    struct CountingAllocator final : ice::Allocator
+    {
+        CountingAllocator(std::source_location src_loc = std::source_location::current()) noexcept
+            : ice::Allocator{ src_loc, "Counting" }
+        {
+        }
+
+        ice::u32 allocations = 0;
+        ice::u32 deallocations = 0;
+
+    protected:
+        auto do_allocate(ice::AllocRequest request) noexcept -> ice::AllocResult override
+        {
+            allocations += 1;
+            return ice::alloc_aligned(request.size, request.alignment);
+        }
+
+        void do_deallocate(void* pointer) noexcept override
+        {
+            deallocations += 1;
+            ice::release_aligned(pointer);
+        }
+    };
+
+} // namespace
+
+SCENARIO("tasks 'task frame allocator'", "[tasks][allocator]")
+{
+    using ice::detail::TaskFrameAllocator;
+
+    static constexpr size_t Constant_SmallFrame = 100;
+    static constexpr size_t Constant_LargeFrame = ice::TaskFramePool::Constant_MaxBlockSize * 2;
+
+    CountingAllocator alloc{ };
+
+    GIVEN("no frame pool")
+    {
+        THEN("frames are allocated without a pool")
+        {
+            void* const frame = TaskFrameAllocator::allocate(Constant_SmallFrame);
+            CHECK(frame != nullptr);
+            TaskFrameAllocator::deallocate(frame, Constant_SmallFrame);
+        }
+    }
+
+    GIVEN("a frame pool")
+    {
+        // Allocated before the pool exists, so it needs to be released without it.
+        void* const early_frame = TaskFrameAllocator::allocate(Constant_SmallFrame);
+
+        ice::UniquePtr<ice::TaskFramePool> pool = ice::create_task_frame_pool(alloc);
+
+        // The pool object itself is also allocated from the backing allocator.
+        alloc.allocations = 0;
+
+        THEN("released frames are reused")
+        {
+            void* const frame = TaskFrameAllocator::allocate(Constant_SmallFrame);
+            REQUIRE(frame != nullptr);
+            CHECK(alloc.allocations == 1);
+
+            TaskFrameAllocator::deallocate(frame, Constant_SmallFrame);
+            CHECK(TaskFrameAllocator::allocate(Constant_SmallFrame) == frame);
+
+            // Frames of a different size class are served from a separate chunk.
+            void* const other_frame = TaskFrameAllocator::allocate(Constant_SmallFrame * 4);
+            CHECK(other_frame != frame);
+            CHECK(alloc.allocations == 2);
+
+            TaskFrameAllocator::deallocate(other_frame, Constant_SmallFrame * 4);
+            TaskFrameAllocator::deallocate(frame, Constant_SmallFrame);
+        }
+
+        THEN("large frames are allocated from the backing allocator")
+        {
+            void* const frame = TaskFrameAllocator::allocate(Constant_LargeFrame);
+            REQUIRE(frame != nullptr);
+            CHECK(alloc.allocations == 1);
+
+            TaskFrameAllocator::deallocate(frame, Constant_LargeFrame);
+            CHECK(alloc.deallocations == 1);
+        }
+
+        THEN("frames can be released on other threads")
+        {
+            void* frames[ice::TaskFramePool::Constant_BatchSize * 3];
+            for (void*& frame : frames)
+            {
+                frame = TaskFrameAllocator::allocate(Constant_SmallFrame);
+                REQUIRE(frame != nullptr);
+            }
+
+            std::thread{ [&frames]() noexcept
+                {
+                    for (void* frame : frames)
+                    {
+                        TaskFrameAllocator::deallocate(frame, Constant_SmallFrame);
+                    }
+                }
+            }.join();
+
+            // Blocks returned to the pool by the other thread are reused.
+            void* const frame = TaskFrameAllocator::allocate(Constant_SmallFrame);
+            CHECK(frame != nullptr);
+            CHECK(alloc.allocations == 1);
+            TaskFrameAllocator::deallocate(frame, Constant_SmallFrame);
+        }
+
+        TaskFrameAllocator::deallocate(early_frame, Constant_SmallFrame);
+
+        WHEN("the pool is destroyed")
+        {
+            TaskFrameAllocator::deallocate(TaskFrameAllocator::allocate(Constant_SmallFrame), Constant_SmallFrame);
+            pool.reset();
+
+            THEN("all memory is returned to the backing allocator")
+            {
+                CHECK(alloc.allocations == 1);
+                CHECK(alloc.deallocations == 2);
+            }
+
+            THEN("a new pool does not reuse blocks cached for the destroyed pool")
+            {
+                pool = ice::create_task_frame_pool(alloc);
+                alloc.allocations = 0;
+
+                void* const frame = TaskFrameAllocator::allocate(Constant_SmallFrame);
+                CHECK(frame != nullptr);
+                CHECK(alloc.allocations == 1);
+                TaskFrameAllocator::deallocate(frame, Constant_SmallFrame);
+            }
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/container/array.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/task_thread_pool.hxx>
+#include <ice/task_scheduler.hxx>
+#include <ice/task_queue.hxx>
+#include <ice/task_sort.hxx>
+#include <random>
+
+SCENARIO("tasks 'ice/task_sort.hxx' (parallel sort)", "[tasks][sort]")
+{
+    ice::HostAllocator alloc;
+    ice::TaskQueue queue;
+    ice::TaskScheduler scheduler{ queue };
+    ice::UniquePtr<ice::TaskThreadPool> threads = ice::create_thread_pool(alloc, queue, { .thread_count = 4 });
+
+    std::mt19937 gen{ 0x1ce'5048 };
+
+    ice::Array<ice::u32> values{ alloc };
+    ice::Array<ice::u32> scratch{ alloc };
+    ice::array::resize(values, 1'000);
+    ice::array::resize(scratch, 1'000);
+    for (ice::u32& value : values)
+    {
+        // A small value range, so runs contain many equal values.
+        value = gen() % 100;
+    }
+
+    ice::Array<ice::u32> expected = values;
+    ice::sort(ice::array::slice(expected));
+
+    auto const pred = [](ice::u32 left, ice::u32 right) noexcept { return left < right; };
+
+    GIVEN("a small chunk size")
+    {
+        // Includes an odd number of chunks, so some merge rounds have a run without a pair, and more chunks than allowed.
+        ice::u32 const chunk_counts[]{ 2, 7, 64 };
+        for (ice::u32 const chunk_count : chunk_counts)
+        {
+            ice::Array<ice::u32> sorted = values;
+            ice::wait_for(
+                ice::parallel_sort(ice::array::slice(sorted), ice::array::slice(scratch), pred, scheduler, chunk_count, 16)
+            );
+
+            for (ice::u32 idx = 0; idx < ice::array::count(sorted); ++idx)
+            {
+                REQUIRE(sorted[idx] == expected[idx]);
+            }
+        }
+    }
+
+    GIVEN("a chunk size larger than half of the values")
+    {
+        ice::wait_for(
+            ice::parallel_sort(ice::array::slice(values), ice::array::slice(scratch), pred, scheduler, 4, 600)
+        );
+
+        THEN("values are sorted on the calling thread")
+        {
+            for (ice::u32 idx = 0; idx < ice::array::count(values); ++idx)
+            {
+                REQUIRE(values[idx] == expected[idx]);
+            }
+        }
+    }
+}
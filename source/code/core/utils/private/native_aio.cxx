@@ -361,9 +361,13 @@ namespace ice::native_aio
 
         // Set seconds to wait
         timeval.tv_sec += limits.timeout_ms / 1000;
-        limits.timeout_ms -= timeval.tv_sec * 1000;
-        // Set remaining to wait
-        timeval.tv_nsec += limits.timeout_ms * 1000 * 1000;
+        // Set remaining to wait, the nanoseconds need to stay below one second for the deadline to be valid.
+        timeval.tv_nsec += long(limits.timeout_ms % 1000) * 1000 * 1000;
+        if (timeval.tv_nsec >= 1000 * 1000 * 1000)
+        {
+            timeval.tv_sec += 1;
+            timeval.tv_nsec -= 1000 * 1000 * 1000;
+        }
 
         if (sem_timedwait(&port->_semaphore, &timeval))
         {
@@ -14,8 +14,11 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <stdio.h>
+#include <unistd.h>
 #endif
 
+#include <atomic>
+
 #if ISP_WEBAPP
 #include <emscripten.h>
 #endif
@@ -349,6 +352,30 @@ namespace ice::native_file
         return write_file(native_file, ice::usize{ std::numeric_limits<ice::usize::base_type>::max() }, data);
     }
 
+    bool rename_file(
+        ice::native_file::FilePath from_path,
+        ice::native_file::FilePath to_path
+    ) noexcept
+    {
+        IPT_ZONE_SCOPED;
+        return MoveFileExW(ice::string::begin(from_path), ice::string::begin(to_path), MOVEFILE_REPLACE_EXISTING) != 0;
+    }
+
+    void path_append_temporary_suffix(
+        ice::native_file::HeapFilePath& path
+    ) noexcept
+    {
+        static std::atomic<ice::u32> temporary_counter = 0;
+
+        ice::StaticString<32> suffix;
+        ice::string::push_format(
+            suffix, ".{:x}.{:x}.tmp",
+            GetCurrentProcessId(),
+            temporary_counter.fetch_add(1, std::memory_order_relaxed)
+        );
+        ice::utf8_to_wide_append(suffix, path);
+    }
+
     bool traverse_directories_internal(
         ice::native_file::FilePath basepath,
         ice::native_file::HeapFilePath &dirpath,
@@ -693,6 +720,27 @@ namespace ice::native_file
         return ice::native_file::write_file(native_file, ice::native_file::sizeof_file(native_file), data);
     }
 
+    bool rename_file(
+        ice::native_file::FilePath from_path,
+        ice::native_file::FilePath to_path
+    ) noexcept
+    {
+        return rename(ice::string::begin(from_path), ice::string::begin(to_path)) == 0;
+    }
+
+    void path_append_temporary_suffix(
+        ice::native_file::HeapFilePath& path
+    ) noexcept
+    {
+        static std::atomic<ice::u32> temporary_counter = 0;
+
+        ice::string::push_format(
+            path, ".{:x}.{:x}.tmp",
+            ice::u32(getpid()),
+            temporary_counter.fetch_add(1, std::memory_order_relaxed)
+        );
+    }
+
     bool traverse_directories_internal(
         ice::native_file::FilePath basepath,
         ice::native_file::HeapFilePath& dirpath,
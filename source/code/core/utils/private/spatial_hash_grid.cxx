@@ -0,0 +1,305 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <ice/spatial_hash_grid.hxx>
+#include <ice/assert.hxx>
+#include <cmath>
+
+namespace ice
+{
+
+    namespace detail
+    {
+
+        static constexpr ice::i64 Constant_CellCoordLimit = (ice::i64{ 1 } << 29) - 2;
+
+        inline auto spatial_cell_coord(ice::f32 value, ice::f32 cell_size) noexcept -> ice::i64
+        {
+            ice::f64 const coord = std::floor(ice::f64(value) / ice::f64(cell_size));
+            if (coord <= ice::f64(-Constant_CellCoordLimit))
+            {
+                return -Constant_CellCoordLimit;
+            }
+            if (coord >= ice::f64(Constant_CellCoordLimit))
+            {
+                return Constant_CellCoordLimit;
+            }
+            return ice::i64(coord);
+        }
+
+        //! \brief Packs the level and cell coordinates into a unique key and scrambles it with a bijective mixer,
+        //!   so keys are well distributed when reduced by the hashmap capacity.
+        inline auto spatial_cell_key(ice::u32 level, ice::i64 x, ice::i64 y) noexcept -> ice::u64
+        {
+            ice::u64 key = (ice::u64(level) << 60)
+                | (ice::u64(x + Constant_CellCoordLimit + 1) << 30)
+                | ice::u64(y + Constant_CellCoordLimit + 1);
+
+            key = (key ^ (key >> 30)) * 0xbf58'476d'1ce4'e5b9;
+            key = (key ^ (key >> 27)) * 0x94d0'49bb'1331'11eb;
+            return key ^ (key >> 31);
+        }
+
+    } // namespace detail
+
+    SpatialHashGrid::SpatialHashGrid(ice::Allocator& alloc, ice::f32 base_cell_size) noexcept
+        : _cell_sizes{ }
+        , _level_counts{ }
+        , _entries{ alloc }
+        , _free_head{ Constant_InvalidIndex }
+        , _ids{ alloc }
+        , _cells{ alloc }
+        , _oversized_head{ Constant_InvalidIndex }
+    {
+        ICE_ASSERT_CORE(base_cell_size > 0.f);
+
+        ice::f32 cell_size = base_cell_size;
+        for (ice::f32& level_cell_size : _cell_sizes)
+        {
+            level_cell_size = cell_size;
+            cell_size *= 2.f;
+        }
+    }
+
+    void SpatialHashGrid::update(ice::u32 id, ice::SpatialBounds const& bounds) noexcept
+    {
+        ice::u32 const level = select_level(bounds);
+        ice::u64 const cell = level == Constant_OversizedLevel ? 0 : cell_key(level, bounds.min);
+
+        ice::u32 idx = ice::hashmap::get(_ids, id, Constant_InvalidIndex);
+        if (idx != Constant_InvalidIndex)
+        {
+            Entry& entry = _entries[idx];
+            entry.bounds = bounds;
+
+            // Most updates are small moves that keep the object in the same cell.
+            if (entry.level == level && entry.cell == cell)
+            {
+                return;
+            }
+
+            unlink(idx);
+            _level_counts[entry.level] -= 1;
+        }
+        else if (_free_head != Constant_InvalidIndex)
+        {
+            idx = _free_head;
+            _free_head = _entries[idx].next;
+            ice::hashmap::set(_ids, id, idx);
+        }
+        else
+        {
+            idx = ice::array::count(_entries);
+            ice::array::push_back(_entries, Entry{ });
+            ice::hashmap::set(_ids, id, idx);
+        }
+
+        _entries[idx] = Entry{
+            .bounds = bounds,
+            .cell = cell,
+            .id = id,
+            .level = level,
+            .prev = Constant_InvalidIndex,
+            .next = Constant_InvalidIndex,
+        };
+
+        link(idx);
+        _level_counts[level] += 1;
+    }
+
+    bool SpatialHashGrid::remove(ice::u32 id) noexcept
+    {
+        ice::u32 const idx = ice::hashmap::get(_ids, id, Constant_InvalidIndex);
+        if (idx != Constant_InvalidIndex)
+        {
+            release(idx);
+        }
+        return idx != Constant_InvalidIndex;
+    }
+
+    bool SpatialHashGrid::contains(ice::u32 id) const noexcept
+    {
+        return ice::hashmap::has(_ids, id);
+    }
+
+    auto SpatialHashGrid::bounds(ice::u32 id) const noexcept -> ice::SpatialBounds
+    {
+        ice::u32 const idx = ice::hashmap::get(_ids, id, Constant_InvalidIndex);
+        return idx == Constant_InvalidIndex ? ice::SpatialBounds{ } : _entries[idx].bounds;
+    }
+
+    auto SpatialHashGrid::count() const noexcept -> ice::ucount
+    {
+        return ice::hashmap::count(_ids);
+    }
+
+    void SpatialHashGrid::clear() noexcept
+    {
+        ice::array::clear(_entries);
+        ice::hashmap::clear(_ids);
+        ice::hashmap::clear(_cells);
+        for (ice::u32& level_count : _level_counts)
+        {
+            level_count = 0;
+        }
+        _free_head = Constant_InvalidIndex;
+        _oversized_head = Constant_InvalidIndex;
+    }
+
+    auto SpatialHashGrid::query(
+        ice::SpatialBounds const& area,
+        ice::Array<ice::u32>& out_ids
+    ) const noexcept -> ice::ucount
+    {
+        ice::ucount const initial_count = ice::array::count(out_ids);
+        ice::u32 scanned_levels = 0;
+
+        for (ice::u32 level = 0; level < Constant_LevelCount; ++level)
+        {
+            if (_level_counts[level] == 0)
+            {
+                continue;
+            }
+
+            // Objects are keyed by their lower corner and are never larger than a cell,
+            //   so we need to look one cell further in the negative direction.
+            ice::f32 const cell_size = _cell_sizes[level];
+            ice::i64 const min_x = detail::spatial_cell_coord(area.min.x, cell_size) - 1;
+            ice::i64 const min_y = detail::spatial_cell_coord(area.min.y, cell_size) - 1;
+            ice::i64 const max_x = detail::spatial_cell_coord(area.max.x, cell_size);
+            ice::i64 const max_y = detail::spatial_cell_coord(area.max.y, cell_size);
+
+            // If the area covers more cells than there are objects on this level, checking each object is cheaper.
+            ice::u64 const cell_count = ice::u64(max_x - min_x + 1) * ice::u64(max_y - min_y + 1);
+            if (cell_count > _level_counts[level])
+            {
+                scanned_levels |= (1u << level);
+                continue;
+            }
+
+            for (ice::i64 x = min_x; x <= max_x; ++x)
+            {
+                for (ice::i64 y = min_y; y <= max_y; ++y)
+                {
+                    ice::u32 idx = ice::hashmap::get(_cells, detail::spatial_cell_key(level, x, y), Constant_InvalidIndex);
+                    while (idx != Constant_InvalidIndex)
+                    {
+                        Entry const& entry = _entries[idx];
+                        if (ice::overlaps(entry.bounds, area))
+                        {
+                            ice::array::push_back(out_ids, entry.id);
+                        }
+                        idx = entry.next;
+                    }
+                }
+            }
+        }
+
+        for (ice::u32 idx = _oversized_head; idx != Constant_InvalidIndex; idx = _entries[idx].next)
+        {
+            Entry const& entry = _entries[idx];
+            if (ice::overlaps(entry.bounds, area))
+            {
+                ice::array::push_back(out_ids, entry.id);
+            }
+        }
+
+        if (scanned_levels != 0)
+        {
+            for (Entry const& entry : _entries)
+            {
+                if (entry.level < Constant_LevelCount
+                    && (scanned_levels & (1u << entry.level)) != 0
+                    && ice::overlaps(entry.bounds, area))
+                {
+                    ice::array::push_back(out_ids, entry.id);
+                }
+            }
+        }
+
+        return ice::array::count(out_ids) - initial_count;
+    }
+
+    auto SpatialHashGrid::select_level(ice::SpatialBounds const& bounds) const noexcept -> ice::u32
+    {
+        ice::f32 const extent = ice::max(bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y);
+        for (ice::u32 level = 0; level < Constant_LevelCount; ++level)
+        {
+            if (extent <= _cell_sizes[level])
+            {
+                return level;
+            }
+        }
+        return Constant_OversizedLevel;
+    }
+
+    auto SpatialHashGrid::cell_key(ice::u32 level, ice::vec2f point) const noexcept -> ice::u64
+    {
+        return detail::spatial_cell_key(
+            level,
+            detail::spatial_cell_coord(point.x, _cell_sizes[level]),
+            detail::spatial_cell_coord(point.y, _cell_sizes[level])
+        );
+    }
+
+    void SpatialHashGrid::link(ice::u32 entry_idx) noexcept
+    {
+        Entry& entry = _entries[entry_idx];
+        if (entry.level == Constant_OversizedLevel)
+        {
+            entry.next = _oversized_head;
+            _oversized_head = entry_idx;
+        }
+        else
+        {
+            entry.next = ice::hashmap::get(_cells, entry.cell, Constant_InvalidIndex);
+            ice::hashmap::set(_cells, entry.cell, entry_idx);
+        }
+
+        entry.prev = Constant_InvalidIndex;
+        if (entry.next != Constant_InvalidIndex)
+        {
+            _entries[entry.next].prev = entry_idx;
+        }
+    }
+
+    void SpatialHashGrid::unlink(ice::u32 entry_idx) noexcept
+    {
+        Entry const& entry = _entries[entry_idx];
+        if (entry.prev != Constant_InvalidIndex)
+        {
+            _entries[entry.prev].next = entry.next;
+        }
+        else if (entry.level == Constant_OversizedLevel)
+        {
+            _oversized_head = entry.next;
+        }
+        else if (entry.next != Constant_InvalidIndex)
+        {
+            ice::hashmap::set(_cells, entry.cell, entry.next);
+        }
+        else
+        {
+            ice::hashmap::remove(_cells, entry.cell);
+        }
+
+        if (entry.next != Constant_InvalidIndex)
+        {
+            _entries[entry.next].prev = entry.prev;
+        }
+    }
+
+    void SpatialHashGrid::release(ice::u32 entry_idx) noexcept
+    {
+        unlink(entry_idx);
+
+        Entry& entry = _entries[entry_idx];
+        _level_counts[entry.level] -= 1;
+        ice::hashmap::remove(_ids, entry.id);
+
+        entry.level = Constant_InvalidIndex;
+        entry.next = _free_head;
+        _free_head = entry_idx;
+    }
+
+} // namespace ice
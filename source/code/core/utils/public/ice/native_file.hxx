@@ -116,6 +116,20 @@ namespace ice::native_file
         ice::Data data
     ) noexcept -> ice::usize;
 
+    //! \brief Moves a file to a new path, replacing the file at the destination if it already exists.
+    //! \note Both paths need to be on the same volume. On most platforms the replacement is atomic.
+    bool rename_file(
+        ice::native_file::FilePath from_path,
+        ice::native_file::FilePath to_path
+    ) noexcept;
+
+    //! \brief Appends a suffix unique for the calling process and for each call, to create a temporary file path.
+    //! \note Temporary files are moved to their final path with 'rename_file' once fully written, so other processes
+    //!   writing the same file never see it partially written.
+    void path_append_temporary_suffix(
+        ice::native_file::HeapFilePath& path
+    ) noexcept;
+
     enum class TraverseAction : ice::u8 { Continue, Break, SkipSubDir };
     enum class EntityType : ice::u8 { File, Directory };
 
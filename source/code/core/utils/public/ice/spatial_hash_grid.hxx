@@ -0,0 +1,124 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/math.hxx>
+#include <ice/constants.hxx>
+#include <ice/mem_allocator.hxx>
+#include <ice/container/array.hxx>
+#include <ice/container/hashmap.hxx>
+
+namespace ice
+{
+
+    //! \brief Axis aligned bounds on the XY plane.
+    struct SpatialBounds
+    {
+        ice::vec2f min;
+        ice::vec2f max;
+    };
+
+    constexpr bool overlaps(ice::SpatialBounds const& left, ice::SpatialBounds const& right) noexcept
+    {
+        return left.min.x <= right.max.x && right.min.x <= left.max.x
+            && left.min.y <= right.max.y && right.min.y <= left.max.y;
+    }
+
+    //! \brief Hierarchical hash grid indexing objects by their 2D bounds.
+    //!
+    //! \details Each level doubles the cell size of the previous one. Objects are stored in a single cell, on the lowest level
+    //!   where the cell size is not smaller than the object, keyed by the cell containing the objects lower corner. Queries only
+    //!   visit cells that can hold overlapping objects, so moving an object within it's cell does only update it's bounds.
+    //!   Objects larger than the last level are kept in a separate list that is checked on every query.
+    //!
+    //! \note Object identifiers need to be unique, but can be any value. Entity handles are a good fit.
+    class SpatialHashGrid
+    {
+    public:
+        static constexpr ice::u32 Constant_LevelCount = 8;
+
+        //! \param base_cell_size Size of cells on the first level, should be close to the size of the smallest indexed objects.
+        SpatialHashGrid(ice::Allocator& alloc, ice::f32 base_cell_size) noexcept;
+        ~SpatialHashGrid() noexcept = default;
+
+        //! \brief Inserts the object or updates it's bounds if it's already indexed.
+        void update(ice::u32 id, ice::SpatialBounds const& bounds) noexcept;
+
+        //! \returns `true` if the object was indexed and got removed.
+        bool remove(ice::u32 id) noexcept;
+
+        //! \brief Removes all objects for which the predicate returns `true`.
+        //! \returns Number of removed objects.
+        template<typename Fn>
+        auto remove_if(Fn&& predicate) noexcept -> ice::ucount;
+
+        bool contains(ice::u32 id) const noexcept;
+
+        //! \returns Bounds of the given object, or empty bounds at the origin if not indexed.
+        auto bounds(ice::u32 id) const noexcept -> ice::SpatialBounds;
+
+        auto count() const noexcept -> ice::ucount;
+
+        void clear() noexcept;
+
+        //! \brief Appends the identifiers of all objects overlapping the given area.
+        //! \returns Number of identifiers appended.
+        auto query(ice::SpatialBounds const& area, ice::Array<ice::u32>& out_ids) const noexcept -> ice::ucount;
+
+    private:
+        static constexpr ice::u32 Constant_InvalidIndex = ice::u32_max;
+        static constexpr ice::u32 Constant_OversizedLevel = Constant_LevelCount;
+
+        struct Entry
+        {
+            ice::SpatialBounds bounds;
+            ice::u64 cell;
+            ice::u32 id;
+            ice::u32 level;
+            ice::u32 prev;
+            ice::u32 next;
+        };
+
+        auto select_level(ice::SpatialBounds const& bounds) const noexcept -> ice::u32;
+        auto cell_key(ice::u32 level, ice::vec2f point) const noexcept -> ice::u64;
+
+        void link(ice::u32 entry_idx) noexcept;
+        void unlink(ice::u32 entry_idx) noexcept;
+        void release(ice::u32 entry_idx) noexcept;
+
+    private:
+        ice::f32 _cell_sizes[Constant_LevelCount];
+        ice::u32 _level_counts[Constant_LevelCount + 1];
+
+        //! \brief Entries with 'level == Constant_InvalidIndex' are free and linked trough 'next'.
+        ice::Array<Entry> _entries;
+        ice::u32 _free_head;
+
+        //! \brief Maps object identifiers to entry indices.
+        ice::HashMap<ice::u32> _ids;
+
+        //! \brief Maps cell keys to the first entry stored in the cell.
+        ice::HashMap<ice::u32> _cells;
+
+        //! \brief First entry of the list holding objects too large for any level.
+        ice::u32 _oversized_head;
+    };
+
+    template<typename Fn>
+    inline auto SpatialHashGrid::remove_if(Fn&& predicate) noexcept -> ice::ucount
+    {
+        ice::ucount removed = 0;
+        ice::ucount const entry_count = ice::array::count(_entries);
+        for (ice::u32 idx = 0; idx < entry_count; ++idx)
+        {
+            Entry const& entry = _entries[idx];
+            if (entry.level != Constant_InvalidIndex && ice::forward<Fn>(predicate)(entry.id))
+            {
+                release(idx);
+                removed += 1;
+            }
+        }
+        return removed;
+    }
+
+} // namespace ice
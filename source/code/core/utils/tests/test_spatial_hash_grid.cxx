@@ -0,0 +1,267 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <ice/spatial_hash_grid.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/sort.hxx>
+#include <random>
+
+namespace
+{
+
+    struct TestObject
+    {
+        ice::u32 id;
+        ice::SpatialBounds bounds;
+    };
+
+    auto random_bounds(std::mt19937& gen, ice::f32 world_size, ice::f32 max_size) noexcept -> ice::SpatialBounds
+    {
+        std::uniform_real_distribution<ice::f32> position{ -world_size, world_size };
+        std::uniform_real_distribution<ice::f32> size{ 0.f, max_size };
+
+        ice::vec2f const min{ position(gen), position(gen) };
+        return { min, min + ice::vec2f{ size(gen), size(gen) } };
+    }
+
+    void brute_force_query(
+        ice::Array<TestObject> const& objects,
+        ice::SpatialBounds const& area,
+        ice::Array<ice::u32>& out_ids
+    ) noexcept
+    {
+        for (TestObject const& object : objects)
+        {
+            if (ice::overlaps(object.bounds, area))
+            {
+                ice::array::push_back(out_ids, object.id);
+            }
+        }
+    }
+
+    void sort_ids(ice::Array<ice::u32>& ids) noexcept
+    {
+        ice::sort(ice::array::slice(ids), [](ice::u32 left, ice::u32 right) noexcept { return left < right; });
+    }
+
+} // namespace
+
+SCENARIO("utils 'ice/spatial_hash_grid.hxx'", "[utils][spatial]")
+{
+    ice::HostAllocator alloc;
+    ice::SpatialHashGrid grid{ alloc, 1.f };
+    ice::Array<ice::u32> results{ alloc };
+
+    GIVEN("an empty grid")
+    {
+        CHECK(grid.count() == 0);
+        CHECK(grid.query({ { -100.f, -100.f }, { 100.f, 100.f } }, results) == 0);
+        CHECK(grid.remove(42) == false);
+
+        WHEN("objects of different sizes are inserted")
+        {
+            grid.update(1, { { 0.f, 0.f }, { 0.5f, 0.5f } });
+            grid.update(2, { { 10.f, 10.f }, { 14.f, 13.f } });
+            grid.update(3, { { -5000.f, -5000.f }, { 5000.f, 5000.f } });
+
+            THEN("they can be found")
+            {
+                CHECK(grid.count() == 3);
+                CHECK(grid.contains(1));
+                CHECK(grid.contains(2));
+                CHECK(grid.contains(3));
+
+                CHECK(grid.query({ { 0.25f, 0.25f }, { 0.25f, 0.25f } }, results) == 2);
+                sort_ids(results);
+                CHECK(results[0] == 1);
+                CHECK(results[1] == 3);
+
+                ice::array::clear(results);
+                CHECK(grid.query({ { 13.5f, 12.5f }, { 20.f, 20.f } }, results) == 2);
+                sort_ids(results);
+                CHECK(results[0] == 2);
+                CHECK(results[1] == 3);
+            }
+
+            THEN("objects can be moved")
+            {
+                grid.update(1, { { 12.f, 12.f }, { 12.5f, 12.5f } });
+                CHECK(grid.count() == 3);
+                CHECK(grid.bounds(1).min.x == 12.f);
+
+                CHECK(grid.query({ { 0.f, 0.f }, { 1.f, 1.f } }, results) == 1);
+                CHECK(results[0] == 3);
+
+                ice::array::clear(results);
+                CHECK(grid.query({ { 12.f, 12.f }, { 12.f, 12.f } }, results) == 3);
+            }
+
+            THEN("objects can be removed")
+            {
+                CHECK(grid.remove(3));
+                CHECK(grid.remove(3) == false);
+                CHECK(grid.count() == 2);
+
+                CHECK(grid.query({ { 0.f, 0.f }, { 1.f, 1.f } }, results) == 1);
+                CHECK(results[0] == 1);
+
+                CHECK(grid.remove_if([](ice::u32 id) noexcept { return id == 1; }) == 1);
+                CHECK(grid.count() == 1);
+                CHECK(grid.contains(2));
+
+                grid.clear();
+                CHECK(grid.count() == 0);
+                CHECK(grid.contains(2) == false);
+            }
+        }
+    }
+
+    GIVEN("randomly placed objects")
+    {
+        static constexpr ice::u32 Constant_ObjectCount = 2'000;
+        static constexpr ice::f32 Constant_WorldSize = 200.f;
+
+        std::mt19937 gen{ 0x1ce'5a4d };
+        ice::Array<TestObject> objects{ alloc };
+        for (ice::u32 idx = 0; idx < Constant_ObjectCount; ++idx)
+        {
+            // Mostly small objects with a few very large ones, to cover all levels.
+            ice::f32 const max_size = (idx % 100) == 0 ? 400.f : 4.f;
+            TestObject const object{ .id = idx + 1, .bounds = random_bounds(gen, Constant_WorldSize, max_size) };
+
+            ice::array::push_back(objects, object);
+            grid.update(object.id, object.bounds);
+        }
+
+        ice::Array<ice::u32> expected{ alloc };
+        auto const check_random_queries = [&]() noexcept
+        {
+            for (ice::u32 query_idx = 0; query_idx < 200; ++query_idx)
+            {
+                ice::f32 const max_size = (query_idx % 10) == 0 ? 500.f : 20.f;
+                ice::SpatialBounds const area = random_bounds(gen, Constant_WorldSize, max_size);
+
+                ice::array::clear(results);
+                ice::array::clear(expected);
+                grid.query(area, results);
+                brute_force_query(objects, area, expected);
+
+                sort_ids(results);
+                sort_ids(expected);
+                REQUIRE(ice::array::count(results) == ice::array::count(expected));
+                for (ice::u32 idx = 0; idx < ice::array::count(results); ++idx)
+                {
+                    CHECK(results[idx] == expected[idx]);
+                }
+            }
+        };
+
+        THEN("queries match a brute force search")
+        {
+            CHECK(grid.count() == Constant_ObjectCount);
+            check_random_queries();
+        }
+
+        WHEN("objects are moved and removed")
+        {
+            std::uniform_real_distribution<ice::f32> offset{ -2.f, 2.f };
+            for (ice::u32 step = 0; step < 5; ++step)
+            {
+                for (TestObject& object : objects)
+                {
+                    ice::vec2f const move{ offset(gen), offset(gen) };
+                    object.bounds = { object.bounds.min + move, object.bounds.max + move };
+                    grid.update(object.id, object.bounds);
+                }
+            }
+
+            // Remove every third object and re-insert some of them under new identifiers.
+            ice::Array<TestObject> remaining{ alloc };
+            for (TestObject const& object : objects)
+            {
+                if ((object.id % 3) == 0)
+                {
+                    CHECK(grid.remove(object.id));
+                    if ((object.id % 2) == 0)
+                    {
+                        TestObject const reinserted{ .id = object.id + Constant_ObjectCount, .bounds = object.bounds };
+                        ice::array::push_back(remaining, reinserted);
+                        grid.update(reinserted.id, reinserted.bounds);
+                    }
+                }
+                else
+                {
+                    ice::array::push_back(remaining, object);
+                }
+            }
+            objects = ice::move(remaining);
+
+            THEN("queries still match a brute force search")
+            {
+                CHECK(grid.count() == ice::array::count(objects));
+                check_random_queries();
+            }
+        }
+    }
+}
+
+TEST_CASE("utils 'ice/spatial_hash_grid.hxx' | benchmark", "[.][utils][spatial][benchmark]")
+{
+    static constexpr ice::u32 Constant_ObjectCount = 20'000;
+    static constexpr ice::f32 Constant_WorldSize = 1000.f;
+
+    ice::HostAllocator alloc;
+    ice::SpatialHashGrid grid{ alloc, 2.f };
+    ice::Array<TestObject> objects{ alloc };
+    ice::Array<ice::u32> results{ alloc };
+
+    std::mt19937 gen{ 0x1ce'5a4d };
+    for (ice::u32 idx = 0; idx < Constant_ObjectCount; ++idx)
+    {
+        ice::array::push_back(objects, TestObject{ .id = idx + 1, .bounds = random_bounds(gen, Constant_WorldSize, 4.f) });
+    }
+
+    BENCHMARK("insert")
+    {
+        grid.clear();
+        for (TestObject const& object : objects)
+        {
+            grid.update(object.id, object.bounds);
+        }
+        return grid.count();
+    };
+
+    std::uniform_real_distribution<ice::f32> offset{ -0.5f, 0.5f };
+    BENCHMARK("move")
+    {
+        for (TestObject& object : objects)
+        {
+            ice::vec2f const move{ offset(gen), offset(gen) };
+            object.bounds = { object.bounds.min + move, object.bounds.max + move };
+            grid.update(object.id, object.bounds);
+        }
+        return grid.count();
+    };
+
+    BENCHMARK("query")
+    {
+        ice::array::clear(results);
+        for (ice::u32 query_idx = 0; query_idx < 100; ++query_idx)
+        {
+            grid.query(random_bounds(gen, Constant_WorldSize, 50.f), results);
+        }
+        return ice::array::count(results);
+    };
+
+    BENCHMARK("query (brute force)")
+    {
+        ice::array::clear(results);
+        for (ice::u32 query_idx = 0; query_idx < 100; ++query_idx)
+        {
+            brute_force_query(objects, random_bounds(gen, Constant_WorldSize, 50.f), results);
+        }
+        return ice::array::count(results);
+    };
+}
@@ -13,19 +13,31 @@
 namespace ice
 {
 
+    auto asset_tilemap_supported_resources(
+        ice::Span<ice::Shard const> params
+    ) noexcept -> ice::Span<ice::String const>
+    {
+        static ice::String extensions[]{ ".tmx" };
+        return extensions;
+    }
+
     void iceshard_register_tmx_tilemap_asset_category(
         ice::AssetCategoryArchive& type_archive
     ) noexcept
     {
-        static ice::String extensions[]{ ".tmx" };
+        // The archive only adopts compilers reporting at least one of the category extensions.
+        static ice::ResourceCompiler const compiler{
+            .fn_supported_resources = asset_tilemap_supported_resources,
+            .fn_collect_dependencies = asset_tilemap_dependencies_tmx,
+            .fn_compile_source = asset_tilemap_oven_tmx,
+        };
 
         static ice::AssetCategoryDefinition definition{
-            .resource_extensions = extensions,
-            // .fn_asset_oven = ice::build::is_windows ? asset_tilemap_oven_tmx : nullptr,
+            .resource_extensions = asset_tilemap_supported_resources({}),
             .fn_asset_loader = asset_tilemap_loader
         };
 
-        type_archive.register_category(ice::AssetCategory_TileMap, definition);
+        type_archive.register_category(ice::AssetCategory_TileMap, definition, &compiler);
     }
 
     void iceshard_base_framework_register_asset_categories(
@@ -41,12 +53,14 @@ namespace ice
         api.fn_register_categories = iceshard_base_framework_register_asset_categories;
     }
 
-    struct FrameworkAssetsModule
+    struct FrameworkAssetsModule : ice::Module<FrameworkAssetsModule>
     {
         static bool on_load(ice::Allocator& alloc, ice::ModuleNegotiator auto const& negotiator) noexcept
         {
             return negotiator.register_api(iceshard_base_framework_pipeline_api);
         }
+
+        IS_WORKAROUND_MODULE_INITIALIZATION(FrameworkAssetsModule);
     };
 
 } // namespace ice
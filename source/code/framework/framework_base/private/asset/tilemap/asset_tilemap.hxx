@@ -6,22 +6,36 @@
 #include <ice/log_tag.hxx>
 #include <ice/math.hxx>
 #include <ice/resource.hxx>
+#include <ice/resource_compiler_api.hxx>
 #include <ice/task.hxx>
 
 namespace ice
 {
 
     class AssetStorage;
+    class AssetCategoryArchive;
     class ResourceTracker;
 
+    auto asset_tilemap_supported_resources(
+        ice::Span<ice::Shard const> params
+    ) noexcept -> ice::Span<ice::String const>;
+
     auto asset_tilemap_oven_tmx(
-        void*,
-        ice::Allocator&,
-        ice::ResourceTracker const&,
-        ice::LooseResource const&,
-        ice::Data,
-        ice::Memory&
-    ) noexcept -> ice::Task<bool>;
+        ice::ResourceCompilerCtx& ctx,
+        ice::ResourceHandle const& resource_handle,
+        ice::ResourceTracker& resource_tracker,
+        ice::Span<ice::ResourceHandle const> sources,
+        ice::Span<ice::URI const> dependencies,
+        ice::Allocator& asset_alloc
+    ) noexcept -> ice::Task<ice::ResourceCompilerResult>;
+
+    //! \brief Reports images used by tilesets, so the tilemap can be preloaded together with its textures.
+    bool asset_tilemap_dependencies_tmx(
+        ice::ResourceCompilerCtx& ctx,
+        ice::ResourceHandle const& resource_handle,
+        ice::ResourceTracker& resource_tracker,
+        ice::Array<ice::URI>& out_dependencies
+    ) noexcept;
 
     auto asset_tilemap_loader(
         void*,
@@ -32,6 +46,10 @@ namespace ice
         ice::Memory& out_data
     ) noexcept -> ice::Task<bool>;
 
+    void iceshard_register_tmx_tilemap_asset_category(
+        ice::AssetCategoryArchive& type_archive
+    ) noexcept;
+
     constexpr ice::LogTagDefinition LogTag_TiledOven = ice::create_log_tag(ice::LogTag::Asset, "Tiled TMX Oven");
 
 } // namespace ice
@@ -5,10 +5,37 @@
 
 #include <ice/game_tilemap.hxx>
 #include <ice/asset_storage.hxx>
+#include <ice/container/array.hxx>
+#include <ice/log.hxx>
 
 namespace ice
 {
 
+    namespace detail
+    {
+
+        auto chunk_grid_size(ice::TileLayer const& layer) noexcept -> ice::vec2u
+        {
+            return {
+                (layer.size.x + ice::Constant_TileMapChunkSize - 1) / ice::Constant_TileMapChunkSize,
+                (layer.size.y + ice::Constant_TileMapChunkSize - 1) / ice::Constant_TileMapChunkSize,
+            };
+        }
+
+        //! \returns Index of the chunk grid cell containing the tile, or 'ice::u32_max' if the tile lies outside of the layer.
+        auto chunk_cell_index(ice::TileLayer const& layer, ice::Tile tile) noexcept -> ice::u32
+        {
+            ice::u32 const tile_x = (tile.offset & 0x0000'ffff) >> 0;
+            ice::u32 const tile_y = (tile.offset & 0xffff'0000) >> 16;
+            if (tile_x >= layer.size.x || tile_y >= layer.size.y)
+            {
+                return ice::u32_max;
+            }
+            return (tile_y / ice::Constant_TileMapChunkSize) * chunk_grid_size(layer).x
+                + (tile_x / ice::Constant_TileMapChunkSize);
+        }
+
+    } // namespace detail
 
     auto asset_tilemap_loader(
         void*,
@@ -20,9 +47,65 @@ namespace ice
     ) noexcept -> ice::Task<bool>
     {
         ice::TileMap const* const asset_tilemap = reinterpret_cast<ice::TileMap const*>(data.location);
+        ice::TileLayer const* const asset_layers = reinterpret_cast<ice::TileLayer const*>(
+            ice::ptr_add(data.location, std::bit_cast<ice::usize>(asset_tilemap->layers))
+        );
+        ice::Tile const* const asset_tiles = reinterpret_cast<ice::Tile const*>(
+            ice::ptr_add(data.location, std::bit_cast<ice::usize>(asset_tilemap->tiles))
+        );
+
+        // Count tiles falling into each chunk of every layer, so we can allocate the chunked tiles with the tilemap.
+        ice::Array<ice::u32> layer_chunk_offsets{ alloc };
+        ice::Array<ice::u32> chunk_tile_counts{ alloc };
+        ice::array::resize(layer_chunk_offsets, asset_tilemap->layer_count);
+
+        ice::u32 grid_cell_count = 0;
+        for (ice::u32 layer_idx = 0; layer_idx < asset_tilemap->layer_count; ++layer_idx)
+        {
+            layer_chunk_offsets[layer_idx] = grid_cell_count;
+            grid_cell_count += detail::chunk_grid_size(asset_layers[layer_idx]).x * detail::chunk_grid_size(asset_layers[layer_idx]).y;
+        }
+
+        ice::array::resize(chunk_tile_counts, grid_cell_count);
+        ice::array::memset(chunk_tile_counts, 0);
+
+        // Tiles outside of their layer bounds are not part of any chunk and are dropped.
+        ice::u32 total_tile_count = 0;
+        ice::u32 skipped_tile_count = 0;
+        for (ice::u32 layer_idx = 0; layer_idx < asset_tilemap->layer_count; ++layer_idx)
+        {
+            ice::TileLayer const& layer = asset_layers[layer_idx];
+            for (ice::Tile const& tile : ice::Span{ asset_tiles + layer.tile_offset, layer.tile_count })
+            {
+                ice::u32 const cell_idx = detail::chunk_cell_index(layer, tile);
+                if (cell_idx == ice::u32_max)
+                {
+                    skipped_tile_count += 1;
+                    continue;
+                }
+
+                chunk_tile_counts[layer_chunk_offsets[layer_idx] + cell_idx] += 1;
+                total_tile_count += 1;
+            }
+        }
+
+        ICE_LOG_IF(
+            skipped_tile_count > 0,
+            LogSeverity::Warning, LogTag::Game,
+            "Tilemap contains {} tiles outside of their layer bounds, these tiles will not be rendered.",
+            skipped_tile_count
+        );
+
+        ice::u32 chunk_count = 0;
+        for (ice::u32 tile_count : chunk_tile_counts)
+        {
+            chunk_count += ice::u32(tile_count > 0);
+        }
 
         ice::meminfo mi_tilemap = ice::meminfo_of<ice::TileMap>;
-        mi_tilemap += ice::meminfo_of<ice::TileSet> * asset_tilemap->tileset_count;
+        ice::usize const offset_tilesets = mi_tilemap += ice::meminfo_of<ice::TileSet> * asset_tilemap->tileset_count;
+        ice::usize const offset_chunks = mi_tilemap += ice::meminfo_of<ice::TileChunk> * chunk_count;
+        ice::usize const offset_chunk_tiles = mi_tilemap += ice::meminfo_of<ice::Tile> * total_tile_count;
 
         out_data = alloc.allocate(mi_tilemap);
 
@@ -32,12 +115,8 @@ namespace ice
         tilemap->tilesets = reinterpret_cast<ice::TileSet const*>(
             ice::ptr_add(data.location, std::bit_cast<ice::usize>(tilemap->tilesets))
         );
-        tilemap->layers = reinterpret_cast<ice::TileLayer const*>(
-            ice::ptr_add(data.location, std::bit_cast<ice::usize>(tilemap->layers))
-        );
-        tilemap->tiles = reinterpret_cast<ice::Tile const*>(
-            ice::ptr_add(data.location, std::bit_cast<ice::usize>(tilemap->tiles))
-        );
+        tilemap->layers = asset_layers;
+        tilemap->tiles = asset_tiles;
         tilemap->objects = reinterpret_cast<ice::TileObject const*>(
             ice::ptr_add(data.location, std::bit_cast<ice::usize>(tilemap->objects))
         );
@@ -53,7 +132,7 @@ namespace ice
             + sizeof(ice::TileSet) * tilemap->tileset_count
         );
 
-        ice::TileSet* resolved_tilesets = reinterpret_cast<ice::TileSet*>(ice::align_to(tilemap + 1, ice::align_of<ice::TileSet>).value);
+        ice::TileSet* resolved_tilesets = reinterpret_cast<ice::TileSet*>(ice::ptr_add(out_data.location, offset_tilesets));
         for (ice::u32 idx = 0; idx < tilemap->tileset_count; ++idx)
         {
             ice::u32 const* asset_name_loc = reinterpret_cast<ice::u32 const*>(&tilemap->tilesets[idx].asset);
@@ -68,6 +147,56 @@ namespace ice
         }
 
         tilemap->tilesets = resolved_tilesets;
+
+        // Create chunks in layer, row, column order. The tile counts are replaced with write cursors for the next step.
+        ice::TileChunk* const chunks = reinterpret_cast<ice::TileChunk*>(ice::ptr_add(out_data.location, offset_chunks));
+        ice::Tile* const chunk_tiles = reinterpret_cast<ice::Tile*>(ice::ptr_add(out_data.location, offset_chunk_tiles));
+
+        ice::u32 chunk_idx = 0;
+        ice::u32 chunk_tile_offset = 0;
+        for (ice::u32 layer_idx = 0; layer_idx < asset_tilemap->layer_count; ++layer_idx)
+        {
+            ice::vec2u const grid_size = detail::chunk_grid_size(asset_layers[layer_idx]);
+            for (ice::u32 cell_idx = 0; cell_idx < grid_size.x * grid_size.y; ++cell_idx)
+            {
+                ice::u32 const cell_tile_count = chunk_tile_counts[layer_chunk_offsets[layer_idx] + cell_idx];
+                chunk_tile_counts[layer_chunk_offsets[layer_idx] + cell_idx] = chunk_tile_offset;
+
+                if (cell_tile_count > 0)
+                {
+                    chunks[chunk_idx] = ice::TileChunk{
+                        .layer_idx = layer_idx,
+                        .position = { cell_idx % grid_size.x, cell_idx / grid_size.x },
+                        .tile_offset = chunk_tile_offset,
+                        .tile_count = cell_tile_count,
+                    };
+                    chunk_idx += 1;
+                }
+
+                chunk_tile_offset += cell_tile_count;
+            }
+        }
+
+        for (ice::u32 layer_idx = 0; layer_idx < asset_tilemap->layer_count; ++layer_idx)
+        {
+            ice::TileLayer const& layer = asset_layers[layer_idx];
+            for (ice::Tile const& tile : ice::Span{ asset_tiles + layer.tile_offset, layer.tile_count })
+            {
+                ice::u32 const cell_idx = detail::chunk_cell_index(layer, tile);
+                if (cell_idx == ice::u32_max)
+                {
+                    continue;
+                }
+
+                ice::u32& write_cursor = chunk_tile_counts[layer_chunk_offsets[layer_idx] + cell_idx];
+                chunk_tiles[write_cursor] = tile;
+                write_cursor += 1;
+            }
+        }
+
+        tilemap->chunk_count = chunk_count;
+        tilemap->chunks = chunks;
+        tilemap->chunk_tiles = chunk_tiles;
         co_return true;
     }
 
@@ -2,6 +2,7 @@
 /// SPDX-License-Identifier: MIT
 
 #include "asset_tilemap.hxx"
+#include "asset_tilemap_oven_tmx_data.hxx"
 
 #include <ice/asset_storage.hxx>
 #include <ice/game_tilemap.hxx>
@@ -19,10 +20,6 @@
 #define TILED_LOG(severity, format, ...) \
     ICE_LOG(severity, LogTag_TiledOven, format, ##__VA_ARGS__)
 
-//! A proper fix for Linux builds is required.
-//! [issue #91]
-#if ISP_WINDOWS
-
 namespace ice
 {
 
@@ -78,6 +75,10 @@ namespace ice
 
             ice::u32* map_collision_count;
 
+            //! \brief Decoded tile GIDs of all layers in document order, each layer stores 'width * height' values.
+            ice::Memory layer_gids;
+            ice::u32 layer_gids_count;
+
             ice::TileSet* tilesets;
             ice::TileLayer* layers;
             ice::Tile* tiles;
@@ -135,53 +136,6 @@ namespace ice
 
 
 
-    template<typename Fn>
-    void parse_node_data_csv(
-        rapidxml::xml_node<> const* node_data,
-        Fn&& tileid_callback
-    ) noexcept
-    {
-        ice::String csv_data{ node_data->value(), ice::ucount(node_data->value_size()) };
-
-        ice::u32 beg = 0;
-        ice::u32 end = ice::string::find_first_of(csv_data, ',');
-        while (end != ice::String_NPos)
-        {
-            char const* val_beg = ice::string::begin(csv_data) + beg;
-            char const* val_end = ice::string::begin(csv_data) + end;
-
-            while (std::isdigit(*val_beg) == false && val_beg != val_end)
-            {
-                val_beg += 1;
-            }
-
-            ice::u32 value = 0;
-            if (std::from_chars(val_beg, val_end, value).ec == std::errc{ 0 })
-            {
-                ice::forward<Fn>(tileid_callback)(value);
-            }
-
-            beg = end + 1;
-            end = ice::string::find_first_of(csv_data, ',', beg);
-        }
-
-        {
-            char const* val_beg = ice::string::begin(csv_data) + beg;
-            char const* val_end = ice::string::begin(csv_data) + node_data->value_size();
-
-            while (std::isdigit(*val_beg) == false && val_beg != val_end)
-            {
-                val_beg += 1;
-            }
-
-            ice::u32 value = 0;
-            if (std::from_chars(val_beg, val_end, value).ec == std::errc{ 0 })
-            {
-                ice::forward<Fn>(tileid_callback)(value);
-            }
-        }
-    }
-
     template<typename Fn>
     void parse_points_string(
         ice::String points,
@@ -204,8 +158,8 @@ namespace ice
             }
 
             ice::vec2f value{ 0 };
-            bool result = std::from_chars(val_beg, val_delim, value.x).ec == std::errc{ 0 };
-            result &= std::from_chars(val_delim + 1, val_end, value.y).ec == std::errc{ 0 };
+            bool result = bool(ice::from_chars(val_beg, val_delim, value.x));
+            result &= bool(ice::from_chars(val_delim + 1, val_end, value.y));
 
             if (result)
             {
@@ -227,8 +181,8 @@ namespace ice
             }
 
             ice::vec2f value{ 0 };
-            bool result = std::from_chars(val_beg, val_delim, value.x).ec == std::errc{ 0 };
-            result &= std::from_chars(val_delim + 1, val_end, value.y).ec == std::errc{ 0 };
+            bool result = bool(ice::from_chars(val_beg, val_delim, value.x));
+            result &= bool(ice::from_chars(val_delim + 1, val_end, value.y));
 
             if (result)
             {
@@ -396,6 +350,7 @@ namespace ice
 
     bool parse_node_layer_estimate_data(
         rapidxml::xml_node<> const* node_layer,
+        ice::Allocator& alloc,
         ice::TileMapInfo& tilemap_info
     ) noexcept
     {
@@ -409,37 +364,111 @@ namespace ice
         rapidxml::xml_attribute<> const* attrib;
         if (detail::get_attrib(node_data, attrib, "encoding") == false)
         {
-            TILED_LOG(LogSeverity::Error, "Invalid TMX resource, cannot read 'encoding' attribute from 'data' node.");
+            TILED_LOG(LogSeverity::Error, "Unsupported TMX resource, tile data stored as 'tile' nodes is not supported.");
             return false;
         }
 
         ice::String data_encoding;
         detail::attrib_value(attrib, data_encoding);
-        if (data_encoding != "csv")
+
+        ice::String data_compression;
+        if (detail::get_attrib(node_data, attrib, "compression"))
         {
-            TILED_LOG(LogSeverity::Error, "Unsupported TMX resource, currently only tile data in a 'csv' encoding is supported.");
+            detail::attrib_value(attrib, data_compression);
+        }
+
+        ice::TMXLayerEncoding const encoding = ice::tmx_layer_encoding(data_encoding, data_compression);
+        if (encoding == TMXLayerEncoding::Invalid)
+        {
+            TILED_LOG(
+                LogSeverity::Error,
+                "Unsupported TMX resource, tile data with encoding '{}' and compression '{}' is not supported.",
+                data_encoding, data_compression
+            );
+            return false;
+        }
+
+        ice::vec2u layer_size{ 0 };
+        detail::get_attrib(node_layer, attrib, "width");
+        detail::attrib_value(attrib, layer_size.x);
+        detail::next_attrib(attrib, attrib, "height");
+        detail::attrib_value(attrib, layer_size.y);
+
+        if (attrib == nullptr)
+        {
+            TILED_LOG(LogSeverity::Error, "Invalid TMX resource, failed to read one or multiple 'layer' attributes.");
             return false;
         }
 
-        parse_node_data_csv(
-            node_data,
-            [&](ice::u32 tile_value) noexcept
+        // Make space for the decoded GIDs, growing the buffer shared by all layers if necessary.
+        ice::u32 const layer_tile_count = layer_size.x * layer_size.y;
+        ice::usize const required_size = ice::size_of<ice::u32> * (tilemap_info.layer_gids_count + layer_tile_count);
+        if (tilemap_info.layer_gids.size < required_size)
+        {
+            ice::Memory const new_gids = alloc.allocate({ ice::max(required_size, tilemap_info.layer_gids.size * 2), ice::align_of<ice::u32> });
+            if (tilemap_info.layer_gids.location != nullptr)
             {
-                tilemap_info.tile_count += (tile_value != 0);
+                ice::memcpy(new_gids.location, tilemap_info.layer_gids.location, ice::size_of<ice::u32> * tilemap_info.layer_gids_count);
+                alloc.deallocate(tilemap_info.layer_gids);
             }
-        );
+            tilemap_info.layer_gids = new_gids;
+        }
 
-        tilemap_info.layer_count += 1;
+        ice::Span<ice::u32> const layer_gids{
+            reinterpret_cast<ice::u32*>(tilemap_info.layer_gids.location) + tilemap_info.layer_gids_count,
+            layer_tile_count
+        };
 
-        if (attrib == nullptr)
+        // Compressed data needs to be base64 decoded first, the decoded data is never larger than the encoded string.
+        ice::String const layer_data{ node_data->value(), ice::ucount(node_data->value_size()) };
+        ice::Memory scratch{ };
+        if (encoding == TMXLayerEncoding::Base64_Zlib || encoding == TMXLayerEncoding::Base64_Gzip || encoding == TMXLayerEncoding::Base64_Zstd)
         {
-            TILED_LOG(LogSeverity::Error, "Invalid TMX resource, failed to read one or multiple 'layer' attributes.");
+            scratch = alloc.allocate({ ice::usize{ node_data->value_size() + 1 }, ice::ualign::b_8 });
         }
-        return attrib != nullptr;
+
+        ice::Expected<ice::ucount> const decoded = ice::tmx_decode_layer_gids(encoding, layer_data, scratch, layer_gids);
+        if (scratch.location != nullptr)
+        {
+            alloc.deallocate(scratch);
+        }
+
+        if (decoded.succeeded() == false)
+        {
+            TILED_LOG(LogSeverity::Error, "Invalid TMX resource, failed to decode layer tile data. ({})", decoded.error());
+            return false;
+        }
+
+        ice::ucount const decoded_count = decoded.value();
+        if (decoded_count != layer_tile_count)
+        {
+            TILED_LOG(
+                LogSeverity::Warning,
+                "Invalid TMX resource, number of tile IDs read from 'data' node do not match total number of tiles in layer. [read: {}, expected: {}]",
+                decoded_count,
+                layer_tile_count
+            );
+
+            // Missing tiles are treated as empty.
+            for (ice::u32 idx = ice::min(decoded_count, layer_tile_count); idx < layer_tile_count; ++idx)
+            {
+                layer_gids[idx] = 0;
+            }
+        }
+
+        for (ice::u32 tile_value : layer_gids)
+        {
+            tilemap_info.tile_count += ice::u32(tile_value != 0);
+        }
+
+        tilemap_info.layer_gids_count += layer_tile_count;
+        tilemap_info.layer_count += 1;
+        return true;
     }
 
     bool gather_tilemap_info(
         rapidxml::xml_node<> const* node_map,
+        ice::Allocator& alloc,
         ice::TileMapInfo& tilemap_info
     ) noexcept
     {
@@ -468,7 +497,7 @@ namespace ice
             }
             else if (child_name == "layer")
             {
-                valid_map &= parse_node_layer_estimate_data(node_child, tilemap_info);
+                valid_map &= parse_node_layer_estimate_data(node_child, alloc, tilemap_info);
             }
             else
             {
@@ -620,6 +649,7 @@ namespace ice
         rapidxml::xml_node<> const* node_layer,
         ice::TileMapInfo const& tilemap_info,
         ice::TileSet const* tilesets,
+        ice::Span<ice::u32 const> layer_gids,
         ice::TileLayer& layer,
         ice::Tile* layer_tiles
     ) noexcept
@@ -675,70 +705,55 @@ namespace ice
         detail::attrib_value(attrib, layer_id);
         layer.name = ice::StringID{ static_cast<ice::StringID_Hash>(layer_id) };
 
-        rapidxml::xml_node<> const* node_data;
-        detail::get_child(node_layer, node_data, "data");
-
-        // detail::get_attrib(node_data, attrib, "encoding");
-        // detail::attrib_value(attrib, encoding_type);
-
         detail::get_attrib(node_layer, attrib, "width");
         detail::attrib_value(attrib, layer.size.x);
         detail::next_attrib(attrib, attrib, "height");
         detail::attrib_value(attrib, layer.size.y);
 
-        ice::u32 total_tile_count = 0;
-        parse_node_data_csv(
-            node_data,
-            [&](ice::u32 tile_value) noexcept
+        ICE_ASSERT(
+            ice::span::count(layer_gids) == layer.size.x * layer.size.y,
+            "Decoded tile data does not match the layer size."
+        );
+
+        ice::u32 tile_index = 0;
+        for (ice::u32 tile_value : layer_gids)
+        {
+            if (tile_value != 0)
             {
-                if (tile_value != 0)
-                {
-                    ice::u8 const value_flips = static_cast<ice::u8>((tile_value & 0xe000'0000) >> 28);
-                    ice::u32 tile_local_id = (tile_value & 0x1fff'ffff);
+                ice::u8 const value_flips = static_cast<ice::u8>((tile_value & 0xe000'0000) >> 28);
+                ice::u32 tile_local_id = (tile_value & 0x1fff'ffff);
 
-                    ice::u32 const tileset_idx = find_local_id(tile_local_id);
-                    ICE_ASSERT(tileset_idx != ~0, "Node global ID {} couldn not be moved to tileset local ID.", tile_local_id);
-                    ice::u16 const tileset_columns = tilemap_info.tileset_info[tileset_idx].columns;
+                ice::u32 const tileset_idx = find_local_id(tile_local_id);
+                ICE_ASSERT(tileset_idx != ~0, "Node global ID {} couldn not be moved to tileset local ID.", tile_local_id);
+                ice::u16 const tileset_columns = tilemap_info.tileset_info[tileset_idx].columns;
 
-                    ice::u16 const tile_id = static_cast<ice::u16>(tile_local_id);
-                    ice::u32 const tile_index = total_tile_count;
+                ice::u16 const tile_id = static_cast<ice::u16>(tile_local_id);
 
-                    ice::u32 const tile_x = (tile_index % layer.size.x);
-                    ice::u32 const tile_y = layer.size.y - (tile_index / layer.size.x) - 1;
+                ice::u32 const tile_x = (tile_index % layer.size.x);
+                ice::u32 const tile_y = layer.size.y - (tile_index / layer.size.x) - 1;
 
-                    layer_tiles->offset = (tile_y << 16) | (0x0000'ffff & tile_x);
-                    layer_tiles->tile_id = ice::detail::tmx_make_tileset_id(
-                        static_cast<ice::u8>(tileset_idx),
-                        value_flips,
-                        tile_id % tileset_columns,
-                        tile_id / tileset_columns
-                    );
+                layer_tiles->offset = (tile_y << 16) | (0x0000'ffff & tile_x);
+                layer_tiles->tile_id = ice::detail::tmx_make_tileset_id(
+                    static_cast<ice::u8>(tileset_idx),
+                    value_flips,
+                    tile_id % tileset_columns,
+                    tile_id / tileset_columns
+                );
 
-                    ice::TileCollision const* tile_collissions = tilemap_info.tile_collisions;
-                    for (ice::u32 idx = 0; idx < tilemap_info.tile_collision_count; ++idx)
+                ice::TileCollision const* tile_collissions = tilemap_info.tile_collisions;
+                for (ice::u32 idx = 0; idx < tilemap_info.tile_collision_count; ++idx)
+                {
+                    if (layer_tiles->tile_id == tile_collissions[idx].tile_id)
                     {
-                        if (layer_tiles->tile_id == tile_collissions[idx].tile_id)
-                        {
-                            *tilemap_info.map_collision_count += 1;
-                        }
+                        *tilemap_info.map_collision_count += 1;
                     }
-
-                    layer_tiles += 1;
-                    layer.tile_count += 1;
                 }
 
-                total_tile_count += 1;
+                layer_tiles += 1;
+                layer.tile_count += 1;
             }
-        );
 
-        if (total_tile_count != (layer.size.x * layer.size.y))
-        {
-            TILED_LOG(
-                LogSeverity::Warning,
-                "Invalid TMX resource, number of tile IDs read from 'data' node do not match total number of tiles in layer. [read: {}, expected: {}]",
-                total_tile_count,
-                (layer.size.x * layer.size.y)
-            );
+            tile_index += 1;
         }
     }
 
@@ -750,6 +765,7 @@ namespace ice
     {
         ice::u32 layer_idx = 0;
         ice::u32 layer_tiles_offset = 0;
+        ice::u32 layer_gids_offset = 0;
 
         ice::u32 tileset_idx = 0;
         ice::u32 objects_offset = 0;
@@ -768,7 +784,7 @@ namespace ice
         ice::Memory alloc_result{ };
         if (tile_memory_request.size > 0_B)
         {
-            alloc.allocate(tile_memory_request);
+            alloc_result = alloc.allocate(tile_memory_request);
         }
 
         ice::detail::TileCollisionInfo* tile_collision_info = reinterpret_cast<ice::detail::TileCollisionInfo*>(
@@ -810,8 +826,21 @@ namespace ice
                 ice::TileLayer& layer = tilemap_info.layers[layer_idx];
                 layer.tile_count = 0;
 
-                bake_layer_tiles(node_child, tilemap_info, tilemap_info.tilesets, layer, layer_tiles);
+                ice::u32 layer_width = 0, layer_height = 0;
+                rapidxml::xml_attribute<> const* attrib;
+                detail::get_attrib(node_child, attrib, "width");
+                detail::attrib_value(attrib, layer_width);
+                detail::next_attrib(attrib, attrib, "height");
+                detail::attrib_value(attrib, layer_height);
+
+                ice::Span<ice::u32 const> const layer_gids{
+                    reinterpret_cast<ice::u32 const*>(tilemap_info.layer_gids.location) + layer_gids_offset,
+                    layer_width * layer_height
+                };
+
+                bake_layer_tiles(node_child, tilemap_info, tilemap_info.tilesets, layer_gids, layer, layer_tiles);
                 layer.tile_offset = layer_tiles_offset;
+                layer_gids_offset += layer_width * layer_height;
 
                 layer_tiles += layer.tile_count;
                 layer_tiles_offset += layer.tile_count;
@@ -829,14 +858,23 @@ namespace ice
     }
 
     auto asset_tilemap_oven_tmx(
-        void* userdata,
-        ice::Allocator& asset_alloc,
-        ice::ResourceTracker const& resource_tracker,
-        ice::LooseResource const& resource,
-        ice::Data resource_data,
-        ice::Memory& out_data
-    ) noexcept -> ice::Task<bool>
+        ice::ResourceCompilerCtx& ctx,
+        ice::ResourceHandle const& resource_handle,
+        ice::ResourceTracker& resource_tracker,
+        ice::Span<ice::ResourceHandle const> sources,
+        ice::Span<ice::URI const> dependencies,
+        ice::Allocator& asset_alloc
+    ) noexcept -> ice::Task<ice::ResourceCompilerResult>
     {
+        ice::ResourceResult const loaded = co_await resource_tracker.load_resource(resource_handle);
+        if (loaded.resource_status != ice::ResourceStatus::Loaded)
+        {
+            TILED_LOG(LogSeverity::Error, "Failed to load TMX resource: {}", ice::resource_uri(resource_handle));
+            co_return { };
+        }
+
+        ice::Data const resource_data = loaded.data;
+        ice::Memory out_data{ };
         ice::Memory resource_copy = asset_alloc.allocate({ resource_data.size + 1_B, resource_data.alignment });
         ice::memcpy(resource_copy, resource_data);
 
@@ -852,7 +890,7 @@ namespace ice
             ice::TileMapInfo* tilemap_info_ptr = asset_alloc.create<ice::TileMapInfo>();
             ice::TileMapInfo& tilemap_info = *tilemap_info_ptr;
 
-            if (gather_tilemap_info(doc->first_node(), tilemap_info))
+            if (gather_tilemap_info(doc->first_node(), asset_alloc, tilemap_info))
             {
                 ice::u32 total_tilemap_bytes = alignof(ice::TileSet) + alignof(ice::TileLayer);
                 total_tilemap_bytes += sizeof(ice::TileMap);
@@ -862,10 +900,9 @@ namespace ice
                 ice::u32 total_tileset_assets_size = 0;
                 for (ice::u32 idx = 0; idx < tilemap_info.tileset_count; ++idx)
                 {
-                    ice::ResourceHandle const self = resource_tracker.find_resource(resource.uri());
                     ice::ResourceHandle const image_res = resource_tracker.find_resource_relative(
                         ice::URI{ ice::Scheme_File,  tilemap_info.tileset_info[idx].image },
-                        self
+                        resource_handle
                     );
 
                     if (image_res == nullptr)
@@ -913,10 +950,9 @@ namespace ice
                 ice::u32 asset_str_offset = 0;
                 for (ice::u32 idx = 0; idx < tilemap_info.tileset_count; ++idx)
                 {
-                    ice::ResourceHandle const self = resource_tracker.find_resource(resource.uri());
                     ice::ResourceHandle image_res = resource_tracker.find_resource_relative(
                         ice::URI{ ice::Scheme_File,  tilemap_info.tileset_info[idx].image },
-                        self
+                        resource_handle
                     );
 
                     if (image_res == nullptr)
@@ -977,6 +1013,9 @@ namespace ice
                     tilemap->objects = nullptr;
                     tilemap->tile_collisions = nullptr;
                     tilemap->object_vertices = nullptr;
+                    tilemap->chunk_count = 0;
+                    tilemap->chunks = nullptr;
+                    tilemap->chunk_tiles = nullptr;
 
                     bake_tilemap_asset(asset_alloc, doc->first_node(), tilemap_info);
 
@@ -1003,15 +1042,93 @@ namespace ice
                 else
                 {
                     asset_alloc.deallocate(out_data);
+                    out_data = { };
                 }
             }
 
+            if (tilemap_info.layer_gids.location != nullptr)
+            {
+                asset_alloc.deallocate(tilemap_info.layer_gids);
+            }
             asset_alloc.destroy(tilemap_info_ptr);
         }
 
         asset_alloc.destroy(doc);
         asset_alloc.deallocate(resource_copy);
-        co_return result;
+
+        if (result == false)
+        {
+            co_return { };
+        }
+        co_return ice::ResourceCompilerResult{ .result = out_data };
+    }
+
+    bool asset_tilemap_dependencies_tmx(
+        ice::ResourceCompilerCtx& ctx,
+        ice::ResourceHandle const& resource_handle,
+        ice::ResourceTracker& resource_tracker,
+        ice::Array<ice::URI>& out_dependencies
+    ) noexcept
+    {
+        // The raw resource is already loaded when baking, so this usually returns immediately.
+        ice::ResourceResult const loaded = ice::wait_for_result(resource_tracker.load_resource(resource_handle));
+        if (loaded.resource_status != ice::ResourceStatus::Loaded)
+        {
+            TILED_LOG(LogSeverity::Error, "Failed to load TMX resource: {}", ice::resource_uri(resource_handle));
+            return false;
+        }
+
+        ice::Allocator& alloc = *out_dependencies._allocator;
+        ice::Memory resource_copy = alloc.allocate({ loaded.data.size + 1_B, loaded.data.alignment });
+        ice::memcpy(resource_copy, loaded.data);
+        reinterpret_cast<char*>(resource_copy.location)[loaded.data.size.value] = '\0';
+
+        bool result = true;
+
+        rapidxml::xml_document<>* doc = alloc.create<rapidxml::xml_document<>>();
+        doc->parse<0>(reinterpret_cast<char*>(resource_copy.location));
+
+        // Tileset images are the only assets a tilemap depends on, their names are stored in the baked tilemap.
+        rapidxml::xml_node<> const* node_tileset = nullptr;
+        if (doc->first_node() != nullptr)
+        {
+            detail::get_child(doc->first_node(), node_tileset, "tileset");
+        }
+
+        while (node_tileset != nullptr && result)
+        {
+            rapidxml::xml_node<> const* node_image;
+            rapidxml::xml_attribute<> const* attrib;
+            ice::String image_source;
+            result = detail::get_child(node_tileset, node_image, "image")
+                && detail::get_attrib(node_image, attrib, "source")
+                && detail::attrib_value(attrib, image_source);
+
+            if (result)
+            {
+                ice::ResourceHandle const image_res = resource_tracker.find_resource_relative(
+                    ice::URI{ ice::Scheme_File, image_source },
+                    resource_handle
+                );
+
+                result = image_res != nullptr;
+                if (result)
+                {
+                    // Same as when baking, the asset name is based on the resource path.
+                    ice::array::push_back(out_dependencies, ice::URI{ ice::Scheme_URN, ice::resource_path(image_res) });
+                }
+                else
+                {
+                    TILED_LOG(LogSeverity::Error, "Failed to find tileset image: {}", image_source);
+                }
+            }
+
+            detail::next_sibling(node_tileset, node_tileset, "tileset");
+        }
+
+        alloc.destroy(doc);
+        alloc.deallocate(resource_copy);
+        return result;
     }
 
     bool detail::get_child(rapidxml::xml_node<> const* parent_node, rapidxml::xml_node<> const*& out_node, char const* name) noexcept
@@ -1101,5 +1218,3 @@ namespace ice
     }
 
 } // namespace ice
-
-#endif // #if ISP_WINDOWS
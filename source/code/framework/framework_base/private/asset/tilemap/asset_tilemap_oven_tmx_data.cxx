@@ -0,0 +1,334 @@
+/// Copyright 2022 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "asset_tilemap_oven_tmx_data.hxx"
+#include <ice/mem_memory.hxx>
+#include <ice/mem_data.hxx>
+#include <ice/mem_utils.hxx>
+#include <ice/string/string.hxx>
+
+// Makes 'z_stream::next_in' a const pointer, so compressed data can be passed without casting.
+#define ZLIB_CONST
+#include <zlib.h>
+#include <zstd.h>
+#include <zstd_errors.h>
+
+#include <array>
+#include <bit>
+
+namespace ice
+{
+
+    namespace detail
+    {
+
+        static constexpr ice::u8 Base64_Invalid = 0xff;
+        static constexpr ice::u8 Base64_Whitespace = 0xfe;
+
+        static constexpr auto Base64_DecodeTable = []() noexcept
+        {
+            std::array<ice::u8, 256> table{ };
+            table.fill(Base64_Invalid);
+
+            constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            for (ice::u8 idx = 0; idx < 64; ++idx)
+            {
+                table[ice::u8(alphabet[idx])] = idx;
+            }
+
+            table[ice::u8(' ')] = Base64_Whitespace;
+            table[ice::u8('\t')] = Base64_Whitespace;
+            table[ice::u8('\r')] = Base64_Whitespace;
+            table[ice::u8('\n')] = Base64_Whitespace;
+            return table;
+        }();
+
+        inline auto base64_group(ice::u8 const* chars) noexcept -> ice::u32
+        {
+            // Invalid and whitespace entries have the highest bits set, which leak into bits 24+ of the result.
+            return (ice::u32(Base64_DecodeTable[chars[0]]) << 18)
+                | (ice::u32(Base64_DecodeTable[chars[1]]) << 12)
+                | (ice::u32(Base64_DecodeTable[chars[2]]) << 6)
+                | (ice::u32(Base64_DecodeTable[chars[3]]) << 0)
+                | ((ice::u32(Base64_DecodeTable[chars[0]]) | Base64_DecodeTable[chars[1]]
+                    | Base64_DecodeTable[chars[2]] | Base64_DecodeTable[chars[3]]) & 0xc0) << 24;
+        }
+
+    } // namespace detail
+
+    auto tmx_layer_encoding(
+        ice::String encoding,
+        ice::String compression
+    ) noexcept -> ice::TMXLayerEncoding
+    {
+        if (encoding == "csv")
+        {
+            return ice::string::empty(compression) ? TMXLayerEncoding::CSV : TMXLayerEncoding::Invalid;
+        }
+        else if (encoding == "base64")
+        {
+            if (ice::string::empty(compression))
+            {
+                return TMXLayerEncoding::Base64;
+            }
+            else if (compression == "zlib")
+            {
+                return TMXLayerEncoding::Base64_Zlib;
+            }
+            else if (compression == "gzip")
+            {
+                return TMXLayerEncoding::Base64_Gzip;
+            }
+            else if (compression == "zstd")
+            {
+                return TMXLayerEncoding::Base64_Zstd;
+            }
+        }
+        return TMXLayerEncoding::Invalid;
+    }
+
+    auto tmx_decode_csv(
+        ice::String csv_data,
+        ice::Span<ice::u32> out_gids
+    ) noexcept -> ice::Expected<ice::ucount>
+    {
+        char const* it = ice::string::begin(csv_data);
+        char const* const end = ice::string::end(csv_data);
+
+        ice::u32* out_it = ice::span::data(out_gids);
+        ice::u32* const out_end = out_it + ice::span::count(out_gids);
+
+        ice::ucount count = 0;
+        ice::u64 value = 0;
+        bool has_value = false;
+
+        // Single pass, digits are accumulated and any separator flushes the value. Whitespace and line breaks are skipped.
+        for (; it != end; ++it)
+        {
+            ice::u32 const digit = ice::u32(ice::u8(*it) - ice::u8('0'));
+            if (digit < 10)
+            {
+                value = value * 10 + digit;
+                has_value = true;
+
+                if (value > ice::u32_max)
+                {
+                    return ice::E_InvalidArgument;
+                }
+            }
+            else if (*it == ',')
+            {
+                if (has_value == false)
+                {
+                    return ice::E_InvalidArgument;
+                }
+
+                if (out_it != out_end)
+                {
+                    *out_it++ = ice::u32(value);
+                }
+                count += 1;
+                value = 0;
+                has_value = false;
+            }
+            else if (*it != ' ' && *it != '\t' && *it != '\r' && *it != '\n')
+            {
+                return ice::E_InvalidArgument;
+            }
+        }
+
+        if (has_value)
+        {
+            if (out_it != out_end)
+            {
+                *out_it = ice::u32(value);
+            }
+            count += 1;
+        }
+        return count;
+    }
+
+    auto tmx_decode_base64(
+        ice::String base64_data,
+        ice::Memory out_data
+    ) noexcept -> ice::Expected<ice::usize>
+    {
+        using detail::Base64_DecodeTable;
+
+        ice::u8 const* it = reinterpret_cast<ice::u8 const*>(ice::string::begin(base64_data));
+        ice::u8 const* end = reinterpret_cast<ice::u8 const*>(ice::string::end(base64_data));
+
+        // Trim trailing whitespace and padding, so the main loop only sees alphabet characters in the common case.
+        while (end != it && (Base64_DecodeTable[end[-1]] == detail::Base64_Whitespace || end[-1] == '='))
+        {
+            end -= 1;
+        }
+
+        ice::u8* out_it = reinterpret_cast<ice::u8*>(out_data.location);
+        ice::u8* const out_end = out_it + out_data.size.value;
+
+        ice::u32 bits = 0;
+        ice::u32 bit_count = 0;
+        while (it != end)
+        {
+            // Fast path, decodes 8 characters into 6 bytes per iteration while no whitespace is encountered.
+            if (bit_count == 0)
+            {
+                while ((end - it) >= 8 && (out_end - out_it) >= 6)
+                {
+                    ice::u32 const first = detail::base64_group(it);
+                    ice::u32 const second = detail::base64_group(it + 4);
+                    if (((first | second) & 0xff00'0000) != 0)
+                    {
+                        break;
+                    }
+
+                    out_it[0] = ice::u8(first >> 16);
+                    out_it[1] = ice::u8(first >> 8);
+                    out_it[2] = ice::u8(first);
+                    out_it[3] = ice::u8(second >> 16);
+                    out_it[4] = ice::u8(second >> 8);
+                    out_it[5] = ice::u8(second);
+                    out_it += 6;
+                    it += 8;
+                }
+
+                if (it == end)
+                {
+                    break;
+                }
+            }
+
+            // Slow path, a single character at a time until we are aligned to a group boundary again.
+            ice::u8 const decoded = Base64_DecodeTable[*it];
+            it += 1;
+
+            if (decoded == detail::Base64_Whitespace)
+            {
+                continue;
+            }
+            else if (decoded == detail::Base64_Invalid)
+            {
+                return ice::E_InvalidArgument;
+            }
+
+            bits = (bits << 6) | decoded;
+            bit_count += 6;
+            if (bit_count >= 8)
+            {
+                if (out_it == out_end)
+                {
+                    return ice::E_OutOfRange;
+                }
+
+                bit_count -= 8;
+                *out_it++ = ice::u8(bits >> bit_count);
+                bits &= (1u << bit_count) - 1;
+            }
+        }
+
+        return ice::usize{ ice::usize::base_type(out_it - reinterpret_cast<ice::u8*>(out_data.location)) };
+    }
+
+    auto tmx_decompress_zlib(
+        ice::Data compressed_data,
+        ice::Memory out_data
+    ) noexcept -> ice::Expected<ice::usize>
+    {
+        z_stream stream{ };
+        stream.next_in = reinterpret_cast<Bytef const*>(compressed_data.location);
+        stream.avail_in = uInt(compressed_data.size.value);
+        stream.next_out = reinterpret_cast<Bytef*>(out_data.location);
+        stream.avail_out = uInt(out_data.size.value);
+
+        // Window bits of '15 + 32' enable automatic detection of zlib and gzip headers.
+        if (inflateInit2(&stream, 15 + 32) != Z_OK)
+        {
+            return ice::E_Fail;
+        }
+
+        int const result = inflate(&stream, Z_FINISH);
+        inflateEnd(&stream);
+
+        if (result != Z_STREAM_END)
+        {
+            return result == Z_BUF_ERROR ? ice::E_OutOfRange : ice::E_InvalidArgument;
+        }
+        return ice::usize{ stream.total_out };
+    }
+
+    auto tmx_decompress_zstd(
+        ice::Data compressed_data,
+        ice::Memory out_data
+    ) noexcept -> ice::Expected<ice::usize>
+    {
+        size_t const result = ZSTD_decompress(
+            out_data.location,
+            out_data.size.value,
+            compressed_data.location,
+            compressed_data.size.value
+        );
+
+        if (ZSTD_isError(result))
+        {
+            return ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall ? ice::E_OutOfRange : ice::E_InvalidArgument;
+        }
+        return ice::usize{ result };
+    }
+
+    auto tmx_decode_layer_gids(
+        ice::TMXLayerEncoding encoding,
+        ice::String layer_data,
+        ice::Memory scratch,
+        ice::Span<ice::u32> out_gids
+    ) noexcept -> ice::Expected<ice::ucount>
+    {
+        static_assert(std::endian::native == std::endian::little, "TMX stores tile GIDs as little-endian values.");
+
+        ice::Memory const out_memory{
+            .location = ice::span::data(out_gids),
+            .size = ice::span::size_bytes(out_gids),
+            .alignment = ice::align_of<ice::u32>
+        };
+
+        ice::Expected<ice::usize> decoded_size{ };
+        switch (encoding)
+        {
+        case TMXLayerEncoding::CSV:
+            return tmx_decode_csv(layer_data, out_gids);
+        case TMXLayerEncoding::Base64:
+            decoded_size = tmx_decode_base64(layer_data, out_memory);
+            break;
+        case TMXLayerEncoding::Base64_Zlib:
+        case TMXLayerEncoding::Base64_Gzip:
+        case TMXLayerEncoding::Base64_Zstd:
+        {
+            ice::Expected<ice::usize> const compressed_size = tmx_decode_base64(layer_data, scratch);
+            if (compressed_size.succeeded() == false)
+            {
+                return compressed_size.error();
+            }
+
+            ice::Data const compressed_data{
+                .location = scratch.location,
+                .size = compressed_size.value(),
+                .alignment = scratch.alignment
+            };
+
+            decoded_size = encoding == TMXLayerEncoding::Base64_Zstd
+                ? tmx_decompress_zstd(compressed_data, out_memory)
+                : tmx_decompress_zlib(compressed_data, out_memory);
+            break;
+        }
+        default:
+            return ice::E_InvalidArgument;
+        }
+
+        if (decoded_size.succeeded() == false)
+        {
+            return decoded_size.error();
+        }
+        return ice::ucount(decoded_size.value().value / sizeof(ice::u32));
+    }
+
+} // namespace ice
@@ -0,0 +1,67 @@
+/// Copyright 2022 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/span.hxx>
+#include <ice/string/string.hxx>
+#include <ice/expected.hxx>
+
+namespace ice
+{
+
+    //! \brief Encodings of the 'data' node in TMX layers, as stored in the 'encoding' and 'compression' attributes.
+    enum class TMXLayerEncoding : ice::u8
+    {
+        Invalid,
+        CSV,
+        Base64,
+        Base64_Zlib,
+        Base64_Gzip,
+        Base64_Zstd,
+    };
+
+    auto tmx_layer_encoding(
+        ice::String encoding,
+        ice::String compression
+    ) noexcept -> ice::TMXLayerEncoding;
+
+    //! \brief Decodes tile GIDs from a comma separated list in a single pass over the data.
+    //! \returns The number of values found, values not fitting into 'out_gids' are only counted.
+    //!   Fails if the data contains anything else than digits, separators and whitespace, empty values or values above 'u32_max'.
+    auto tmx_decode_csv(
+        ice::String csv_data,
+        ice::Span<ice::u32> out_gids
+    ) noexcept -> ice::Expected<ice::ucount>;
+
+    //! \brief Decodes base64 data, ignoring any whitespace characters.
+    //! \returns The number of bytes written to 'out_data' or an error if the input was invalid or too large.
+    auto tmx_decode_base64(
+        ice::String base64_data,
+        ice::Memory out_data
+    ) noexcept -> ice::Expected<ice::usize>;
+
+    //! \brief Decompresses a zlib or gzip stream into the provided memory.
+    //! \returns The number of bytes written to 'out_data' or an error if the stream is invalid.
+    auto tmx_decompress_zlib(
+        ice::Data compressed_data,
+        ice::Memory out_data
+    ) noexcept -> ice::Expected<ice::usize>;
+
+    //! \brief Decompresses a zstd frame into the provided memory.
+    //! \returns The number of bytes written to 'out_data' or an error if the frame is invalid.
+    auto tmx_decompress_zstd(
+        ice::Data compressed_data,
+        ice::Memory out_data
+    ) noexcept -> ice::Expected<ice::usize>;
+
+    //! \brief Decodes all tile GIDs of a single layer 'data' node value.
+    //! \param scratch Memory used to hold the decoded but still compressed data, needs to be at least as large as the base64 string.
+    //! \returns The number of decoded GIDs or an error if the data could not be decoded.
+    auto tmx_decode_layer_gids(
+        ice::TMXLayerEncoding encoding,
+        ice::String layer_data,
+        ice::Memory scratch,
+        ice::Span<ice::u32> out_gids
+    ) noexcept -> ice::Expected<ice::ucount>;
+
+} // namespace ice
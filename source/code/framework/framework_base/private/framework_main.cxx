@@ -23,6 +23,7 @@
 #include <ice/gfx/gfx_graph_runtime.hxx>
 
 #include <ice/render/render_module.hxx>
+#include <ice/render/render_shader.hxx>
 #include <ice/ecs/ecs_archetype_index.hxx>
 #include <ice/engine.hxx>
 #include <ice/engine_runner.hxx>
@@ -40,9 +41,11 @@
 
 #include <ice/resource_tracker.hxx>
 #include <ice/resource_provider.hxx>
+#include <ice/resource_compiler_api.hxx>
 #include <ice/asset_category_archive.hxx>
 #include <ice/asset_storage.hxx>
 #include <ice/asset_module.hxx>
+#include <ice/font.hxx>
 
 #include <ice/input/device_event_queue.hxx>
 #include <ice/input/input_tracker.hxx>
@@ -54,6 +57,7 @@
 
 #include <ice/mem_allocator_proxy.hxx>
 #include <ice/task_thread_pool.hxx>
+#include <ice/task_frame_allocator.hxx>
 #include <ice/task_utils.hxx>
 #include <ice/task_scoped_container.hxx>
 #include <ice/sync_manual_events.hxx>
@@ -103,6 +107,12 @@ struct ice::app::State
 {
     ice::Allocator& alloc;
 
+    ice::ProxyAllocator tasks_alloc;
+
+    //! \brief Declared first so it's destroyed last, after 'ice_shutdown' joined all task threads and every other
+    //!   member released its tasks.
+    ice::UniquePtr<ice::TaskFramePool> task_frames;
+
     ice::ProxyAllocator resources_alloc;
     ice::ProxyAllocator modules_alloc;
     ice::ProxyAllocator gamework_alloc;
@@ -112,6 +122,12 @@ struct ice::app::State
     ice::UniquePtr<ice::framework::Game> game;
     ice::UniquePtr<ice::ModuleRegister> modules;
 
+    //! \brief Directory for font glyphs generated at runtime, needs to outlive the asset storage.
+    ice::HeapString<> font_glyph_cache;
+
+    //! \brief Directory for shaders transpiled and compiled at runtime, needs to outlive the asset storage.
+    ice::HeapString<> shader_cache;
+
     ice::UniquePtr<ice::AssetStorage> assets;
     ice::UniquePtr<ice::Engine> engine;
     ice::UniquePtr<ice::render::RenderDriver> renderer;
@@ -137,6 +153,8 @@ struct ice::app::State
 
     State(ice::Allocator& alloc) noexcept
         : alloc{ alloc }
+        , tasks_alloc{ alloc, "Tasks" }
+        , task_frames{ ice::create_task_frame_pool(tasks_alloc) }
         , resources_alloc{ alloc, "Resources" }
         , modules_alloc{ alloc, "Modules" }
         , gamework_alloc{ alloc, "Gamework" }
@@ -144,6 +162,8 @@ struct ice::app::State
         , resources{ }
         , game{ ice::framework::create_game(gamework_alloc) }
         , modules{ ice::create_default_module_register(modules_alloc, true) }
+        , font_glyph_cache{ alloc }
+        , shader_cache{ alloc }
         , render_surface{ }
         , providers{ }
         , platform{ .core = nullptr }
@@ -206,6 +226,10 @@ struct ice::app::Runtime
     ice::ManualResetEvent gfx_wait;
     ice::Task<void> next_frame_task;
 
+    //! \brief Used to check for rebuilt modules in develop builds.
+    ice::Timer module_reload_timer{ };
+    bool module_reload_pending = false;
+
     Frame frames[2];
     Frame* previous;
     ice::TaskQueue render_stage;
@@ -441,10 +465,25 @@ auto ice_setup(
     {
         ice::UniquePtr<ice::AssetCategoryArchive> asset_categories = ice::create_asset_category_archive(state.engine_alloc);
         ice::load_asset_category_definitions(state.engine_alloc, *state.modules, *asset_categories);
+        // Fonts are baked when loaded, glyphs are generated on the thread pool and cached between runs.
+        state.font_glyph_cache = storage->cache_location();
+        ice::path::join(state.font_glyph_cache, "font_glyphs");
+
+        // Shaders compiled from sources are cached the same way, so unchanged shaders are not compiled again.
+        state.shader_cache = storage->cache_location();
+        ice::path::join(state.shader_cache, "shaders");
+
+        ice::Shard const compiler_params[]{
+            ice::shard(ice::ShardID_FontGlyphScheduler, &state.platform.threads->threadpool()),
+            ice::shard(ice::ShardID_FontGlyphCache, ice::string::begin(state.font_glyph_cache)),
+            ice::shard(ice::render::ShardID_ShaderCacheDirectory, ice::string::begin(state.shader_cache)),
+        };
+
         ice::AssetStorageCreateInfo const asset_storage_info{
             .resource_tracker = *state.resources,
             .task_scheduler = state.platform.threads->threadpool(),
-            .task_flags = ice::TaskFlags{}
+            .task_flags = ice::TaskFlags{},
+            .compiler_params = compiler_params,
         };
         engine_create_info.assets = ice::create_asset_storage(state.resources_alloc, ice::move(asset_categories), asset_storage_info);
     }
@@ -505,7 +544,9 @@ auto ice_resume(
             }
         };
 
+        using ice::operator""_Ts;
         runtime.clock = ice::clock::create_clock();
+        runtime.module_reload_timer = ice::timer::create_timer(runtime.clock, 1_Ts);
         runtime.runner = ice::create_engine_runner(state.engine_alloc, *state.modules, runner_create_info);
         runtime.frame = ice::wait_for_result(runtime.runner->aquire_frame());
         runtime.game_clock = ice::clock::create_clock(runtime.game_clock, 1.0f);
@@ -716,12 +757,33 @@ auto ice_update(
     // Possibly enter the render stage for one of the frames
     bool render_enabled_frame = runtime.render_enabled && runtime.resize_handled && was_restored == false;
 
+    if constexpr (ice::build::is_debug || ice::build::is_develop)
+    {
+        if (runtime.module_reload_pending == false && ice::timer::update(runtime.module_reload_timer))
+        {
+            runtime.module_reload_pending = state.modules->has_changed_modules();
+        }
+    }
+
     // If nothing is running, the we start the next frame task
     if (runtime.previous->wait.is_set())
     {
         runtime.render_stage.process_one(&render_enabled_frame);
 
-        if (runtime.next_frame_task.valid())
+        if (runtime.module_reload_pending)
+        {
+            // Rebuilt modules are only reloaded when both frames finished and the pool is idle, so no module code is executing.
+            //  Only libraries opting-in into hot-reload are swapped, see 'ICE_MODULE_HOT_RELOAD()'.
+            ice::TaskThreadPool const* const threadpool = state.platform.threads->threadpool_object();
+            if (runtime.frames[0].wait.is_set() && runtime.frames[1].wait.is_set()
+                && (threadpool == nullptr || threadpool->is_idle()))
+            {
+                ice::ucount const reloaded_count = state.modules->reload_changed_modules();
+                ICE_LOG(ice::LogSeverity::Info, ice::LogTag::Game, "Reloaded {} changed modules", reloaded_count);
+                runtime.module_reload_pending = false;
+            }
+        }
+        else if (runtime.next_frame_task.valid())
         {
             // system_events will have changed after a frame was awaited!
             runtime.previous->wait.reset();
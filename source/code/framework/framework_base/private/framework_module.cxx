@@ -8,6 +8,7 @@
 
 #include "traits/trait_tilemap.hxx"
 #include "traits/trait_camera.hxx"
+#include "traits/trait_spatial_index.hxx"
 #include "traits/trait_sprite_animator.hxx"
 #include "traits/trait_player_actor.hxx"
 #include "traits/physics/trait_chipmunk2d.hxx"
@@ -71,6 +72,7 @@ namespace ice::framework
     bool framework_register_traits(ice::TraitArchive& archive) noexcept
     {
         archive.register_trait(ice::IceWorldTrait_RenderCamera::trait_descriptor());
+        archive.register_trait(ice::IceWorldTrait_SpatialIndex2D::trait_descriptor());
         return true;
     }
 
@@ -2,6 +2,11 @@
 /// SPDX-License-Identifier: MIT
 
 #include <ice/game_tilemap.hxx>
+#include <ice/game_camera.hxx>
+#include <ice/container/array.hxx>
+#include <ice/container/hashmap.hxx>
+#include <algorithm>
+#include <limits>
 
 namespace ice
 {
@@ -23,4 +28,199 @@ namespace ice
         return static_cast<ice::TileSetID>(result);
     }
 
+    bool tilemap_camera_region(
+        ice::CameraData const& camera,
+        ice::vec2f& out_region_min,
+        ice::vec2f& out_region_max
+    ) noexcept
+    {
+        ice::mat4x4 inv_view_projection = camera.projection * camera.view;
+        if (ice::math::inverse_insitu(inv_view_projection) == false)
+        {
+            return false;
+        }
+
+        static constexpr ice::vec2f ndc_corners[]{
+            { -1.f, -1.f }, { 1.f, -1.f }, { 1.f, 1.f }, { -1.f, 1.f }
+        };
+
+        auto const& m = inv_view_projection.v;
+        out_region_min = ice::vec2f{ std::numeric_limits<ice::f32>::max() };
+        out_region_max = ice::vec2f{ std::numeric_limits<ice::f32>::lowest() };
+
+        for (ice::vec2f const& ndc : ndc_corners)
+        {
+            ice::f32 const w = m[0][3] * ndc.x + m[1][3] * ndc.y + m[3][3];
+            ice::vec2f const world{
+                (m[0][0] * ndc.x + m[1][0] * ndc.y + m[3][0]) / w,
+                (m[0][1] * ndc.x + m[1][1] * ndc.y + m[3][1]) / w,
+            };
+
+            out_region_min = { ice::min(out_region_min.x, world.x), ice::min(out_region_min.y, world.y) };
+            out_region_max = { ice::max(out_region_max.x, world.x), ice::max(out_region_max.y, world.y) };
+        }
+        return true;
+    }
+
+    auto tilemap_query_chunks(
+        ice::TileMap const& tilemap,
+        ice::u32 layer_idx,
+        ice::vec2f region_min,
+        ice::vec2f region_max,
+        ice::Array<ice::u32>& out_chunks
+    ) noexcept -> ice::ucount
+    {
+        ice::TileLayer const& layer = tilemap.layers[layer_idx];
+        ice::vec2f const chunk_size = tilemap.tile_size * ice::f32(Constant_TileMapChunkSize);
+        if (layer.tile_count == 0 || layer.size.x == 0 || layer.size.y == 0 || chunk_size.x <= 0.f || chunk_size.y <= 0.f)
+        {
+            return 0;
+        }
+
+        ice::vec2u const grid_size{
+            (layer.size.x + Constant_TileMapChunkSize - 1) / Constant_TileMapChunkSize,
+            (layer.size.y + Constant_TileMapChunkSize - 1) / Constant_TileMapChunkSize,
+        };
+        ice::vec2f const map_extent{
+            chunk_size.x * ice::f32(grid_size.x),
+            chunk_size.y * ice::f32(grid_size.y),
+        };
+
+        // Written as negations so NaN regions are rejected too.
+        if (!(region_max.x >= 0.f && region_max.y >= 0.f && region_min.x < map_extent.x && region_min.y < map_extent.y))
+        {
+            return 0;
+        }
+
+        // Clamp to the map extents before converting, so unbounded regions (ex.: no camera) stay in the u32 range.
+        ice::vec2f const clamped_min{
+            ice::max(region_min.x, 0.f),
+            ice::max(region_min.y, 0.f),
+        };
+        ice::vec2f const clamped_max{
+            ice::min(region_max.x, map_extent.x),
+            ice::min(region_max.y, map_extent.y),
+        };
+
+        // Tiles are positioned at their bottom-left corner, so a chunk covers [position, position + chunk_size).
+        ice::vec2u const first{
+            ice::min(ice::u32(clamped_min.x / chunk_size.x), grid_size.x - 1),
+            ice::min(ice::u32(clamped_min.y / chunk_size.y), grid_size.y - 1),
+        };
+        ice::vec2u const last{
+            ice::min(ice::u32(clamped_max.x / chunk_size.x), grid_size.x - 1),
+            ice::min(ice::u32(clamped_max.y / chunk_size.y), grid_size.y - 1),
+        };
+        if (first.x > last.x || first.y > last.y)
+        {
+            return 0;
+        }
+
+        // Chunks are sorted by layer, row and column, so we can binary search the start of each visible row.
+        auto const chunk_order = [](ice::TileChunk const& chunk, ice::TileChunk const& key) noexcept
+        {
+            if (chunk.layer_idx != key.layer_idx)
+            {
+                return chunk.layer_idx < key.layer_idx;
+            }
+            if (chunk.position.y != key.position.y)
+            {
+                return chunk.position.y < key.position.y;
+            }
+            return chunk.position.x < key.position.x;
+        };
+
+        ice::TileChunk const* const chunks_beg = tilemap.chunks;
+        ice::TileChunk const* const chunks_end = tilemap.chunks + tilemap.chunk_count;
+
+        ice::ucount const initial_count = ice::array::count(out_chunks);
+        for (ice::u32 row = first.y; row <= last.y; ++row)
+        {
+            ice::TileChunk const key{ .layer_idx = layer_idx, .position = { first.x, row } };
+            ice::TileChunk const* it = std::lower_bound(chunks_beg, chunks_end, key, chunk_order);
+
+            while (it != chunks_end && it->layer_idx == layer_idx && it->position.y == row && it->position.x <= last.x)
+            {
+                ice::array::push_back(out_chunks, ice::u32(it - chunks_beg));
+                it += 1;
+            }
+        }
+        return ice::array::count(out_chunks) - initial_count;
+    }
+
+    TileMapChunkSlots::TileMapChunkSlots(ice::Allocator& alloc, ice::u32 slot_count) noexcept
+        : _current_frame{ 0 }
+        , _chunk_slots{ alloc }
+        , _slot_chunks{ alloc }
+        , _slot_last_frame{ alloc }
+    {
+        ice::hashmap::reserve(_chunk_slots, slot_count);
+        ice::array::resize(_slot_chunks, slot_count);
+        ice::array::resize(_slot_last_frame, slot_count);
+        reset();
+    }
+
+    auto TileMapChunkSlots::slot_count() const noexcept -> ice::u32
+    {
+        return ice::array::count(_slot_chunks);
+    }
+
+    void TileMapChunkSlots::next_frame() noexcept
+    {
+        _current_frame += 1;
+    }
+
+    void TileMapChunkSlots::reset() noexcept
+    {
+        ice::hashmap::clear(_chunk_slots);
+        for (ice::u32 slot_idx = 0; slot_idx < slot_count(); ++slot_idx)
+        {
+            _slot_chunks[slot_idx] = ice::u32_max;
+            _slot_last_frame[slot_idx] = 0;
+        }
+    }
+
+    auto TileMapChunkSlots::acquire(ice::u32 chunk_idx, bool& out_needs_upload) noexcept -> ice::u32
+    {
+        out_needs_upload = false;
+
+        ice::u32 selected_slot = ice::hashmap::get(_chunk_slots, chunk_idx, ice::u32_max);
+        if (selected_slot == ice::u32_max)
+        {
+            // Free slots are taken first, otherwise pick the one not used for the longest time.
+            //  Slots used in the current frame are never selected, as their chunks are already queued for drawing.
+            ice::u32 selected_frame = _current_frame;
+            for (ice::u32 slot_idx = 0; slot_idx < slot_count(); ++slot_idx)
+            {
+                if (_slot_chunks[slot_idx] == ice::u32_max)
+                {
+                    selected_slot = slot_idx;
+                    break;
+                }
+
+                if (_slot_last_frame[slot_idx] < selected_frame)
+                {
+                    selected_slot = slot_idx;
+                    selected_frame = _slot_last_frame[slot_idx];
+                }
+            }
+
+            if (selected_slot == ice::u32_max)
+            {
+                return ice::u32_max;
+            }
+
+            if (_slot_chunks[selected_slot] != ice::u32_max)
+            {
+                ice::hashmap::remove(_chunk_slots, _slot_chunks[selected_slot]);
+            }
+            ice::hashmap::set(_chunk_slots, chunk_idx, selected_slot);
+            _slot_chunks[selected_slot] = chunk_idx;
+            out_needs_upload = true;
+        }
+
+        _slot_last_frame[selected_slot] = _current_frame;
+        return selected_slot;
+    }
+
 } // namespace ice
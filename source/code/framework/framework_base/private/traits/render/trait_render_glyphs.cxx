@@ -47,6 +47,7 @@ namespace ice
 
     IceWorldTrait_RenderGlyphs::IceWorldTrait_RenderGlyphs(ice::Allocator& alloc) noexcept
         : _fonts{ alloc }
+        , _layout_cache{ alloc }
     {
     }
 
@@ -294,6 +295,7 @@ namespace ice
     ) noexcept
     {
         IPT_ZONE_SCOPED_NAMED("[Trait] RenderGlyphs :: update");
+        _layout_cache.next_frame();
 
         ice::Array<ice::String> load_fonts{ frame.allocator() };
         ice::array::reserve(load_fonts, 10);
@@ -439,74 +441,15 @@ namespace ice
     {
         IPT_ZONE_SCOPED_NAMED("[Trait] RenderGlyphs :: build vertices");
 
-        char const* it = ice::string::begin(draw_info.text);
-        char const* const end = ice::string::end(draw_info.text);
+        // Layouts are cached relative to the text origin, so we only need to move them into place.
+        ice::TextLayout const layout = _layout_cache.layout(*font, draw_info.text, draw_info.font_size);
+        ice::vec2f const origin{ ice::f32(draw_info.position.x), ice::f32(draw_info.position.y) };
 
-        ice::u32 font_size = draw_info.font_size;
-        ice::vec2u position = draw_info.position;
-
-        while (it < end)
+        for (ice::vec4f const& vertex : layout.vertices)
         {
-            ice::u32 advance = 0;
-            ice::u32 const codepoint = ice::text_get_codepoint(it, advance);
-
-            it += advance;
-
-            for (ice::Glyph const& glyph : font->glyphs)
-            {
-                if (glyph.codepoint == codepoint)
-                {
-                    if (glyph.size.x > 0)
-                    {
-                        ice::vec2f const pos = {
-                            position.x + (glyph.offset.x * font_size),
-                            position.y - (glyph.offset.y * font_size)
-                        };
-
-                        ice::vec2f const size = {
-                            glyph.size.x * font_size,
-                            glyph.size.y * font_size
-                        };
-
-                        // TRI 1
-                        posuv_vertices[posuv_offset + 0].x = pos.x;
-                        posuv_vertices[posuv_offset + 0].y = pos.y;
-                        posuv_vertices[posuv_offset + 0].z = glyph.atlas_x;
-                        posuv_vertices[posuv_offset + 0].w = glyph.atlas_y;
-                        posuv_vertices[posuv_offset + 1].x = pos.x;
-                        posuv_vertices[posuv_offset + 1].y = pos.y + size.y;
-                        posuv_vertices[posuv_offset + 1].z = glyph.atlas_x;
-                        posuv_vertices[posuv_offset + 1].w = glyph.atlas_y + glyph.atlas_h;
-                        posuv_vertices[posuv_offset + 2].x = pos.x + size.x;
-                        posuv_vertices[posuv_offset + 2].y = pos.y + size.y;
-                        posuv_vertices[posuv_offset + 2].z = glyph.atlas_x + glyph.atlas_w;
-                        posuv_vertices[posuv_offset + 2].w = glyph.atlas_y + glyph.atlas_h;
-
-                        // TRI 1
-                        posuv_vertices[posuv_offset + 3].x = pos.x;
-                        posuv_vertices[posuv_offset + 3].y = pos.y;
-                        posuv_vertices[posuv_offset + 3].z = glyph.atlas_x;
-                        posuv_vertices[posuv_offset + 3].w = glyph.atlas_y;
-                        posuv_vertices[posuv_offset + 4].x = pos.x + size.x;
-                        posuv_vertices[posuv_offset + 4].y = pos.y + size.y;
-                        posuv_vertices[posuv_offset + 4].z = glyph.atlas_x + glyph.atlas_w;
-                        posuv_vertices[posuv_offset + 4].w = glyph.atlas_y + glyph.atlas_h;
-                        posuv_vertices[posuv_offset + 5].x = pos.x + size.x;
-                        posuv_vertices[posuv_offset + 5].y = pos.y;
-                        posuv_vertices[posuv_offset + 5].z = glyph.atlas_x + glyph.atlas_w;
-                        posuv_vertices[posuv_offset + 5].w = glyph.atlas_y;
-
-                        // Move by number of draw_vertices
-                        posuv_offset += 6;
-                    }
-
-                    position.x += ice::u32(glyph.advance * draw_info.font_size);
-                    break;
-                }
-            }
+            posuv_vertices[posuv_offset] = { vertex.x + origin.x, vertex.y + origin.y, vertex.z, vertex.w };
+            posuv_offset += 1;
         }
-
-        ICE_ASSERT(it == end, "Invalid utf8 string!");
     }
 
     auto IceWorldTrait_RenderGlyphs::load_font(
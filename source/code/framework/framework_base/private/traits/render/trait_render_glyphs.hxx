@@ -6,6 +6,7 @@
 #include <ice/game_render_traits.hxx>
 #include <ice/asset.hxx>
 #include <ice/font.hxx>
+#include <ice/font_layout_cache.hxx>
 
 namespace ice
 {
@@ -96,6 +97,7 @@ namespace ice
         };
 
         ice::HashMap<FontEntry, ContainerLogic::Complex> _fonts;
+        ice::TextLayoutCache _layout_cache;
 
         ice::render::Buffer _vertex_buffer;
 
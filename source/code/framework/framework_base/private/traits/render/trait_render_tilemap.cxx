@@ -210,8 +210,15 @@ namespace ice
     ) noexcept
         : _allocator{ alloc }
         , _render_cache{ _allocator }
+        , _chunk_slots{ _allocator, Constant_TileMapChunkSlotCount }
+        , _visible_chunks{ _allocator }
+        , _chunk_uploads{ _allocator }
+        , _chunk_draws{ _allocator }
     {
         ice::hashmap::reserve(_render_cache, 10);
+        ice::array::reserve(_visible_chunks, Constant_TileMapChunkSlotCount);
+        ice::array::reserve(_chunk_uploads, Constant_TileMapChunkSlotCount);
+        ice::array::reserve(_chunk_draws, Constant_TileMapChunkSlotCount);
     }
 
     void IceWorldTrait_RenderTilemap::on_activate(
@@ -482,7 +489,10 @@ namespace ice
 
 
         _vertex_buffer = device.create_buffer(BufferType::Vertex, 1024 * 1024 * 2);
-        _instance_buffer = device.create_buffer(BufferType::Vertex, 1024 * 1024 * 1);
+        _instance_buffer = device.create_buffer(
+            BufferType::Vertex,
+            sizeof(ice::Tile) * Constant_TileMapChunkSize * Constant_TileMapChunkSize * Constant_TileMapChunkSlotCount
+        );
     }
 
     void IceWorldTrait_RenderTilemap::gfx_cleanup(
@@ -557,6 +567,8 @@ namespace ice
                 update_resource_tilemap(gfx_ctx, *draw_operation->render_info);
             }
 
+            update_resource_chunks(gfx_ctx, engine_frame, *draw_operation->render_info);
+
             gfx_frame.set_stage_slot(ice::Constant_GfxStage_DrawTilemap, this);
         }
 
@@ -588,23 +600,15 @@ namespace ice
             1
         );
 
-        ice::u32 instance_offset = 0;
-        for (ice::IceTileLayer_RenderInfo const& layer : draw_operation->render_info->layers)
+        for (ice::IceTileMap_ChunkDraw const& chunk_draw : _chunk_draws)
         {
-            if (layer.visible)
-            {
-                ice::u32 const instance_count = ice::count(layer.tiles);
-
-                api.draw(
-                    cmds,
-                    4,
-                    instance_count,
-                    0,
-                    instance_offset
-                );
-
-                instance_offset += instance_count;
-            }
+            api.draw(
+                cmds,
+                4,
+                chunk_draw.instance_count,
+                0,
+                chunk_draw.instance_offset
+            );
         }
     }
 
@@ -628,8 +632,7 @@ namespace ice
         vertices[2] = Vertex{ .pos_and_uv = { ice::f32(tile_width) * 1, 0.f, 1.f, 1.f }, .index = vec1u{ 2 } };
         vertices[3] = Vertex{ .pos_and_uv = { ice::f32(tile_width) * 1, ice::f32(tile_height) * 1, 1.f, 0.f }, .index = vec1u{ 3 } };
 
-        ice::u32 update_count = 1;
-        ice::render::BufferUpdateInfo updates[6]{
+        ice::render::BufferUpdateInfo updates[]{
             ice::render::BufferUpdateInfo
             {
                 .buffer = _vertex_buffer,
@@ -637,25 +640,88 @@ namespace ice
             }
         };
 
-        ice::u32 instance_offset = 0;
-        for (ice::IceTileLayer_RenderInfo const& layer : tilemap_info.layers)
+        gfx_ctx.device().update_buffers(updates);
+
+        // A different tilemap, none of the cached chunks are valid anymore.
+        _chunk_slots.reset();
+        _last_tiles_version = tilemap_info.tiles_version;
+    }
+
+    void IceWorldTrait_RenderTilemap::update_resource_chunks(
+        ice::gfx::GfxContext& gfx_ctx,
+        ice::EngineFrame const& engine_frame,
+        ice::IceTileMap_RenderInfo const& tilemap_info
+    ) noexcept
+    {
+        IPT_ZONE_SCOPED_NAMED("[GfxTrait] TileMap :: Update chunks");
+
+        ice::TileMap const& tilemap = *tilemap_info.tilemap;
+        if (_last_tiles_version != tilemap_info.tiles_version)
         {
-            if (layer.visible)
+            _last_tiles_version = tilemap_info.tiles_version;
+            _chunk_slots.reset();
+        }
+
+        _chunk_slots.next_frame();
+
+        // Without camera data we cannot cull anything, so we select all chunks in the map.
+        ice::vec2f region_min{ 0.f };
+        ice::vec2f region_max{ std::numeric_limits<ice::f32>::max() };
+
+        ice::CameraData const* const camera_data = engine_frame.storage().named_object<ice::CameraData>(_render_camera);
+        if (camera_data != nullptr)
+        {
+            ice::tilemap_camera_region(*camera_data, region_min, region_max);
+        }
+
+        ice::array::clear(_visible_chunks);
+        for (ice::u32 layer_idx = 0; layer_idx < tilemap.layer_count; ++layer_idx)
+        {
+            if (tilemap_info.layers[layer_idx].visible)
             {
-                ice::u32 const instance_byte_offset = sizeof(Tile) * instance_offset;
+                ice::tilemap_query_chunks(tilemap, layer_idx, region_min, region_max, _visible_chunks);
+            }
+        }
 
-                instance_offset += ice::count(layer.tiles);
-                updates[update_count] = ice::render::BufferUpdateInfo
-                {
+        ice::u32 constexpr slot_tile_capacity = Constant_TileMapChunkSize * Constant_TileMapChunkSize;
+
+        ice::array::clear(_chunk_uploads);
+        ice::array::clear(_chunk_draws);
+        for (ice::u32 chunk_idx : _visible_chunks)
+        {
+            ice::TileChunk const& chunk = tilemap.chunks[chunk_idx];
+
+            bool needs_upload;
+            ice::u32 const slot_idx = _chunk_slots.acquire(chunk_idx, needs_upload);
+            if (slot_idx == ice::u32_max)
+            {
+                ICE_LOG(
+                    ice::LogSeverity::Warning, ice::LogTag::Engine,
+                    "Too many visible tilemap chunks, only {} chunks can be drawn at once.",
+                    Constant_TileMapChunkSlotCount
+                );
+                break;
+            }
+
+            if (needs_upload)
+            {
+                ice::array::push_back(_chunk_uploads, ice::render::BufferUpdateInfo{
                     .buffer = _instance_buffer,
-                    .data = ice::data_view(layer.tiles),
-                    .offset = instance_byte_offset,
-                };
-                update_count += 1;
+                    .data = ice::data_view(ice::Span{ tilemap.chunk_tiles + chunk.tile_offset, chunk.tile_count }),
+                    .offset = sizeof(ice::Tile) * slot_tile_capacity * slot_idx,
+                });
             }
+
+            ice::array::push_back(_chunk_draws, ice::IceTileMap_ChunkDraw{
+                .instance_offset = slot_tile_capacity * slot_idx,
+                .instance_count = chunk.tile_count,
+            });
         }
 
-        gfx_ctx.device().update_buffers({ updates, update_count });
+        if (ice::array::any(_chunk_uploads))
+        {
+            gfx_ctx.device().update_buffers(_chunk_uploads);
+        }
     }
 
     void IceWorldTrait_RenderTilemap::update_resource_camera(
@@ -6,6 +6,8 @@
 #include <ice/render/render_declarations.hxx>
 
 #include <ice/mem_data.hxx>
+#include <ice/container/array.hxx>
+#include <ice/container/hashmap.hxx>
 
 namespace ice
 {
@@ -16,13 +18,14 @@ namespace ice
     static constexpr ice::String Tilemap_VtxShader = "shaders/game2d/tiled-vtx";
     static constexpr ice::String Tilemap_PixShader = "shaders/game2d/tiled-pix";
 
+    static constexpr ice::u32 Constant_TileMapChunkSlotCount = 512;
+
     struct Tile;
     struct TileMap;
 
     struct IceTileLayer_RenderInfo
     {
         bool visible;
-        ice::Span<ice::Tile const> tiles;
     };
 
     struct IceTileMap_RenderInfo
@@ -30,6 +33,15 @@ namespace ice
         ice::vec2f tilesize;
         ice::TileMap const* tilemap;
         ice::IceTileLayer_RenderInfo layers[5];
+
+        //! \brief Bumped each time tiles of the tilemap change, invalidates all cached chunks.
+        ice::u32 tiles_version;
+    };
+
+    struct IceTileMap_ChunkDraw
+    {
+        ice::u32 instance_offset;
+        ice::u32 instance_count;
     };
 
     struct IceTileMap_RenderCache
@@ -95,6 +107,12 @@ namespace ice
             ice::IceTileMap_RenderInfo const& tilemap_info
         ) noexcept;
 
+        void update_resource_chunks(
+            ice::gfx::GfxContext& gfx_ctx,
+            ice::EngineFrame const& engine_frame,
+            ice::IceTileMap_RenderInfo const& tilemap_info
+        ) noexcept;
+
         void update_resource_camera(
             ice::gfx::GfxContext& gfx_ctx
         ) noexcept;
@@ -120,7 +138,15 @@ namespace ice
         ice::render::Buffer _instance_buffer;
 
         ice::TileMap const* _last_tilemap = nullptr;
+        ice::u32 _last_tiles_version = 0;
         ice::HashMap<ice::IceTileMap_RenderCache*> _render_cache;
+
+        //! \brief The instance buffer is split into slots each holding the tiles of a single chunk.
+        ice::TileMapChunkSlots _chunk_slots;
+
+        ice::Array<ice::u32> _visible_chunks;
+        ice::Array<ice::render::BufferUpdateInfo> _chunk_uploads;
+        ice::Array<ice::IceTileMap_ChunkDraw> _chunk_draws;
     };
 
 
@@ -0,0 +1,161 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "trait_spatial_index.hxx"
+#include <ice/game_entity.hxx>
+
+#include <ice/engine_frame.hxx>
+#include <ice/engine_types_mappers.hxx>
+#include <ice/shard_container.hxx>
+
+#include <ice/ecs/ecs_query.hxx>
+#include <ice/ecs/ecs_entity_operations.hxx>
+#include <cmath>
+
+namespace ice
+{
+
+    namespace detail
+    {
+
+        inline auto spatial_bounds_from_transform(ice::vec3f position, ice::vec2f scale) noexcept -> ice::SpatialBounds
+        {
+            ice::vec2f const half_extent{ std::abs(scale.x) * 0.5f, std::abs(scale.y) * 0.5f };
+            ice::vec2f const center{ position.x, position.y };
+            return { center - half_extent, center + half_extent };
+        }
+
+    } // namespace detail
+
+    auto IceWorldTrait_SpatialIndex2D::trait_descriptor() noexcept -> ice::TraitDescriptor const&
+    {
+        static ice::TraitDescriptor const descriptor{
+            .name = ice::TraitID_SpatialIndex2D,
+            .fn_factory = ice::detail::default_trait_factory<IceWorldTrait_SpatialIndex2D>,
+        };
+        return descriptor;
+    }
+
+    IceWorldTrait_SpatialIndex2D::IceWorldTrait_SpatialIndex2D(
+        ice::Allocator& alloc,
+        ice::TraitContext& context
+    ) noexcept
+        : ice::TraitSpatialIndex2D{ context }
+        , _grids{ { alloc, Constant_BaseCellSize }, { alloc, Constant_BaseCellSize } }
+        , _published{ 0 }
+        , _pending_ids{ alloc }
+        , _last_version{ 0 }
+    {
+        context.bind<&IceWorldTrait_SpatialIndex2D::on_update>();
+    }
+
+    auto IceWorldTrait_SpatialIndex2D::deactivate(
+        ice::WorldStateParams const& params
+    ) noexcept -> ice::Task<>
+    {
+        // Force a full rebuild if the world gets activated again.
+        _grids[0].clear();
+        _grids[1].clear();
+        ice::array::clear(_pending_ids);
+        _last_version = 0;
+        co_return;
+    }
+
+    auto IceWorldTrait_SpatialIndex2D::query_area(
+        ice::SpatialBounds const& area,
+        ice::Array<ice::ecs::Entity>& out_entities
+    ) const noexcept -> ice::ucount
+    {
+        ice::Array<ice::u32> ids{ *out_entities._allocator };
+        ice::ucount const result = spatial_index().query(area, ids);
+
+        ice::array::reserve(out_entities, ice::array::count(out_entities) + result);
+        for (ice::u32 const id : ids)
+        {
+            ice::array::push_back(out_entities, static_cast<ice::ecs::Entity>(id));
+        }
+        return result;
+    }
+
+    auto IceWorldTrait_SpatialIndex2D::spatial_index() const noexcept -> ice::SpatialHashGrid const&
+    {
+        return _grids[_published.load(std::memory_order_acquire)];
+    }
+
+    void IceWorldTrait_SpatialIndex2D::sync_back_grid() noexcept
+    {
+        ice::u32 const published = _published.load(std::memory_order_relaxed);
+        ice::SpatialHashGrid const& front = _grids[published];
+        ice::SpatialHashGrid& back = _grids[published ^ 1];
+
+        for (ice::u32 const id : _pending_ids)
+        {
+            if (front.contains(id))
+            {
+                back.update(id, front.bounds(id));
+            }
+            else
+            {
+                back.remove(id);
+            }
+        }
+        ice::array::clear(_pending_ids);
+    }
+
+    auto IceWorldTrait_SpatialIndex2D::on_update(
+        ice::EngineFrameUpdate const& params
+    ) noexcept -> ice::Task<>
+    {
+        // Anything written after this point will be picked up by the next update.
+        ice::u64 const current_version = entity_queries().query_provider().change_version();
+        ice::ecs::QueryChangedSince const changed_since{ _last_version };
+
+        // Readers only access the published grid, so we are free to modify the other one.
+        sync_back_grid();
+        ice::u32 const back_idx = _published.load(std::memory_order_relaxed) ^ 1;
+        ice::SpatialHashGrid& grid = _grids[back_idx];
+
+        // Entities moved to a different archetype might have lost their transform.
+        //  If not, they are added back below, since the destination block was stamped with a new version.
+        auto const remove_entity = [this, &grid](ice::ecs::Entity entity) noexcept
+        {
+            ice::u32 const id = static_cast<ice::u32>(entity);
+            if (grid.remove(id))
+            {
+                ice::array::push_back(_pending_ids, id);
+            }
+        };
+
+        ice::shards::inspect_each<ice::ecs::Entity>(params.frame.shards(), ice::ecs::Shard_EntityDestroyed, remove_entity);
+        ice::shards::inspect_each<ice::ecs::Entity>(params.frame.shards(), ice::ecs::Shard_EntityArchetypeChanged, remove_entity);
+
+        ice::ecs::Query query_static = co_await query<
+            ice::ecs::Entity,
+            ice::Transform2DStatic const&
+        >().synchronized_on(params.thread.tasks);
+
+        for (auto[entity, xform] : query_static.filtered(changed_since).for_each_entity())
+        {
+            ice::u32 const id = static_cast<ice::u32>(*entity);
+            grid.update(id, detail::spatial_bounds_from_transform(xform->position, xform->scale));
+            ice::array::push_back(_pending_ids, id);
+        }
+
+        ice::ecs::Query query_dynamic = co_await query<
+            ice::ecs::Entity,
+            ice::Transform2DDynamic const&
+        >().synchronized_on(params.thread.tasks);
+
+        for (auto[entity, xform] : query_dynamic.filtered(changed_since).for_each_entity())
+        {
+            ice::u32 const id = static_cast<ice::u32>(*entity);
+            grid.update(id, detail::spatial_bounds_from_transform(xform->position, xform->scale));
+            ice::array::push_back(_pending_ids, id);
+        }
+
+        _published.store(back_idx, std::memory_order_release);
+        _last_version = current_version;
+        co_return;
+    }
+
+} // namespace ice
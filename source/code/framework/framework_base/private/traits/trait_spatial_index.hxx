@@ -0,0 +1,57 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/game_spatial.hxx>
+#include <ice/world/world_trait_descriptor.hxx>
+#include <atomic>
+
+namespace ice
+{
+
+    class IceWorldTrait_SpatialIndex2D : public ice::TraitSpatialIndex2D
+    {
+    public:
+        //! \brief Size of the smallest grid cell, should be close to the common entity size.
+        static constexpr ice::f32 Constant_BaseCellSize = 1.f;
+
+        static auto trait_descriptor() noexcept -> ice::TraitDescriptor const&;
+
+        IceWorldTrait_SpatialIndex2D(
+            ice::Allocator& alloc,
+            ice::TraitContext& context
+        ) noexcept;
+
+        auto deactivate(
+            ice::WorldStateParams const& params
+        ) noexcept -> ice::Task<> override;
+
+        auto query_area(
+            ice::SpatialBounds const& area,
+            ice::Array<ice::ecs::Entity>& out_entities
+        ) const noexcept -> ice::ucount override;
+
+        auto spatial_index() const noexcept -> ice::SpatialHashGrid const& override;
+
+    protected:
+        auto on_update(
+            ice::EngineFrameUpdate const& params
+        ) noexcept -> ice::Task<>;
+
+    private:
+        //! \brief Brings the back grid up to date with changes applied to the published grid during the last update.
+        void sync_back_grid() noexcept;
+
+    private:
+        //! \brief The update writes into the grid not published to readers, and publishes it once finished.
+        ice::SpatialHashGrid _grids[2];
+        std::atomic<ice::u32> _published;
+
+        //! \brief Objects updated or removed in the published grid, replayed on the back grid before the next update.
+        ice::Array<ice::u32> _pending_ids;
+
+        //! \brief Change version of the entity storage at the start of the last update.
+        ice::u64 _last_version;
+    };
+
+} // namespace ice
@@ -17,52 +17,6 @@ namespace ice
 {
 
 #if 0
-    namespace detail
-    {
-
-        auto task_prepare_rendering_data(
-            ice::EngineFrame& frame,
-            ice::EngineRunner& runner,
-            ice::TileMap const& tilemap,
-            ice::IceTileMap_RenderInfo& render_info
-        ) noexcept -> ice::Task<>
-        {
-            ice::u32 const layer_count = tilemap.layer_count;
-            ice::Array<ice::Span<ice::Tile>> layer_tiles{ frame.allocator() };
-
-            {
-                IPT_ZONE_SCOPED_NAMED("[Trait] TileMap :: Prepare render memory");
-
-                ice::array::resize(layer_tiles, layer_count);
-
-                for (ice::u32 idx = 0; idx < layer_count; ++idx)
-                {
-                    ice::TileLayer const& layer = tilemap.layers[idx];
-                    ice::IceTileLayer_RenderInfo& layer_render_info = render_info.layers[idx];
-
-                    layer_tiles[idx] = frame.storage().create_named_span<ice::Tile>(layer.name, layer.tile_count);
-                    layer_render_info.tiles = layer_tiles[idx];
-                    layer_render_info.visible = true;
-                }
-            }
-
-            co_await runner.task_scheduler();
-
-            {
-                IPT_ZONE_SCOPED_NAMED("[Trait] TileMap :: Prepare render data");
-
-                for (ice::u32 idx = 0; idx < layer_count; ++idx)
-                {
-                    ice::TileLayer const& layer = tilemap.layers[idx];
-                    ice::Tile const* tiles = tilemap.tiles + layer.tile_offset;
-
-                    ice::memcpy(ice::begin(layer_tiles[idx]), tiles, layer.tile_count * sizeof(ice::Tile));
-                }
-            }
-        }
-
-    }
-
     IceWorldTrait_TileMap::IceWorldTrait_TileMap(
         ice::Allocator& alloc,
         ice::WorldTrait_Physics2D& trait_physics
@@ -70,6 +24,7 @@ namespace ice
         : _allocator{ alloc }
         , _physics{ trait_physics }
         , _tilemaps{ _allocator }
+        , _tiles_version{ 0 }
     {
     }
 
@@ -146,6 +101,9 @@ namespace ice
             }
         }
 
+        // Each loaded tilemap gets a new version, even if the same asset is loaded again.
+        _tiles_version += 1;
+        tilemap_info.tiles_version = _tiles_version;
         ice::array::push_back(_tilemaps, tilemap_info);
 
         ICE_ASSERT((physics_ids - tilemap_info.physics_ids) <= tilemap.map_collision_count, "Invalid number of collision objects created!");
@@ -199,14 +157,16 @@ namespace ice
         {
             ice::TileMapInstance& tilemap_info = _tilemaps[0];
 
+            // Tiles are read by the renderer directly from the loaded chunks, we only provide what should be visible.
             ice::IceTileMap_RenderInfo* render_info = frame.storage().create_named_object<ice::IceTileMap_RenderInfo>("tilemap.render-info"_sid);
             render_info->tilemap = tilemap_info.tilemap;
             render_info->tilesize = tilemap_info.tilemap->tile_size;
+            render_info->tiles_version = tilemap_info.tiles_version;
 
-            runner.execute_task(
-                detail::task_prepare_rendering_data(frame, runner, *tilemap_info.tilemap, *render_info),
-                EngineContext::LogicFrame
-            );
+            for (ice::u32 idx = 0; idx < tilemap_info.tilemap->layer_count; ++idx)
+            {
+                render_info->layers[idx].visible = true;
+            }
         }
     }
 
@@ -16,6 +16,9 @@ namespace ice
     {
         ice::TileMap const* tilemap;
         ice::PhysicsID* physics_ids;
+
+        //! \brief Version of the instance tiles, passed to the renderer so cached chunks are dropped when tiles change.
+        ice::u32 tiles_version;
     };
 
     class IceWorldTrait_TileMap : public ice::WorldTrait_TileMap
@@ -60,6 +63,7 @@ namespace ice
 
         ice::String _requested_tilemap;
         ice::Array<ice::TileMapInstance> _tilemaps;
+        ice::u32 _tiles_version;
     };
 
     class WorldTraitArchive;
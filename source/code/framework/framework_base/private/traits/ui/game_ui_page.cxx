@@ -134,6 +134,33 @@ namespace ice
             *font_ptr = font;
         }
 
+        bool element_uses_resource(
+            ice::ui::PageInfo const& page_info,
+            ice::ui::ElementInfo const& element_info,
+            ice::u32 resource_idx
+        ) noexcept
+        {
+            using ice::ui::DataSource;
+
+            ice::ui::DataRef text{ };
+            ice::ui::DataRef font{ };
+            if (element_info.type == ice::ui::ElementType::Button)
+            {
+                ice::ui::ButtonInfo const& button_info = page_info.data_buttons[element_info.type_data_i];
+                text = button_info.text;
+                font = button_info.font;
+            }
+            else if (element_info.type == ice::ui::ElementType::Label)
+            {
+                ice::ui::LabelInfo const& label_info = page_info.data_labels[element_info.type_data_i];
+                text = label_info.text;
+                font = label_info.font;
+            }
+
+            return (text.source == DataSource::ValueResource && text.source_i == resource_idx)
+                || (font.source == DataSource::ValueResource && page_info.fonts[font.source_i].resource_i == resource_idx);
+        }
+
     } // namespace detail
 
 
@@ -304,8 +331,9 @@ namespace ice
     void GameUI_Page::open(ice::vec2u canvas_size) noexcept
     {
         _current_canvas_size = { ice::f32(canvas_size.x), ice::f32(canvas_size.y) };
-        _current_flags |= Flags::ActionShow | Flags::StateDirtyLayout | Flags::StateDirtyStyle;
+        _current_flags |= Flags::ActionShow;
         _current_flags &= ~Flags::ActionHide;
+        set_dirty_layout();
     }
 
     void GameUI_Page::open_inside(
@@ -320,14 +348,15 @@ namespace ice
 
         _current_parent = parent_page;
         _current_parent_element = parent_element;
-        _current_flags |= Flags::ActionShow | Flags::StateDirtyLayout | Flags::StateDirtyStyle;
+        _current_flags |= Flags::ActionShow;
         _current_flags &= ~Flags::ActionHide;
+        set_dirty_layout();
     }
 
     void GameUI_Page::resize(ice::vec2u canvas_size) noexcept
     {
         _current_canvas_size = { ice::f32(canvas_size.x), ice::f32(canvas_size.y) };
-        _current_flags |= Flags::StateDirtyLayout | Flags::StateDirtyStyle;
+        set_dirty_layout();
     }
 
     void GameUI_Page::close() noexcept
@@ -350,6 +379,7 @@ namespace ice
         ice::ui::UIResourceData& resource = _resources[resource_idx];
         ICE_ASSERT(resource.info.type == ResourceType::String, "Trying to set incompatible value to resource!");
         ice::detail::resource_set_value(resource, string);
+        set_dirty_resource(resource_idx);
         return true;
     }
 
@@ -367,16 +397,36 @@ namespace ice
         ice::ui::UIResourceData& resource = _resources[resource_idx];
         ICE_ASSERT(resource.info.type == ResourceType::Font, "Trying to set incompatible value to resource!");
         ice::detail::resource_set_value(resource, font);
+        set_dirty_resource(resource_idx);
         return true;
     }
 
     void GameUI_Page::set_dirty_layout() noexcept
     {
+        // The root element subtree is the whole page.
+        _states[0].dirty |= GameUI_ElementDirty::Layout;
         _current_flags |= Flags::StateDirtyLayout;
     }
 
-    void GameUI_Page::set_dirty_style() noexcept
+    void GameUI_Page::set_dirty_layout(
+        ice::ui::Element const& element
+    ) noexcept
     {
+        ice::u16 const idx = ice::u16(&element - ice::span::data(_elements));
+        ICE_ASSERT(idx < ice::count(_elements), "Out of bounds!");
+
+        _states[ice::gameui_layout_root(_page->elements, idx)].dirty |= GameUI_ElementDirty::Layout;
+        _current_flags |= Flags::StateDirtyLayout;
+    }
+
+    void GameUI_Page::set_dirty_style(
+        ice::ui::Element const& element
+    ) noexcept
+    {
+        ice::u16 const idx = ice::u16(&element - ice::span::data(_elements));
+        ICE_ASSERT(idx < ice::count(_elements), "Out of bounds!");
+
+        _states[idx].dirty |= GameUI_ElementDirty::Style;
         _current_flags |= Flags::StateDirtyStyle;
     }
 
@@ -389,11 +439,23 @@ namespace ice
         ICE_ASSERT(idx < ice::count(_elements), "Out of bounds!");
         if (_elements[idx].state != state)
         {
-            set_dirty_style();
+            // State only affects the selected style, the layout stays the same.
+            set_dirty_style(_elements[idx]);
             _elements[idx].state = state;
         }
     }
 
+    void GameUI_Page::set_dirty_resource(ice::u32 resource_idx) noexcept
+    {
+        for (ice::ui::Element const& element : _elements)
+        {
+            if (ice::detail::element_uses_resource(*_page, *element.definition, resource_idx))
+            {
+                set_dirty_layout(element);
+            }
+        }
+    }
+
     auto GameUI_Page::update(
         ice::EngineRunner& runner
     ) noexcept -> ice::Task<>
@@ -507,11 +569,27 @@ namespace ice
             return false;
         };
 
+        auto const in_layout_pass = [this](ice::u32 idx) noexcept
+        {
+            return has_all(_states[idx].dirty, GameUI_ElementDirty::LayoutPass);
+        };
+
         IPT_ZONE_SCOPED;
         ice::u32 const count_elements = ice::count(_page->elements);
 
+        // Select all elements inside invalidated subtrees.
+        if (ice::gameui_select_layout_pass(_page->elements, _states))
+        {
+            _current_flags |= Flags::StateDirtyStyle;
+        }
+
         for (ice::u32 idx = 0; idx < count_elements; ++idx)
         {
+            if (in_layout_pass(idx) == false)
+            {
+                continue;
+            }
+
             ice::ui::ElementInfo const& current_element_data = _page->elements[idx];
             ice::ui::Element& current_element = _elements[idx];
             ice::ui::Element& parent_element = _elements[current_element_data.parent];
@@ -526,7 +604,11 @@ namespace ice
             );
         }
 
-        if (_current_parent == nullptr)
+        if (in_layout_pass(0) == false)
+        {
+            // Nothing to do for the root element
+        }
+        else if (_current_parent == nullptr)
         {
             _elements[0].flags = ElementFlags::None;
             _elements[0].bbox = ice::ui::Rect{
@@ -596,6 +678,11 @@ namespace ice
         // Calculate positions and some remaining sizes
         for (ice::u32 idx = 0; idx < count_elements; ++idx)
         {
+            if (in_layout_pass(idx) == false)
+            {
+                continue;
+            }
+
             ice::ui::Element& current_element = _elements[idx];
             ice::ui::Element& parent_element = _elements[current_element.definition->parent];
 
@@ -613,6 +700,11 @@ namespace ice
             contains_unresolved() == false,
             "UI sizes should be fully resolved!"
         );
+
+        for (ice::GameUI_ElementState& state : _states)
+        {
+            state.dirty &= ~GameUI_ElementDirty::LayoutPass;
+        }
         co_return;
     }
 
@@ -622,8 +714,16 @@ namespace ice
 
         IPT_ZONE_SCOPED;
 
+        ice::u32 idx = 0;
         for (ice::ui::Element const& element : _elements)
         {
+            ice::GameUI_ElementState& state = _states[idx++];
+            if (has_none(state.dirty, GameUI_ElementDirty::Style))
+            {
+                continue;
+            }
+            state.dirty &= ~GameUI_ElementDirty::Style;
+
             ice::ui::StyleColor const* color_data = nullptr;
             if (ice::ui::element_get_style(*_page, element, StyleFlags::TargetBackground, color_data))
             {
@@ -687,8 +787,6 @@ namespace ice
                             reinterpret_cast<ice::Font const*>(resupdate->resource_data)
                         );
                     }
-
-                    _current_flags |= Flags::StateDirtyLayout;
                 }
             }
         }
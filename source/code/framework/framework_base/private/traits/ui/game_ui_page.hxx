@@ -12,14 +12,11 @@
 #include <ice/font.hxx>
 #include <ice/task.hxx>
 
+#include "game_ui_page_layout.hxx"
+
 namespace ice
 {
 
-    struct GameUI_ElementState
-    {
-        ice::ui::UpdateResult update_result;
-    };
-
     class GameUI_Page
     {
     public:
@@ -81,8 +78,21 @@ namespace ice
             return false;
         }
 
+        //! \brief Invalidates the layout of the whole page.
         void set_dirty_layout() noexcept;
-        void set_dirty_style() noexcept;
+
+        //! \brief Invalidates the layout of the given element.
+        //! \details The invalidation is propagated up to the first ancestor whose size does not depend on it's children
+        //!   and that doesn't arrange it's children, only the subtree of that ancestor is laid out again.
+        //! \see ice::gameui_layout_root
+        void set_dirty_layout(
+            ice::ui::Element const& element
+        ) noexcept;
+
+        //! \brief Invalidates the draw data of the given element only.
+        void set_dirty_style(
+            ice::ui::Element const& element
+        ) noexcept;
 
         void set_element_state(
             ice::ui::Element const& element,
@@ -94,6 +104,9 @@ namespace ice
         ) noexcept -> ice::Task<>;
 
     private:
+        //! \brief Invalidates the layout of all elements displaying the given resource.
+        void set_dirty_resource(ice::u32 resource_idx) noexcept;
+
         auto update_layout() noexcept -> ice::Task<>;
         auto update_style() noexcept -> ice::Task<>;
         auto update_resources(ice::EngineFrame const& frame) noexcept -> ice::Task<>;
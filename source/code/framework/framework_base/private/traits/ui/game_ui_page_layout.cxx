@@ -0,0 +1,88 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "game_ui_page_layout.hxx"
+
+namespace ice
+{
+
+    namespace detail
+    {
+
+        bool gameui_has_stretched_children(
+            ice::Span<ice::ui::ElementInfo const> elements,
+            ice::u16 parent_idx
+        ) noexcept
+        {
+            using ice::ui::ElementFlags;
+
+            // Parents are always stored before their children.
+            for (ice::u32 idx = parent_idx + 1; idx < ice::count(elements); ++idx)
+            {
+                if (elements[idx].parent == parent_idx
+                    && has_any(elements[idx].flags, ElementFlags::Size_StretchWidth | ElementFlags::Size_StretchHeight))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    } // namespace detail
+
+    auto gameui_layout_root(
+        ice::Span<ice::ui::ElementInfo const> elements,
+        ice::u16 element_idx
+    ) noexcept -> ice::u16
+    {
+        using ice::ui::ElementFlags;
+        using ice::ui::ElementType;
+
+        while (element_idx != 0)
+        {
+            ice::u16 const parent_idx = elements[element_idx].parent;
+            ice::ui::ElementInfo const& parent_info = elements[parent_idx];
+
+            bool const parent_resizes = has_any(parent_info.flags, ElementFlags::Size_AutoWidth | ElementFlags::Size_AutoHeight);
+            bool const parent_arranges = parent_info.type == ElementType::LayoutV
+                || parent_info.type == ElementType::LayoutH
+                || ice::detail::gameui_has_stretched_children(elements, parent_idx);
+
+            if (parent_resizes == false && parent_arranges == false)
+            {
+                break;
+            }
+
+            element_idx = parent_idx;
+
+            // The parent keeps it's size, so only it's children need to be placed again.
+            if (parent_resizes == false)
+            {
+                break;
+            }
+        }
+        return element_idx;
+    }
+
+    bool gameui_select_layout_pass(
+        ice::Span<ice::ui::ElementInfo const> elements,
+        ice::Span<ice::GameUI_ElementState> states
+    ) noexcept
+    {
+        bool selected = false;
+        for (ice::u32 idx = 0; idx < ice::count(elements); ++idx)
+        {
+            ice::GameUI_ElementState& state = states[idx];
+            bool const parent_in_pass = idx != 0 && has_all(states[elements[idx].parent].dirty, GameUI_ElementDirty::LayoutPass);
+            if (parent_in_pass || has_all(state.dirty, GameUI_ElementDirty::Layout))
+            {
+                // Moved elements need their draw data updated too.
+                state.dirty |= GameUI_ElementDirty::LayoutPass | GameUI_ElementDirty::Style;
+                selected = true;
+            }
+            state.dirty &= ~GameUI_ElementDirty::Layout;
+        }
+        return selected;
+    }
+
+} // namespace ice
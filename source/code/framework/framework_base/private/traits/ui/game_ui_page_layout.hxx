@@ -0,0 +1,50 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/ui_element_info.hxx>
+#include <ice/ui_element.hxx>
+#include <ice/span.hxx>
+
+namespace ice
+{
+
+    enum class GameUI_ElementDirty : ice::u8
+    {
+        None = 0x00,
+
+        //! \brief The element is the root of a subtree that needs to be laid out again.
+        Layout = 0x01,
+
+        //! \brief The element draw data needs to be regenerated.
+        Style = 0x02,
+
+        //! \brief Set while 'update_layout' processes all elements inside invalidated subtrees.
+        LayoutPass = 0x04,
+
+        All = Layout | Style | LayoutPass
+    };
+
+    struct GameUI_ElementState
+    {
+        ice::ui::UpdateResult update_result;
+        ice::GameUI_ElementDirty dirty;
+    };
+
+    //! \returns Index of the element whose subtree needs to be laid out again after the given element changed it's size.
+    //! \details Walks up as long as the parent size is computed from it's children. A parent with a fixed size is
+    //!   still selected if it arranges it's children, either as a layout element or by having stretched children.
+    auto gameui_layout_root(
+        ice::Span<ice::ui::ElementInfo const> elements,
+        ice::u16 element_idx
+    ) noexcept -> ice::u16;
+
+    //! \brief Marks all elements inside subtrees with the 'Layout' flag for the next layout pass and clears the flag.
+    //! \note Elements selected for the layout pass also get their draw data invalidated.
+    //! \returns 'true' if at least one element was selected.
+    bool gameui_select_layout_pass(
+        ice::Span<ice::ui::ElementInfo const> elements,
+        ice::Span<ice::GameUI_ElementState> states
+    ) noexcept;
+
+} // namespace ice
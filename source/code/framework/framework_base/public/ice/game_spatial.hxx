@@ -0,0 +1,54 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/game_camera.hxx>
+#include <ice/spatial_hash_grid.hxx>
+#include <ice/world/world_trait.hxx>
+#include <ice/ecs/ecs_entity.hxx>
+
+namespace ice
+{
+
+    static constexpr ice::StringID TraitID_SpatialIndex2D = "iceshard/trait/spatial-index-2d"_sid;
+
+    //! \brief Spatial index of all entities with a 2D transform, shared by all traits of a world.
+    //!
+    //! \details Entity bounds are centered on the transform position and sized by the absolute transform scale.
+    //!   The index is updated during the logic update, only visiting data blocks where transforms where changed since the
+    //!   previous update. Entities destroyed or moved to an archetype without a transform are removed on the next update.
+    //!
+    //! \note The index is double buffered, readers always access the last published state. During the logic update this can
+    //!   be either the state of the previous update or, once the trait finished it's own update, the state of the current one.
+    //!   Returned references are valid until the end of the current frame.
+    //!
+    //! \example
+    //!   ice::TraitSpatialIndex2D const* spatial = static_cast<ice::TraitSpatialIndex2D const*>(
+    //!       world.trait(ice::TraitID_SpatialIndex2D)
+    //!   );
+    class TraitSpatialIndex2D : public ice::Trait
+    {
+    public:
+        using ice::Trait::Trait;
+
+        //! \brief Appends all entities with bounds overlapping the given area.
+        //! \returns Number of entities appended.
+        virtual auto query_area(
+            ice::SpatialBounds const& area,
+            ice::Array<ice::ecs::Entity>& out_entities
+        ) const noexcept -> ice::ucount = 0;
+
+        //! \returns The underlying index, objects are identified by the entity handle value.
+        virtual auto spatial_index() const noexcept -> ice::SpatialHashGrid const& = 0;
+    };
+
+    //! \returns Area visible trough the given ortographic camera on the XY plane, used for culling queries.
+    constexpr auto camera_visible_area(ice::Camera const& camera, ice::CameraOrtho const& ortho) noexcept -> ice::SpatialBounds
+    {
+        return ice::SpatialBounds{
+            .min = { camera.position.x + ortho.left_right.x, camera.position.y + ortho.bottom_top.x },
+            .max = { camera.position.x + ortho.left_right.y, camera.position.y + ortho.bottom_top.y },
+        };
+    }
+
+} // namespace ice
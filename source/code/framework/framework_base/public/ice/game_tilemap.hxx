@@ -4,6 +4,7 @@
 #pragma once
 #include <ice/math.hxx>
 #include <ice/span.hxx>
+#include <ice/container_types.hxx>
 #include <ice/shard.hxx>
 #include <ice/stringid.hxx>
 #include <ice/mem_unique_ptr.hxx>
@@ -20,6 +21,13 @@ namespace ice
     static constexpr ice::StringID Constant_TraitName_Tilemap
         = "ice.base-framework.trait-tilemap"_sid;
 
+    //! \brief Number of tiles along each edge of a single tilemap chunk.
+    //! \details Tile layers are split into square chunks when a tilemap is loaded, so only the chunks
+    //!   intersecting the visible region need to be uploaded and drawn.
+    static constexpr ice::u32 Constant_TileMapChunkSize = 32;
+
+    struct CameraData;
+
     enum class TileSetID : ice::u32
     {
         Invalid = 0xffff'ffff
@@ -51,6 +59,14 @@ namespace ice
         ice::u32 tile_count;
     };
 
+    struct TileChunk
+    {
+        ice::u32 layer_idx;
+        ice::vec2u position;
+        ice::u32 tile_offset;
+        ice::u32 tile_count;
+    };
+
     struct TileSet
     {
         ice::String asset;
@@ -73,6 +89,12 @@ namespace ice
         ice::TileObject const* objects;
         ice::TileCollision const* tile_collisions;
         ice::vec2f const* object_vertices;
+
+        //! \brief Non-empty chunks of all layers, sorted by layer, row and column.
+        //! \note Only available after the tilemap was loaded, baked tilemaps store zero chunks.
+        ice::u32 chunk_count;
+        ice::TileChunk const* chunks;
+        ice::Tile const* chunk_tiles;
     };
 
     class WorldTrait_Physics2D;
@@ -92,4 +114,49 @@ namespace ice
         ice::u16 tile_y
     ) noexcept -> ice::TileSetID;
 
+    //! \brief Calculates the world region visible through the given camera, projected onto the tilemap plane.
+    //! \returns 'false' if the camera matrices cannot be inverted.
+    bool tilemap_camera_region(
+        ice::CameraData const& camera,
+        ice::vec2f& out_region_min,
+        ice::vec2f& out_region_max
+    ) noexcept;
+
+    //! \brief Gathers indices of all chunks in the given layer intersecting the world region.
+    //! \returns Number of chunk indices pushed into 'out_chunks'.
+    auto tilemap_query_chunks(
+        ice::TileMap const& tilemap,
+        ice::u32 layer_idx,
+        ice::vec2f region_min,
+        ice::vec2f region_max,
+        ice::Array<ice::u32>& out_chunks
+    ) noexcept -> ice::ucount;
+
+    //! \brief Assigns tilemap chunks to a fixed number of slots (ex.: regions of a GPU instance buffer).
+    //! \details Slots keep their chunk over frames and are only reused for other chunks in least-recently-used order,
+    //!   so chunks staying visible don't need to be uploaded again.
+    class TileMapChunkSlots
+    {
+    public:
+        TileMapChunkSlots(ice::Allocator& alloc, ice::u32 slot_count) noexcept;
+
+        //! \brief Starts a new frame, slots acquired in the current frame cannot be reused until the next one.
+        void next_frame() noexcept;
+
+        //! \brief Releases all slots, needs to be called when the tilemap or its tiles changed.
+        void reset() noexcept;
+
+        //! \returns Slot holding the given chunk or 'ice::u32_max' if all slots are used by the current frame.
+        //! \param[out] out_needs_upload Set to 'true' if the slot was newly assigned and the chunk data needs to be uploaded.
+        auto acquire(ice::u32 chunk_idx, bool& out_needs_upload) noexcept -> ice::u32;
+
+        auto slot_count() const noexcept -> ice::u32;
+
+    private:
+        ice::u32 _current_frame;
+        ice::HashMap<ice::u32> _chunk_slots;
+        ice::Array<ice::u32> _slot_chunks;
+        ice::Array<ice::u32> _slot_last_frame;
+    };
+
 } // namespace ice
@@ -0,0 +1,187 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../private/traits/ui/game_ui_page_layout.hxx"
+
+#include <vector>
+
+namespace
+{
+
+    using ice::ui::ElementFlags;
+    using ice::ui::ElementType;
+
+    auto element(ice::u16 parent, ElementType type = ElementType::Any, ElementFlags flags = ElementFlags::None) noexcept
+    {
+        return ice::ui::ElementInfo{ .parent = parent, .type = type, .flags = flags };
+    }
+
+    //! \returns Indices of all elements selected for the layout pass, after invalidating the given elements.
+    auto layout_pass(
+        ice::Span<ice::ui::ElementInfo const> elements,
+        std::initializer_list<ice::u16> invalidated
+    ) noexcept -> std::vector<ice::u16>
+    {
+        std::vector<ice::GameUI_ElementState> states(ice::count(elements));
+        for (ice::u16 const idx : invalidated)
+        {
+            states[ice::gameui_layout_root(elements, idx)].dirty |= ice::GameUI_ElementDirty::Layout;
+        }
+
+        std::vector<ice::u16> result;
+        if (ice::gameui_select_layout_pass(elements, { states.data(), ice::ucount(states.size()) }))
+        {
+            for (ice::u16 idx = 0; idx < states.size(); ++idx)
+            {
+                CHECK(has_none(states[idx].dirty, ice::GameUI_ElementDirty::Layout));
+                if (has_all(states[idx].dirty, ice::GameUI_ElementDirty::LayoutPass))
+                {
+                    CHECK(has_all(states[idx].dirty, ice::GameUI_ElementDirty::Style));
+                    result.push_back(idx);
+                }
+            }
+        }
+        return result;
+    }
+
+} // namespace
+
+SCENARIO("framework_base 'GameUI page layout invalidation'", "[ui][layout]")
+{
+    GIVEN("elements inside fixed size parents")
+    {
+        // [0] page
+        //   [1] panel
+        //     [2] label
+        //     [3] label
+        //   [4] panel
+        //     [5] label
+        ice::ui::ElementInfo const elements[]{
+            element(0, ElementType::Page),
+            element(0),
+            element(1, ElementType::Label),
+            element(1, ElementType::Label),
+            element(0),
+            element(4, ElementType::Label),
+        };
+
+        THEN("only the invalidated element is laid out again")
+        {
+            CHECK(ice::gameui_layout_root(elements, 2) == 2);
+            CHECK(layout_pass(elements, { 2 }) == std::vector<ice::u16>{ 2 });
+        }
+
+        THEN("invalidating a parent selects it's whole subtree")
+        {
+            CHECK(layout_pass(elements, { 1 }) == std::vector<ice::u16>{ 1, 2, 3 });
+        }
+
+        THEN("separate subtrees are selected together")
+        {
+            CHECK(layout_pass(elements, { 3, 5 }) == std::vector<ice::u16>{ 3, 5 });
+        }
+
+        THEN("invalidating the root selects all elements")
+        {
+            CHECK(layout_pass(elements, { 0 }) == std::vector<ice::u16>{ 0, 1, 2, 3, 4, 5 });
+        }
+
+        THEN("nothing is selected without invalidated elements")
+        {
+            CHECK(layout_pass(elements, { }).empty());
+        }
+    }
+
+    GIVEN("elements inside auto sized parents")
+    {
+        // [0] page
+        //   [1] panel (fixed)
+        //     [2] panel (auto width)
+        //       [3] panel (auto height)
+        //         [4] label
+        //   [5] label
+        ice::ui::ElementInfo const elements[]{
+            element(0, ElementType::Page),
+            element(0),
+            element(1, ElementType::Any, ElementFlags::Size_AutoWidth),
+            element(2, ElementType::Any, ElementFlags::Size_AutoHeight),
+            element(3, ElementType::Label),
+            element(0, ElementType::Label),
+        };
+
+        THEN("the invalidation stops at the first parent with a fixed size")
+        {
+            CHECK(ice::gameui_layout_root(elements, 4) == 2);
+            CHECK(layout_pass(elements, { 4 }) == std::vector<ice::u16>{ 2, 3, 4 });
+        }
+    }
+
+    GIVEN("elements with stretched siblings")
+    {
+        // [0] page
+        //   [1] panel (fixed)
+        //     [2] label
+        //     [3] panel (stretch width)
+        //   [4] panel (fixed)
+        //     [5] label
+        //       [6] label (stretch height)
+        ice::ui::ElementInfo const elements[]{
+            element(0, ElementType::Page),
+            element(0),
+            element(1, ElementType::Label),
+            element(1, ElementType::Any, ElementFlags::Size_StretchWidth),
+            element(0),
+            element(4, ElementType::Label),
+            element(5, ElementType::Label, ElementFlags::Size_StretchHeight),
+        };
+
+        THEN("the parent of the stretched element is laid out again")
+        {
+            CHECK(ice::gameui_layout_root(elements, 2) == 1);
+            CHECK(layout_pass(elements, { 2 }) == std::vector<ice::u16>{ 1, 2, 3 });
+        }
+
+        THEN("the invalidation doesn't continue past the fixed size parent")
+        {
+            CHECK(ice::gameui_layout_root(elements, 1) == 1);
+        }
+
+        THEN("stretched elements don't affect the parents of their parent")
+        {
+            CHECK(ice::gameui_layout_root(elements, 6) == 5);
+            CHECK(layout_pass(elements, { 6 }) == std::vector<ice::u16>{ 5, 6 });
+        }
+    }
+
+    GIVEN("elements inside layouts")
+    {
+        // [0] page
+        //   [1] vertical layout (auto height)
+        //     [2] horizontal layout (fixed)
+        //       [3] label
+        //       [4] label
+        //     [5] label
+        ice::ui::ElementInfo const elements[]{
+            element(0, ElementType::Page),
+            element(0, ElementType::LayoutV, ElementFlags::Size_AutoHeight),
+            element(1, ElementType::LayoutH),
+            element(2, ElementType::Label),
+            element(2, ElementType::Label),
+            element(1, ElementType::Label),
+        };
+
+        THEN("the layout with a fixed size places it's children again")
+        {
+            CHECK(ice::gameui_layout_root(elements, 3) == 2);
+            CHECK(layout_pass(elements, { 3 }) == std::vector<ice::u16>{ 2, 3, 4 });
+        }
+
+        THEN("the auto sized layout is laid out again with all it's children")
+        {
+            CHECK(ice::gameui_layout_root(elements, 5) == 1);
+            CHECK(layout_pass(elements, { 5 }) == std::vector<ice::u16>{ 1, 2, 3, 4, 5 });
+        }
+    }
+}
@@ -0,0 +1,355 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/game_tilemap.hxx>
+#include <ice/asset_storage.hxx>
+#include <ice/asset_category_archive.hxx>
+#include <ice/resource_tracker.hxx>
+#include <ice/container/array.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/task_queue.hxx>
+#include <ice/task_scheduler.hxx>
+#include <ice/task_utils.hxx>
+
+#include "../private/asset/tilemap/asset_tilemap.hxx"
+
+#include <bit>
+#include <cstddef>
+#include <limits>
+
+namespace
+{
+
+    auto tile_at(ice::u32 x, ice::u32 y, ice::u16 tile = 0) noexcept -> ice::Tile
+    {
+        return ice::Tile{ .offset = (y << 16) | x, .tile_id = ice::make_tileset_id(0, 0, tile, 0) };
+    }
+
+    //! \brief A tilemap with two layers, the first one spanning 2x2 chunks with the top-right chunk being empty.
+    struct TestChunkedTileMap
+    {
+        ice::TileLayer layers[2]{
+            { .size = { 64, 40 }, .tile_offset = 0, .tile_count = 1 },
+            { .size = { 64, 40 }, .tile_offset = 1, .tile_count = 1 },
+        };
+
+        ice::TileChunk chunks[4]{
+            { .layer_idx = 0, .position = { 0, 0 } },
+            { .layer_idx = 0, .position = { 1, 0 } },
+            { .layer_idx = 0, .position = { 0, 1 } },
+            { .layer_idx = 1, .position = { 1, 1 } },
+        };
+
+        ice::TileMap tilemap{
+            .tile_size = { 2.f, 2.f },
+            .layer_count = 2,
+            .layers = layers,
+            .chunk_count = 4,
+            .chunks = chunks,
+        };
+    };
+
+    //! \brief A tilemap in the baked format, with all pointers stored as offsets from the start of the data.
+    struct TestBakedTileMap
+    {
+        ice::TileMap tilemap;
+        ice::TileLayer layers[2];
+        ice::Tile tiles[7];
+    };
+
+    auto baked_tilemap() noexcept -> TestBakedTileMap
+    {
+        TestBakedTileMap result{
+            .tilemap = {
+                .tile_size = { 1.f, 1.f },
+                .layer_count = 2,
+            },
+            .layers = {
+                { .size = { 40, 40 }, .tile_offset = 0, .tile_count = 5 },
+                { .size = { 10, 10 }, .tile_offset = 5, .tile_count = 2 },
+            },
+            .tiles = {
+                // Layer 0: two tiles in the last chunk, one in each of the first two and one outside of the layer.
+                tile_at(39, 39, 1), tile_at(3, 2, 2), tile_at(33, 0, 3), tile_at(40, 0, 4), tile_at(32, 32, 5),
+                // Layer 1: a single chunk with one tile outside of the layer.
+                tile_at(1, 1, 6), tile_at(10, 10, 7),
+            },
+        };
+
+        ice::usize const offset_data_end{ sizeof(TestBakedTileMap) };
+        result.tilemap.layers = std::bit_cast<ice::TileLayer const*>(ice::usize{ offsetof(TestBakedTileMap, layers) });
+        result.tilemap.tiles = std::bit_cast<ice::Tile const*>(ice::usize{ offsetof(TestBakedTileMap, tiles) });
+        result.tilemap.tilesets = std::bit_cast<ice::TileSet const*>(offset_data_end);
+        result.tilemap.objects = std::bit_cast<ice::TileObject const*>(offset_data_end);
+        result.tilemap.tile_collisions = std::bit_cast<ice::TileCollision const*>(offset_data_end);
+        result.tilemap.object_vertices = std::bit_cast<ice::vec2f const*>(offset_data_end);
+        return result;
+    }
+
+} // namespace
+
+SCENARIO("framework_base 'ice::tilemap_query_chunks'", "[tilemap][chunks]")
+{
+    ice::HostAllocator alloc{ };
+    ice::Array<ice::u32> found{ alloc };
+
+    // Chunks are 64x64 units in size, so the layer covers [0, 128) on both axes.
+    TestChunkedTileMap const test_map{ };
+    ice::TileMap const& tilemap = test_map.tilemap;
+
+    GIVEN("a region inside a single chunk")
+    {
+        THEN("only that chunk is returned")
+        {
+            REQUIRE(ice::tilemap_query_chunks(tilemap, 0, { 70.f, 10.f }, { 80.f, 20.f }, found) == 1);
+            CHECK(found[0] == 1);
+        }
+    }
+
+    GIVEN("a region covering the whole layer")
+    {
+        THEN("all non-empty chunks of the layer are returned in order")
+        {
+            REQUIRE(ice::tilemap_query_chunks(tilemap, 0, { 0.f, 0.f }, { 127.f, 127.f }, found) == 3);
+            CHECK(found[0] == 0);
+            CHECK(found[1] == 1);
+            CHECK(found[2] == 2);
+        }
+
+        THEN("chunks of other layers are not returned")
+        {
+            REQUIRE(ice::tilemap_query_chunks(tilemap, 1, { 0.f, 0.f }, { 127.f, 127.f }, found) == 1);
+            CHECK(found[0] == 3);
+        }
+    }
+
+    GIVEN("a region partially outside of the layer")
+    {
+        THEN("the region is clamped to the layer")
+        {
+            REQUIRE(ice::tilemap_query_chunks(tilemap, 0, { -500.f, 100.f }, { 10.f, 1000.f }, found) == 1);
+            CHECK(found[0] == 2);
+        }
+    }
+
+    GIVEN("an unbounded region")
+    {
+        constexpr ice::f32 max = std::numeric_limits<ice::f32>::max();
+        constexpr ice::f32 inf = std::numeric_limits<ice::f32>::infinity();
+
+        THEN("all non-empty chunks of the layer are returned")
+        {
+            CHECK(ice::tilemap_query_chunks(tilemap, 0, { -max, -max }, { max, max }, found) == 3);
+            CHECK(ice::tilemap_query_chunks(tilemap, 0, { -inf, -inf }, { inf, inf }, found) == 3);
+        }
+    }
+
+    GIVEN("a region not intersecting the layer")
+    {
+        constexpr ice::f32 nan = std::numeric_limits<ice::f32>::quiet_NaN();
+
+        THEN("no chunks are returned")
+        {
+            CHECK(ice::tilemap_query_chunks(tilemap, 0, { -20.f, -20.f }, { -10.f, -10.f }, found) == 0);
+            CHECK(ice::tilemap_query_chunks(tilemap, 0, { 128.f, 0.f }, { 200.f, 200.f }, found) == 0);
+            CHECK(ice::tilemap_query_chunks(tilemap, 0, { nan, nan }, { nan, nan }, found) == 0);
+            CHECK(ice::array::empty(found));
+        }
+    }
+
+    GIVEN("a region only covering an empty chunk")
+    {
+        THEN("no chunks are returned")
+        {
+            CHECK(ice::tilemap_query_chunks(tilemap, 0, { 70.f, 70.f }, { 80.f, 80.f }, found) == 0);
+        }
+    }
+
+    GIVEN("an array already holding chunk indices")
+    {
+        ice::array::push_back(found, 42u);
+
+        THEN("new indices are appended")
+        {
+            REQUIRE(ice::tilemap_query_chunks(tilemap, 1, { 0.f, 0.f }, { 127.f, 127.f }, found) == 1);
+            REQUIRE(ice::array::count(found) == 2);
+            CHECK(found[0] == 42);
+            CHECK(found[1] == 3);
+        }
+    }
+}
+
+SCENARIO("framework_base 'ice::TileMapChunkSlots'", "[tilemap][chunks]")
+{
+    ice::HostAllocator alloc{ };
+    ice::TileMapChunkSlots slots{ alloc, 2 };
+    REQUIRE(slots.slot_count() == 2);
+
+    bool needs_upload = false;
+
+    GIVEN("free slots")
+    {
+        slots.next_frame();
+
+        THEN("new chunks take a free slot and need to be uploaded")
+        {
+            ice::u32 const slot_a = slots.acquire(10, needs_upload);
+            CHECK(needs_upload);
+            ice::u32 const slot_b = slots.acquire(20, needs_upload);
+            CHECK(needs_upload);
+
+            CHECK(slot_a != ice::u32_max);
+            CHECK(slot_b != ice::u32_max);
+            CHECK(slot_a != slot_b);
+        }
+
+        THEN("chunks acquired again keep their slot and don't need to be uploaded")
+        {
+            ice::u32 const slot = slots.acquire(10, needs_upload);
+            slots.next_frame();
+
+            CHECK(slots.acquire(10, needs_upload) == slot);
+            CHECK(needs_upload == false);
+        }
+    }
+
+    GIVEN("all slots used in a previous frame")
+    {
+        slots.next_frame();
+        ice::u32 const slot_older = slots.acquire(10, needs_upload);
+        slots.next_frame();
+        ice::u32 const slot_newer = slots.acquire(20, needs_upload);
+        slots.next_frame();
+
+        THEN("the least recently used slot is reused")
+        {
+            CHECK(slots.acquire(30, needs_upload) == slot_older);
+            CHECK(needs_upload);
+
+            // The evicted chunk needs to be uploaded again.
+            CHECK(slots.acquire(10, needs_upload) == slot_newer);
+            CHECK(needs_upload);
+        }
+
+        THEN("using a chunk updates it's position in the reuse order")
+        {
+            CHECK(slots.acquire(10, needs_upload) == slot_older);
+            CHECK(needs_upload == false);
+
+            CHECK(slots.acquire(30, needs_upload) == slot_newer);
+            CHECK(needs_upload);
+        }
+    }
+
+    GIVEN("all slots used in the current frame")
+    {
+        slots.next_frame();
+        slots.acquire(10, needs_upload);
+        slots.acquire(20, needs_upload);
+
+        THEN("no slot is available for new chunks")
+        {
+            CHECK(slots.acquire(30, needs_upload) == ice::u32_max);
+            CHECK(needs_upload == false);
+        }
+
+        THEN("chunks already holding a slot can still be acquired")
+        {
+            CHECK(slots.acquire(20, needs_upload) != ice::u32_max);
+            CHECK(needs_upload == false);
+        }
+
+        WHEN("the slots are reset")
+        {
+            slots.reset();
+
+            THEN("all chunks need to be uploaded again")
+            {
+                CHECK(slots.acquire(10, needs_upload) != ice::u32_max);
+                CHECK(needs_upload);
+                CHECK(slots.acquire(30, needs_upload) != ice::u32_max);
+                CHECK(needs_upload);
+            }
+        }
+    }
+}
+
+SCENARIO("framework_base 'ice::asset_tilemap_loader' (chunks)", "[tilemap][chunks]")
+{
+    ice::HostAllocator alloc{ };
+
+    ice::UniquePtr<ice::ResourceTracker> tracker = ice::create_resource_tracker(
+        alloc, { .predicted_resource_count = 1, .io_dedicated_threads = 0 }
+    );
+
+    ice::TaskQueue queue{ };
+    ice::TaskScheduler scheduler{ queue };
+    ice::UniquePtr<ice::AssetStorage> storage = ice::create_asset_storage(
+        alloc,
+        ice::create_asset_category_archive(alloc),
+        ice::AssetStorageCreateInfo{ .resource_tracker = *tracker, .task_scheduler = scheduler, .task_flags = { } }
+    );
+
+    GIVEN("a baked tilemap")
+    {
+        TestBakedTileMap const baked = baked_tilemap();
+        ice::Config const meta;
+
+        ice::Memory loaded{ };
+        bool const result = ice::wait_for_result(
+            ice::asset_tilemap_loader(nullptr, alloc, *storage, meta, ice::data_view(baked), loaded)
+        );
+        REQUIRE(result);
+        REQUIRE(loaded.location != nullptr);
+
+        ice::TileMap const& tilemap = *reinterpret_cast<ice::TileMap const*>(loaded.location);
+
+        THEN("only non-empty chunks are created, sorted by layer, row and column")
+        {
+            REQUIRE(tilemap.chunk_count == 4);
+            CHECK(tilemap.chunks[0].layer_idx == 0);
+            CHECK((tilemap.chunks[0].position.x == 0 && tilemap.chunks[0].position.y == 0));
+            CHECK(tilemap.chunks[1].layer_idx == 0);
+            CHECK((tilemap.chunks[1].position.x == 1 && tilemap.chunks[1].position.y == 0));
+            CHECK(tilemap.chunks[2].layer_idx == 0);
+            CHECK((tilemap.chunks[2].position.x == 1 && tilemap.chunks[2].position.y == 1));
+            CHECK(tilemap.chunks[3].layer_idx == 1);
+            CHECK((tilemap.chunks[3].position.x == 0 && tilemap.chunks[3].position.y == 0));
+        }
+
+        THEN("chunks hold their tiles in a continuous range, in the original order")
+        {
+            REQUIRE(tilemap.chunk_count == 4);
+
+            ice::u32 tile_offset = 0;
+            for (ice::TileChunk const& chunk : ice::Span{ tilemap.chunks, tilemap.chunk_count })
+            {
+                CHECK(chunk.tile_offset == tile_offset);
+                tile_offset += chunk.tile_count;
+            }
+
+            // Tiles outside of their layer are dropped.
+            CHECK(tile_offset == 5);
+
+            CHECK(tilemap.chunks[0].tile_count == 1);
+            CHECK(tilemap.chunk_tiles[0].tile_id == baked.tiles[1].tile_id);
+            CHECK(tilemap.chunks[1].tile_count == 1);
+            CHECK(tilemap.chunk_tiles[1].tile_id == baked.tiles[2].tile_id);
+            CHECK(tilemap.chunks[2].tile_count == 2);
+            CHECK(tilemap.chunk_tiles[2].tile_id == baked.tiles[0].tile_id);
+            CHECK(tilemap.chunk_tiles[3].tile_id == baked.tiles[4].tile_id);
+            CHECK(tilemap.chunks[3].tile_count == 1);
+            CHECK(tilemap.chunk_tiles[4].tile_id == baked.tiles[5].tile_id);
+        }
+
+        THEN("the loaded chunks can be queried")
+        {
+            ice::Array<ice::u32> found{ alloc };
+            REQUIRE(ice::tilemap_query_chunks(tilemap, 0, { 33.f, 33.f }, { 34.f, 34.f }, found) == 1);
+            CHECK(found[0] == 2);
+        }
+
+        alloc.deallocate(loaded);
+    }
+}
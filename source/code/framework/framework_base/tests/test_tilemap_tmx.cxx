@@ -0,0 +1,313 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/asset_category_archive.hxx>
+#include <ice/game_tilemap.hxx>
+#include <ice/mem_allocator_host.hxx>
+
+#include "../private/asset/tilemap/asset_tilemap.hxx"
+#include "../private/asset/tilemap/asset_tilemap_oven_tmx_data.hxx"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+SCENARIO("framework_base 'TMX tilemap category'", "[tilemap][tmx]")
+{
+    ice::HostAllocator alloc{ };
+
+    GIVEN("an asset category archive with the tilemap category registered")
+    {
+        ice::UniquePtr<ice::AssetCategoryArchive> archive = ice::create_asset_category_archive(alloc);
+        ice::iceshard_register_tmx_tilemap_asset_category(*archive);
+
+        THEN("the TMX compiler was adopted by the archive")
+        {
+            ice::ResourceCompiler const* const compiler = archive->find_compiler(ice::AssetCategory_TileMap);
+            REQUIRE(compiler != nullptr);
+            CHECK(compiler->fn_compile_source == ice::asset_tilemap_oven_tmx);
+
+            ice::Span<ice::String const> const extensions = compiler->fn_supported_resources({});
+            REQUIRE(ice::span::count(extensions) == 1);
+            CHECK(extensions[0] == ".tmx");
+        }
+    }
+}
+
+SCENARIO("framework_base 'TMX layer CSV data'", "[tilemap][tmx]")
+{
+    ice::u32 gids[6]{ };
+
+    GIVEN("valid CSV data")
+    {
+        ice::Expected<ice::ucount> const result = ice::tmx_decode_csv("1,2,3,\r\n4, 5 ,\t4294967295\n", gids);
+
+        THEN("all values are decoded")
+        {
+            REQUIRE(result.succeeded());
+            CHECK(result.value() == 6);
+            CHECK(gids[0] == 1);
+            CHECK(gids[3] == 4);
+            CHECK(gids[4] == 5);
+            CHECK(gids[5] == ice::u32_max);
+        }
+    }
+
+    GIVEN("CSV data with more values than the output can hold")
+    {
+        ice::Expected<ice::ucount> const result = ice::tmx_decode_csv("1,2,3,4,5,6,7,8", gids);
+
+        THEN("all values are counted")
+        {
+            REQUIRE(result.succeeded());
+            CHECK(result.value() == 8);
+        }
+    }
+
+    GIVEN("invalid CSV data")
+    {
+        THEN("decoding fails")
+        {
+            CHECK(ice::tmx_decode_csv("1,2,x,4", gids).succeeded() == false);
+            CHECK(ice::tmx_decode_csv("1,-2,3", gids).succeeded() == false);
+            CHECK(ice::tmx_decode_csv("1,2.5,3", gids).succeeded() == false);
+            CHECK(ice::tmx_decode_csv("1,,3", gids).succeeded() == false);
+            CHECK(ice::tmx_decode_csv("4294967296", gids).succeeded() == false);
+        }
+    }
+}
+
+namespace
+{
+
+    // Tile GIDs '1, 2, 3, 4, 5, 6, 7' and '9' with the horizontal flip flag, stored as little-endian values.
+    static constexpr ice::u32 Constant_LayerGIDs[]{ 1, 2, 3, 4, 5, 6, 7, 0x8000'0009 };
+    static constexpr ice::String Constant_LayerBase64 = "AQAAAAIAAAADAAAABAAAAAUAAAAGAAAABwAAAAkAAIA=";
+    static constexpr ice::String Constant_LayerZlib = "eNpjZGBgYAJiZiBmAWJWIGYDYnYg5mRgaAAAAoQApg==";
+    static constexpr ice::String Constant_LayerGzip = "H4sIAAAAAAACA2NkYGBgAmJmIGYBYlYgZgNidiDmZGBoAAAJVVnyIAAAAA==";
+    static constexpr ice::String Constant_LayerZstd = "KLUv/SQgzQAAAkIFDNC1GgAAQCSU3d29U2Hwu71On8sjAPEXATE=";
+
+    //! \brief Encodes the data as base64, inserting a line break with indentation every 76 characters like TMX editors do.
+    auto encode_base64(ice::Data data) noexcept -> std::string
+    {
+        static constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        ice::u8 const* const bytes = reinterpret_cast<ice::u8 const*>(data.location);
+        std::string result;
+        for (ice::usize::base_type idx = 0; idx < data.size.value; idx += 3)
+        {
+            ice::usize::base_type const remaining = data.size.value - idx;
+            ice::u32 const group = (ice::u32(bytes[idx]) << 16)
+                | (remaining > 1 ? ice::u32(bytes[idx + 1]) << 8 : 0)
+                | (remaining > 2 ? ice::u32(bytes[idx + 2]) : 0);
+
+            result.push_back(alphabet[(group >> 18) & 0x3f]);
+            result.push_back(alphabet[(group >> 12) & 0x3f]);
+            result.push_back(remaining > 1 ? alphabet[(group >> 6) & 0x3f] : '=');
+            result.push_back(remaining > 2 ? alphabet[group & 0x3f] : '=');
+
+            if ((result.size() % 80) == 76)
+            {
+                result.append("\n    ");
+            }
+        }
+        return result;
+    }
+
+    auto decode_layer(ice::TMXLayerEncoding encoding, ice::String data, ice::Span<ice::u32> out_gids) noexcept
+    {
+        ice::u8 scratch[128]{ };
+        return ice::tmx_decode_layer_gids(encoding, data, ice::Memory{ scratch, ice::size_of<ice::u8> * 128, ice::ualign::b_1 }, out_gids);
+    }
+
+} // namespace
+
+SCENARIO("framework_base 'TMX layer encodings'", "[tilemap][tmx]")
+{
+    using ice::TMXLayerEncoding;
+
+    THEN("encodings are selected from the 'encoding' and 'compression' attributes")
+    {
+        CHECK(ice::tmx_layer_encoding("csv", "") == TMXLayerEncoding::CSV);
+        CHECK(ice::tmx_layer_encoding("base64", "") == TMXLayerEncoding::Base64);
+        CHECK(ice::tmx_layer_encoding("base64", "zlib") == TMXLayerEncoding::Base64_Zlib);
+        CHECK(ice::tmx_layer_encoding("base64", "gzip") == TMXLayerEncoding::Base64_Gzip);
+        CHECK(ice::tmx_layer_encoding("base64", "zstd") == TMXLayerEncoding::Base64_Zstd);
+        CHECK(ice::tmx_layer_encoding("csv", "zlib") == TMXLayerEncoding::Invalid);
+        CHECK(ice::tmx_layer_encoding("base64", "lz4") == TMXLayerEncoding::Invalid);
+        CHECK(ice::tmx_layer_encoding("xml", "") == TMXLayerEncoding::Invalid);
+    }
+}
+
+SCENARIO("framework_base 'TMX layer base64 data'", "[tilemap][tmx]")
+{
+    ice::u8 bytes[8]{ };
+    ice::Memory const out_bytes{ bytes, ice::size_of<ice::u8> * 8, ice::ualign::b_1 };
+
+    GIVEN("base64 data with and without padding")
+    {
+        THEN("all bytes are decoded")
+        {
+            ice::Expected<ice::usize> const result = ice::tmx_decode_base64("aWNlc2hhcmQ=", out_bytes);
+            REQUIRE(result.succeeded());
+            CHECK(result.value() == ice::size_of<ice::u8> * 8);
+            CHECK(std::memcmp(bytes, "iceshard", 8) == 0);
+
+            ice::Expected<ice::usize> const unpadded = ice::tmx_decode_base64("aWNl", out_bytes);
+            REQUIRE(unpadded.succeeded());
+            CHECK(unpadded.value() == ice::size_of<ice::u8> * 3);
+            CHECK(std::memcmp(bytes, "ice", 3) == 0);
+        }
+    }
+
+    GIVEN("base64 data with whitespace and line breaks")
+    {
+        ice::Expected<ice::usize> const result = ice::tmx_decode_base64("\n   aWNl\r\n\tc2hh cmQ=  \n", out_bytes);
+
+        THEN("the whitespace is ignored")
+        {
+            REQUIRE(result.succeeded());
+            CHECK(result.value() == ice::size_of<ice::u8> * 8);
+            CHECK(std::memcmp(bytes, "iceshard", 8) == 0);
+        }
+    }
+
+    GIVEN("malformed base64 data")
+    {
+        THEN("decoding fails")
+        {
+            CHECK(ice::tmx_decode_base64("aWNl*2hhcmQ=", out_bytes) == ice::E_InvalidArgument);
+            CHECK(ice::tmx_decode_base64("aWNlc2hh-mQ=", out_bytes) == ice::E_InvalidArgument);
+            CHECK(ice::tmx_decode_base64("aW=lc2hhcmQ", out_bytes) == ice::E_InvalidArgument);
+        }
+    }
+
+    GIVEN("base64 data larger than the output memory")
+    {
+        THEN("decoding fails")
+        {
+            CHECK(ice::tmx_decode_base64("aWNlc2hhcmQtZW5naW5l", out_bytes) == ice::E_OutOfRange);
+        }
+    }
+
+    GIVEN("a large layer spanning multiple lines")
+    {
+        std::vector<ice::u32> gids(64 * 64);
+        for (ice::u32 idx = 0; idx < gids.size(); ++idx)
+        {
+            gids[idx] = (idx * 2654435761u) ^ (idx << 7);
+        }
+
+        std::string const encoded = encode_base64(ice::Data{ gids.data(), ice::size_of<ice::u32> * gids.size(), ice::align_of<ice::u32> });
+        std::vector<ice::u32> decoded(gids.size() + 1);
+
+        WHEN("decoded into enough memory")
+        {
+            ice::Expected<ice::ucount> const result = ice::tmx_decode_layer_gids(
+                ice::TMXLayerEncoding::Base64, ice::String{ encoded }, { }, { decoded.data(), ice::ucount(decoded.size()) }
+            );
+
+            THEN("all values match")
+            {
+                REQUIRE(result.succeeded());
+                CHECK(result.value() == gids.size());
+                CHECK(std::memcmp(decoded.data(), gids.data(), gids.size() * sizeof(ice::u32)) == 0);
+            }
+        }
+
+        WHEN("decoded into less memory than required")
+        {
+            ice::Expected<ice::ucount> const result = ice::tmx_decode_layer_gids(
+                ice::TMXLayerEncoding::Base64, ice::String{ encoded }, { }, { decoded.data(), ice::ucount(gids.size() - 1) }
+            );
+
+            THEN("decoding fails")
+            {
+                CHECK(result == ice::E_OutOfRange);
+            }
+        }
+    }
+}
+
+SCENARIO("framework_base 'TMX layer compressed data'", "[tilemap][tmx]")
+{
+    using ice::TMXLayerEncoding;
+
+    ice::u32 gids[8]{ };
+
+    GIVEN("layer data in all supported encodings")
+    {
+        struct EncodedLayer
+        {
+            TMXLayerEncoding encoding;
+            ice::String data;
+        };
+
+        EncodedLayer const layers[]{
+            { TMXLayerEncoding::Base64, Constant_LayerBase64 },
+            { TMXLayerEncoding::Base64_Zlib, Constant_LayerZlib },
+            { TMXLayerEncoding::Base64_Gzip, Constant_LayerGzip },
+            { TMXLayerEncoding::Base64_Zstd, Constant_LayerZstd },
+        };
+
+        THEN("the same GIDs are decoded")
+        {
+            for (EncodedLayer const& layer : layers)
+            {
+                ice::u32 decoded[8]{ };
+                ice::Expected<ice::ucount> const result = decode_layer(layer.encoding, layer.data, decoded);
+                REQUIRE(result.succeeded());
+                CHECK(result.value() == 8);
+                CHECK(std::memcmp(decoded, Constant_LayerGIDs, sizeof(decoded)) == 0);
+            }
+        }
+
+        THEN("decoding into too little memory fails")
+        {
+            for (EncodedLayer const& layer : layers)
+            {
+                CHECK(decode_layer(layer.encoding, layer.data, { gids, 7 }) == ice::E_OutOfRange);
+            }
+        }
+    }
+
+    GIVEN("truncated compressed streams")
+    {
+        THEN("decoding fails")
+        {
+            // Dropping the last base64 group removes the stream checksum and end marker.
+            CHECK(decode_layer(TMXLayerEncoding::Base64_Zlib, ice::string::substr(Constant_LayerZlib, 0, 40), gids).failed());
+            CHECK(decode_layer(TMXLayerEncoding::Base64_Gzip, ice::string::substr(Constant_LayerGzip, 0, 52), gids).failed());
+            CHECK(decode_layer(TMXLayerEncoding::Base64_Zstd, ice::string::substr(Constant_LayerZstd, 0, 48), gids).failed());
+        }
+    }
+
+    GIVEN("corrupted compressed streams")
+    {
+        THEN("decoding fails")
+        {
+            CHECK(decode_layer(TMXLayerEncoding::Base64_Zstd, Constant_LayerZlib, gids) == ice::E_InvalidArgument);
+            CHECK(decode_layer(TMXLayerEncoding::Base64_Zlib, Constant_LayerZstd, gids) == ice::E_InvalidArgument);
+            CHECK(decode_layer(TMXLayerEncoding::Base64_Zlib, "AAAAAAAAAAAAAAAA", gids) == ice::E_InvalidArgument);
+        }
+    }
+
+    GIVEN("compressed data larger than the scratch memory")
+    {
+        THEN("decoding fails")
+        {
+            ice::u8 scratch[16]{ };
+            ice::Memory const small_scratch{ scratch, ice::size_of<ice::u8> * 16, ice::ualign::b_1 };
+            CHECK(ice::tmx_decode_layer_gids(TMXLayerEncoding::Base64_Zlib, Constant_LayerZlib, small_scratch, gids) == ice::E_OutOfRange);
+        }
+    }
+
+    GIVEN("an invalid encoding")
+    {
+        THEN("decoding fails")
+        {
+            CHECK(decode_layer(TMXLayerEncoding::Invalid, Constant_LayerBase64, gids) == ice::E_InvalidArgument);
+        }
+    }
+}
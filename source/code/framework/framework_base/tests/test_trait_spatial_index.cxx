@@ -0,0 +1,255 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/game_entity.hxx>
+#include <ice/engine_frame.hxx>
+#include <ice/engine_runner.hxx>
+#include <ice/world/world.hxx>
+#include <ice/world/world_trait_context.hxx>
+#include <ice/ecs/ecs_archetype_index.hxx>
+#include <ice/ecs/ecs_entity_index.hxx>
+#include <ice/ecs/ecs_entity_storage.hxx>
+#include <ice/ecs/ecs_entity_operations.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/task_queue.hxx>
+#include <ice/task_scheduler.hxx>
+#include <ice/task_utils.hxx>
+
+#include "../private/traits/trait_spatial_index.hxx"
+
+using ice::operator""_sid;
+
+namespace
+{
+
+    struct TestMarker
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.spatial-index.marker"_sid;
+        ice::u32 value;
+    };
+
+    class TestWorld final : public ice::World, public ice::TraitContext
+    {
+    public:
+        TestWorld(ice::Allocator& alloc, ice::ecs::ArchetypeIndex const& archetypes) noexcept
+            : _storage{ alloc, archetypes }
+            , _queries{ alloc, _storage }
+            , _operations{ alloc, _storage.entities(), archetypes }
+        {
+            _storage.update_archetypes();
+        }
+
+        // ice::World
+        auto activate(ice::WorldStateParams const&) noexcept -> ice::Task<> override { co_return; }
+        auto deactivate(ice::WorldStateParams const&) noexcept -> ice::Task<> override { co_return; }
+        auto trait(ice::StringID_Arg) noexcept -> ice::Trait* override { return nullptr; }
+        auto trait(ice::StringID_Arg) const noexcept -> ice::Trait const* override { return nullptr; }
+        auto trait_storage(ice::Trait*) noexcept -> ice::DataStorage* override { return nullptr; }
+        auto trait_storage(ice::Trait const*) const noexcept -> ice::DataStorage const* override { return nullptr; }
+        auto entities() noexcept -> ice::ecs::EntityIndex& override { return _storage.entities(); }
+        auto entity_queries() noexcept -> ice::ecs::QueryProvider const& override { return _storage; }
+        auto entity_queries_storage() noexcept -> ice::ecs::QueryStorage& override { return _queries; }
+        auto entity_operations() noexcept -> ice::ecs::EntityOperations& override { return _operations; }
+
+        // ice::TraitContext
+        auto world() noexcept -> ice::World& override { return *this; }
+        void send(ice::detail::TraitEvent) noexcept override { }
+        auto checkpoint(ice::StringID) noexcept -> ice::TaskCheckpointGate override { return { }; }
+        bool register_checkpoint(ice::StringID, ice::TaskCheckpoint&) noexcept override { return false; }
+        void unregister_checkpoint(ice::StringID, ice::TaskCheckpoint&) noexcept override { }
+        auto bind(ice::TraitTaskBinding const&) noexcept -> ice::Result override { return ice::S_Ok; }
+        void register_interface_selector(ice::InterfaceSelector*) noexcept override { }
+
+        //! \brief Executes all queued operations, pushing the resulting events into the given container.
+        void execute_operations(ice::ShardContainer& out_shards) noexcept
+        {
+            _storage.execute_operations(_operations, out_shards);
+            _operations.clear();
+        }
+
+    private:
+        ice::ecs::EntityStorage _storage;
+        ice::ecs::QueryStorage _queries;
+        ice::ecs::EntityOperations _operations;
+    };
+
+    class TestFrame final : public ice::EngineFrame
+    {
+    public:
+        TestFrame(ice::Allocator& alloc, TestWorld& world) noexcept
+            : _allocator{ alloc }
+            , _world{ world }
+            , _shards{ alloc }
+        { }
+
+        auto allocator() const noexcept -> ice::Allocator& override { return _allocator; }
+        auto index() const noexcept -> ice::u32 override { return 0; }
+        auto shards() noexcept -> ice::ShardContainer& override { return _shards; }
+        auto shards() const noexcept -> ice::ShardContainer const& override { return _shards; }
+        auto entity_index() noexcept -> ice::ecs::EntityIndex& override { return _world.entities(); }
+        auto entity_operations() noexcept -> ice::ecs::EntityOperations& override { return _world.entity_operations(); }
+        auto entity_operations() const noexcept -> ice::ecs::EntityOperations const& override { return _world.entity_operations(); }
+
+        // Frame data and tasks are not accessed by the spatial index.
+        auto data() noexcept -> ice::DataStorage& override { return *_data; }
+        auto data() const noexcept -> ice::DataStorage const& override { return *_data; }
+        auto tasks_container() noexcept -> ice::TaskContainer& override { return *_tasks; }
+
+    private:
+        ice::Allocator& _allocator;
+        TestWorld& _world;
+        ice::ShardContainer _shards;
+        ice::DataStorage* _data = nullptr;
+        ice::TaskContainer* _tasks = nullptr;
+    };
+
+    class TestSpatialIndex : public ice::IceWorldTrait_SpatialIndex2D
+    {
+    public:
+        using IceWorldTrait_SpatialIndex2D::IceWorldTrait_SpatialIndex2D;
+        using IceWorldTrait_SpatialIndex2D::on_update;
+    };
+
+    //! \brief Runs a single logic update of the trait, with storage events from the preceding operations.
+    void update_trait(TestSpatialIndex& trait, TestWorld& world, TestFrame& frame, ice::TaskQueue& queue) noexcept
+    {
+        ice::shards::clear(frame.shards());
+        world.execute_operations(frame.shards());
+
+        ice::TaskScheduler scheduler{ queue };
+        ice::EngineFrameUpdate const update{
+            .frame = frame,
+            .last_frame = frame,
+            .thread = { .main = scheduler, .tasks = scheduler, .gfx = scheduler },
+        };
+
+        ice::execute_task(trait.on_update(update));
+        queue.process_all();
+    }
+
+    auto transform_at(ice::f32 x, ice::f32 y) noexcept -> ice::Transform2DDynamic
+    {
+        return ice::Transform2DDynamic{ .position = { x, y, 0.f }, .scale = { 1.f, 1.f } };
+    }
+
+    //! \brief Moves the entity by writing to it's transform trough a query, stamping the data block with a new version.
+    void move_entity(TestWorld& world, ice::ecs::Entity entity, ice::f32 x, ice::f32 y) noexcept
+    {
+        auto const query = world.entity_queries_storage().build<ice::ecs::Entity, ice::Transform2DDynamic&>();
+        ice::ecs::query::for_each_entity(
+            query.query_object(),
+            query.filter_object(),
+            [&](ice::ecs::Entity queried, ice::Transform2DDynamic& xform) noexcept
+            {
+                if (queried == entity)
+                {
+                    xform.position = { x, y, 0.f };
+                }
+            }
+        );
+    }
+
+} // namespace
+
+SCENARIO("framework_base 'ice::TraitSpatialIndex2D'", "[trait][spatial_index]")
+{
+    ice::HostAllocator alloc{ };
+    ice::ecs::ArchetypeIndex archetypes{ alloc };
+
+    // The trait queries both transform types, so both need to be known to the storage.
+    archetypes.new_archetype<ice::Transform2DStatic>("static");
+    ice::ecs::Archetype const arch_dynamic = archetypes.new_archetype<ice::Transform2DDynamic>("dynamic");
+    ice::ecs::Archetype const arch_marker = archetypes.new_archetype<TestMarker>("marker");
+
+    TestWorld world{ alloc, archetypes };
+    TestFrame frame{ alloc, world };
+    ice::TaskQueue queue{ };
+
+    TestSpatialIndex trait{ alloc, world };
+    ice::SpatialBounds const area{ .min = { -10.f, -10.f }, .max = { 10.f, 10.f } };
+
+    ice::Array<ice::ecs::Entity> entities{ alloc };
+    ice::Transform2DDynamic const transforms[]{ transform_at(0.f, 0.f), transform_at(5.f, 5.f), transform_at(50.f, 50.f) };
+    world.entity_operations().create(arch_dynamic, 3)
+        .with_data(ice::Span<ice::Transform2DDynamic const>{ transforms })
+        .store(entities);
+
+    GIVEN("entities created before the first update")
+    {
+        ice::SpatialHashGrid const& published = trait.spatial_index();
+        CHECK(published.count() == 0);
+
+        update_trait(trait, world, frame, queue);
+
+        THEN("they are indexed once the update finished")
+        {
+            CHECK(trait.spatial_index().count() == 3);
+
+            ice::Array<ice::ecs::Entity> found{ alloc };
+            CHECK(trait.query_area(area, found) == 2);
+        }
+
+        THEN("the previously published state was not modified by the update")
+        {
+            CHECK(&published != &trait.spatial_index());
+            CHECK(published.count() == 0);
+        }
+
+        WHEN("an entity is destroyed")
+        {
+            world.entity_operations().destroy({ &entities[0], 1 });
+            update_trait(trait, world, frame, queue);
+
+            THEN("it's removed from the index")
+            {
+                CHECK(trait.spatial_index().contains(static_cast<ice::u32>(entities[0])) == false);
+                CHECK(trait.spatial_index().count() == 2);
+
+                ice::Array<ice::ecs::Entity> found{ alloc };
+                REQUIRE(trait.query_area(area, found) == 1);
+                CHECK(found[0] == entities[1]);
+            }
+
+            THEN("it stays removed after the grids are swapped again")
+            {
+                update_trait(trait, world, frame, queue);
+                CHECK(trait.spatial_index().contains(static_cast<ice::u32>(entities[0])) == false);
+                CHECK(trait.spatial_index().count() == 2);
+            }
+        }
+
+        WHEN("an entity is moved to an archetype without a transform")
+        {
+            world.entity_operations().set(arch_marker, ice::array::slice(entities, 1, 1)).with_data(TestMarker{ 42 });
+            update_trait(trait, world, frame, queue);
+
+            THEN("it's removed from the index")
+            {
+                CHECK(trait.spatial_index().contains(static_cast<ice::u32>(entities[1])) == false);
+                CHECK(trait.spatial_index().count() == 2);
+            }
+        }
+
+        WHEN("an entity is moved")
+        {
+            move_entity(world, entities[2], 1.f, 1.f);
+            update_trait(trait, world, frame, queue);
+
+            THEN("the published index holds the new bounds")
+            {
+                ice::Array<ice::ecs::Entity> found{ alloc };
+                CHECK(trait.query_area(area, found) == 3);
+            }
+
+            THEN("the bounds are kept after the grids are swapped again")
+            {
+                update_trait(trait, world, frame, queue);
+
+                ice::Array<ice::ecs::Entity> found{ alloc };
+                CHECK(trait.query_area(area, found) == 3);
+                CHECK(trait.spatial_index().bounds(static_cast<ice::u32>(entities[2])).min.x == 0.5f);
+            }
+        }
+    }
+}
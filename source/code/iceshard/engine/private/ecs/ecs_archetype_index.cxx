@@ -7,6 +7,7 @@
 #include <ice/assert.hxx>
 #include <ice/log.hxx>
 
+#include <mutex>
 #include <numeric>
 
 namespace ice::ecs
@@ -28,6 +29,24 @@ namespace ice::ecs
             return base_offset;
         }
 
+        //! \returns Hash identifying the given query requirements, used as a key for cached archetype matches.
+        auto query_signature(
+            ice::Span<ice::ecs::detail::QueryTypeInfo const> in_conditions,
+            ice::Span<ice::StringID const> in_required_tags
+        ) noexcept -> ice::u64
+        {
+            ice::u64 result = ice::hash_combine(ice::count(in_conditions), ice::count(in_required_tags));
+            for (ice::ecs::detail::QueryTypeInfo const& condition : in_conditions)
+            {
+                result = ice::hash_combine(result, ice::hash(condition.identifier) + ice::u64(condition.is_optional));
+            }
+            for (ice::StringID_Arg tag : in_required_tags)
+            {
+                result = ice::hash_combine(result, ice::hash(tag));
+            }
+            return result;
+        }
+
         bool contains_required_components(
             ice::Span<ice::ecs::detail::QueryTypeInfo const> in_conditions,
             ice::Span<ice::StringID const> in_required_tags,
@@ -97,6 +116,29 @@ namespace ice::ecs
             return result;
         }
 
+        //! \returns 'true' if an archetype with the given component identifiers is matched by the query.
+        bool archetype_matches_query(
+            ice::Span<ice::ecs::detail::QueryTypeInfo const> in_conditions,
+            ice::Span<ice::StringID const> in_required_tags,
+            ice::Span<ice::StringID const> archetype_identifiers
+        ) noexcept
+        {
+            ice::u32 required_type_count = ice::count(in_required_tags);
+            for (ice::ecs::detail::QueryTypeInfo const& condition : in_conditions)
+            {
+                required_type_count += ice::u32{ condition.is_optional == false };
+            }
+
+            if (ice::count(archetype_identifiers) < required_type_count)
+            {
+                return false;
+            }
+
+            // If we don't match any component in a full optional query, we still skip this archetype.
+            //  #todo: we should probably also check for the existance of the EntityHandle in the query. Then the check should be `> 1`
+            return contains_required_components(in_conditions, in_required_tags, archetype_identifiers);
+        }
+
     } // namespace detail
 
     template<typename T>
@@ -137,6 +179,38 @@ namespace ice::ecs
         }
     };
 
+    struct ArchetypeIndex::QueryMatchCache
+    {
+        //! \brief The full query, compared on each lookup since different queries can have the same signature.
+        ice::Array<ice::ecs::detail::QueryTypeInfo> query_info;
+        ice::Array<ice::StringID> query_tags;
+
+        ice::Array<ice::ecs::Archetype> matched_archetypes;
+
+        bool matches(
+            ice::Span<ice::ecs::detail::QueryTypeInfo const> other_info,
+            ice::Span<ice::StringID const> other_tags
+        ) const noexcept
+        {
+            if (ice::count(query_info) != ice::count(other_info) || ice::count(query_tags) != ice::count(other_tags))
+            {
+                return false;
+            }
+
+            bool result = true;
+            for (ice::u32 idx = 0; result && idx < ice::count(other_info); ++idx)
+            {
+                result = query_info[idx].identifier == other_info[idx].identifier
+                    && query_info[idx].is_optional == other_info[idx].is_optional;
+            }
+            for (ice::u32 idx = 0; result && idx < ice::count(other_tags); ++idx)
+            {
+                result = query_tags[idx] == other_tags[idx];
+            }
+            return result;
+        }
+    };
+
     static constexpr ice::u32 Constant_TotalMemoryUsedForArchetypeHeaders_KiB = ice::ecs::Constant_MaxArchetypeCount * sizeof(void*) / 1024;
 
     ArchetypeIndex::ArchetypeIndex(ice::Allocator& alloc) noexcept
@@ -145,6 +219,8 @@ namespace ice::ecs
         , _archetype_index{ _allocator }
         , _archetype_names_index{ _allocator }
         , _archetype_data{ _allocator }
+        , _query_cache_mutex{ }
+        , _query_cache{ _allocator }
     {
         ice::array::reserve(_archetype_data, ice::ecs::Constant_MaxArchetypeCount);
         ice::array::push_back(_archetype_data, nullptr);
@@ -152,6 +228,11 @@ namespace ice::ecs
 
     ArchetypeIndex::~ArchetypeIndex() noexcept
     {
+        for (QueryMatchCache* cache : _query_cache)
+        {
+            _allocator.destroy(cache);
+        }
+
         for (ArchetypeDataHeader* header : ice::array::slice(_archetype_data, 1))
         {
             ice::usize const size = ArchetypeDataHeader::calculate_meminfo(header->archetype_name, header->archetype_info);
@@ -176,6 +257,9 @@ namespace ice::ecs
         ice::ecs::detail::DataBlockPool* data_block_pool
     ) noexcept -> ice::ecs::Archetype
     {
+        // Queries might be resolved on other threads while we register new archetypes.
+        std::unique_lock<std::shared_mutex> lk{ _query_cache_mutex };
+
         if (ice::hashmap::has(_archetype_index, ice::hash(archetype_info.identifier)))
         {
             ICE_LOG(
@@ -308,6 +392,21 @@ namespace ice::ecs
             ice::hashmap::set(_archetype_names_index, ice::hash(data_header->archetype_name), archetype_index);
         }
 
+        // Cached queries only need to be checked against the new archetype, all others where already matched.
+        for (QueryMatchCache* cache : _query_cache)
+        {
+            bool const was_matched = ice::ecs::detail::archetype_matches_query(
+                cache->query_info,
+                cache->query_tags,
+                data_header->archetype_info.component_identifiers
+            );
+
+            if (was_matched)
+            {
+                ice::array::push_back(cache->matched_archetypes, archetype_info.identifier);
+            }
+        }
+
         return archetype_info.identifier;
     }
 
@@ -357,30 +456,65 @@ namespace ice::ecs
             "An query without any required components or tags might impact performance as it will check every archetype possible for a match."
         );
 
-        ice::u32 const total_required_type_count = required_component_count + required_tag_count;
-        for (ArchetypeDataHeader const* entry : ice::array::slice(_archetype_data, 1))
-        {
-            ice::ecs::detail::ArchetypeInstanceInfo const& archetype_info = entry->archetype_info;
+        ice::u64 const signature = ice::ecs::detail::query_signature(query_info, query_tags);
 
-            ice::u32 const archetype_component_count = ice::count(archetype_info.component_identifiers);
-            if (archetype_component_count < total_required_type_count)
+        {
+            std::shared_lock<std::shared_mutex> lk{ _query_cache_mutex };
+            if (QueryMatchCache const* cache = find_query_cache(signature, query_info, query_tags); cache != nullptr)
             {
-                continue;
+                ice::array::push_back(out_archetypes, cache->matched_archetypes);
+                return;
             }
+        }
 
-            bool const was_matched = ice::ecs::detail::contains_required_components(
+        std::unique_lock<std::shared_mutex> lk{ _query_cache_mutex };
+
+        // The same query might have been resolved by another thread before we acquired the lock.
+        if (QueryMatchCache const* cache = find_query_cache(signature, query_info, query_tags); cache != nullptr)
+        {
+            ice::array::push_back(out_archetypes, cache->matched_archetypes);
+            return;
+        }
+
+        QueryMatchCache* const cache = _allocator.create<QueryMatchCache>(
+            ice::Array<ice::ecs::detail::QueryTypeInfo>{ _allocator },
+            ice::Array<ice::StringID>{ _allocator },
+            ice::Array<ice::ecs::Archetype>{ _allocator }
+        );
+        ice::array::push_back(cache->query_info, query_info);
+        ice::array::push_back(cache->query_tags, query_tags);
+        ice::multi_hashmap::insert(_query_cache, signature, cache);
+
+        // Skip the first entry, it's always 'nullptr'
+        for (ArchetypeDataHeader const* entry : ice::array::slice(_archetype_data, 1))
+        {
+            bool const was_matched = ice::ecs::detail::archetype_matches_query(
                 query_info,
                 query_tags,
-                archetype_info.component_identifiers
+                entry->archetype_info.component_identifiers
             );
 
-            // If we don't match any component in a full optional query, we still skip this archetype.
-            //  #todo: we should probably also check for the existance of the EntityHandle in the query. Then the check should be `> 1`
             if (was_matched)
             {
-                ice::array::push_back(out_archetypes, entry->archetype_identifier);
+                ice::array::push_back(cache->matched_archetypes, entry->archetype_identifier);
             }
         }
+
+        ice::array::push_back(out_archetypes, cache->matched_archetypes);
+    }
+
+    auto ArchetypeIndex::find_query_cache(
+        ice::u64 signature,
+        ice::Span<ice::ecs::detail::QueryTypeInfo const> query_info,
+        ice::Span<ice::StringID const> query_tags
+    ) const noexcept -> QueryMatchCache*
+    {
+        auto it = ice::multi_hashmap::find_first(_query_cache, signature);
+        while (it != nullptr && it.value()->matches(query_info, query_tags) == false)
+        {
+            it = ice::multi_hashmap::find_next(_query_cache, it);
+        }
+        return it != nullptr ? it.value() : nullptr;
     }
 
     void ArchetypeIndex::fetch_archetype_instance_infos(
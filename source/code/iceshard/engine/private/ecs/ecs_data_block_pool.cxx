@@ -62,13 +62,23 @@ namespace ice::ecs::detail
 
         if (free_block == nullptr)
         {
-            ice::usize filter_data_size = info.data_block_filter.data_size;
-
             void* block_data = _allocator.allocate({ Constant_DefaultBlockSize, ice::align_of<DataBlock> }).memory;
             free_block = reinterpret_cast<DataBlock*>(block_data);
-            free_block->block_data_size = ice::usize::subtract(provided_block_size(), filter_data_size);
-            free_block->block_filter_data = filter_data_size > 0_B ? (free_block + 1) : nullptr;
-            free_block->block_data = ice::ptr_add(free_block + 1, filter_data_size);// free_block + 1;
+        }
+
+        // Released blocks can be reused by a different archetype, so we always recalculate the layout.
+        //  [DataBlock][component versions][filter data][component data]
+        ice::usize const versions_size = ice::ecs::detail::calculate_block_versions_size(info);
+        ice::usize const filter_data_size = info.data_block_filter.data_size;
+
+        free_block->block_data_size = ice::usize::subtract(provided_block_size(), versions_size + filter_data_size);
+        free_block->block_component_versions = reinterpret_cast<ice::u64*>(free_block + 1);
+        free_block->block_filter_data = filter_data_size > 0_B ? ice::ptr_add(free_block + 1, versions_size) : nullptr;
+        free_block->block_data = ice::ptr_add(free_block + 1, versions_size + filter_data_size);
+
+        for (ice::u32 idx = 0; idx < ice::span::count(info.component_identifiers); ++idx)
+        {
+            free_block->block_component_versions[idx] = 0;
         }
 
         free_block->block_entity_count_max = ice::ecs::detail::calculate_entity_count_for_space(info, provided_block_size());
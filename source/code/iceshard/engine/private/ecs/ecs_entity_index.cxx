@@ -5,6 +5,7 @@
 #include <ice/container/array.hxx>
 #include <ice/container/queue.hxx>
 #include <ice/assert.hxx>
+#include <ice/log.hxx>
 
 namespace ice::ecs
 {
@@ -161,4 +162,63 @@ namespace ice::ecs
         return false;
     }
 
+    auto EntityIndex::generations() const noexcept -> ice::Span<ice::u8 const>
+    {
+        return ice::array::slice(_generation);
+    }
+
+    void EntityIndex::free_indices(ice::Array<ice::u32>& out_indices) const noexcept
+    {
+        ice::array::reserve(out_indices, ice::array::count(out_indices) + ice::queue::count(_free_indices));
+        ice::queue::for_each(_free_indices, [&out_indices](ice::u32 index) noexcept
+            {
+                ice::array::push_back(out_indices, index);
+            }
+        );
+    }
+
+    bool EntityIndex::restore(
+        ice::Span<ice::u8 const> generations,
+        ice::Span<ice::u32 const> free_indices
+    ) noexcept
+    {
+        ice::u32 const generation_count = ice::span::count(generations);
+        if (generation_count > _max_entity_count)
+        {
+            ICE_LOG(
+                LogSeverity::Error, LogTag::Engine,
+                "Restored entity count is higher than the maximum allowed number of entities! [ restored: {}, maximum: {} ]",
+                generation_count,
+                _max_entity_count
+            );
+            return false;
+        }
+
+        if (generation_count == 0 || ice::span::front(generations) != ice::u8_max)
+        {
+            ICE_LOG(LogSeverity::Error, LogTag::Engine, "Restored generations are missing the 'Invalid' entity!");
+            return false;
+        }
+
+        for (ice::u32 const index : free_indices)
+        {
+            if (index == 0 || index >= generation_count)
+            {
+                ICE_LOG(LogSeverity::Error, LogTag::Engine, "Restored free index {} is out of range!", index);
+                return false;
+            }
+        }
+
+        ice::array::clear(_generation);
+        ice::array::push_back(_generation, generations);
+
+        // Pushing an empty span is not supported by queues without any capacity.
+        ice::queue::clear(_free_indices);
+        if (ice::span::any(free_indices))
+        {
+            ice::queue::push_back(_free_indices, free_indices);
+        }
+        return true;
+    }
+
 } // namespace ice::ecs
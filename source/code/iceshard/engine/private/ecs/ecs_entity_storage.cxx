@@ -58,6 +58,19 @@ namespace ice::ecs
             }
         }
 
+        void stamp_block_versions(
+            ice::ecs::detail::DataBlock& block,
+            ice::ecs::detail::ArchetypeInstanceInfo const& info,
+            ice::u64 version
+        ) noexcept
+        {
+            ice::u32 const component_count = ice::span::count(info.component_identifiers);
+            for (ice::u32 idx = 0; idx < component_count; ++idx)
+            {
+                block.block_component_versions[idx] = version;
+            }
+        }
+
 #if 0
         auto get_block(
             ice::ecs::EntityDataSlot slot_info,
@@ -319,7 +332,8 @@ namespace ice::ecs
             ice::HashMap<ice::ecs::detail::EntityDestructor> const& destructors,
             ice::Span<ice::ecs::EntityDataSlot> data_slots,
             ice::Span<ice::ecs::Entity const> entities_to_remove,
-            ice::Span<ice::ecs::detail::DataBlock*> data_blocks
+            ice::Span<ice::ecs::detail::DataBlock*> data_blocks,
+            ice::u64 change_version
         ) noexcept
         {
             auto const* it = ice::span::begin(entities_to_remove);
@@ -484,6 +498,8 @@ namespace ice::ecs
                         src_data_details, /* src data block */
                         del_data_details /* dst data block */
                     );
+
+                    ice::ecs::detail::stamp_block_versions(*archetype_block, *archetype_infos[0], change_version);
                 }
 
                 // Remove entity count from the block we moved from (we can just forget the data existed)
@@ -560,6 +576,7 @@ namespace ice::ecs
         , _data_blocks{ _allocator }
         , _data_slots{ _allocator }
         , _destructors{ _allocator }
+        , _change_version{ 0 }
     {
         ice::array::reserve(_head_blocks, 100); // 100 archetypes should suffice for now
         ice::array::resize(_data_slots, Constant_InitialEntityCount);
@@ -567,15 +584,20 @@ namespace ice::ecs
 
     EntityStorage::~EntityStorage() noexcept
     {
-        using ice::ecs::detail::DataBlock;
-        using ice::ecs::detail::DataBlockPool;
-        using ice::ecs::detail::ArchetypeInstance;
-
         for (ice::ecs::QueryAccessTracker* tracker : ice::hashmap::values(_access_trackers))
         {
             _allocator.destroy(tracker);
         }
 
+        release_data_blocks();
+    }
+
+    void EntityStorage::release_data_blocks() noexcept
+    {
+        using ice::ecs::detail::DataBlock;
+        using ice::ecs::detail::DataBlockPool;
+        using ice::ecs::detail::ArchetypeInstance;
+
         ice::u32 block_idx = 0;
         for (DataBlock* const data_block : _data_blocks)
         {
@@ -595,6 +617,8 @@ namespace ice::ecs
                     block_pool->release_block(block_it);
                     block_it = next_block;
                 }
+
+                data_block->next = nullptr;
             }
 
             block_idx += 1;
@@ -640,6 +664,8 @@ namespace ice::ecs
         {
             DataBlock* head_block = ice::addressof(_head_blocks[idx]);
             head_block->block_data = nullptr;
+            head_block->block_filter_data = nullptr;
+            head_block->block_component_versions = nullptr;
             head_block->block_data_size = 0_B;
             head_block->block_entity_count = 0;
             head_block->block_entity_count_max = 0;
@@ -724,6 +750,9 @@ namespace ice::ecs
             ICE_ASSERT_CORE(final_counter_exec == final_counter_next);
         }
 
+        // All blocks modified by operations are stamped with the same version.
+        ice::u64 const change_version = acquire_change_version();
+
         for (EntityOperation const& operation : operations)
         {
             if (operation.entity_count == 0)
@@ -981,12 +1010,19 @@ namespace ice::ecs
 
                             // Remove entity count from the block we moved from (we can just forget the data existed)
                             data_block_it_2->block_entity_count -= 1;
+                            ice::ecs::detail::stamp_block_versions(*data_block_it_2, *src_instance_info[0], change_version);
+
+                            if (src_instance_idx != dst_instance_idx)
+                            {
+                                ice::shards::push_back(out_shards, ice::ecs::Shard_EntityArchetypeChanged | ice::span::front(entities));
+                            }
                         }
 
                         // Update the remianing count
                         processed_count += entities_stored;
                         remaining_count -= entities_stored;
                         data_block_it->block_entity_count += entities_stored;
+                        ice::ecs::detail::stamp_block_versions(*data_block_it, *dst_instance_info, change_version);
                     }
 
                     // Get the next block
@@ -1057,6 +1093,8 @@ namespace ice::ecs
                         provided_data_details, /* src data block */
                         src_data_details /* dst data block */
                     );
+
+                    ice::ecs::detail::stamp_block_versions(*data_block_it, *src_instance_info[0], change_version);
                 }
                 else
                 {
@@ -1074,8 +1112,14 @@ namespace ice::ecs
                         _destructors,
                         _data_slots,
                         entities,
-                        _data_blocks
+                        _data_blocks,
+                        change_version
                     );
+
+                    for (ice::ecs::Entity const entity : entities)
+                    {
+                        ice::shards::push_back(out_shards, ice::ecs::Shard_EntityDestroyed | entity);
+                    }
                 }
             }
             else
@@ -1142,6 +1186,16 @@ namespace ice::ecs
         return true; // TODO: Check if we actually found an archetype.
     }
 
+    auto EntityStorage::change_version() const noexcept -> ice::u64
+    {
+        return _change_version.load(std::memory_order_relaxed);
+    }
+
+    auto EntityStorage::acquire_change_version() const noexcept -> ice::u64
+    {
+        return _change_version.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
     void EntityStorage::query_internal(
         ice::Span<ice::ecs::detail::QueryTypeInfo const> query_info,
         ice::Span<ice::StringID const> query_tags,
@@ -0,0 +1,540 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <ice/ecs/ecs_entity_storage.hxx>
+#include <ice/ecs/ecs_archetype_index.hxx>
+#include <ice/container/array.hxx>
+#include <ice/mem_utils.hxx>
+#include <ice/profiler.hxx>
+#include <ice/assert.hxx>
+#include <ice/log.hxx>
+
+namespace ice::ecs
+{
+
+    namespace detail
+    {
+
+        //! \brief Image layout, each section is aligned to 8 bytes.
+        //!
+        //!   [SnapshotHeader]
+        //!   [SnapshotArchetype + u64 identifiers[] + u32 sizes[] + u32 offsets[]] * archetype_count
+        //!   [u8 generations[]] [u32 free_indices[]] [EntityDataSlot data_slots[]]
+        //!   [SnapshotBlock + filter data + component arrays[]] * block_count (in archetype order)
+        struct SnapshotHeader
+        {
+            static constexpr ice::u32 Constant_Magic = 0x5345'5349; // 'ISES'
+            static constexpr ice::u32 Constant_Version = 1;
+
+            ice::u32 magic;
+            ice::u32 version;
+            ice::u32 archetype_count;
+            ice::u32 generation_count;
+            ice::u32 free_index_count;
+            ice::u32 block_count;
+        };
+
+        struct SnapshotArchetype
+        {
+            ice::u32 instance;
+            ice::u32 component_count;
+            ice::u32 block_count;
+            ice::u32 block_entity_count_max;
+            ice::u32 filter_data_size;
+            ice::u32 reserved;
+        };
+
+        struct SnapshotBlock
+        {
+            ice::u32 entity_count;
+            ice::u32 reserved;
+        };
+
+        //! \brief Writes data at aligned offsets. When created without memory it only calculates the required size.
+        struct SnapshotWriter
+        {
+            void* location;
+            ice::usize offset;
+
+            void write(void const* data, ice::usize size) noexcept
+            {
+                if (location != nullptr && size > 0_B)
+                {
+                    ice::memcpy(ice::ptr_add(location, offset), data, size);
+                }
+                offset += ice::align_to(size, ice::ualign::b_8).value;
+            }
+
+            template<typename T>
+            void write(ice::Span<T> values) noexcept
+            {
+                write(ice::span::data(values), ice::span::size_bytes(values));
+            }
+
+            template<typename T>
+            void write(T const& value) noexcept
+            {
+                write(ice::addressof(value), ice::size_of<T>);
+            }
+        };
+
+        //! \brief Reads data at aligned offsets, returns `nullptr` if the image is to small.
+        struct SnapshotReader
+        {
+            ice::Data image;
+            ice::usize offset;
+
+            auto read(ice::usize size) noexcept -> void const*
+            {
+                ice::usize const aligned_size = ice::align_to(size, ice::ualign::b_8).value;
+                if (offset + size > image.size)
+                {
+                    return nullptr;
+                }
+
+                void const* const result = ice::ptr_add(image.location, offset);
+                offset += aligned_size;
+                return result;
+            }
+
+            template<typename T>
+            auto read(ice::u32 count = 1) noexcept -> T const*
+            {
+                return reinterpret_cast<T const*>(read(ice::size_of<T> * count));
+            }
+        };
+
+        //! \brief Writes all archetype component arrays stored in a block, only the used part of each array is written.
+        void write_block_components(
+            ice::ecs::detail::SnapshotWriter& writer,
+            ice::ecs::detail::ArchetypeInstanceInfo const& info,
+            ice::ecs::detail::DataBlock const& block
+        ) noexcept
+        {
+            ice::u32 const component_count = ice::span::count(info.component_identifiers);
+            for (ice::u32 idx = 0; idx < component_count; ++idx)
+            {
+                // Tag components do not store any data.
+                if (info.component_sizes[idx] > 0)
+                {
+                    writer.write(
+                        ice::ptr_add(block.block_data, { info.component_offsets[idx] }),
+                        { ice::usize::base_type{ info.component_sizes[idx] } * block.block_entity_count }
+                    );
+                }
+            }
+        }
+
+        //! \brief Checks if the archetype stored in the image can be restored into the given archetype instance.
+        bool is_matching_archetype(
+            ice::ecs::detail::ArchetypeInstanceInfo const& info,
+            ice::ecs::detail::DataBlockPool const& pool,
+            ice::ecs::detail::SnapshotArchetype const& archetype,
+            ice::u64 const* identifiers,
+            ice::u32 const* sizes,
+            ice::u32 const* offsets
+        ) noexcept
+        {
+            ice::u32 const component_count = ice::span::count(info.component_identifiers);
+            if (component_count != archetype.component_count
+                || info.data_block_filter.data_size.value != archetype.filter_data_size
+                || ice::ecs::detail::calculate_entity_count_for_space(info, pool.provided_block_size()) != archetype.block_entity_count_max)
+            {
+                return false;
+            }
+
+            bool matching = true;
+            for (ice::u32 idx = 0; idx < component_count && matching; ++idx)
+            {
+                matching = ice::hash(info.component_identifiers[idx]) == identifiers[idx]
+                    && info.component_sizes[idx] == sizes[idx]
+                    && info.component_offsets[idx] == offsets[idx];
+            }
+            return matching;
+        }
+
+    } // namespace detail
+
+    auto EntityStorage::snapshot(ice::Allocator& alloc) const noexcept -> ice::Memory
+    {
+        IPT_ZONE_SCOPED;
+
+        using ice::ecs::detail::ArchetypeInstance;
+        using ice::ecs::detail::ArchetypeInstanceInfo;
+        using ice::ecs::detail::DataBlock;
+        using ice::ecs::detail::DataBlockPool;
+
+        ice::Array<ice::u32> free_indices{ alloc };
+        _entity_index.free_indices(free_indices);
+
+        ice::Span<ice::u8 const> const generations = _entity_index.generations();
+        ice::u32 const generation_count = ice::span::count(generations);
+        ice::u32 const archetype_count = ice::array::count(_data_blocks);
+
+        ice::Array<ice::u64> identifiers{ alloc };
+
+        // The image is written twice, first time only to calculate the final size.
+        auto const write_image = [&](ice::ecs::detail::SnapshotWriter& writer) noexcept
+        {
+            ice::ecs::detail::SnapshotHeader header{
+                .magic = ice::ecs::detail::SnapshotHeader::Constant_Magic,
+                .version = ice::ecs::detail::SnapshotHeader::Constant_Version,
+                .archetype_count = 0,
+                .generation_count = generation_count,
+                .free_index_count = ice::array::count(free_indices),
+                .block_count = 0,
+            };
+
+            // Archetypes without any blocks are skipped, we start at '1' because '0' is the null archetype.
+            for (ice::u32 idx = 1; idx < archetype_count; ++idx)
+            {
+                for (DataBlock const* block = _data_blocks[idx]->next; block != nullptr; block = block->next)
+                {
+                    header.block_count += 1;
+                }
+                header.archetype_count += ice::u32(_data_blocks[idx]->next != nullptr);
+            }
+            writer.write(header);
+
+            for (ice::u32 idx = 1; idx < archetype_count; ++idx)
+            {
+                if (_data_blocks[idx]->next == nullptr)
+                {
+                    continue;
+                }
+
+                ArchetypeInstanceInfo const* info = nullptr;
+                _archetype_index.fetch_archetype_instance_info_by_index(idx, info);
+                ICE_ASSERT_CORE(info != nullptr);
+
+                ice::ecs::detail::SnapshotArchetype archetype{
+                    .instance = idx,
+                    .component_count = ice::span::count(info->component_identifiers),
+                    .block_count = 0,
+                    .block_entity_count_max = _data_blocks[idx]->next->block_entity_count_max,
+                    .filter_data_size = ice::u32(info->data_block_filter.data_size.value),
+                };
+
+                for (DataBlock const* block = _data_blocks[idx]->next; block != nullptr; block = block->next)
+                {
+                    archetype.block_count += 1;
+                }
+
+                ice::array::clear(identifiers);
+                for (ice::StringID_Arg component : info->component_identifiers)
+                {
+                    ice::array::push_back(identifiers, ice::hash(component));
+                }
+
+                writer.write(archetype);
+                writer.write(ice::array::slice(identifiers));
+                writer.write(info->component_sizes);
+                writer.write(info->component_offsets);
+            }
+
+            writer.write(generations);
+            writer.write(ice::array::slice(free_indices));
+            writer.write(ice::array::slice(_data_slots, 0, ice::min(generation_count, ice::array::count(_data_slots))));
+
+            // If data slots where not yet resized for all entities, the remaining slots are empty.
+            if (generation_count > ice::array::count(_data_slots))
+            {
+                writer.offset += ice::align_to(
+                    ice::size_of<ice::ecs::EntityDataSlot> * (generation_count - ice::array::count(_data_slots)),
+                    ice::ualign::b_8
+                ).value;
+            }
+
+            for (ice::u32 idx = 1; idx < archetype_count; ++idx)
+            {
+                if (_data_blocks[idx]->next == nullptr)
+                {
+                    continue;
+                }
+
+                ArchetypeInstanceInfo const* info = nullptr;
+                _archetype_index.fetch_archetype_instance_info_by_index(idx, info);
+
+                for (DataBlock const* block = _data_blocks[idx]->next; block != nullptr; block = block->next)
+                {
+                    writer.write(ice::ecs::detail::SnapshotBlock{ .entity_count = block->block_entity_count });
+                    writer.write(block->block_filter_data, info->data_block_filter.data_size);
+                    ice::ecs::detail::write_block_components(writer, *info, *block);
+                }
+            }
+        };
+
+        ice::ecs::detail::SnapshotWriter size_calculator{ .location = nullptr, .offset = 0_B };
+        write_image(size_calculator);
+
+        ice::Memory const result = alloc.allocate({ size_calculator.offset, ice::ualign::b_8 });
+        ice::memset(result, 0);
+
+        ice::ecs::detail::SnapshotWriter writer{ .location = result.location, .offset = 0_B };
+        write_image(writer);
+        ICE_ASSERT_CORE(writer.offset == size_calculator.offset);
+        return result;
+    }
+
+    bool EntityStorage::restore(ice::Data image) noexcept
+    {
+        IPT_ZONE_SCOPED;
+
+        using ice::ecs::detail::ArchetypeInstance;
+        using ice::ecs::detail::ArchetypeInstanceInfo;
+        using ice::ecs::detail::DataBlock;
+        using ice::ecs::detail::DataBlockPool;
+        using ice::ecs::detail::SnapshotArchetype;
+        using ice::ecs::detail::SnapshotBlock;
+
+        ice::ecs::detail::SnapshotReader reader{ .image = image, .offset = 0_B };
+        ice::ecs::detail::SnapshotHeader const* const header = reader.read<ice::ecs::detail::SnapshotHeader>();
+        if (header == nullptr
+            || header->magic != ice::ecs::detail::SnapshotHeader::Constant_Magic
+            || header->version != ice::ecs::detail::SnapshotHeader::Constant_Version)
+        {
+            ICE_LOG(ice::LogSeverity::Error, ice::LogTag::Engine, "Entity storage snapshot has an invalid header.");
+            return false;
+        }
+
+        // Ensure all currently registered archetypes have head blocks.
+        update_archetypes();
+
+        struct RestoredArchetype
+        {
+            SnapshotArchetype const* archetype;
+            ArchetypeInstanceInfo const* info;
+            DataBlockPool* pool;
+            ice::u32 first_block;
+        };
+
+        ice::Array<RestoredArchetype> restored{ _allocator };
+        ice::array::reserve(restored, header->archetype_count);
+
+        // Maps archetype instances stored in the image to currently registered instances, '0' if not stored in the image.
+        ice::Array<ice::u32> instance_remap{ _allocator };
+        // Maps archetype instances stored in the image to entries in the 'restored' array.
+        ice::Array<ice::u32> instance_entries{ _allocator };
+        bool requires_remap = false;
+
+        ice::u32 const registered_count = ice::array::count(_data_blocks);
+        for (ice::u32 archetype_idx = 0; archetype_idx < header->archetype_count; ++archetype_idx)
+        {
+            SnapshotArchetype const* const archetype = reader.read<SnapshotArchetype>();
+            ice::u64 const* const identifiers = archetype ? reader.read<ice::u64>(archetype->component_count) : nullptr;
+            ice::u32 const* const sizes = identifiers ? reader.read<ice::u32>(archetype->component_count) : nullptr;
+            ice::u32 const* const offsets = sizes ? reader.read<ice::u32>(archetype->component_count) : nullptr;
+            if (offsets == nullptr)
+            {
+                ICE_LOG(ice::LogSeverity::Error, ice::LogTag::Engine, "Entity storage snapshot is truncated.");
+                return false;
+            }
+
+            // Instances and blocks need to be addressable by entity data slots.
+            if (archetype->instance == 0
+                || archetype->instance > ice::ecs::Constant_MaxArchetypeCount
+                || archetype->block_count > ice::ecs::Constant_MaxBlockCount
+                || archetype->block_entity_count_max > ice::ecs::Constant_MaxBlockEntityIndex
+                || (archetype->instance < ice::array::count(instance_remap) && instance_remap[archetype->instance] != 0))
+            {
+                ICE_LOG(ice::LogSeverity::Error, ice::LogTag::Engine, "Entity storage snapshot contains an invalid archetype.");
+                return false;
+            }
+
+            // Check the same instance first, it will be the same if archetypes are registered in the same order.
+            ice::u32 instance_idx = archetype->instance;
+            ArchetypeInstanceInfo const* info = nullptr;
+            DataBlockPool* pool = nullptr;
+            auto const fetch_instance = [&](ice::u32 idx) noexcept -> bool
+            {
+                _archetype_index.fetch_archetype_instance_info_by_index(idx, info);
+                _archetype_index.fetch_archetype_instance_pool(ArchetypeInstance{ idx }, pool);
+                return info != nullptr && pool != nullptr
+                    && ice::ecs::detail::is_matching_archetype(*info, *pool, *archetype, identifiers, sizes, offsets);
+            };
+
+            if (instance_idx >= registered_count || fetch_instance(instance_idx) == false)
+            {
+                instance_idx = 1;
+                while (instance_idx < registered_count && fetch_instance(instance_idx) == false)
+                {
+                    instance_idx += 1;
+                }
+
+                if (instance_idx == registered_count)
+                {
+                    ICE_LOG(
+                        ice::LogSeverity::Error, ice::LogTag::Engine,
+                        "Entity storage snapshot contains an archetype with {} components that is not registered.",
+                        archetype->component_count
+                    );
+                    return false;
+                }
+            }
+
+            if (ice::array::count(instance_remap) <= archetype->instance)
+            {
+                ice::u32 const old_count = ice::array::count(instance_remap);
+                ice::array::resize(instance_remap, archetype->instance + 1);
+                ice::array::resize(instance_entries, archetype->instance + 1);
+                for (ice::u32 idx = old_count; idx <= archetype->instance; ++idx)
+                {
+                    instance_remap[idx] = 0;
+                }
+            }
+            instance_remap[archetype->instance] = instance_idx;
+            instance_entries[archetype->instance] = ice::array::count(restored);
+            requires_remap |= instance_idx != archetype->instance;
+
+            ice::array::push_back(restored, RestoredArchetype{ archetype, info, pool, 0 });
+        }
+
+        ice::u8 const* const generations = reader.read<ice::u8>(header->generation_count);
+        ice::u32 const* const free_indices = generations ? reader.read<ice::u32>(header->free_index_count) : nullptr;
+        ice::ecs::EntityDataSlot const* const data_slots = free_indices ? reader.read<ice::ecs::EntityDataSlot>(header->generation_count) : nullptr;
+        if (data_slots == nullptr || header->generation_count == 0)
+        {
+            ICE_LOG(ice::LogSeverity::Error, ice::LogTag::Engine, "Entity storage snapshot is truncated.");
+            return false;
+        }
+
+        // Validate the block section before we release any of the existing data.
+        ice::Array<ice::u32> block_entity_counts{ _allocator };
+        ice::usize const blocks_offset = reader.offset;
+        for (RestoredArchetype& entry : restored)
+        {
+            entry.first_block = ice::array::count(block_entity_counts);
+            for (ice::u32 block_idx = 0; block_idx < entry.archetype->block_count; ++block_idx)
+            {
+                SnapshotBlock const* const block = reader.read<SnapshotBlock>();
+                if (block == nullptr
+                    || block->entity_count > entry.archetype->block_entity_count_max
+                    || reader.read(entry.info->data_block_filter.data_size) == nullptr)
+                {
+                    ICE_LOG(ice::LogSeverity::Error, ice::LogTag::Engine, "Entity storage snapshot contains invalid blocks.");
+                    return false;
+                }
+
+                for (ice::u32 const component_size : entry.info->component_sizes)
+                {
+                    if (component_size > 0 && reader.read({ ice::usize::base_type{ component_size } * block->entity_count }) == nullptr)
+                    {
+                        ICE_LOG(ice::LogSeverity::Error, ice::LogTag::Engine, "Entity storage snapshot is truncated.");
+                        return false;
+                    }
+                }
+
+                ice::array::push_back(block_entity_counts, block->entity_count);
+            }
+        }
+
+        // Slots of released indices are never accessed and might point to blocks that are not stored in the image.
+        ice::Array<bool> released_indices{ _allocator };
+        ice::array::resize(released_indices, header->generation_count);
+        ice::array::memset(released_indices, 0);
+        for (ice::u32 const index : ice::Span<ice::u32 const>{ free_indices, header->free_index_count })
+        {
+            if (index < header->generation_count)
+            {
+                released_indices[index] = true;
+            }
+        }
+
+        // Validate slots of all alive entities, block '0' is the empty head block and never holds entities.
+        for (ice::u32 index = 1; index < header->generation_count; ++index)
+        {
+            ice::ecs::EntityDataSlot const slot = data_slots[index];
+            if (released_indices[index] || slot.archetype == 0)
+            {
+                continue;
+            }
+
+            bool const valid_slot = slot.archetype < ice::array::count(instance_remap)
+                && instance_remap[slot.archetype] != 0
+                && slot.block > 0
+                && slot.block <= restored[instance_entries[slot.archetype]].archetype->block_count
+                && slot.index < block_entity_counts[restored[instance_entries[slot.archetype]].first_block + slot.block - 1];
+
+            if (valid_slot == false)
+            {
+                ICE_LOG(
+                    ice::LogSeverity::Error, ice::LogTag::Engine,
+                    "Entity storage snapshot contains an invalid data slot for entity index {}.",
+                    index
+                );
+                return false;
+            }
+        }
+
+        // Restore the entity index and data slots, the index validates its own state before it is replaced.
+        if (_entity_index.restore({ generations, header->generation_count }, { free_indices, header->free_index_count }) == false)
+        {
+            ICE_LOG(ice::LogSeverity::Error, ice::LogTag::Engine, "Entity storage snapshot contains an invalid entity index.");
+            return false;
+        }
+
+        ice::array::clear(_data_slots);
+        ice::array::push_back(_data_slots, ice::Span<ice::ecs::EntityDataSlot const>{ data_slots, header->generation_count });
+        for (ice::u32 index = 0; index < header->generation_count; ++index)
+        {
+            ice::ecs::EntityDataSlot& slot = _data_slots[index];
+            if (released_indices[index] || index == 0)
+            {
+                slot = { };
+            }
+            else if (requires_remap && slot.archetype != 0)
+            {
+                slot.archetype = instance_remap[slot.archetype];
+            }
+        }
+
+        // Restore data blocks
+        release_data_blocks();
+
+        ice::u64 const change_version = acquire_change_version();
+        reader.offset = blocks_offset;
+        for (RestoredArchetype const& entry : restored)
+        {
+            ice::u32 const instance_idx = instance_remap[entry.archetype->instance];
+            ice::u32 const component_count = entry.archetype->component_count;
+
+            DataBlock* tail_block = _data_blocks[instance_idx];
+            for (ice::u32 block_idx = 0; block_idx < entry.archetype->block_count; ++block_idx)
+            {
+                SnapshotBlock const* const snapshot_block = reader.read<SnapshotBlock>();
+
+                DataBlock* const block = entry.pool->request_block(*entry.info);
+                ICE_ASSERT_CORE(block->block_entity_count_max == entry.archetype->block_entity_count_max);
+
+                void const* const filter_data = reader.read(entry.info->data_block_filter.data_size);
+                if (block->block_filter_data != nullptr)
+                {
+                    ice::memcpy(block->block_filter_data, filter_data, entry.info->data_block_filter.data_size);
+                }
+
+                for (ice::u32 idx = 0; idx < component_count; ++idx)
+                {
+                    ice::usize const array_size{ ice::usize::base_type{ entry.info->component_sizes[idx] } * snapshot_block->entity_count };
+                    if (entry.info->component_sizes[idx] > 0)
+                    {
+                        ice::memcpy(
+                            ice::ptr_add(block->block_data, { entry.info->component_offsets[idx] }),
+                            reader.read(array_size),
+                            array_size
+                        );
+                    }
+
+                    block->block_component_versions[idx] = change_version;
+                }
+
+                block->block_entity_count = snapshot_block->entity_count;
+                tail_block->next = block;
+                tail_block = block;
+            }
+        }
+
+        ICE_ASSERT_CORE(reader.offset <= image.size);
+        return true;
+    }
+
+} // namespace ice::ecs
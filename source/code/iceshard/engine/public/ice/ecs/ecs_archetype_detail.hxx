@@ -5,6 +5,7 @@
 #include <ice/ecs/ecs_types.hxx>
 #include <ice/ecs/ecs_data_block_filter.hxx>
 #include <ice/stringid.hxx>
+#include <ice/mem_align.hxx>
 #include <ice/sort.hxx>
 #include <ice/algorithm.hxx>
 
@@ -117,12 +118,19 @@ namespace ice::ecs::detail
         return result;
     }
 
+    //! \returns Size of the component version array stored in each data block, padded so the following data stays aligned.
+    constexpr auto calculate_block_versions_size(ice::ecs::detail::ArchetypeInstanceInfo const& arch) noexcept -> ice::usize
+    {
+        return ice::align_to(ice::size_of<ice::u64> * ice::span::count(arch.component_identifiers), ice::ualign::b_8).value;
+    }
+
     constexpr auto calculate_entity_count_for_space(ice::ecs::detail::ArchetypeInstanceInfo const& arch, ice::usize space) noexcept -> ice::ucount
     {
         ice::u32 const component_size_sum = ice::accumulate(arch.component_sizes, 0);
         ice::u32 const component_alignment_sum = ice::accumulate(arch.component_alignments, 0);
 
-        ice::usize const available_block_size = { ice::usize::subtract(space, arch.data_block_filter.data_size).value - component_alignment_sum };
+        ice::usize const block_header_size = arch.data_block_filter.data_size + calculate_block_versions_size(arch);
+        ice::usize const available_block_size = { ice::usize::subtract(space, block_header_size).value - component_alignment_sum };
         return ice::ucount(available_block_size.value) / component_size_sum;
     }
 
@@ -9,6 +9,8 @@
 #include <ice/container_types.hxx>
 #include <ice/span.hxx>
 
+#include <shared_mutex>
+
 namespace ice::ecs
 {
 
@@ -41,6 +43,9 @@ namespace ice::ecs
             ice::String name
         ) const noexcept -> ice::ecs::Archetype;
 
+        //! \brief Finds all archetypes matching the given query requirements.
+        //! \details Results are cached for each unique query, subsequent calls only copy the cached archetypes.
+        //!   Registering a new archetype clears the cache.
         void find_archetypes(
             ice::Array<ice::ecs::Archetype>& out_archetypes,
             ice::Span<ice::ecs::detail::QueryTypeInfo const> query_info,
@@ -82,6 +87,20 @@ namespace ice::ecs
 
         struct ArchetypeDataHeader;
         ice::Array<ArchetypeDataHeader*> _archetype_data;
+
+        struct QueryMatchCache;
+
+        //! \returns The cached matches for the given query or 'nullptr'.
+        //! \note Needs to be called with the cache mutex locked.
+        auto find_query_cache(
+            ice::u64 signature,
+            ice::Span<ice::ecs::detail::QueryTypeInfo const> query_info,
+            ice::Span<ice::StringID const> query_tags
+        ) const noexcept -> QueryMatchCache*;
+
+        //! \brief Guards the query cache and archetype registration, cached queries are only locked for reading.
+        mutable std::shared_mutex _query_cache_mutex;
+        mutable ice::HashMap<QueryMatchCache*> _query_cache;
     };
 
     template<ice::ecs::Component... Components>
@@ -26,6 +26,11 @@ namespace ice::ecs::detail
         //! \brief Block filter data
         void* block_filter_data;
 
+        //! \brief Version stamps for each archetype component, updated every time the component data might have been written to.
+        //!
+        //! \note Versions are provided by `QueryProvider::acquire_change_version` and allow queries to skip unchanged blocks.
+        ice::u64* block_component_versions;
+
         //! \brief Pointer to component data.
         void* block_data;
 
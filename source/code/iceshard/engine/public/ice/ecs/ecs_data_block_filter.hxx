@@ -31,6 +31,7 @@ namespace ice::ecs::detail
                 : arch{ }
                 , fn_filter{ nullptr }
                 , filter_data{ }
+                , changed_since{ 0 }
             { }
 
             template<ice::ecs::detail::FilterType T>
@@ -38,12 +39,15 @@ namespace ice::ecs::detail
                 : arch{ }
                 , fn_filter{ (DataBlockFilter::FilterFn)T::on_filter }
                 , filter_data{ }
+                , changed_since{ 0 }
             {
                 ice::memcpy(filter_data, ice::addressof(filter), sizeof(T));
             }
 
             QueryFilter(QueryFilter const& other) noexcept
-                : fn_filter{ other.fn_filter }
+                : arch{ other.arch }
+                , fn_filter{ other.fn_filter }
+                , changed_since{ other.changed_since }
             {
                 ice::memcpy(filter_data, other.filter_data, sizeof(filter_data));
             }
@@ -55,6 +59,7 @@ namespace ice::ecs::detail
                     arch = other.arch;
                     fn_filter = other.fn_filter;
                     ice::memcpy(filter_data, other.filter_data, sizeof(filter_data));
+                    changed_since = other.changed_since;
                 }
                 return *this;
             }
@@ -64,6 +69,25 @@ namespace ice::ecs::detail
                 return fn_filter == nullptr || fn_filter(data_block->block_filter_data, filter_data);
             }
 
+            //! \brief Checks if any of the queried components was written to after the `changed_since` version.
+            //! \param argument_idx_map Index of each queried component in the blocks archetype, `ice::u32_max` if not present.
+            bool changed(ice::ecs::detail::DataBlock const* data_block, ice::Span<ice::u32 const> argument_idx_map) const noexcept
+            {
+                if (changed_since == 0)
+                {
+                    return true;
+                }
+
+                for (ice::u32 const component_idx : argument_idx_map)
+                {
+                    if (component_idx != ice::u32_max && data_block->block_component_versions[component_idx] > changed_since)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             auto next(ice::ecs::detail::DataBlock const* data_block) const noexcept
             {
                 ICE_ASSERT_CORE(data_block != nullptr);
@@ -85,6 +109,9 @@ namespace ice::ecs::detail
             ice::ecs::Archetype arch;
             FilterFn fn_filter;
             char filter_data[16];
+
+            //! \brief Blocks with all queried components at or below this version are skipped, '0' disables the check.
+            ice::u64 changed_since;
         };
     };
 
@@ -5,6 +5,7 @@
 #include <ice/span.hxx>
 #include <ice/ecs/ecs_entity.hxx>
 #include <ice/container/queue.hxx>
+#include <ice/container/array.hxx>
 #include <atomic>
 
 namespace ice::ecs
@@ -38,6 +39,20 @@ namespace ice::ecs
 
         bool recreate(ice::Array<ice::ecs::Entity>& entity, ice::u32 new_count) noexcept;
 
+        //! \returns Generation values of all entity indices created so far.
+        auto generations() const noexcept -> ice::Span<ice::u8 const>;
+
+        //! \brief Copies all released indices in the order they will be reused.
+        void free_indices(ice::Array<ice::u32>& out_indices) const noexcept;
+
+        //! \brief Replaces the whole index state, used to restore entity storage snapshots.
+        //! \note The first generation value belongs to the 'Invalid' entity and needs to be set to `ice::u8_max`.
+        //! \return `false` if the values are not a valid index state, the current state is kept in such a case.
+        bool restore(
+            ice::Span<ice::u8 const> generations,
+            ice::Span<ice::u32 const> free_indices
+        ) noexcept;
+
     private:
         ice::Allocator& _allocator;
         ice::u32 const _max_entity_count;
@@ -36,11 +36,36 @@ namespace ice::ecs
             ice::ecs::detail::EntityDestructor const& destructor
         ) noexcept;
 
+        //! \brief Executes all queued operations, stamping modified data blocks with a new change version.
+        //! \note Pushes 'Shard_EntityDestroyed' for each entity that had it's data removed and 'Shard_EntityArchetypeChanged'
+        //!   for each entity moved into a different archetype.
         void execute_operations(
             ice::ecs::EntityOperations const& operations,
             ice::ShardContainer& out_shards
         ) noexcept;
 
+        //! \brief Serializes archetype layouts, the entity index and all component data into a single binary image.
+        //!
+        //! \note Component data is copied as raw memory, only components that can be safely copied with `memcpy` are supported.
+        //! \pre No queries or operations are accessing the storage while the snapshot is created.
+        //!
+        //! \param alloc Allocator used to allocate the returned image.
+        //! \return Memory block holding the image, the caller is responsible for releasing it.
+        auto snapshot(ice::Allocator& alloc) const noexcept -> ice::Memory;
+
+        //! \brief Replaces all stored entities with the contents of a snapshot image.
+        //!
+        //! \details The image is only read from, so it can be stored in a resource pack or a memory mapped file.
+        //!   Archetypes are matched by their component layout, so they need to be registered before the snapshot is restored.
+        //!   Data blocks are requested from archetype pools and filled with a single copy for each component array.
+        //!
+        //! \note Existing entities are discarded without calling attached destructors.
+        //! \note All restored blocks are stamped with a new change version.
+        //! \pre No queries or operations are accessing the storage while the snapshot is restored.
+        //!
+        //! \return `false` if the image is malformed or contains archetypes that are not registered.
+        bool restore(ice::Data image) noexcept;
+
         auto find_archetype(
             ice::String name
         ) const noexcept -> ice::ecs::Archetype override;
@@ -60,6 +85,10 @@ namespace ice::ecs
             ice::ecs::detail::DataBlock const*& out_head_block
         ) const noexcept override;
 
+        auto change_version() const noexcept -> ice::u64 override;
+
+        auto acquire_change_version() const noexcept -> ice::u64 override;
+
     protected:
         void query_internal(
             ice::Span<ice::ecs::detail::QueryTypeInfo const> query_info,
@@ -69,6 +98,9 @@ namespace ice::ecs
             ice::Array<ice::ecs::detail::DataBlock const*>& out_data_blocks
         ) const noexcept override;
 
+    private:
+        void release_data_blocks() noexcept;
+
     private:
         ice::ProxyAllocator _allocator;
         ice::ecs::EntityIndex _entity_index;
@@ -80,6 +112,8 @@ namespace ice::ecs
         ice::Array<ice::ecs::EntityDataSlot> _data_slots;
 
         ice::HashMap<ice::ecs::detail::EntityDestructor> _destructors;
+
+        mutable std::atomic<ice::u64> _change_version;
     };
 
 } // namespace ice::ecs
@@ -60,6 +60,12 @@ namespace ice::ecs
             return *this;
         }
 
+        auto filtered(ice::ecs::QueryChangedSince changed_since) noexcept -> Query&
+        {
+            _filter.changed_since = changed_since.version;
+            return *this;
+        }
+
         template<ice::ecs::detail::FilterType T>
         auto filtered(T const& filter) noexcept -> Query&;
 
@@ -123,6 +129,12 @@ namespace ice::ecs
             return *this;
         }
 
+        auto filtered(ice::ecs::QueryChangedSince changed_since) noexcept -> Query&
+        {
+            _filter.changed_since = changed_since.version;
+            return *this;
+        }
+
         template<ice::ecs::detail::FilterType T>
         auto filtered(T const& filter) noexcept -> Query&;
 
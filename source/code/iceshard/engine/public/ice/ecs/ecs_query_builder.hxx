@@ -97,6 +97,13 @@ namespace ice::ecs
             return result;
         }
 
+        auto filtered(ice::ecs::QueryChangedSince changed_since) noexcept -> ice::ecs::Query<QueryType::Unchecked, Parts...>
+        {
+            Query result = ice::ecs::Query<QueryType::Unchecked, Parts...>{ query_object() };
+            result.filtered(changed_since);
+            return result;
+        }
+
         template<ice::ecs::detail::FilterType T>
         auto filtered(T const& filter) noexcept -> ice::ecs::Query<QueryType::Unchecked, Parts...>
         {
@@ -56,6 +56,20 @@ namespace ice::ecs
             ice::ecs::detail::QueryTags<Tags...>::Constant_Tags;
     };
 
+    //! \brief A query filter skipping data blocks where none of the queried components where written to after the given version.
+    //!
+    //! \details Components are considered written to when entities are added, moved or updated in a block, or when a query with
+    //!   write access to a component iterates over the block. To only process entities changed since the last update, store
+    //!   `QueryProvider::change_version()` after executing the query and pass it to the filter on the next frame.
+    //!
+    //! \note Components accessed trough entity references (sub-parts) are not tracked.
+    //!
+    //! \example query.filtered(QueryChangedSince{ _last_version }).for_each_block(...)
+    struct QueryChangedSince
+    {
+        ice::u64 version;
+    };
+
     namespace detail
     {
 
@@ -44,6 +44,43 @@ namespace ice::ecs
     namespace detail
     {
 
+        //! \returns A new change version if the query part has write access to any of it's components, '0' otherwise.
+        template<ice::u32 RefIdx, QueryArg... T>
+        inline auto acquire_write_version(
+            ice::ecs::QueryProvider const& provider,
+            ice::ecs::detail::QueryObjectPart<RefIdx, T...>
+        ) noexcept -> ice::u64
+        {
+            if constexpr ((ice::ecs::detail::Constant_QueryTypeIsWritable<T> || ...))
+            {
+                return provider.acquire_change_version();
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        //! \brief Stamps the given version on all block components the query part has write access to.
+        template<ice::u32 RefIdx, QueryArg... T>
+        inline void stamp_block_versions(
+            ice::ecs::detail::DataBlock const* block,
+            ice::Span<ice::u32 const> argument_idx_map,
+            ice::u64 version,
+            ice::ecs::detail::QueryObjectPart<RefIdx, T...>
+        ) noexcept
+        {
+            static constexpr bool Constant_IsWritable[]{ ice::ecs::detail::Constant_QueryTypeIsWritable<T>... };
+
+            for (ice::u32 arg_idx = 0; arg_idx < sizeof...(T); ++arg_idx)
+            {
+                if (Constant_IsWritable[arg_idx] && argument_idx_map[arg_idx] != ice::u32_max)
+                {
+                    block->block_component_versions[argument_idx_map[arg_idx]] = version;
+                }
+            }
+        }
+
         template<ice::u32 RefIdx, QueryArg... T>
         inline auto create_entity_tuple(
             ice::u32 index,
@@ -273,17 +310,21 @@ namespace ice::ecs
             ice::ecs::detail::DataBlockFilter::QueryFilter filter
         ) noexcept -> ice::ucount
         {
+            static constexpr ice::ucount component_count = MainPart::ComponentCount;
+
             // On a query with multiple parts we only want to check the blocks of the main part.
-            ice::Span const blocks_to_check = ice::array::slice(query.archetype_data_blocks, 0, query.archetype_count_for_part[0]);
+            ice::u32 const arch_count = query.archetype_count_for_part[0];
 
             ice::ucount result = 0;
-            for (ice::ecs::detail::DataBlock const* const head_block : blocks_to_check)
+            for (ice::u32 arch_idx = 0; arch_idx < arch_count; ++arch_idx)
             {
+                ice::Span<ice::u32 const> make_argument_idx_map = ice::array::slice(query.archetype_argument_idx_map, arch_idx * component_count, component_count);
+
                 // We don't want to count the head-block since it never contains actual entity data.
-                ice::ecs::detail::DataBlock const* it = head_block->next;
+                ice::ecs::detail::DataBlock const* it = query.archetype_data_blocks[arch_idx]->next;
                 while (it != nullptr)
                 {
-                    if (filter.check(it))
+                    if (filter.check(it) && filter.changed(it, make_argument_idx_map))
                     {
                         result += it->block_entity_count;
                     }
@@ -360,6 +401,10 @@ namespace ice::ecs
                 query.archetype_argument_idx_map, arch_idx * component_count, component_count
             );
 
+            ice::ecs::detail::stamp_block_versions(
+                block, make_argument_idx_map, ice::ecs::detail::acquire_write_version(*query.provider, MainPart{}), MainPart{}
+            );
+
             for (ice::u32 arg_idx = 0; arg_idx < component_count; ++arg_idx)
             {
                 if (make_argument_idx_map[arg_idx] == ice::u32_max)
@@ -408,6 +453,7 @@ namespace ice::ecs
 
             // Only go over the archetypes of the main part
             ice::u32 const arch_count = query_object.archetype_count_for_part[0];
+            ice::u64 const write_version = ice::ecs::detail::acquire_write_version(*query_object.provider, MainPart{});
             for (ice::u32 arch_idx = 0; arch_idx < arch_count; ++arch_idx)
             {
                 ice::ecs::detail::ArchetypeInstanceInfo const* arch = query_object.archetype_instances[arch_idx];
@@ -420,6 +466,14 @@ namespace ice::ecs
 
                 while (block != nullptr && filter.check(block))
                 {
+                    if (filter.changed(block, make_argument_idx_map) == false)
+                    {
+                        block = filter.next(block);
+                        continue;
+                    }
+
+                    ice::ecs::detail::stamp_block_versions(block, make_argument_idx_map, write_version, MainPart{});
+
                     for (ice::u32 arg_idx = 0; arg_idx < component_count; ++arg_idx)
                     {
                         if (make_argument_idx_map[arg_idx] == ice::u32_max)
@@ -478,6 +532,7 @@ namespace ice::ecs
 
             // Only go over the archetypes of the main part
             ice::u32 const arch_count = query_object.archetype_count_for_part[0];
+            ice::u64 const write_version = ice::ecs::detail::acquire_write_version(*query_object.provider, MainPart{});
             for (ice::u32 arch_idx = 0; arch_idx < arch_count; ++arch_idx)
             {
                 ice::ecs::detail::ArchetypeInstanceInfo const* arch = query_object.archetype_instances[arch_idx];
@@ -490,6 +545,14 @@ namespace ice::ecs
 
                 while (block != nullptr && filter.check(block))
                 {
+                    if (filter.changed(block, make_argument_idx_map) == false)
+                    {
+                        block = filter.next(block);
+                        continue;
+                    }
+
+                    ice::ecs::detail::stamp_block_versions(block, make_argument_idx_map, write_version, MainPart{});
+
                     for (ice::u32 arg_idx = 0; arg_idx < component_count; ++arg_idx)
                     {
                         if (make_argument_idx_map[arg_idx] == ice::u32_max)
@@ -551,6 +614,7 @@ namespace ice::ecs
             void* helper_pointer_array[component_count]{ nullptr };
 
             ice::u32 const arch_count = ice::count(query.archetype_instances);
+            ice::u64 const write_version = ice::ecs::detail::acquire_write_version(*query.provider, MainPart{});
             for (ice::u32 arch_idx = 0; arch_idx < arch_count; ++arch_idx)
             {
                 ice::ecs::detail::ArchetypeInstanceInfo const* arch = query.archetype_instances[arch_idx];
@@ -563,6 +627,14 @@ namespace ice::ecs
 
                 while (block != nullptr && filter.check(block))
                 {
+                    if (filter.changed(block, make_argument_idx_map) == false)
+                    {
+                        block = filter.next(block);
+                        continue;
+                    }
+
+                    ice::ecs::detail::stamp_block_versions(block, make_argument_idx_map, write_version, MainPart{});
+
                     for (ice::u32 arg_idx = 0; arg_idx < component_count; ++arg_idx)
                     {
                         if (make_argument_idx_map[arg_idx] == ice::u32_max)
@@ -600,6 +672,7 @@ namespace ice::ecs
             void* helper_pointer_array[component_count]{ nullptr };
 
             ice::u32 const arch_count = ice::count(query.archetype_instances);
+            ice::u64 const write_version = ice::ecs::detail::acquire_write_version(*query.provider, MainPart{});
             for (ice::u32 arch_idx = 0; arch_idx < arch_count; ++arch_idx)
             {
                 ice::ecs::detail::ArchetypeInstanceInfo const* arch = query.archetype_instances[arch_idx];
@@ -612,6 +685,14 @@ namespace ice::ecs
 
                 while (block != nullptr)
                 {
+                    if (filter.changed(block, make_argument_idx_map) == false)
+                    {
+                        block = filter.next(block);
+                        continue;
+                    }
+
+                    ice::ecs::detail::stamp_block_versions(block, make_argument_idx_map, write_version, MainPart{});
+
                     for (ice::u32 arg_idx = 0; arg_idx < component_count; ++arg_idx)
                     {
                         if (make_argument_idx_map[arg_idx] == ice::u32_max)
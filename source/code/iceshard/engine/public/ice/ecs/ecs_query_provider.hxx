@@ -45,6 +45,13 @@ namespace ice::ecs
             ice::ecs::detail::DataBlock const*& out_head_block
         ) const noexcept = 0;
 
+        //! \returns The last version stamped on data blocks, any data written after this call will be stamped with a higher version.
+        //! \note Versions are 64bit so they can be compared directly, the counter does not wrap during the lifetime of a storage.
+        virtual auto change_version() const noexcept -> ice::u64 = 0;
+
+        //! \brief Increments the change version and returns it, used to stamp data blocks a query acquired write access to.
+        virtual auto acquire_change_version() const noexcept -> ice::u64 = 0;
+
     protected:
         virtual void query_internal(
             ice::Span<ice::ecs::detail::QueryTypeInfo const> query_info,
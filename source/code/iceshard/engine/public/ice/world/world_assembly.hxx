@@ -15,6 +15,12 @@ namespace ice
     {
         ice::StringID name;
         ice::Span<ice::StringID const> traits;
+
+        //! \brief Logic tasks of this world are updated as a separate task group on the 'tasks' scheduler.
+        //! \details Allows independent worlds to be updated concurrently on different threads. The runner still waits for
+        //!   all world groups before the frame is finished, so the frame acts as a barrier between updates.
+        //! \note Traits of such a world should not expect to be started on the 'main' scheduler.
+        bool parallel_update = false;
     };
 
     struct WorldAssembly
@@ -0,0 +1,151 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/ecs/ecs_archetype_index.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/container/array.hxx>
+
+using ice::operator""_sid;
+
+namespace
+{
+
+    struct TestComponent1
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.ecs.component-1"_sid;
+        int x;
+    };
+
+    struct TestComponent2
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.ecs.component-2"_sid;
+        float y;
+    };
+
+    struct TestTag
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.ecs.tag"_sid;
+    };
+
+    bool contains(ice::Array<ice::ecs::Archetype> const& archetypes, ice::ecs::Archetype expected) noexcept
+    {
+        for (ice::ecs::Archetype archetype : archetypes)
+        {
+            if (archetype == expected)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+} // namespace
+
+SCENARIO("engine 'ecs archetype index'", "[ecs][archetype]")
+{
+    using ice::ecs::detail::QueryRequirements;
+    using ice::ecs::detail::QueryTags;
+
+    ice::HostAllocator alloc{ };
+    ice::ecs::ArchetypeIndex index{ alloc };
+    ice::Array<ice::ecs::Archetype> results{ alloc };
+
+    ice::ecs::Archetype const arch_c1 = index.new_archetype<TestComponent1>("c1");
+    ice::ecs::Archetype const arch_c1_c2 = index.new_archetype<TestComponent1, TestComponent2>("c1_c2");
+
+    GIVEN("queries with different requirements")
+    {
+        using QuerySpan = ice::Span<ice::ecs::detail::QueryTypeInfo const>;
+        QuerySpan const query_c1 = ice::span::from_std_const(
+            QueryRequirements<TestComponent1 const&>::Constant_Requirements
+        );
+        QuerySpan const query_c1_c2 = ice::span::from_std_const(
+            QueryRequirements<TestComponent1 const&, TestComponent2 const&>::Constant_Requirements
+        );
+        QuerySpan const query_c1_opt_c2 = ice::span::from_std_const(
+            QueryRequirements<TestComponent1 const&, TestComponent2 const*>::Constant_Requirements
+        );
+
+        THEN("each query returns its own results")
+        {
+            index.find_archetypes(results, query_c1);
+            CHECK(ice::array::count(results) == 2);
+
+            ice::array::clear(results);
+            index.find_archetypes(results, query_c1_c2);
+            REQUIRE(ice::array::count(results) == 1);
+            CHECK(results[0] == arch_c1_c2);
+
+            // Only differs in the optional flag from the previous query.
+            ice::array::clear(results);
+            index.find_archetypes(results, query_c1_opt_c2);
+            CHECK(ice::array::count(results) == 2);
+
+            ice::array::clear(results);
+            index.find_archetypes(results, query_c1_c2);
+            CHECK(ice::array::count(results) == 1);
+        }
+
+        WHEN("a new archetype is registered after the queries were cached")
+        {
+            index.find_archetypes(results, query_c1);
+            index.find_archetypes(results, query_c1_c2);
+            ice::array::clear(results);
+
+            ice::ecs::Archetype const arch_c1_tag = index.new_archetype<TestComponent1, TestTag>("c1_tag");
+
+            THEN("the new archetype is part of the results")
+            {
+                index.find_archetypes(results, query_c1);
+                CHECK(ice::array::count(results) == 3);
+                CHECK(contains(results, arch_c1));
+                CHECK(contains(results, arch_c1_tag));
+
+                ice::array::clear(results);
+                index.find_archetypes(results, query_c1_c2);
+                CHECK(ice::array::count(results) == 1);
+            }
+
+            THEN("queries with tags only return tagged archetypes")
+            {
+                index.find_archetypes(results, query_c1, ice::span::from_std_const(QueryTags<TestTag>::Constant_Tags));
+                REQUIRE(ice::array::count(results) == 1);
+                CHECK(results[0] == arch_c1_tag);
+            }
+        }
+
+        WHEN("archetypes are registered after tagged and optional queries were cached")
+        {
+            ice::Span<ice::StringID const> const tags = ice::span::from_std_const(QueryTags<TestTag>::Constant_Tags);
+
+            index.find_archetypes(results, query_c1, tags);
+            CHECK(ice::array::count(results) == 0);
+            index.find_archetypes(results, query_c1_opt_c2);
+            CHECK(ice::array::count(results) == 2);
+
+            ice::ecs::Archetype const arch_c2 = index.new_archetype<TestComponent2>("c2");
+            ice::ecs::Archetype const arch_c1_c2_tag = index.new_archetype<TestComponent1, TestComponent2, TestTag>("c1_c2_tag");
+
+            THEN("only matching archetypes are appended to the cached results")
+            {
+                ice::array::clear(results);
+                index.find_archetypes(results, query_c1, tags);
+                REQUIRE(ice::array::count(results) == 1);
+                CHECK(results[0] == arch_c1_c2_tag);
+
+                ice::array::clear(results);
+                index.find_archetypes(results, query_c1_opt_c2);
+                REQUIRE(ice::array::count(results) == 3);
+                CHECK(results[0] == arch_c1);
+                CHECK(results[1] == arch_c1_c2);
+                CHECK(results[2] == arch_c1_c2_tag);
+                CHECK(contains(results, arch_c2) == false);
+
+                ice::array::clear(results);
+                index.find_archetypes(results, query_c1_c2);
+                CHECK(ice::array::count(results) == 2);
+            }
+        }
+    }
+}
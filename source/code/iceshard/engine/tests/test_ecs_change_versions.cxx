@@ -0,0 +1,193 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/ecs/ecs_archetype_index.hxx>
+#include <ice/ecs/ecs_entity_storage.hxx>
+#include <ice/ecs/ecs_entity_operations.hxx>
+#include <ice/ecs/ecs_query_storage.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/container/array.hxx>
+
+using ice::operator""_sid;
+
+namespace
+{
+
+    struct TestPosition
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.ecs.versions.position"_sid;
+        ice::i32 x;
+        ice::i32 y;
+    };
+
+    struct TestHealth
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.ecs.versions.health"_sid;
+        ice::f32 value;
+    };
+
+    //! \returns Number of entities visited by the query, when skipping blocks not changed after the given version.
+    template<typename... Components>
+    auto count_changed(ice::ecs::QueryStorage& queries, ice::u64 version) noexcept -> ice::u32
+    {
+        auto const query = queries.build<ice::ecs::Entity, Components...>()
+            .filtered(ice::ecs::QueryChangedSince{ version });
+
+        ice::u32 result = 0;
+        ice::ecs::query::for_each_entity(
+            query.query_object(),
+            query.filter_object(),
+            [&](auto&&...) noexcept { result += 1; }
+        );
+        return result;
+    }
+
+    //! \brief Writes to all health components trough a query, this stamps the visited blocks with a new version.
+    void write_health(ice::ecs::QueryStorage& queries, ice::f32 value) noexcept
+    {
+        auto const query = queries.build<TestHealth&>();
+        ice::ecs::query::for_each_entity(
+            query.query_object(),
+            query.filter_object(),
+            [&](TestHealth& health) noexcept { health.value = value; }
+        );
+    }
+
+} // namespace
+
+SCENARIO("engine 'ecs entity storage' (change versions)", "[ecs][versions]")
+{
+    ice::HostAllocator alloc{ };
+    ice::ecs::ArchetypeIndex archetypes{ alloc };
+
+    ice::ecs::Archetype const arch_position = archetypes.new_archetype<TestPosition>("position");
+    ice::ecs::Archetype const arch_position_health = archetypes.new_archetype<TestPosition, TestHealth>("position_health");
+
+    ice::ecs::EntityStorage storage{ alloc, archetypes };
+    storage.update_archetypes();
+
+    ice::ecs::QueryStorage queries{ alloc, storage };
+    ice::ecs::EntityOperations operations{ alloc, storage.entities(), archetypes };
+    ice::ShardContainer shards{ alloc };
+
+    auto const execute_operations = [&]() noexcept
+    {
+        storage.execute_operations(operations, shards);
+        operations.clear();
+    };
+
+    TestPosition const positions[]{ { 1, 2 }, { 3, 4 } };
+    TestHealth const health[]{ { 10.f }, { 20.f } };
+
+    ice::Array<ice::ecs::Entity> moving{ alloc };
+    ice::Array<ice::ecs::Entity> living{ alloc };
+
+    ice::u64 const initial_version = storage.change_version();
+    operations.create(arch_position, 2).with_data(ice::Span<TestPosition const>{ positions }).store(moving);
+    operations.create(arch_position_health, 2)
+        .with_data(ice::Span<TestPosition const>{ positions }, ice::Span<TestHealth const>{ health })
+        .store(living);
+    execute_operations();
+
+    GIVEN("newly created entities")
+    {
+        THEN("the change version was increased")
+        {
+            CHECK(storage.change_version() > initial_version);
+        }
+
+        THEN("their blocks are stamped with the new version")
+        {
+            CHECK(count_changed<TestPosition const&>(queries, initial_version) == 4);
+            CHECK(count_changed<TestHealth const&>(queries, initial_version) == 2);
+        }
+
+        THEN("version '0' disables the filter")
+        {
+            CHECK(count_changed<TestPosition const&>(queries, 0) == 4);
+        }
+    }
+
+    GIVEN("the version stored after the last update")
+    {
+        ice::u64 const last_version = storage.change_version();
+
+        THEN("unchanged blocks are skipped")
+        {
+            CHECK(count_changed<TestPosition const&>(queries, last_version) == 0);
+            CHECK(count_changed<TestHealth const&>(queries, last_version) == 0);
+        }
+
+        THEN("queries with read-only access don't stamp blocks")
+        {
+            count_changed<TestPosition const&, TestHealth const&>(queries, 0);
+            CHECK(storage.change_version() == last_version);
+            CHECK(count_changed<TestPosition const&>(queries, last_version) == 0);
+        }
+
+        WHEN("a query writes to a component")
+        {
+            write_health(queries, 42.f);
+
+            THEN("only blocks of the written component are stamped")
+            {
+                CHECK(storage.change_version() > last_version);
+                CHECK(count_changed<TestHealth const&>(queries, last_version) == 2);
+                CHECK(count_changed<TestPosition const&>(queries, last_version) == 0);
+            }
+
+            THEN("the blocks are skipped again with the latest version")
+            {
+                CHECK(count_changed<TestHealth const&>(queries, storage.change_version()) == 0);
+            }
+        }
+
+        WHEN("entities are added to an archetype")
+        {
+            operations.create(arch_position, 1).with_data(TestPosition{ 5, 6 });
+            execute_operations();
+
+            THEN("only the block holding the new entity is stamped")
+            {
+                CHECK(count_changed<TestPosition const&>(queries, last_version) == 3);
+                CHECK(count_changed<TestHealth const&>(queries, last_version) == 0);
+            }
+        }
+
+        WHEN("an entity is destroyed")
+        {
+            operations.destroy({ &living[0], 1 });
+            execute_operations();
+
+            THEN("the block it was removed from is stamped")
+            {
+                CHECK(count_changed<TestHealth const&>(queries, last_version) == 1);
+                CHECK(count_changed<TestPosition const&>(queries, last_version) == 1);
+            }
+        }
+
+        WHEN("an entity is moved to a different archetype")
+        {
+            operations.set(arch_position_health, ice::array::slice(moving, 0, 1)).with_data(TestHealth{ 30.f });
+            execute_operations();
+
+            THEN("both the source and destination blocks are stamped")
+            {
+                CHECK(count_changed<TestHealth const&>(queries, last_version) == 3);
+                CHECK(count_changed<TestPosition const&>(queries, last_version) == 4);
+            }
+        }
+    }
+
+    GIVEN("a version above the 32bit range")
+    {
+        // Truncating the version would make the filter accept all blocks stamped with a lower version.
+        ice::u64 const future_version = ice::u64{ ice::u32_max } + storage.change_version() + 1;
+
+        THEN("all blocks are skipped")
+        {
+            CHECK(count_changed<TestPosition const&>(queries, future_version) == 0);
+        }
+    }
+}
@@ -0,0 +1,234 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/ecs/ecs_archetype_index.hxx>
+#include <ice/ecs/ecs_entity_storage.hxx>
+#include <ice/ecs/ecs_entity_operations.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/container/array.hxx>
+#include <bit>
+#include <cstring>
+
+using ice::operator""_sid;
+
+namespace
+{
+
+    struct TestPosition
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.ecs.snapshot.position"_sid;
+        ice::i32 x;
+        ice::i32 y;
+    };
+
+    struct TestHealth
+    {
+        static constexpr ice::StringID Identifier = "iceshard.test.ecs.snapshot.health"_sid;
+        ice::f32 value;
+    };
+
+    template<typename T>
+    auto read_component(
+        ice::ecs::EntityStorage const& storage,
+        ice::ecs::Archetype archetype,
+        ice::ecs::Entity entity
+    ) noexcept -> T const*
+    {
+        ice::ecs::EntityDataSlot const slot = storage.query_data_slot(entity);
+
+        ice::ecs::detail::ArchetypeInstanceInfo const* info = nullptr;
+        ice::ecs::detail::DataBlock const* block = nullptr;
+        if (storage.query_archetype_block(archetype, info, block) == false)
+        {
+            return nullptr;
+        }
+
+        for (ice::u32 idx = 0; idx < slot.block && block != nullptr; ++idx)
+        {
+            block = block->next;
+        }
+
+        ice::u32 const component_count = ice::span::count(info->component_identifiers);
+        for (ice::u32 idx = 0; idx < component_count && block != nullptr; ++idx)
+        {
+            if (info->component_identifiers[idx] == T::Identifier)
+            {
+                T const* const components = reinterpret_cast<T const*>(
+                    ice::ptr_add(block->block_data, { info->component_offsets[idx] })
+                );
+                return components + slot.index;
+            }
+        }
+        return nullptr;
+    }
+
+    //! \brief Finds the data slot of an entity in a snapshot image, by searching for the slots of two consecutive entities.
+    auto find_data_slot(
+        ice::Memory image,
+        ice::ecs::EntityStorage const& storage,
+        ice::ecs::Entity first,
+        ice::ecs::Entity second
+    ) noexcept -> ice::ecs::EntityDataSlot*
+    {
+        if (ice::ecs::entity_info(first).index + 1 != ice::ecs::entity_info(second).index)
+        {
+            return nullptr;
+        }
+
+        ice::u32 const expected[]{
+            std::bit_cast<ice::u32>(storage.query_data_slot(first)),
+            std::bit_cast<ice::u32>(storage.query_data_slot(second)),
+        };
+
+        ice::u32* const values = reinterpret_cast<ice::u32*>(image.location);
+        ice::u32 const value_count = ice::u32(image.size.value / sizeof(ice::u32));
+        for (ice::u32 idx = 0; idx + 1 < value_count; ++idx)
+        {
+            if (values[idx] == expected[0] && values[idx + 1] == expected[1])
+            {
+                return reinterpret_cast<ice::ecs::EntityDataSlot*>(values + idx);
+            }
+        }
+        return nullptr;
+    }
+
+} // namespace
+
+SCENARIO("engine 'ecs entity storage' (snapshot)", "[ecs][snapshot]")
+{
+    ice::HostAllocator alloc{ };
+    ice::ecs::ArchetypeIndex archetypes{ alloc };
+
+    ice::ecs::Archetype const arch_position = archetypes.new_archetype<TestPosition>("position");
+    ice::ecs::Archetype const arch_position_health = archetypes.new_archetype<TestPosition, TestHealth>("position_health");
+
+    ice::ecs::EntityStorage storage{ alloc, archetypes };
+    storage.update_archetypes();
+
+    ice::ecs::EntityOperations operations{ alloc, storage.entities(), archetypes };
+    ice::ShardContainer shards{ alloc };
+
+    TestPosition const positions[]{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+    TestHealth const health[]{ { 10.f }, { 20.f } };
+
+    ice::Array<ice::ecs::Entity> moving{ alloc };
+    ice::Array<ice::ecs::Entity> living{ alloc };
+    operations.create(arch_position, 3).with_data(ice::Span<TestPosition const>{ positions }).store(moving);
+    operations.create(arch_position_health, 2)
+        .with_data(ice::Span<TestPosition const>{ positions, 2 }, ice::Span<TestHealth const>{ health })
+        .store(living);
+    storage.execute_operations(operations, shards);
+    operations.clear();
+
+    ice::Memory const image = storage.snapshot(alloc);
+    REQUIRE(image.location != nullptr);
+
+    GIVEN("a storage with the same archetypes")
+    {
+        ice::ecs::EntityStorage restored{ alloc, archetypes };
+
+        THEN("all entities and their data are restored")
+        {
+            REQUIRE(restored.restore(ice::data_view(image)));
+            CHECK(restored.entities().count() == storage.entities().count());
+
+            for (ice::u32 idx = 0; idx < ice::count(positions); ++idx)
+            {
+                REQUIRE(restored.entities().is_alive(moving[idx]));
+                TestPosition const* const position = read_component<TestPosition>(restored, arch_position, moving[idx]);
+                REQUIRE(position != nullptr);
+                CHECK(position->x == positions[idx].x);
+                CHECK(position->y == positions[idx].y);
+            }
+
+            for (ice::u32 idx = 0; idx < ice::count(health); ++idx)
+            {
+                REQUIRE(restored.entities().is_alive(living[idx]));
+                TestHealth const* const value = read_component<TestHealth>(restored, arch_position_health, living[idx]);
+                REQUIRE(value != nullptr);
+                CHECK(value->value == health[idx].value);
+            }
+        }
+
+        THEN("a snapshot of the restored storage is identical")
+        {
+            REQUIRE(restored.restore(ice::data_view(image)));
+
+            ice::Memory const second_image = restored.snapshot(alloc);
+            REQUIRE(second_image.size == image.size);
+            CHECK(std::memcmp(second_image.location, image.location, image.size.value) == 0);
+            alloc.deallocate(second_image);
+        }
+    }
+
+    GIVEN("a corrupted image")
+    {
+        ice::ecs::EntityStorage restored{ alloc, archetypes };
+        restored.update_archetypes();
+
+        ice::Array<ice::ecs::Entity> existing{ alloc };
+
+        ice::ecs::EntityOperations restored_operations{ alloc, restored.entities(), archetypes };
+        restored_operations.create(arch_position, 1).with_data(TestPosition{ 42, 42 }).store(existing);
+        restored.execute_operations(restored_operations, shards);
+        ice::u32 const existing_count = restored.entities().count();
+
+        ice::Memory const corrupted = alloc.allocate({ image.size, ice::ualign::b_8 });
+        ice::memcpy(corrupted, ice::data_view(image));
+
+        auto const check_unchanged = [&]()
+        {
+            CHECK(restored.entities().count() == existing_count);
+            TestPosition const* const position = read_component<TestPosition>(restored, arch_position, existing[0]);
+            REQUIRE(position != nullptr);
+            CHECK(position->x == 42);
+        };
+
+        WHEN("the image is truncated")
+        {
+            ice::Data const truncated{ corrupted.location, { image.size.value / 2 }, corrupted.alignment };
+            CHECK(restored.restore(truncated) == false);
+            check_unchanged();
+        }
+
+        WHEN("the header is invalid")
+        {
+            *reinterpret_cast<ice::u32*>(corrupted.location) = 0;
+            CHECK(restored.restore(ice::data_view(corrupted)) == false);
+            check_unchanged();
+        }
+
+        WHEN("a data slot points outside of the stored blocks")
+        {
+            ice::ecs::EntityDataSlot* const slot = find_data_slot(corrupted, storage, living[0], living[1]);
+            REQUIRE(slot != nullptr);
+            REQUIRE(slot->archetype != 0);
+
+            THEN("an invalid block index is rejected")
+            {
+                slot->block = 7;
+                CHECK(restored.restore(ice::data_view(corrupted)) == false);
+                check_unchanged();
+            }
+
+            THEN("an invalid entity index is rejected")
+            {
+                slot->index = 100;
+                CHECK(restored.restore(ice::data_view(corrupted)) == false);
+                check_unchanged();
+            }
+
+            THEN("an unknown archetype instance is rejected")
+            {
+                slot->archetype = 100;
+                CHECK(restored.restore(ice::data_view(corrupted)) == false);
+                check_unchanged();
+            }
+        }
+
+        alloc.deallocate(corrupted);
+    }
+
+    alloc.deallocate(image);
+}
@@ -148,6 +148,9 @@ namespace ice
             world_updater.update(current_tasks, task_params, { update_shard });
         }
 
+        // Keep asset memory within the configured budgets, runs on the asset storage scheduler.
+        current_tasks.create_tasks(1, "engine.runner.asset-residency"_shardid)[0] = _engine.assets().update_residency();
+
         co_await current_tasks.await_tasks_scheduled_on(_schedulers.main, _schedulers.main);
     }
 
@@ -9,6 +9,10 @@
 #include <ice/devui_context.hxx>
 #include <ice/engine_shards.hxx>
 #include <ice/engine_state_tracker.hxx>
+#include <ice/engine_params.hxx>
+#include <ice/task_scoped_container.hxx>
+#include <ice/task_utils.hxx>
+#include <ice/profiler.hxx>
 
 namespace ice
 {
@@ -48,6 +52,15 @@ namespace ice
             ice::shards::push_back(out_shards, shard);
         }
 
+        auto update_world_group(
+            ice::Array<ice::Task<>> tasks,
+            ice::TaskScheduler& scheduler
+        ) noexcept -> ice::Task<>
+        {
+            IPT_ZONE_SCOPED;
+            co_await ice::await_scheduled(ice::array::slice(tasks), scheduler);
+        }
+
     } // namespace detail
 
     IceshardWorldManager::IceshardWorldManager(
@@ -141,7 +154,12 @@ namespace ice
             _devui_tasks.get()
         );
 
-        Entry world_entry{ .context = ice::move(world_context), .world = world };
+        Entry world_entry{
+            .context = ice::move(world_context),
+            .world = world,
+            .is_active = false,
+            .parallel_update = world_template.parallel_update
+        };
 
         // Add a new pending event
         ice::shards::push_back(
@@ -222,7 +240,7 @@ namespace ice
         {
             if (world_entry.is_active)
             {
-                world_entry.world->task_launcher().gather(out_tasks, params, event_shards);
+                gather_world_tasks(world_entry, out_tasks, params, event_shards);
             }
         }
     }
@@ -237,7 +255,35 @@ namespace ice
         Entry const* const entry = ice::hashmap::try_get(_worlds, ice::hash(world_name));
         if (entry != nullptr && entry->is_active)
         {
-            entry->world->task_launcher().gather(out_tasks, params, event_shards);
+            gather_world_tasks(*entry, out_tasks, params, event_shards);
+        }
+    }
+
+    void IceshardWorldManager::gather_world_tasks(
+        Entry const& entry,
+        ice::TaskContainer& out_tasks,
+        ice::EngineParamsBase const& params,
+        ice::Span<ice::Shard const> event_shards
+    ) noexcept
+    {
+        // Only logic tasks can be moved, graphics and render tasks are bound to their own threads.
+        if (entry.parallel_update == false || params.task_type != TraitTaskType::Logic)
+        {
+            entry.world->task_launcher().gather(out_tasks, params, event_shards);
+            return;
+        }
+
+        ice::ScopedTaskContainer world_tasks{ _allocator };
+        entry.world->task_launcher().gather(world_tasks, params, event_shards);
+
+        ice::Array<ice::Task<>> tasks = world_tasks.extract_tasks();
+        if (ice::array::any(tasks))
+        {
+            // The whole group is awaited by the runner together with all other frame tasks.
+            ice::LogicTaskParams const& logic_params = static_cast<ice::LogicTaskParams const&>(params);
+            out_tasks.create_tasks(1, "engine.worlds.update-group"_shardid)[0] = detail::update_world_group(
+                ice::move(tasks), logic_params.schedulers.tasks
+            );
         }
     }
 
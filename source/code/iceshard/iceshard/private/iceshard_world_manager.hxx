@@ -76,8 +76,16 @@ namespace ice
             ice::UniquePtr<ice::IceshardWorldContext> context;
             ice::IceshardWorld* world;
             bool is_active;
+            bool parallel_update;
         };
 
+        void gather_world_tasks(
+            Entry const& entry,
+            ice::TaskContainer& out_tasks,
+            ice::EngineParamsBase const& params,
+            ice::Span<ice::Shard const> event_shards
+        ) noexcept;
+
     private:
         ice::HashMap<Entry> _worlds;
         ice::ShardContainer _pending_events;
@@ -9,6 +9,16 @@
 #include <ice/font.hxx>
 #include <ice/font_utils.hxx>
 #include <ice/task_utils.hxx>
+#include <ice/string_utils.hxx>
+#include <ice/native_file.hxx>
+#include <ice/resource_compiler_api.hxx>
+#include <ice/resource_tracker.hxx>
+#include <ice/container/array.hxx>
+#include <ice/log.hxx>
+#include <ice/hash.hxx>
+
+#include <thread>
+#include <bit>
 
 #if ISP_WINDOWS
 
@@ -29,17 +39,51 @@ namespace ice
     {
         using ice::Font;
         using ice::FontAtlas;
+        using ice::FontGlyphIndex;
         using ice::GlyphRange;
         using ice::Glyph;
 
         static_assert(ice::align_of<Font> == ice::ualign::b_8);
         static_assert(ice::align_of<FontAtlas> == ice::ualign::b_4);
         static_assert(ice::align_of<GlyphRange> == ice::ualign::b_4);
+        static_assert(ice::align_of<FontGlyphIndex> == ice::ualign::b_4);
+
+        ice::f32 const atlas_width = static_cast<ice::f32>(bitmap.width);
+        ice::f32 const atlas_height = static_cast<ice::f32>(bitmap.height);
+
+        // Glyphs are converted first, so we know the size of the glyph tables we need to bake.
+        ice::Array<Glyph> font_glyphs{ alloc };
+        ice::array::reserve(font_glyphs, ice::ucount(glyphs.size()));
+        for (msdf_atlas::GlyphGeometry const& glyph_geometry : glyphs)
+        {
+            ice::i32 x, y, w, h;
+            glyph_geometry.getBoxRect(x, y, w, h);
+
+            ice::vec<4,ice::f64> l;
+            glyph_geometry.getQuadPlaneBounds(l.x, l.y, l.z, l.w);
+
+            Glyph gfx_glyph;
+            gfx_glyph.atlas_x = static_cast<ice::f32>(x) / atlas_width;
+            gfx_glyph.atlas_y = static_cast<ice::f32>(y) / atlas_height;
+            gfx_glyph.atlas_w = static_cast<ice::f32>(w) / atlas_width;
+            gfx_glyph.atlas_h = static_cast<ice::f32>(h) / atlas_height;
+            gfx_glyph.advance = static_cast<ice::f32>(glyph_geometry.getAdvance());
+            gfx_glyph.offset.x = static_cast<ice::f32>(l.x);
+            gfx_glyph.offset.y = static_cast<ice::f32>(l.y);
+            gfx_glyph.size.x = static_cast<ice::f32>(l.z - l.x);
+            gfx_glyph.size.y = static_cast<ice::f32>(l.y - l.w);
+            gfx_glyph.codepoint = static_cast<ice::u32>(glyph_geometry.getCodepoint());
+            ice::array::push_back(font_glyphs, gfx_glyph);
+        }
+
+        ice::FontGlyphTableInfo const table_info = ice::font_glyph_table_info(font_glyphs);
 
         ice::meminfo font_meminfo = ice::meminfo_of<Font>;
         ice::usize const offset_atlas = font_meminfo += ice::meminfo_of<FontAtlas>;
         ice::usize const offset_glyphrange = font_meminfo += ice::meminfo_of<GlyphRange>;
         ice::usize const offset_glyphs = font_meminfo += ice::meminfo_of<Glyph> * glyphs.size();
+        ice::usize const offset_glyph_sparse = font_meminfo += ice::meminfo_of<FontGlyphIndex> * table_info.sparse_count;
+        ice::usize const offset_glyph_table = font_meminfo += ice::meminfo_of<ice::u16> * table_info.table_size;
         ice::usize const offset_bitmap = font_meminfo += ice::meminfo_of<msdfgen::byte> * bitmap.width * bitmap.height * 4;
 
         ice::Memory font_mem = alloc.allocate(font_meminfo);
@@ -49,16 +93,14 @@ namespace ice
         FontAtlas* gfx_atlas = reinterpret_cast<FontAtlas*>(ice::ptr_add(font_mem.location, offset_atlas));
         // TODO: Multi range support
         GlyphRange* gfx_glyph_range = reinterpret_cast<GlyphRange*>(ice::ptr_add(font_mem.location, offset_glyphrange));
-        Glyph* font_glyphs = reinterpret_cast<Glyph*>(ice::ptr_add(font_mem.location, offset_glyphs));
+        Glyph* gfx_glyphs = reinterpret_cast<Glyph*>(ice::ptr_add(font_mem.location, offset_glyphs));
+        FontGlyphIndex* gfx_glyph_sparse = reinterpret_cast<FontGlyphIndex*>(ice::ptr_add(font_mem.location, offset_glyph_sparse));
+        ice::u16* gfx_glyph_table = reinterpret_cast<ice::u16*>(ice::ptr_add(font_mem.location, offset_glyph_table));
         void* atlas_bitmap = ice::ptr_add(font_mem.location, offset_bitmap);
 
         void const* end_ptr = ice::ptr_add(atlas_bitmap, ice::size_of<msdfgen::byte> * bitmap.width * bitmap.height * 4);
         ICE_ASSERT(end_ptr == ice::ptr_add(font_mem.location, font_meminfo.size), "Insufficient memory!");
 
-        gfx_font->atlases = { gfx_atlas, 1 };
-        gfx_font->ranges = { gfx_glyph_range, 1 };
-        gfx_font->glyphs = { font_glyphs, ice::ucount(glyphs.size()) };
-
         gfx_glyph_range->type = ice::GlyphRangeType::Explicit;
         gfx_glyph_range->glyph_count = ice::ucount(glyphs.size());
         gfx_glyph_range->glyph_index = 0;
@@ -68,60 +110,230 @@ namespace ice
         gfx_atlas->image_data_offset = ice::u32(offset_bitmap.value);
         gfx_atlas->image_data_size = bitmap.width * bitmap.height * 4;
 
+        ice::memcpy(gfx_glyphs, ice::array::begin(font_glyphs), ice::array::size_bytes(font_glyphs));
+        ice::font_build_glyph_table(
+            font_glyphs,
+            { gfx_glyph_table, table_info.table_size },
+            { gfx_glyph_sparse, table_info.sparse_count }
+        );
 
-        ice::u32* offset = reinterpret_cast<ice::u32*>(std::addressof(gfx_font->atlases));
-        offset[0] = ice::u32(offset_atlas.value);
-        offset[1] = 1;
+        // Spans are stored as pairs of (offset, count) relative to the font object.
+        auto const store_offset = [](auto& span, ice::usize offset, ice::u32 count) noexcept
+        {
+            ice::u32* const values = reinterpret_cast<ice::u32*>(std::addressof(span));
+            values[0] = ice::u32(offset.value);
+            values[1] = count;
+        };
 
-        offset = reinterpret_cast<ice::u32*>(std::addressof(gfx_font->ranges));
-        offset[0] = ice::u32(offset_glyphrange.value);
-        offset[1] = 1;
+        store_offset(gfx_font->atlases, offset_atlas, 1);
+        store_offset(gfx_font->ranges, offset_glyphrange, 1);
+        store_offset(gfx_font->glyphs, offset_glyphs, static_cast<ice::u32>(glyphs.size()));
+        store_offset(gfx_font->glyph_table, offset_glyph_table, table_info.table_size);
+        store_offset(gfx_font->glyph_table_sparse, offset_glyph_sparse, table_info.sparse_count);
 
-        offset = reinterpret_cast<ice::u32*>(std::addressof(gfx_font->glyphs));
-        offset[0] = ice::u32(offset_glyphs.value);
-        offset[1] = static_cast<ice::u32>(glyphs.size());
+        ice::memcpy(atlas_bitmap, bitmap.pixels, gfx_atlas->image_data_size);
+        return font_mem;
+    }
 
-        ice::f32 const atlas_width = static_cast<ice::f32>(bitmap.width);
-        ice::f32 const atlas_height = static_cast<ice::f32>(bitmap.height);
+    struct FontCompilerContext
+    {
+        ice::TaskScheduler* scheduler;
+        ice::native_file::HeapFilePath cache_dir;
+    };
 
-        ice::u32 glyph_idx = 0;
-        for (msdf_atlas::GlyphGeometry const& glyph_geometry : glyphs)
-        {
-            ice::i32 x, y, w, h;
-            glyph_geometry.getBoxRect(x, y, w, h);
+    inline auto font_context(ice::ResourceCompilerCtx& ctx) noexcept -> ice::FontCompilerContext*
+    {
+        return reinterpret_cast<ice::FontCompilerContext*>(ctx.userdata);
+    }
 
-            ice::vec<4,ice::f64> l;
-            glyph_geometry.getQuadPlaneBounds(l.x, l.y, l.z, l.w);
+    bool asset_font_context_prepare(
+        ice::Allocator& alloc,
+        ice::ResourceCompilerCtx& ctx,
+        ice::Span<ice::Shard const> params
+    ) noexcept
+    {
+        ice::FontCompilerContext* const font_ctx = alloc.create<ice::FontCompilerContext>(
+            nullptr, ice::native_file::HeapFilePath{ alloc }
+        );
 
-            Glyph& gfx_glyph = font_glyphs[glyph_idx];
-            gfx_glyph.atlas_x = static_cast<ice::f32>(x) / atlas_width;
-            gfx_glyph.atlas_y = static_cast<ice::f32>(y) / atlas_height;
-            gfx_glyph.atlas_w = static_cast<ice::f32>(w) / atlas_width;
-            gfx_glyph.atlas_h = static_cast<ice::f32>(h) / atlas_height;
-            gfx_glyph.advance = static_cast<ice::f32>(glyph_geometry.getAdvance());
-            gfx_glyph.offset.x = static_cast<ice::f32>(l.x);
-            gfx_glyph.offset.y = static_cast<ice::f32>(l.y);
-            gfx_glyph.size.x = static_cast<ice::f32>(l.z - l.x);
-            gfx_glyph.size.y = static_cast<ice::f32>(l.y - l.w);
-            gfx_glyph.codepoint = static_cast<ice::u32>(glyph_geometry.getCodepoint());
+        ice::u32 idx;
+        if (ice::search(params, ice::ShardID_FontGlyphScheduler, idx))
+        {
+            ice::shard_inspect(params[idx], font_ctx->scheduler);
+        }
 
-            glyph_idx += 1;
+        char const* cache_dir = nullptr;
+        if (ice::search(params, ice::ShardID_FontGlyphCache, idx) && ice::shard_inspect(params[idx], cache_dir))
+        {
+            ice::native_file::path_from_string(font_ctx->cache_dir, cache_dir);
+            if (ice::native_file::is_directory(font_ctx->cache_dir) == false
+                && ice::native_file::create_directory(font_ctx->cache_dir) == false)
+            {
+                ICE_LOG(
+                    LogSeverity::Warning, LogTag::Tool,
+                    "Failed to create font glyph cache directory '{}', glyphs won't be cached.",
+                    cache_dir
+                );
+                ice::string::clear(font_ctx->cache_dir);
+            }
         }
 
-        ice::memcpy(atlas_bitmap, bitmap.pixels, gfx_atlas->image_data_size);
-        return font_mem;
+        ctx.userdata = font_ctx;
+        return true;
     }
 
-    auto asset_font_oven(
-        void*,
-        ice::Allocator& alloc,
-        ice::ResourceTracker const& tracker,
-        ice::LooseResource const& resource,
-        ice::Data data,
-        ice::Memory& memory
-    ) noexcept -> ice::Task<bool>
+    bool asset_font_context_cleanup(ice::Allocator& alloc, ice::ResourceCompilerCtx& ctx) noexcept
     {
-        bool result = true;
+        alloc.destroy(font_context(ctx));
+        return true;
+    }
+
+    //! \brief Generates or loads from cache the MTSDF bitmap of a single glyph and stores it in the atlas.
+    struct FontGlyphGenerator
+    {
+        using BitmapStorage = msdf_atlas::BitmapAtlasStorage<msdfgen::byte, 4>;
+
+        //! \brief Version of cached glyph tiles, needs to be bumped every time the tile format or the generation
+        //!   process changes in a way not captured by the values stored in this object.
+        static constexpr ice::u64 Constant_GlyphCacheVersion = 2;
+
+        ice::Allocator& alloc;
+        ice::FontCompilerContext const& ctx;
+        msdf_atlas::GeneratorAttributes const& attribs;
+        BitmapStorage& storage;
+        ice::u64 font_hash;
+        ice::f64 pixel_range;
+        ice::f64 edge_coloring_angle;
+        ice::u64 edge_coloring_seed;
+
+        //! \returns Cache file path for the given glyph, based on everything that affects the generated bitmap.
+        auto cache_path(msdf_atlas::GlyphGeometry const& glyph) const noexcept -> ice::native_file::HeapFilePath
+        {
+            ice::i32 w, h;
+            glyph.getBoxSize(w, h);
+
+            msdfgen::Vector2 const translate = glyph.getBoxTranslate();
+            msdfgen::ErrorCorrectionConfig const& error_correction = attribs.config.errorCorrection;
+
+            ice::u64 const key_values[]{
+                Constant_GlyphCacheVersion,
+                font_hash,
+                ice::u64(glyph.getIndex()),
+                std::bit_cast<ice::u64>(pixel_range),
+                std::bit_cast<ice::u64>(edge_coloring_angle),
+                edge_coloring_seed,
+                (ice::u64(attribs.scanlinePass) << 1) | ice::u64(attribs.config.overlapSupport),
+                (ice::u64(error_correction.mode) << 32) | ice::u64(error_correction.distanceCheckMode),
+                std::bit_cast<ice::u64>(error_correction.minDeviationRatio),
+                std::bit_cast<ice::u64>(error_correction.minImproveRatio),
+                std::bit_cast<ice::u64>(glyph.getBoxScale()),
+                std::bit_cast<ice::u64>(translate.x),
+                std::bit_cast<ice::u64>(translate.y),
+                (ice::u64(w) << 32) | ice::u64(h),
+            };
+            ice::u64 const key = ice::hash(std::string_view{ reinterpret_cast<char const*>(key_values), sizeof(key_values) });
+
+            ice::HeapString<> filename{ alloc };
+            ice::string::push_format(filename, "{:016x}.mtsdf", key);
+
+            ice::native_file::HeapFilePath result{ alloc, ctx.cache_dir };
+            ice::native_file::path_join_string(result, filename);
+            return result;
+        }
+
+        void generate(msdf_atlas::GlyphGeometry const& glyph) const noexcept
+        {
+            if (glyph.isWhitespace())
+            {
+                return;
+            }
+
+            ice::i32 x, y, w, h;
+            glyph.getBoxRect(x, y, w, h);
+
+            msdfgen::Bitmap<msdfgen::byte, 4> tile{ w, h };
+            ice::Memory const tile_memory{
+                .location = static_cast<msdfgen::byte*>(tile),
+                .size = ice::size_of<msdfgen::byte> * w * h * 4,
+                .alignment = ice::align_of<msdfgen::byte>
+            };
+
+            bool const use_cache = ice::string::any(ctx.cache_dir);
+            ice::native_file::HeapFilePath const tile_path = use_cache ? cache_path(glyph) : ice::native_file::HeapFilePath{ alloc };
+            if (use_cache && ice::native_file::sizeof_file(tile_path) == tile_memory.size)
+            {
+                ice::native_file::File const file = ice::native_file::open_file(tile_path);
+                if (file && ice::native_file::read_file(file, tile_memory.size, tile_memory) == tile_memory.size)
+                {
+                    storage.put(x, y, msdfgen::BitmapConstRef<msdfgen::byte, 4>{ tile });
+                    return;
+                }
+            }
+
+            msdfgen::Bitmap<ice::f32, 4> glyph_bitmap{ w, h };
+            msdf_atlas::mtsdfGenerator(glyph_bitmap, glyph, attribs);
+
+            ice::f32 const* const pixels = static_cast<ice::f32 const*>(glyph_bitmap);
+            msdfgen::byte* const tile_pixels = static_cast<msdfgen::byte*>(tile);
+            for (ice::i32 idx = 0; idx < w * h * 4; ++idx)
+            {
+                tile_pixels[idx] = msdfgen::pixelFloatToByte(pixels[idx]);
+            }
+
+            if (use_cache)
+            {
+                // Tiles are moved into place once fully written, so other compilers never read a partially written tile.
+                ice::native_file::HeapFilePath temp_path{ alloc, tile_path };
+                ice::native_file::path_append_temporary_suffix(temp_path);
+
+                bool written = false;
+                {
+                    using enum ice::native_file::FileOpenFlags;
+                    ice::native_file::File const file = ice::native_file::open_file(temp_path, Write);
+                    written = file && ice::native_file::write_file(
+                        file, 0_B, ice::Data{ tile_memory.location, tile_memory.size, tile_memory.alignment }
+                    ) == tile_memory.size;
+                }
+
+                bool const stored = written && ice::native_file::rename_file(temp_path, tile_path);
+                ICE_LOG_IF(
+                    stored == false,
+                    LogSeverity::Warning, LogTag::Tool,
+                    "Failed to store glyph {} in the font glyph cache.",
+                    glyph.getIndex()
+                );
+            }
+
+            // Glyph boxes don't overlap, so tiles can be stored from multiple threads at the same time.
+            storage.put(x, y, msdfgen::BitmapConstRef<msdfgen::byte, 4>{ tile });
+        }
+
+        auto generate_task(msdf_atlas::GlyphGeometry const& glyph) const noexcept -> ice::Task<>
+        {
+            generate(glyph);
+            co_return;
+        }
+    };
+
+    auto asset_font_compile(
+        ice::ResourceCompilerCtx& ctx,
+        ice::ResourceHandle const& resource_handle,
+        ice::ResourceTracker& resource_tracker,
+        ice::Span<ice::ResourceHandle const> sources,
+        ice::Span<ice::URI const> dependencies,
+        ice::Allocator& result_alloc
+    ) noexcept -> ice::Task<ice::ResourceCompilerResult>
+    {
+        ice::FontCompilerContext const& font_ctx = *font_context(ctx);
+
+        ice::ResourceResult const res = co_await resource_tracker.load_resource(resource_handle);
+        if (res.resource_status != ResourceStatus::Loaded)
+        {
+            co_return { };
+        }
+
+        ice::Data const data = res.data;
+        ice::Memory result{ };
 
         msdfgen::FreetypeHandle* const freetype = msdfgen::initializeFreetype();
         if (freetype != nullptr)
@@ -131,7 +343,8 @@ namespace ice
             {
                 msdf_atlas::Charset charset = msdf_atlas::Charset::ASCII;
 
-                ice::Memory mem = co_await resource.load_named_part("charset"_sid, alloc);
+                ice::LooseResource const* const resource = ice::get_loose_resource(resource_handle);
+                ice::Memory mem = co_await resource->load_named_part("charset"_sid, result_alloc);
                 if (mem.location != nullptr)
                 {
                     charset = msdf_atlas::Charset{};
@@ -147,7 +360,7 @@ namespace ice
                         chars += byte_count;
                     }
 
-                    alloc.deallocate(mem);
+                    result_alloc.deallocate(mem);
                 }
 
                 {
@@ -161,53 +374,73 @@ namespace ice
 
                     // Apply MSDF edge coloring
                     ice::f64 constexpr maxCornerAngle = 3.0;
+                    ice::u64 constexpr coloringSeed = 0;
                     for (msdf_atlas::GlyphGeometry& glyph_geometry : glyphs)
                     {
-                        glyph_geometry.edgeColoring(&msdfgen::edgeColoringInkTrap, maxCornerAngle, 0);
+                        glyph_geometry.edgeColoring(&msdfgen::edgeColoringInkTrap, maxCornerAngle, coloringSeed);
                     }
 
+                    ice::f64 constexpr pixel_range = 2.0;
+
                     msdf_atlas::TightAtlasPacker atlas_packer;
                     atlas_packer.setDimensionsConstraint(msdf_atlas::TightAtlasPacker::DimensionsConstraint::SQUARE);
                     atlas_packer.setMinimumScale(32.0);
-                    atlas_packer.setPixelRange(2.0);
+                    atlas_packer.setPixelRange(pixel_range);
                     atlas_packer.setMiterLimit(1.0);
                     atlas_packer.pack(glyphs.data(), int(glyphs.size()));
 
                     ice::i32 width, height;
                     atlas_packer.getDimensions(width, height);
 
-                    ice::i32 constexpr atlas_channels = 4;
-
-                    using BitmapConstRef = msdfgen::BitmapConstRef<msdfgen::byte, atlas_channels>;
-                    using BitmapStorage = msdf_atlas::BitmapAtlasStorage<msdf_atlas::byte, atlas_channels>;
-                    using BitmapAtlasGenerator = msdf_atlas::ImmediateAtlasGenerator<
-                        float,
-                        atlas_channels,
-                        msdf_atlas::mtsdfGenerator,
-                        BitmapStorage
-                    >;
-
-                    BitmapAtlasGenerator bitmapGenerator{ width, height };
-
+                    FontGlyphGenerator::BitmapStorage storage{ width, height };
                     msdf_atlas::GeneratorAttributes attribs;
-                    bitmapGenerator.setAttributes(attribs);
-                    bitmapGenerator.setThreadCount(2);
-                    bitmapGenerator.generate(glyphs.data(), int(glyphs.size()));
 
-                    memory = ice::create_engine_object(
-                        alloc,
+                    FontGlyphGenerator const generator{
+                        .alloc = result_alloc,
+                        .ctx = font_ctx,
+                        .attribs = attribs,
+                        .storage = storage,
+                        .font_hash = ice::hash(std::string_view{ reinterpret_cast<char const*>(data.location), data.size.value }),
+                        .pixel_range = pixel_range,
+                        .edge_coloring_angle = maxCornerAngle,
+                        .edge_coloring_seed = coloringSeed,
+                    };
+
+                    if (font_ctx.scheduler != nullptr)
+                    {
+                        // Each glyph is a separate task, so the whole thread pool can work on a single font.
+                        ice::Array<ice::Task<>> tasks{ result_alloc };
+                        ice::array::reserve(tasks, ice::ucount(glyphs.size()));
+                        for (msdf_atlas::GlyphGeometry const& glyph : glyphs)
+                        {
+                            ice::array::push_back(tasks, generator.generate_task(glyph));
+                        }
+
+                        co_await ice::await_scheduled(tasks, *font_ctx.scheduler);
+                    }
+                    else
+                    {
+                        msdf_atlas::Workload{
+                            [&](int idx, int /*thread_idx*/) noexcept -> bool
+                            {
+                                generator.generate(glyphs[idx]);
+                                return true;
+                            },
+                            int(glyphs.size())
+                        }.finish(int(ice::max(std::thread::hardware_concurrency(), 1u)));
+                    }
+
+                    result = ice::create_engine_object(
+                        result_alloc,
                         glyphs,
-                        bitmapGenerator.atlasStorage()
+                        msdfgen::BitmapConstRef<msdfgen::byte, 4>{ storage }
                     );
-
-                    BitmapConstRef bitmap_ref = bitmapGenerator.atlasStorage();
-                    msdfgen::savePng(bitmap_ref, "test.png");
                     msdfgen::destroyFont(font);
                 }
             }
             msdfgen::deinitializeFreetype(freetype);
         }
-        co_return result;
+        co_return ResourceCompilerResult{ result };
     }
 
     auto asset_font_loader(
@@ -231,20 +464,40 @@ namespace ice
         font->ranges = { reinterpret_cast<ice::GlyphRange const*>(ice::ptr_add(raw_font, { offsets[0] })), offsets[1] };
         offsets = reinterpret_cast<ice::u32 const*>(ice::addressof(raw_font->glyphs));
         font->glyphs = { reinterpret_cast<ice::Glyph const*>(ice::ptr_add(raw_font, { offsets[0] })), offsets[1] };
+        offsets = reinterpret_cast<ice::u32 const*>(ice::addressof(raw_font->glyph_table));
+        font->glyph_table = { reinterpret_cast<ice::u16 const*>(ice::ptr_add(raw_font, { offsets[0] })), offsets[1] };
+        offsets = reinterpret_cast<ice::u32 const*>(ice::addressof(raw_font->glyph_table_sparse));
+        font->glyph_table_sparse = { reinterpret_cast<ice::FontGlyphIndex const*>(ice::ptr_add(raw_font, { offsets[0] })), offsets[1] };
         co_return true;
     }
 
-    void asset_category_font_definition(ice::AssetCategoryArchive& asset_category_archive) noexcept
+    auto asset_font_supported_resources(
+        ice::Span<ice::Shard const> params
+    ) noexcept -> ice::Span<ice::String const>
     {
         static ice::String extensions[]{ ".ttf" };
+        return extensions;
+    }
+
+    void asset_category_font_definition(
+        ice::AssetCategoryArchive& asset_category_archive,
+        ice::ModuleQuery const& module_query
+    ) noexcept
+    {
+        // The archive only adopts compilers reporting at least one of the category extensions.
+        static ice::ResourceCompiler const compiler{
+            .fn_supported_resources = asset_font_supported_resources,
+            .fn_prepare_context = asset_font_context_prepare,
+            .fn_cleanup_context = asset_font_context_cleanup,
+            .fn_compile_source = asset_font_compile,
+        };
 
-        static ice::AssetCategoryDefinition definition{
-            .resource_extensions = extensions,
-            // .fn_asset_oven = asset_font_oven,
+        static ice::AssetCategoryDefinition const definition{
+            .resource_extensions = asset_font_supported_resources({}),
             .fn_asset_loader = asset_font_loader
         };
 
-        asset_category_archive.register_category(ice::AssetCategory_Font, definition);
+        asset_category_archive.register_category(ice::AssetCategory_Font, definition, &compiler);
     }
 
 } // namespace ice
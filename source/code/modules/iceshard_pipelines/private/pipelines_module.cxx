@@ -17,6 +17,11 @@ namespace ice
     {
         static void v1_archive_api(ice::detail::asset_system::v1::AssetArchiveAPI& api) noexcept;
 
+        static void register_categories(
+            ice::AssetCategoryArchive& asset_category_archive,
+            ice::ModuleQuery const& module_query
+        ) noexcept;
+
         static bool on_load(ice::Allocator& alloc, ice::ModuleNegotiator auto const& negotiator) noexcept
         {
             ice::LogModule::init(alloc, negotiator);
@@ -28,7 +33,18 @@ namespace ice
 
     void IceShardPipelinesModule::v1_archive_api(ice::detail::asset_system::v1::AssetArchiveAPI& api) noexcept
     {
-        api.fn_register_categories = ice::asset_category_image_definition;
+        api.fn_register_categories = register_categories;
+    }
+
+    void IceShardPipelinesModule::register_categories(
+        ice::AssetCategoryArchive& asset_category_archive,
+        ice::ModuleQuery const& module_query
+    ) noexcept
+    {
+        ice::asset_category_image_definition(asset_category_archive, module_query);
+#if ISP_WINDOWS
+        ice::asset_category_font_definition(asset_category_archive, module_query);
+#endif
     }
 
 } // namespace ice
@@ -0,0 +1,290 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "null_commands.hxx"
+#include <ice/render/render_image.hxx>
+#include <ice/mem_utils.hxx>
+#include <ice/assert.hxx>
+
+namespace ice::render::null
+{
+
+    namespace detail
+    {
+
+        constexpr auto pack(ice::u32 high, ice::u32 low) noexcept -> ice::u64
+        {
+            return (ice::u64{ high } << 32) | ice::u64{ low };
+        }
+
+        template<typename... Args>
+        void record(ice::render::CommandBuffer cmds, NullCommandType type, Args... args) noexcept
+        {
+            NullCommandBuffer* const null_cmds = NullCommandBuffer::native(cmds);
+            ICE_ASSERT_CORE(null_cmds != nullptr);
+
+            ice::u64 const words[]{ pack(ice::u32(type), sizeof...(Args)), static_cast<ice::u64>(args)... };
+            ice::array::push_back(null_cmds->stream, ice::Span<ice::u64 const>{ words });
+            null_cmds->stats.commands += 1;
+        }
+
+        auto stats(ice::render::CommandBuffer cmds) noexcept -> ice::render::RenderStats&
+        {
+            return NullCommandBuffer::native(cmds)->stats;
+        }
+
+    } // namespace detail
+
+    void NullRenderCommands::begin(
+        ice::render::CommandBuffer cmds
+    ) noexcept
+    {
+        // Starting a recording resets the command buffer, same as on other APIs.
+        NullCommandBuffer* const null_cmds = NullCommandBuffer::native(cmds);
+        ice::array::clear(null_cmds->stream);
+        null_cmds->stats = { };
+        null_cmds->stats.command_buffers = 1;
+
+        detail::record(cmds, NullCommandType::Begin, null_cmds->type);
+    }
+
+    void NullRenderCommands::begin_renderpass(
+        ice::render::CommandBuffer cmds,
+        ice::render::Renderpass renderpass,
+        ice::render::Framebuffer framebuffer,
+        ice::vec2u extent,
+        ice::vec4f clear_color
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::BeginRenderpass, renderpass, framebuffer, detail::pack(extent.x, extent.y));
+        detail::stats(cmds).renderpasses += 1;
+    }
+
+    void NullRenderCommands::begin_renderpass(
+        ice::render::CommandBuffer cmds,
+        ice::render::Renderpass renderpass,
+        ice::render::Framebuffer framebuffer,
+        ice::Span<ice::vec4f const> clear_values,
+        ice::vec2u extent
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::BeginRenderpass, renderpass, framebuffer, detail::pack(extent.x, extent.y));
+        detail::stats(cmds).renderpasses += 1;
+    }
+
+    void NullRenderCommands::next_subpass(
+        ice::render::CommandBuffer cmds,
+        ice::render::SubPassContents contents
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::NextSubpass, contents);
+    }
+
+    void NullRenderCommands::set_viewport(
+        ice::render::CommandBuffer cmds,
+        ice::vec4u viewport_rect
+    ) noexcept
+    {
+        detail::record(
+            cmds, NullCommandType::SetViewport,
+            detail::pack(viewport_rect.x, viewport_rect.y),
+            detail::pack(viewport_rect.z, viewport_rect.w)
+        );
+    }
+
+    void NullRenderCommands::set_scissor(
+        ice::render::CommandBuffer cmds,
+        ice::vec4u scissor_rect
+    ) noexcept
+    {
+        detail::record(
+            cmds, NullCommandType::SetScissor,
+            detail::pack(scissor_rect.x, scissor_rect.y),
+            detail::pack(scissor_rect.z, scissor_rect.w)
+        );
+    }
+
+    void NullRenderCommands::bind_pipeline(
+        ice::render::CommandBuffer cmds,
+        ice::render::Pipeline pipeline
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::BindPipeline, pipeline);
+        detail::stats(cmds).pipeline_binds += 1;
+    }
+
+    void NullRenderCommands::bind_resource_set(
+        ice::render::CommandBuffer cmds,
+        ice::render::PipelineLayout pipeline_layout,
+        ice::render::ResourceSet resource_set,
+        ice::u32 first_set
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::BindResourceSet, pipeline_layout, resource_set, first_set);
+        detail::stats(cmds).resource_set_binds += 1;
+    }
+
+    void NullRenderCommands::bind_index_buffer(
+        ice::render::CommandBuffer cmds,
+        ice::render::Buffer buffer
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::BindIndexBuffer, buffer);
+        detail::stats(cmds).buffer_binds += 1;
+    }
+
+    void NullRenderCommands::bind_vertex_buffer(
+        ice::render::CommandBuffer cmds,
+        ice::render::Buffer buffer,
+        ice::u32 binding
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::BindVertexBuffer, buffer, binding);
+        detail::stats(cmds).buffer_binds += 1;
+    }
+
+    void NullRenderCommands::draw(
+        ice::render::CommandBuffer cmds,
+        ice::u32 vertex_count,
+        ice::u32 instance_count,
+        ice::u32 vertex_offset,
+        ice::u32 instance_offset
+    ) noexcept
+    {
+        detail::record(
+            cmds, NullCommandType::Draw,
+            detail::pack(vertex_count, instance_count),
+            detail::pack(vertex_offset, instance_offset)
+        );
+
+        ice::render::RenderStats& stats = detail::stats(cmds);
+        stats.draws += 1;
+        stats.vertices += vertex_count * instance_count;
+        stats.instances += instance_count;
+    }
+
+    void NullRenderCommands::draw_indexed(
+        ice::render::CommandBuffer cmds,
+        ice::u32 vertex_count,
+        ice::u32 instance_count
+    ) noexcept
+    {
+        draw_indexed(cmds, vertex_count, instance_count, 0, 0, 0);
+    }
+
+    void NullRenderCommands::draw_indexed(
+        ice::render::CommandBuffer cmds,
+        ice::u32 vertex_count,
+        ice::u32 instance_count,
+        ice::u32 index_offset,
+        ice::u32 vertex_offset,
+        ice::u32 instance_offset
+    ) noexcept
+    {
+        detail::record(
+            cmds, NullCommandType::DrawIndexed,
+            detail::pack(vertex_count, instance_count),
+            detail::pack(index_offset, vertex_offset),
+            instance_offset
+        );
+
+        ice::render::RenderStats& stats = detail::stats(cmds);
+        stats.draws += 1;
+        stats.vertices += vertex_count * instance_count;
+        stats.instances += instance_count;
+    }
+
+    void NullRenderCommands::end_renderpass(
+        ice::render::CommandBuffer cmds
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::EndRenderpass);
+    }
+
+    void NullRenderCommands::end(
+        ice::render::CommandBuffer cmds
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::End);
+
+        NullCommandBuffer* const null_cmds = NullCommandBuffer::native(cmds);
+        null_cmds->stats.command_stream_size = ice::size_of<ice::u64> * ice::array::count(null_cmds->stream);
+    }
+
+    void NullRenderCommands::pipeline_image_barrier(
+        ice::render::CommandBuffer cmds,
+        ice::render::PipelineStage source_stage,
+        ice::render::PipelineStage destination_stage,
+        ice::Span<ice::render::ImageBarrier const> image_barriers
+    ) noexcept
+    {
+        detail::record(
+            cmds, NullCommandType::ImageBarrier,
+            detail::pack(ice::u32(source_stage), ice::u32(destination_stage)),
+            ice::span::count(image_barriers)
+        );
+        detail::stats(cmds).image_barriers += ice::span::count(image_barriers);
+    }
+
+    void NullRenderCommands::update_texture(
+        ice::render::CommandBuffer cmds,
+        ice::render::Image image,
+        ice::render::Buffer image_contents,
+        ice::vec2u extents
+    ) noexcept
+    {
+        update_texture_v2(cmds, image, image_contents, extents);
+    }
+
+    void NullRenderCommands::update_texture_v2(
+        ice::render::CommandBuffer cmds,
+        ice::render::Image image,
+        ice::render::Buffer image_contents,
+        ice::vec2u extents
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::UpdateTexture, image, image_contents, detail::pack(extents.x, extents.y));
+
+        // Commands are executed on recording, there is no device timeline to defer the copy to.
+        NullImage* const null_image = NullImage::native(image);
+        NullBuffer const* const null_buffer = NullBuffer::native(image_contents);
+        if (null_image->memory.location != nullptr && null_buffer->memory.location != nullptr)
+        {
+            ice::usize const copy_size = ice::min(null_image->memory.size, null_buffer->memory.size);
+            ice::memcpy(null_image->memory.location, null_buffer->memory.location, copy_size);
+        }
+    }
+
+    void NullRenderCommands::push_constant(
+        ice::render::CommandBuffer cmds,
+        ice::render::PipelineLayout pipeline,
+        ice::render::ShaderStageFlags shader_stages,
+        ice::Data data,
+        ice::u32 offset
+    ) noexcept
+    {
+        detail::record(cmds, NullCommandType::PushConstant, pipeline, shader_stages, detail::pack(offset, ice::u32(data.size.value)));
+
+        ice::render::RenderStats& stats = detail::stats(cmds);
+        stats.push_constants += 1;
+        stats.bytes_uploaded += data.size;
+    }
+
+#if IPT_ENABLED
+    auto NullRenderCommands::profiling_zone(
+        ice::render::CommandBuffer cmds,
+        const tracy::SourceLocationData* srcloc,
+        ice::String name
+    ) noexcept -> ice::render::detail::ProfilingZone
+    {
+        return { };
+    }
+
+    void NullRenderCommands::profiling_collect_zones(
+        ice::render::CommandBuffer cmds
+    ) noexcept
+    {
+    }
+#endif
+
+} // namespace ice::render::null
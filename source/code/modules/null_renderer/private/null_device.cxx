@@ -0,0 +1,328 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "null_device.hxx"
+#include "null_queue.hxx"
+#include "null_fence.hxx"
+#include "null_surface.hxx"
+#include "null_swapchain.hxx"
+
+#include <ice/render/render_buffer.hxx>
+#include <ice/render/render_framebuffer.hxx>
+#include <ice/render/render_image.hxx>
+#include <ice/render/render_pass.hxx>
+#include <ice/render/render_pipeline.hxx>
+#include <ice/render/render_resource.hxx>
+#include <ice/render/render_shader.hxx>
+#include <ice/mem_utils.hxx>
+#include <ice/assert.hxx>
+
+namespace ice::render::null
+{
+
+    NullRenderDevice::NullRenderDevice(ice::Allocator& alloc) noexcept
+        : _allocator{ alloc }
+        , _commands{ }
+        , _next_handle{ 1 }
+        , _stats{ }
+    {
+    }
+
+    NullRenderDevice::~NullRenderDevice() noexcept = default;
+
+    template<typename Handle>
+    auto NullRenderDevice::create_object() noexcept -> Handle
+    {
+        _stats.on_object_created();
+        return static_cast<Handle>(_next_handle.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    template<typename Handle>
+    void NullRenderDevice::destroy_object(Handle handle) noexcept
+    {
+        if (handle != Handle::Invalid)
+        {
+            _stats.on_object_destroyed();
+        }
+    }
+
+    auto NullRenderDevice::create_swapchain(
+        ice::render::RenderSurface* surface
+    ) noexcept -> ice::render::RenderSwapchain*
+    {
+        ICE_ASSERT(surface != nullptr, "Invalid render surface object!");
+        return _allocator.create<NullRenderSwapchain>(static_cast<NullRenderSurface*>(surface)->extent());
+    }
+
+    void NullRenderDevice::destroy_swapchain(
+        ice::render::RenderSwapchain* swapchain
+    ) noexcept
+    {
+        _allocator.destroy(static_cast<NullRenderSwapchain*>(swapchain));
+    }
+
+    auto NullRenderDevice::create_renderpass(
+        ice::render::RenderpassInfo const& /*info*/
+    ) noexcept -> ice::render::Renderpass
+    {
+        return create_object<ice::render::Renderpass>();
+    }
+
+    void NullRenderDevice::destroy_renderpass(
+        ice::render::Renderpass render_pass
+    ) noexcept
+    {
+        destroy_object(render_pass);
+    }
+
+    auto NullRenderDevice::create_resourceset_layout(
+        ice::Span<ice::render::ResourceSetLayoutBinding const> /*bindings*/
+    ) noexcept -> ice::render::ResourceSetLayout
+    {
+        return create_object<ice::render::ResourceSetLayout>();
+    }
+
+    void NullRenderDevice::destroy_resourceset_layout(
+        ice::render::ResourceSetLayout resourceset_layout
+    ) noexcept
+    {
+        destroy_object(resourceset_layout);
+    }
+
+    bool NullRenderDevice::create_resourcesets(
+        ice::Span<ice::render::ResourceSetLayout const> resource_set_layouts,
+        ice::Span<ice::render::ResourceSet> resource_sets_out
+    ) noexcept
+    {
+        ICE_ASSERT_CORE(ice::span::count(resource_set_layouts) == ice::span::count(resource_sets_out));
+        for (ice::render::ResourceSet& out_set : resource_sets_out)
+        {
+            out_set = create_object<ice::render::ResourceSet>();
+        }
+        return true;
+    }
+
+    void NullRenderDevice::update_resourceset(
+        ice::Span<ice::render::ResourceSetUpdateInfo const> /*update_infos*/
+    ) noexcept
+    {
+    }
+
+    void NullRenderDevice::destroy_resourcesets(
+        ice::Span<ice::render::ResourceSet const> resource_sets
+    ) noexcept
+    {
+        for (ice::render::ResourceSet resource_set : resource_sets)
+        {
+            destroy_object(resource_set);
+        }
+    }
+
+    auto NullRenderDevice::create_pipeline_layout(
+        ice::render::PipelineLayoutInfo const& /*info*/
+    ) noexcept -> ice::render::PipelineLayout
+    {
+        return create_object<ice::render::PipelineLayout>();
+    }
+
+    void NullRenderDevice::destroy_pipeline_layout(
+        ice::render::PipelineLayout pipeline_layout
+    ) noexcept
+    {
+        destroy_object(pipeline_layout);
+    }
+
+    auto NullRenderDevice::create_shader(
+        ice::render::ShaderInfo const& /*shader_info*/
+    ) noexcept -> ice::render::Shader
+    {
+        return create_object<ice::render::Shader>();
+    }
+
+    void NullRenderDevice::destroy_shader(
+        ice::render::Shader shader
+    ) noexcept
+    {
+        destroy_object(shader);
+    }
+
+    auto NullRenderDevice::create_pipeline(
+        ice::render::PipelineInfo const& /*info*/
+    ) noexcept -> ice::render::Pipeline
+    {
+        return create_object<ice::render::Pipeline>();
+    }
+
+    void NullRenderDevice::destroy_pipeline(
+        ice::render::Pipeline pipeline
+    ) noexcept
+    {
+        destroy_object(pipeline);
+    }
+
+    auto NullRenderDevice::create_buffer(
+        ice::render::BufferType buffer_type,
+        ice::u32 buffer_size
+    ) noexcept -> ice::render::Buffer
+    {
+        NullBuffer* const buffer = _allocator.create<NullBuffer>();
+        buffer->type = buffer_type;
+        buffer->memory = _allocator.allocate(ice::meminfo{ ice::usize{ buffer_size }, ice::ualign::b_16 });
+
+        _stats.on_allocate(buffer->memory.size);
+        return NullBuffer::handle(buffer);
+    }
+
+    void NullRenderDevice::destroy_buffer(
+        ice::render::Buffer buffer
+    ) noexcept
+    {
+        NullBuffer* const null_buffer = NullBuffer::native(buffer);
+        if (null_buffer != nullptr)
+        {
+            _stats.on_release(null_buffer->memory.size);
+            _allocator.deallocate(null_buffer->memory);
+            _allocator.destroy(null_buffer);
+        }
+    }
+
+    void NullRenderDevice::update_buffers(
+        ice::Span<ice::render::BufferUpdateInfo const> update_infos
+    ) noexcept
+    {
+        ice::usize uploaded = 0_B;
+        for (ice::render::BufferUpdateInfo const& update_info : update_infos)
+        {
+            NullBuffer* const null_buffer = NullBuffer::native(update_info.buffer);
+            ICE_ASSERT(
+                ice::usize{ update_info.offset } + update_info.data.size <= null_buffer->memory.size,
+                "Buffer update out of bounds [offset: {}, size: {}, buffer size: {}]",
+                update_info.offset, update_info.data.size.value, null_buffer->memory.size.value
+            );
+
+            ice::memcpy(
+                ice::ptr_add(null_buffer->memory.location, ice::usize{ update_info.offset }),
+                update_info.data.location,
+                update_info.data.size
+            );
+            uploaded += update_info.data.size;
+        }
+        _stats.on_upload(uploaded);
+    }
+
+    auto NullRenderDevice::create_framebuffer(
+        ice::vec2u /*extent*/,
+        ice::render::Renderpass /*renderpass*/,
+        ice::Span<ice::render::Image const> /*images*/
+    ) noexcept -> ice::render::Framebuffer
+    {
+        return create_object<ice::render::Framebuffer>();
+    }
+
+    void NullRenderDevice::destroy_framebuffer(
+        ice::render::Framebuffer framebuffer
+    ) noexcept
+    {
+        destroy_object(framebuffer);
+    }
+
+    auto NullRenderDevice::create_image(
+        ice::render::ImageInfo const& image_info,
+        ice::Data data
+    ) noexcept -> ice::render::Image
+    {
+        NullImage* const image = _allocator.create<NullImage>();
+        image->format = image_info.format;
+        image->usage = image_info.usage;
+        image->extent = { image_info.width, image_info.height };
+
+        ice::usize const image_size = ice::usize{ image_format_size(image_info.format) } * image_info.width * image_info.height;
+        image->memory = _allocator.allocate(ice::meminfo{ image_size, ice::ualign::b_16 });
+        _stats.on_allocate(image->memory.size);
+
+        // Initial image data can be provided either trough the info structure or the explicit data argument.
+        void const* const initial_data = data.location != nullptr ? data.location : image_info.data;
+        if (initial_data != nullptr)
+        {
+            ice::usize const copy_size = data.location != nullptr ? ice::min(data.size, image_size) : image_size;
+            ice::memcpy(image->memory.location, initial_data, copy_size);
+            _stats.on_upload(copy_size);
+        }
+        return NullImage::handle(image);
+    }
+
+    void NullRenderDevice::destroy_image(
+        ice::render::Image image
+    ) noexcept
+    {
+        NullImage* const null_image = NullImage::native(image);
+        if (null_image != nullptr)
+        {
+            _stats.on_release(null_image->memory.size);
+            _allocator.deallocate(null_image->memory);
+            _allocator.destroy(null_image);
+        }
+    }
+
+    auto NullRenderDevice::create_sampler(
+        ice::render::SamplerInfo const& /*sampler_info*/
+    ) noexcept -> ice::render::Sampler
+    {
+        return create_object<ice::render::Sampler>();
+    }
+
+    void NullRenderDevice::destroy_sampler(
+        ice::render::Sampler sampler
+    ) noexcept
+    {
+        destroy_object(sampler);
+    }
+
+    auto NullRenderDevice::create_queue(
+        ice::render::QueueID /*queue_id*/,
+        ice::render::QueueFlags /*flags*/,
+        ice::u32 /*queue_index*/,
+        ice::u32 /*command_pools*/
+    ) const noexcept -> ice::render::RenderQueue*
+    {
+        return _allocator.create<NullRenderQueue>(_allocator, _stats);
+    }
+
+    void NullRenderDevice::destroy_queue(
+        ice::render::RenderQueue* queue
+    ) const noexcept
+    {
+        _allocator.destroy(static_cast<NullRenderQueue*>(queue));
+    }
+
+    auto NullRenderDevice::create_fence() noexcept -> ice::render::RenderFence*
+    {
+        return _allocator.create<NullRenderFence>();
+    }
+
+    void NullRenderDevice::destroy_fence(
+        ice::render::RenderFence* fence
+    ) noexcept
+    {
+        _allocator.destroy(static_cast<NullRenderFence*>(fence));
+    }
+
+    auto NullRenderDevice::get_commands() noexcept -> ice::render::RenderCommands&
+    {
+        return _commands;
+    }
+
+    void NullRenderDevice::wait_idle() const noexcept
+    {
+        // All submitted work is finished during the 'submit' call.
+    }
+
+    bool NullRenderDevice::query_frame_stats(
+        ice::render::RenderStats& out_stats
+    ) const noexcept
+    {
+        out_stats = _stats.last_frame();
+        return true;
+    }
+
+} // namespace ice::render::null
@@ -0,0 +1,164 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/render/render_device.hxx>
+#include <ice/mem_allocator.hxx>
+#include "null_commands.hxx"
+#include "null_stats.hxx"
+
+namespace ice::render::null
+{
+
+    class NullRenderDevice : public ice::render::RenderDevice
+    {
+    public:
+        NullRenderDevice(ice::Allocator& alloc) noexcept;
+        ~NullRenderDevice() noexcept override;
+
+        auto create_swapchain(
+            ice::render::RenderSurface* surface
+        ) noexcept -> ice::render::RenderSwapchain* override;
+
+        void destroy_swapchain(
+            ice::render::RenderSwapchain* swapchain
+        ) noexcept override;
+
+        auto create_renderpass(
+            ice::render::RenderpassInfo const& info
+        ) noexcept -> ice::render::Renderpass override;
+
+        void destroy_renderpass(
+            ice::render::Renderpass render_pass
+        ) noexcept override;
+
+        auto create_resourceset_layout(
+            ice::Span<ice::render::ResourceSetLayoutBinding const> bindings
+        ) noexcept -> ice::render::ResourceSetLayout override;
+
+        void destroy_resourceset_layout(
+            ice::render::ResourceSetLayout resourceset_layout
+        ) noexcept override;
+
+        bool create_resourcesets(
+            ice::Span<ice::render::ResourceSetLayout const> resource_set_layouts,
+            ice::Span<ice::render::ResourceSet> resource_sets_out
+        ) noexcept override;
+
+        void update_resourceset(
+            ice::Span<ice::render::ResourceSetUpdateInfo const> update_infos
+        ) noexcept override;
+
+        void destroy_resourcesets(
+            ice::Span<ice::render::ResourceSet const> resource_sets
+        ) noexcept override;
+
+        auto create_pipeline_layout(
+            ice::render::PipelineLayoutInfo const& info
+        ) noexcept -> ice::render::PipelineLayout override;
+
+        void destroy_pipeline_layout(
+            ice::render::PipelineLayout pipeline_layout
+        ) noexcept override;
+
+        auto create_shader(
+            ice::render::ShaderInfo const& shader_info
+        ) noexcept -> ice::render::Shader override;
+
+        void destroy_shader(
+            ice::render::Shader shader
+        ) noexcept override;
+
+        auto create_pipeline(
+            ice::render::PipelineInfo const& info
+        ) noexcept -> ice::render::Pipeline override;
+
+        void destroy_pipeline(
+            ice::render::Pipeline pipeline
+        ) noexcept override;
+
+        auto create_buffer(
+            ice::render::BufferType buffer_type,
+            ice::u32 buffer_size
+        ) noexcept -> ice::render::Buffer override;
+
+        void destroy_buffer(
+            ice::render::Buffer buffer
+        ) noexcept override;
+
+        void update_buffers(
+            ice::Span<ice::render::BufferUpdateInfo const> update_infos
+        ) noexcept override;
+
+        auto create_framebuffer(
+            ice::vec2u extent,
+            ice::render::Renderpass renderpass,
+            ice::Span<ice::render::Image const> images
+        ) noexcept -> ice::render::Framebuffer override;
+
+        void destroy_framebuffer(
+            ice::render::Framebuffer framebuffer
+        ) noexcept override;
+
+        auto create_image(
+            ice::render::ImageInfo const& image_info,
+            ice::Data data
+        ) noexcept -> ice::render::Image override;
+
+        void destroy_image(
+            ice::render::Image image
+        ) noexcept override;
+
+        auto create_sampler(
+            ice::render::SamplerInfo const& sampler_info
+        ) noexcept -> ice::render::Sampler override;
+
+        void destroy_sampler(
+            ice::render::Sampler sampler
+        ) noexcept override;
+
+        auto create_queue(
+            ice::render::QueueID queue_id,
+            ice::render::QueueFlags flags,
+            ice::u32 queue_index,
+            ice::u32 command_pools
+        ) const noexcept -> ice::render::RenderQueue* override;
+
+        void destroy_queue(
+            ice::render::RenderQueue* queue
+        ) const noexcept override;
+
+        auto create_fence() noexcept -> ice::render::RenderFence* override;
+
+        void destroy_fence(
+            ice::render::RenderFence* fence
+        ) noexcept override;
+
+        auto get_commands() noexcept -> ice::render::RenderCommands& override;
+
+        void wait_idle() const noexcept override;
+
+        bool query_frame_stats(
+            ice::render::RenderStats& out_stats
+        ) const noexcept override;
+
+        auto stats() const noexcept -> ice::render::null::NullFrameStats const& { return _stats; }
+
+    private:
+        //! \brief Objects without any backing data only need an unique non-null handle.
+        template<typename Handle>
+        auto create_object() noexcept -> Handle;
+
+        template<typename Handle>
+        void destroy_object(Handle handle) noexcept;
+
+    private:
+        ice::Allocator& _allocator;
+        ice::render::null::NullRenderCommands _commands;
+        std::atomic<ice::uptr> _next_handle;
+
+        //! \brief Mutable because queues, which report submitted work, are created from a 'const' method.
+        mutable ice::render::null::NullFrameStats _stats;
+    };
+
+} // namespace ice::render::null
@@ -0,0 +1,59 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "null_driver.hxx"
+#include "null_device.hxx"
+#include "null_surface.hxx"
+#include <ice/render/render_queue.hxx>
+
+namespace ice::render::null
+{
+
+    NullRenderDriver::NullRenderDriver(ice::Allocator& alloc) noexcept
+        : _allocator{ alloc, "Null-Renderer" }
+    {
+    }
+
+    auto NullRenderDriver::create_surface(
+        ice::render::SurfaceInfo const& surface_info
+    ) noexcept -> ice::render::RenderSurface*
+    {
+        return _allocator.create<NullRenderSurface>(surface_info);
+    }
+
+    void NullRenderDriver::destroy_surface(
+        ice::render::RenderSurface* surface
+    ) noexcept
+    {
+        _allocator.destroy(static_cast<NullRenderSurface*>(surface));
+    }
+
+    void NullRenderDriver::query_queue_infos(
+        ice::Array<ice::render::QueueFamilyInfo>& queue_info
+    ) noexcept
+    {
+        ice::array::push_back(
+            queue_info,
+            QueueFamilyInfo{
+                .id = QueueID{ 0 },
+                .flags = QueueFlags::Graphics | QueueFlags::Compute | QueueFlags::Transfer | QueueFlags::Present,
+                .count = 4,
+            }
+        );
+    }
+
+    auto NullRenderDriver::create_device(
+        ice::Span<ice::render::QueueInfo const> /*queue_info*/
+    ) noexcept -> ice::render::RenderDevice*
+    {
+        return _allocator.create<NullRenderDevice>(_allocator);
+    }
+
+    void NullRenderDriver::destroy_device(
+        ice::render::RenderDevice* device
+    ) noexcept
+    {
+        _allocator.destroy(static_cast<NullRenderDevice*>(device));
+    }
+
+} // namespace ice::render::null
@@ -0,0 +1,37 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/render/render_driver.hxx>
+#include <ice/mem_allocator_proxy.hxx>
+
+namespace ice::render::null
+{
+
+    //! \brief Render driver implementing the whole render API in host memory.
+    //! \details Does not require a GPU or a window, all submitted work is only recorded and measured.
+    //!   Allows to run and benchmark whole frames in headless environments.
+    class NullRenderDriver : public ice::render::RenderDriver
+    {
+    public:
+        NullRenderDriver(ice::Allocator& alloc) noexcept;
+        ~NullRenderDriver() noexcept override = default;
+
+        auto allocator() noexcept -> ice::Allocator& { return _allocator.backing_allocator(); }
+
+        auto state() const noexcept -> ice::render::DriverState override { return DriverState::Ready; }
+        auto render_api() const noexcept -> ice::render::DriverAPI override { return DriverAPI::None; }
+
+        auto create_surface(ice::render::SurfaceInfo const& surface_info) noexcept -> ice::render::RenderSurface* override;
+        void destroy_surface(ice::render::RenderSurface* surface) noexcept override;
+
+        void query_queue_infos(ice::Array<ice::render::QueueFamilyInfo>& queue_info) noexcept override;
+
+        auto create_device(ice::Span<ice::render::QueueInfo const> queue_info) noexcept -> ice::render::RenderDevice* override;
+        void destroy_device(ice::render::RenderDevice* device) noexcept override;
+
+    private:
+        ice::ProxyAllocator _allocator;
+    };
+
+} // namespace ice::render::null
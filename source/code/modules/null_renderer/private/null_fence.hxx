@@ -0,0 +1,39 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/render/render_fence.hxx>
+#include <atomic>
+
+namespace ice::render::null
+{
+
+    //! \brief Work is executed at submit time, so fences are always signaled before anyone can wait on them.
+    class NullRenderFence : public ice::render::RenderFence
+    {
+    public:
+        NullRenderFence() noexcept
+            : _signaled{ false }
+        {
+        }
+
+        void set() noexcept
+        {
+            _signaled.store(true, std::memory_order_release);
+        }
+
+        bool wait(ice::u64 /*timeout_ns*/) noexcept override
+        {
+            return _signaled.load(std::memory_order_acquire);
+        }
+
+        void reset() noexcept override
+        {
+            _signaled.store(false, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<bool> _signaled;
+    };
+
+} // namespace ice::render::null
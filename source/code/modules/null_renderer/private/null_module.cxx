@@ -0,0 +1,41 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <ice/render/render_module.hxx>
+#include <ice/module.hxx>
+#include <ice/log_module.hxx>
+
+#include "null_driver.hxx"
+
+namespace ice::render::null
+{
+
+    auto create_null_driver(ice::Allocator& alloc) noexcept -> ice::render::RenderDriver*
+    {
+        return alloc.create<NullRenderDriver>(alloc);
+    }
+
+    void destroy_null_driver(ice::render::RenderDriver* driver) noexcept
+    {
+        ice::Allocator& alloc = static_cast<NullRenderDriver*>(driver)->allocator();
+        alloc.destroy(static_cast<NullRenderDriver*>(driver));
+    }
+
+    struct NullRendererModule : ice::Module<NullRendererModule>
+    {
+        static void v1_driver_api(ice::render::detail::v1::RenderAPI& api) noexcept
+        {
+            api.create_driver_fn = create_null_driver;
+            api.destroy_driver_fn = destroy_null_driver;
+        }
+
+        static bool on_load(ice::Allocator& alloc, ice::ModuleNegotiator auto const& negotiator) noexcept
+        {
+            ice::LogModule::init(alloc, negotiator);
+            return negotiator.register_api(v1_driver_api);
+        }
+
+        IS_WORKAROUND_MODULE_INITIALIZATION(NullRendererModule);
+    };
+
+} // namespace ice::render::null
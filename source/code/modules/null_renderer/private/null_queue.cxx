@@ -0,0 +1,109 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "null_queue.hxx"
+#include "null_fence.hxx"
+#include <ice/assert.hxx>
+
+namespace ice::render::null
+{
+
+    NullRenderQueue::NullRenderQueue(
+        ice::Allocator& alloc,
+        ice::render::null::NullFrameStats& stats
+    ) noexcept
+        : _allocator{ alloc }
+        , _stats{ stats }
+        , _command_buffers{ _allocator }
+    {
+    }
+
+    NullRenderQueue::~NullRenderQueue() noexcept
+    {
+        for (NullCommandBuffer* null_cmds : _command_buffers)
+        {
+            _allocator.destroy(null_cmds);
+        }
+    }
+
+    void NullRenderQueue::allocate_buffers(
+        ice::u32 pool_index,
+        ice::render::CommandBufferType type,
+        ice::Span<ice::render::CommandBuffer> buffers
+    ) noexcept
+    {
+        for (ice::render::CommandBuffer& out_buffer : buffers)
+        {
+            NullCommandBuffer* const null_cmds = _allocator.create<NullCommandBuffer>(_allocator, type);
+            ice::multi_hashmap::insert(_command_buffers, pool_index, null_cmds);
+            out_buffer = NullCommandBuffer::handle(null_cmds);
+        }
+    }
+
+    void NullRenderQueue::release_buffers(
+        ice::u32 pool_index,
+        ice::render::CommandBufferType /*type*/,
+        ice::Span<ice::render::CommandBuffer> buffers
+    ) noexcept
+    {
+        for (ice::render::CommandBuffer buffer : buffers)
+        {
+            NullCommandBuffer* const null_cmds = NullCommandBuffer::native(buffer);
+
+            auto it = ice::multi_hashmap::find_first(_command_buffers, pool_index);
+            while (it != nullptr)
+            {
+                auto next = ice::multi_hashmap::find_next(_command_buffers, it);
+                if (it.value() == null_cmds)
+                {
+                    ice::multi_hashmap::remove(_command_buffers, it);
+                    _allocator.destroy(null_cmds);
+                    break;
+                }
+                it = next;
+            }
+        }
+    }
+
+    void NullRenderQueue::reset_pool(
+        ice::u32 pool_index
+    ) noexcept
+    {
+        // Keep the stream capacity, so recording the next frame does not allocate.
+        auto it = ice::multi_hashmap::find_first(_command_buffers, pool_index);
+        while (it != nullptr)
+        {
+            ice::array::clear(it.value()->stream);
+            it.value()->stats = { };
+            it = ice::multi_hashmap::find_next(_command_buffers, it);
+        }
+    }
+
+    void NullRenderQueue::submit(
+        ice::Span<ice::render::CommandBuffer const> buffers,
+        ice::render::RenderFence* fence
+    ) noexcept
+    {
+        ice::render::RenderStats submit_stats{ .submits = 1 };
+        for (ice::render::CommandBuffer cmdbuff : buffers)
+        {
+            NullCommandBuffer const* const null_cmds = NullCommandBuffer::native(cmdbuff);
+            ICE_ASSERT_CORE(null_cmds != nullptr);
+            accumulate_stats(submit_stats, null_cmds->stats);
+        }
+        _stats.on_submit(submit_stats);
+
+        if (fence != nullptr)
+        {
+            static_cast<NullRenderFence*>(fence)->set();
+        }
+    }
+
+    void NullRenderQueue::present(
+        ice::render::RenderSwapchain* /*swapchain*/
+    ) noexcept
+    {
+        _stats.on_present();
+    }
+
+} // namespace ice::render::null
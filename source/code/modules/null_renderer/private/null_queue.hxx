@@ -0,0 +1,53 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/render/render_queue.hxx>
+#include <ice/container/hashmap.hxx>
+#include "null_commands.hxx"
+#include "null_stats.hxx"
+
+namespace ice::render::null
+{
+
+    class NullRenderQueue : public ice::render::RenderQueue
+    {
+    public:
+        NullRenderQueue(
+            ice::Allocator& alloc,
+            ice::render::null::NullFrameStats& stats
+        ) noexcept;
+        ~NullRenderQueue() noexcept override;
+
+        void allocate_buffers(
+            ice::u32 pool_index,
+            ice::render::CommandBufferType type,
+            ice::Span<ice::render::CommandBuffer> buffers
+        ) noexcept override;
+
+        void release_buffers(
+            ice::u32 pool_index,
+            ice::render::CommandBufferType type,
+            ice::Span<ice::render::CommandBuffer> buffers
+        ) noexcept override;
+
+        void reset_pool(
+            ice::u32 pool_index
+        ) noexcept override;
+
+        void submit(
+            ice::Span<ice::render::CommandBuffer const> buffers,
+            ice::render::RenderFence* fence
+        ) noexcept override;
+
+        void present(
+            ice::render::RenderSwapchain* swapchain
+        ) noexcept override;
+
+    private:
+        ice::Allocator& _allocator;
+        ice::render::null::NullFrameStats& _stats;
+        ice::HashMap<NullCommandBuffer*> _command_buffers;
+    };
+
+} // namespace ice::render::null
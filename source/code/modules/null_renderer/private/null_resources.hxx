@@ -0,0 +1,61 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/mem_memory.hxx>
+#include <ice/render/render_buffer.hxx>
+#include <ice/render/render_image.hxx>
+
+namespace ice::render::null
+{
+
+    template<typename Handle, typename Native>
+    struct NullHandleUtils
+    {
+        static auto handle(Native* native) noexcept
+        {
+            return static_cast<Handle>(reinterpret_cast<ice::uptr>(native));
+        }
+
+        static auto native(Handle handle) noexcept
+        {
+            return reinterpret_cast<Native*>(static_cast<ice::uptr>(handle));
+        }
+    };
+
+    //! \brief Buffer object backed by a regular host allocation.
+    struct NullBuffer : NullHandleUtils<ice::render::Buffer, NullBuffer>
+    {
+        ice::render::BufferType type;
+        ice::Memory memory;
+    };
+
+    //! \brief Image object backed by a regular host allocation.
+    //! \note Swapchain images do not own any memory.
+    struct NullImage : NullHandleUtils<ice::render::Image, NullImage>
+    {
+        ice::render::ImageFormat format;
+        ice::render::ImageUsageFlags usage;
+        ice::vec2u extent;
+        ice::Memory memory;
+    };
+
+    constexpr auto image_format_size(ice::render::ImageFormat format) noexcept -> ice::u32
+    {
+        switch (format)
+        {
+        case ImageFormat::I32_RGBA: return 16;
+        case ImageFormat::UNORM_RGB: return 3;
+        case ImageFormat::SRGB_RGBA:
+        case ImageFormat::SRGB_BGRA:
+        case ImageFormat::UNORM_RGBA:
+        case ImageFormat::UNORM_BGRA:
+        case ImageFormat::UNORM_ARGB:
+        case ImageFormat::UNORM_D24_UINT_S8:
+        case ImageFormat::SFLOAT_D32: return 4;
+        case ImageFormat::SFLOAT_D32_UINT_S8: return 8;
+        default: return 0;
+        }
+    }
+
+} // namespace ice::render::null
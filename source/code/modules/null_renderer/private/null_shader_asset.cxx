@@ -0,0 +1,101 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "null_shader_asset.hxx"
+
+#include <ice/asset_category_archive.hxx>
+#include <ice/asset.hxx>
+#include <ice/config.hxx>
+#include <ice/path_utils.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/render/render_shader.hxx>
+#include <ice/render/render_module.hxx>
+
+namespace ice::render::null
+{
+
+    auto asset_shader_state(
+        void*,
+        ice::AssetCategoryDefinition const&,
+        ice::Config const& metadata,
+        ice::URI const& uri
+    ) noexcept -> ice::AssetState
+    {
+        bool baked = false;
+        if (ice::config::get(metadata, "ice.shader.baked", baked) && baked)
+        {
+            return AssetState::Baked;
+        }
+
+        ice::String const ext = ice::path::extension(uri.path());
+        if (ext == ".glsl" || ext == ".asl")
+        {
+            return AssetState::Raw;
+        }
+        return AssetState::Baked;
+    }
+
+    auto asset_shader_loader(
+        void*,
+        ice::Allocator& alloc,
+        ice::AssetStorage&,
+        ice::Config const& meta,
+        ice::Data data,
+        ice::Memory& out_data
+    ) noexcept -> ice::Task<bool>
+    {
+        // Shader code is never executed, so the data is only forwarded as is.
+        out_data = alloc.allocate(ice::meminfo_of<Data>);
+
+        Data* shader_data = reinterpret_cast<Data*>(out_data.location);
+        shader_data->location = data.location;
+        shader_data->size = data.size;
+        shader_data->alignment = data.alignment;
+        co_return true;
+    }
+
+    void asset_category_shader_definition(
+        ice::AssetCategoryArchive& asset_category_archive,
+        ice::ModuleQuery const& module_query
+    ) noexcept
+    {
+        static ice::String constexpr extensions[]{ ".asl", ".glsl", ".spv", ".wgsl" };
+
+        static ice::AssetCategoryDefinition definition{
+            .resource_extensions = extensions,
+            .fn_asset_state = asset_shader_state,
+            .fn_asset_loader = asset_shader_loader
+        };
+
+        static ice::HostAllocator host_alloc;
+
+        // Other render drivers register their own shader category, so we only provide it if we are the only one loaded.
+        ice::Array<ice::render::detail::v1::RenderAPI> render_apis{ host_alloc };
+        module_query.query_apis(render_apis);
+        if (ice::array::count(render_apis) > 1 || asset_category_archive.find_definition(ice::render::AssetCategory_Shader).valid())
+        {
+            return;
+        }
+
+        ice::ResourceCompiler const* selected_compiler = nullptr;
+        ice::Array<ice::ResourceCompiler> compilers{ host_alloc };
+        module_query.query_apis(compilers);
+
+        for (ice::ResourceCompiler const& compiler : compilers)
+        {
+            if (compiler.id_category == "ice/shader-resource"_sid)
+            {
+                selected_compiler = ice::addressof(compiler);
+                break;
+            }
+        }
+
+        asset_category_archive.register_category(ice::render::AssetCategory_Shader, definition, selected_compiler);
+    }
+
+    void NullShaderAssetModule::v1_archive_api(ice::detail::asset_system::v1::AssetArchiveAPI& api) noexcept
+    {
+        api.fn_register_categories = asset_category_shader_definition;
+    }
+
+} // namespace ice::render::null
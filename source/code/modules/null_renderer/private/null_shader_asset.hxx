@@ -0,0 +1,27 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/module.hxx>
+#include <ice/module_query.hxx>
+#include <ice/resource_compiler.hxx>
+#include <ice/asset_module.hxx>
+
+namespace ice::render::null
+{
+
+    //! \brief Registers the shader asset category, so pipelines can be created without any other render module loaded.
+    //! \note The category is not registered if another render driver is loaded or the category is already defined.
+    struct NullShaderAssetModule : ice::Module<NullShaderAssetModule>
+    {
+        static void v1_archive_api(ice::detail::asset_system::v1::AssetArchiveAPI& api) noexcept;
+
+        static bool on_load(ice::Allocator& alloc, ice::ModuleNegotiator auto const& negotiator) noexcept
+        {
+            return negotiator.register_api(v1_archive_api);
+        }
+
+        IS_WORKAROUND_MODULE_INITIALIZATION(NullShaderAssetModule);
+    };
+
+} // namespace ice::render::null
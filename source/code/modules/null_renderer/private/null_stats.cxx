@@ -0,0 +1,118 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "null_stats.hxx"
+
+namespace ice::render::null
+{
+
+    void accumulate_stats(
+        ice::render::RenderStats& target,
+        ice::render::RenderStats const& source
+    ) noexcept
+    {
+        target.submits += source.submits;
+        target.command_buffers += source.command_buffers;
+        target.commands += source.commands;
+        target.renderpasses += source.renderpasses;
+        target.draws += source.draws;
+        target.vertices += source.vertices;
+        target.instances += source.instances;
+        target.pipeline_binds += source.pipeline_binds;
+        target.resource_set_binds += source.resource_set_binds;
+        target.buffer_binds += source.buffer_binds;
+        target.push_constants += source.push_constants;
+        target.image_barriers += source.image_barriers;
+        target.bytes_uploaded += source.bytes_uploaded;
+        target.command_stream_size += source.command_stream_size;
+    }
+
+    NullFrameStats::NullFrameStats() noexcept
+        : _lock{ }
+        , _current{ }
+        , _last{ }
+        , _frame_index{ 0 }
+        , _objects_alive{ 0 }
+        , _bytes_resident{ 0 }
+    {
+    }
+
+    void NullFrameStats::on_submit(ice::render::RenderStats const& command_stats) noexcept
+    {
+        lock();
+        accumulate_stats(_current, command_stats);
+        unlock();
+    }
+
+    void NullFrameStats::on_upload(ice::usize bytes) noexcept
+    {
+        lock();
+        _current.bytes_uploaded += bytes;
+        unlock();
+    }
+
+    void NullFrameStats::on_allocate(ice::usize bytes) noexcept
+    {
+        lock();
+        _bytes_resident += bytes;
+        _objects_alive += 1;
+        unlock();
+    }
+
+    void NullFrameStats::on_release(ice::usize bytes) noexcept
+    {
+        lock();
+        _bytes_resident = ice::usize::subtract(_bytes_resident, bytes);
+        _objects_alive -= 1;
+        unlock();
+    }
+
+    void NullFrameStats::on_object_created() noexcept
+    {
+        lock();
+        _objects_alive += 1;
+        unlock();
+    }
+
+    void NullFrameStats::on_object_destroyed() noexcept
+    {
+        lock();
+        _objects_alive -= 1;
+        unlock();
+    }
+
+    void NullFrameStats::on_present() noexcept
+    {
+        lock();
+        _last = _current;
+        _last.frame_index = _frame_index;
+        _last.objects_alive = _objects_alive;
+        _last.bytes_resident = _bytes_resident;
+        _current = { };
+        _frame_index += 1;
+        unlock();
+    }
+
+    auto NullFrameStats::last_frame() const noexcept -> ice::render::RenderStats
+    {
+        lock();
+        ice::render::RenderStats const result = _last;
+        unlock();
+        return result;
+    }
+
+    void NullFrameStats::lock() const noexcept
+    {
+        while (_lock.test_and_set(std::memory_order_acquire))
+        {
+            _lock.wait(true, std::memory_order_relaxed);
+        }
+    }
+
+    void NullFrameStats::unlock() const noexcept
+    {
+        _lock.clear(std::memory_order_release);
+        _lock.notify_one();
+    }
+
+} // namespace ice::render::null
@@ -0,0 +1,48 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/render/render_stats.hxx>
+#include <atomic>
+
+namespace ice::render::null
+{
+
+    void accumulate_stats(
+        ice::render::RenderStats& target,
+        ice::render::RenderStats const& source
+    ) noexcept;
+
+    //! \brief Collects statistics of submitted work and separates them into frames.
+    //! \note Submits can happen from multiple threads, so all access is guarded by a simple spin-lock.
+    class NullFrameStats
+    {
+    public:
+        NullFrameStats() noexcept;
+
+        void on_submit(ice::render::RenderStats const& command_stats) noexcept;
+        void on_upload(ice::usize bytes) noexcept;
+        void on_allocate(ice::usize bytes) noexcept;
+        void on_release(ice::usize bytes) noexcept;
+        void on_object_created() noexcept;
+        void on_object_destroyed() noexcept;
+
+        //! \brief Finishes the current frame, called when a swapchain image is presented.
+        void on_present() noexcept;
+
+        auto last_frame() const noexcept -> ice::render::RenderStats;
+
+    private:
+        void lock() const noexcept;
+        void unlock() const noexcept;
+
+    private:
+        mutable std::atomic_flag _lock;
+        ice::render::RenderStats _current;
+        ice::render::RenderStats _last;
+        ice::u32 _frame_index;
+        ice::u32 _objects_alive;
+        ice::usize _bytes_resident;
+    };
+
+} // namespace ice::render::null
@@ -0,0 +1,31 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/render/render_surface.hxx>
+
+namespace ice::render::null
+{
+
+    static constexpr ice::vec2u Constant_DefaultSurfaceExtent{ 1600, 1080 };
+
+    class NullRenderSurface : public ice::render::RenderSurface
+    {
+    public:
+        NullRenderSurface(ice::render::SurfaceInfo const& surface_info) noexcept
+            : _extent{ Constant_DefaultSurfaceExtent }
+        {
+            // Platform window surfaces are accepted, but nothing is ever presented on them.
+            if (surface_info.type == SurfaceType::Headless)
+            {
+                _extent = { surface_info.headless.width, surface_info.headless.height };
+            }
+        }
+
+        auto extent() const noexcept -> ice::vec2u { return _extent; }
+
+    private:
+        ice::vec2u _extent;
+    };
+
+} // namespace ice::render::null
@@ -0,0 +1,65 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/render/render_swapchain.hxx>
+#include "null_resources.hxx"
+
+namespace ice::render::null
+{
+
+    class NullRenderSwapchain : public ice::render::RenderSwapchain
+    {
+    public:
+        static constexpr ice::u32 Constant_ImageCount = 2;
+
+        NullRenderSwapchain(ice::vec2u extent) noexcept
+            : _images{ }
+            , _current_index{ 0 }
+        {
+            for (NullImage& image : _images)
+            {
+                image.format = ImageFormat::UNORM_BGRA;
+                image.usage = ImageUsageFlags::ColorAttachment;
+                image.extent = extent;
+                image.memory = { };
+            }
+        }
+
+        auto extent() const noexcept -> ice::vec2u override
+        {
+            return _images[0].extent;
+        }
+
+        auto image_format() const noexcept -> ice::render::ImageFormat override
+        {
+            return _images[0].format;
+        }
+
+        auto image_count() const noexcept -> ice::u32 override
+        {
+            return Constant_ImageCount;
+        }
+
+        auto image(ice::u32 index) const noexcept -> ice::render::Image override
+        {
+            return NullImage::handle(const_cast<NullImage*>(_images + index));
+        }
+
+        auto aquire_image() noexcept -> ice::u32 override
+        {
+            _current_index = (_current_index + 1) % Constant_ImageCount;
+            return _current_index;
+        }
+
+        auto current_image_index() const noexcept -> ice::u32 override
+        {
+            return _current_index;
+        }
+
+    private:
+        NullImage _images[Constant_ImageCount];
+        ice::u32 _current_index;
+    };
+
+} // namespace ice::render::null
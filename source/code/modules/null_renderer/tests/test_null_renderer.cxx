@@ -0,0 +1,138 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/module_register.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/render/render_module.hxx>
+#include <ice/render/render_driver.hxx>
+#include <ice/render/render_device.hxx>
+#include <ice/render/render_queue.hxx>
+#include <ice/render/render_buffer.hxx>
+#include <ice/render/render_command_buffer.hxx>
+#include <ice/render/render_stats.hxx>
+#include <ice/os/windows.hxx>
+#include <ice/os/unix.hxx>
+
+#include <filesystem>
+
+using ice::operator""_B;
+
+namespace
+{
+
+    auto null_renderer_path() noexcept -> std::string
+    {
+        std::filesystem::path executable_path;
+#if ISP_WINDOWS
+        wchar_t buffer[MAX_PATH];
+        DWORD const length = GetModuleFileNameW(nullptr, buffer, MAX_PATH);
+        executable_path = std::wstring{ buffer, length };
+        return (executable_path.parent_path() / "null_renderer.dll").string();
+#else
+        std::error_code ec;
+        executable_path = std::filesystem::read_symlink("/proc/self/exe", ec);
+        return (executable_path.parent_path() / "libnull_renderer.so").string();
+#endif
+    }
+
+} // namespace
+
+SCENARIO("null_renderer 'ice::render::RenderDevice'", "[render][null_renderer]")
+{
+    using namespace ice::render;
+
+    ice::HostAllocator alloc{ };
+
+    std::string const module_path = null_renderer_path();
+    ice::UniquePtr<ice::ModuleRegister> modules = ice::create_default_module_register(alloc, false);
+    REQUIRE(modules->load_module(alloc, ice::String{ std::string_view{ module_path } }));
+
+    ice::UniquePtr<RenderDriver> driver = ice::render::create_render_driver(alloc, *modules);
+    REQUIRE(driver != nullptr);
+    CHECK(driver->state() == DriverState::Ready);
+
+    ice::Array<QueueFamilyInfo> queue_families{ alloc };
+    driver->query_queue_infos(queue_families);
+    REQUIRE(ice::array::count(queue_families) > 0);
+
+    QueueInfo const queue_info{ .id = queue_families[0].id, .count = 1 };
+    RenderDevice* const device = driver->create_device({ &queue_info, 1 });
+    REQUIRE(device != nullptr);
+
+    RenderQueue* const queue = device->create_queue(queue_info.id, QueueFlags::Graphics, 0, 1);
+    REQUIRE(queue != nullptr);
+
+    GIVEN("a recorded command buffer")
+    {
+        ice::u32 const vertices[]{ 0, 1, 2, 3, 4, 5 };
+        Buffer const buffer = device->create_buffer(BufferType::Vertex, sizeof(vertices));
+        BufferUpdateInfo const update{ .buffer = buffer, .data = ice::data_view(vertices), .offset = 0 };
+        device->update_buffers({ &update, 1 });
+
+        CommandBuffer cmds;
+        queue->allocate_buffers(0, CommandBufferType::Primary, { &cmds, 1 });
+
+        RenderCommands& commands = device->get_commands();
+        commands.begin(cmds);
+        commands.bind_vertex_buffer(cmds, buffer, 0);
+        commands.draw(cmds, 3, 2, 0, 0);
+        commands.draw(cmds, 6, 1, 0, 0);
+        commands.end(cmds);
+
+        WHEN("it's submitted and presented")
+        {
+            queue->submit({ &cmds, 1 }, nullptr);
+            queue->present(nullptr);
+
+            THEN("the device reports statistics of the presented frame")
+            {
+                RenderStats stats{ };
+                REQUIRE(device->query_frame_stats(stats));
+                CHECK(stats.frame_index == 0);
+                CHECK(stats.submits == 1);
+                CHECK(stats.command_buffers == 1);
+                CHECK(stats.commands == 5);
+                CHECK(stats.draws == 2);
+                CHECK(stats.vertices == 12);
+                CHECK(stats.instances == 3);
+                CHECK(stats.buffer_binds == 1);
+                CHECK(stats.bytes_uploaded == ice::size_of<ice::u32> * 6);
+                CHECK(stats.bytes_resident >= ice::size_of<ice::u32> * 6);
+                CHECK(stats.objects_alive == 1);
+                CHECK(stats.command_stream_size > 0_B);
+            }
+
+            THEN("the next frame starts with empty statistics")
+            {
+                queue->present(nullptr);
+
+                RenderStats stats{ };
+                REQUIRE(device->query_frame_stats(stats));
+                CHECK(stats.frame_index == 1);
+                CHECK(stats.submits == 0);
+                CHECK(stats.draws == 0);
+                CHECK(stats.objects_alive == 1);
+            }
+        }
+
+        WHEN("nothing was presented yet")
+        {
+            queue->submit({ &cmds, 1 }, nullptr);
+
+            THEN("the statistics are empty")
+            {
+                RenderStats stats{ };
+                REQUIRE(device->query_frame_stats(stats));
+                CHECK(stats.submits == 0);
+                CHECK(stats.draws == 0);
+            }
+        }
+
+        queue->release_buffers(0, CommandBufferType::Primary, { &cmds, 1 });
+        device->destroy_buffer(buffer);
+    }
+
+    device->destroy_queue(queue);
+    driver->destroy_device(device);
+}
@@ -13,6 +13,7 @@
 #include <ice/sort.hxx>
 
 #include "shader_tools_asl.hxx"
+#include "shader_tools_cache.hxx"
 #include "shader_tools_glsl.hxx"
 #include "shader_tools_wgsl.hxx"
 
@@ -34,13 +35,27 @@ namespace ice
     {
         ice::ShaderTargetPlatform const target = param_shader_target(params);
         ice::ShaderStage const stage = param_shader_stage(params);
-        ctx.userdata = alloc.create<ShaderCompilerContext>(alloc, target, stage);
+        ShaderCompilerContext* const shader_ctx = alloc.create<ShaderCompilerContext>(alloc, target, stage);
+
+        ice::u32 idx;
+        char const* cache_dir = nullptr;
+        if (ice::search(params, ice::render::ShardID_ShaderCacheDirectory, idx) && ice::shard_inspect(params[idx], cache_dir))
+        {
+            shader_ctx->cache = ice::create_shader_cache(alloc, cache_dir);
+        }
+
+        ctx.userdata = shader_ctx;
         return true;
     }
 
     bool compiler_context_cleanup(ice::Allocator& alloc, ice::ResourceCompilerCtx& ctx) noexcept
     {
-        alloc.destroy(shader_context(ctx));
+        ShaderCompilerContext* const shader_ctx = shader_context(ctx);
+        if (shader_ctx->cache != nullptr)
+        {
+            alloc.destroy(shader_ctx->cache);
+        }
+        alloc.destroy(shader_ctx);
         return true;
     }
 
@@ -16,6 +16,8 @@
 namespace ice
 {
 
+    class ShaderCache;
+
     using ASLImportVisitors = arctic::SyntaxVisitorGroup<
         arctic::syntax::Import
     >;
@@ -58,12 +60,16 @@ namespace ice
         ) noexcept
             : target{ target }
             , stage{ stage }
+            , cache{ nullptr }
             , shader_main{ alloc }
         { }
 
         ice::ShaderTargetPlatform const target;
         ice::ShaderStage const stage;
 
+        //! \brief Optional cache of transpiled and compiled shaders, owned by the context.
+        ice::ShaderCache* cache;
+
         ice::i32 shader_type;
         ice::HeapString<> shader_main;
     };
@@ -17,10 +17,12 @@ namespace ice
     public:
         ASLResourceScriptLoader(
             ice::Allocator& alloc,
-            ice::ResourceTracker& tracker
+            ice::ResourceTracker& tracker,
+            ice::Array<ice::ShaderCacheDependency>* out_dependencies
         ) noexcept
             : _allocator{ alloc }
             , _tracker{ tracker }
+            , _dependencies{ out_dependencies }
         { }
 
         auto load_source(arctic::String import_path, ice::ResourceHandle& out_res) noexcept -> arctic::String override
@@ -51,6 +53,15 @@ namespace ice
             // Keep the handle so the resource won't get unloaded.
             out_res = res.resource;
 
+            // Track the script, so cached shaders get invalidated when it changes.
+            if (_dependencies != nullptr)
+            {
+                ice::array::push_back(*_dependencies, ice::ShaderCacheDependency{
+                    .path = ice::HeapString<>{ _allocator, ice::String{ import_path_final } },
+                    .content_hash = ice::hash(std::string_view{ (char const*)res.data.location, res.data.size.value })
+                });
+            }
+
             // Return the script contents
             return arctic::String{ (char const*)res.data.location, res.data.size.value };
         }
@@ -58,14 +69,16 @@ namespace ice
     private:
         ice::Allocator& _allocator;
         ice::ResourceTracker& _tracker;
+        ice::Array<ice::ShaderCacheDependency>* _dependencies;
     };
 
     auto create_script_loader(
         ice::Allocator& alloc,
-        ice::ResourceTracker& tracker
+        ice::ResourceTracker& tracker,
+        ice::Array<ice::ShaderCacheDependency>* out_dependencies
     ) noexcept -> ice::UniquePtr<ice::ASLScriptLoader>
     {
-        return ice::make_unique<ice::ASLResourceScriptLoader>(alloc, alloc, tracker);
+        return ice::make_unique<ice::ASLResourceScriptLoader>(alloc, alloc, tracker, out_dependencies);
     }
 
     auto parse_import_file(
@@ -7,6 +7,7 @@
 #include "shader_tools_asl_database.hxx"
 #include "shader_tools_asl_script.hxx"
 #include "shader_tools_asl_utils.cxx"
+#include "shader_tools_cache.hxx"
 
 #include <arctic/arctic_types.hxx>
 #include <arctic/arctic_syntax.hxx>
@@ -24,9 +25,11 @@ namespace ice
         virtual auto load_source(arctic::String import_path, ice::ResourceHandle& res) noexcept -> arctic::String = 0;
     };
 
+    //! \param[out] out_dependencies If provided, receives the path and content hash of every loaded script.
     auto create_script_loader(
         ice::Allocator& alloc,
-        ice::ResourceTracker& tracker
+        ice::ResourceTracker& tracker,
+        ice::Array<ice::ShaderCacheDependency>* out_dependencies = nullptr
     ) noexcept -> ice::UniquePtr<ice::ASLScriptLoader>;
 
     class ASLImportTracker final : public ice::ASLEntityTracker, public arctic::SyntaxVisitorGroup<arctic::syntax::Import>
@@ -0,0 +1,364 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "shader_tools_cache.hxx"
+#include <ice/string_utils.hxx>
+#include <ice/profiler.hxx>
+#include <ice/uri.hxx>
+#include <ice/log.hxx>
+
+namespace ice
+{
+
+    namespace detail
+    {
+
+        static constexpr ice::u32 Constant_ShaderCacheMagic = 0x4353'5349; // 'ISSC'
+
+        static constexpr ice::String Constant_ShaderCacheExtension_Source = ".ssrc";
+        static constexpr ice::String Constant_ShaderCacheExtension_Binary = ".sbin";
+
+        struct ShaderCacheHeader
+        {
+            ice::u32 magic;
+            ice::u32 version;
+            ice::u64 key;
+            ice::u64 payload_hash;
+            ice::u64 payload_size;
+        };
+
+        inline auto shader_cache_hash(void const* data, ice::u64 size) noexcept -> ice::u64
+        {
+            return ice::hash(std::string_view{ reinterpret_cast<char const*>(data), size });
+        }
+
+        inline auto shader_cache_key(
+            ice::String contents,
+            ice::ShaderTargetPlatform target,
+            ice::render::ShaderStageFlags stage,
+            ice::u64 kind
+        ) noexcept -> ice::u64
+        {
+            // All parameters affecting the output are part of the seed, so the same contents end up with different keys.
+            ice::u64 const seed = (ice::u64{ Constant_ShaderCacheVersion } << 32)
+                | (kind << 24)
+                | (ice::u64(target) << 16)
+                | ice::u64(stage);
+
+            return ice::detail::murmur2_hash::cexpr_murmur2_x64_64(contents, seed).h[0];
+        }
+
+        //! \brief Reads and validates the payload of a cache entry.
+        //! \returns Payload memory allocated with the given allocator, or empty memory if the entry is missing or invalid.
+        auto read_entry(
+            ice::native_file::FilePath path,
+            ice::u64 key,
+            ice::Allocator& alloc
+        ) noexcept -> ice::Memory
+        {
+            ice::native_file::File const file = ice::native_file::open_file(path);
+            if (file == false)
+            {
+                return {};
+            }
+
+            ShaderCacheHeader header{};
+            ice::Memory const header_memory{
+                .location = &header,
+                .size = ice::size_of<ShaderCacheHeader>,
+                .alignment = ice::align_of<ShaderCacheHeader>
+            };
+            if (ice::native_file::read_file(file, header_memory.size, header_memory) != header_memory.size
+                || header.magic != Constant_ShaderCacheMagic
+                || header.version != Constant_ShaderCacheVersion
+                || header.key != key
+                || header.payload_size == 0
+                || header.payload_size > ice::native_file::sizeof_file(file).value - header_memory.size.value)
+            {
+                return {};
+            }
+
+            ice::Memory const payload = alloc.allocate(ice::usize{ header.payload_size });
+            if (ice::native_file::read_file(file, header_memory.size, payload.size, payload) != payload.size
+                || shader_cache_hash(payload.location, header.payload_size) != header.payload_hash)
+            {
+                alloc.deallocate(payload);
+                return {};
+            }
+            return payload;
+        }
+
+        void write_entry(
+            ice::Allocator& alloc,
+            ice::native_file::FilePath path,
+            ice::u64 key,
+            ice::Data payload
+        ) noexcept
+        {
+            ShaderCacheHeader const header{
+                .magic = Constant_ShaderCacheMagic,
+                .version = Constant_ShaderCacheVersion,
+                .key = key,
+                .payload_hash = shader_cache_hash(payload.location, payload.size.value),
+                .payload_size = payload.size.value,
+            };
+
+            // Entries are moved into place once fully written, so other compilers sharing the cache never read a
+            //   partially written entry. Readers still validate entries, in case the file was modified otherwise.
+            ice::native_file::HeapFilePath temp_path{ alloc, path };
+            ice::native_file::path_append_temporary_suffix(temp_path);
+
+            bool written = false;
+            {
+                using enum ice::native_file::FileOpenFlags;
+                ice::native_file::File const file = ice::native_file::open_file(temp_path, Write);
+                ice::Data const header_data = ice::data_view(header);
+                written = file
+                    && ice::native_file::write_file(file, 0_B, header_data) == header_data.size
+                    && ice::native_file::write_file(file, header_data.size, payload) == payload.size;
+            }
+
+            bool const stored = written && ice::native_file::rename_file(temp_path, path);
+            ICE_LOG_IF(
+                stored == false,
+                LogSeverity::Warning, LogTag::Tool,
+                "Failed to store entry {:016x} in the shader cache.",
+                key
+            );
+        }
+
+        //! \brief Simple bounds checked reader, entry payloads don't keep any alignment.
+        struct ShaderCacheReader
+        {
+            ice::Memory payload;
+            ice::u64 offset = 0;
+
+            bool read(void* out_value, ice::u64 size) noexcept
+            {
+                if (offset + size > payload.size.value)
+                {
+                    return false;
+                }
+
+                ice::memcpy(out_value, ice::ptr_add(payload.location, ice::usize{ offset }), ice::usize{ size });
+                offset += size;
+                return true;
+            }
+
+            bool read_string(ice::String& out_string, ice::u64 size) noexcept
+            {
+                if (offset + size > payload.size.value)
+                {
+                    return false;
+                }
+
+                out_string = ice::String{
+                    reinterpret_cast<char const*>(ice::ptr_add(payload.location, ice::usize{ offset })),
+                    static_cast<ice::ucount>(size)
+                };
+                offset += size;
+                return true;
+            }
+
+            auto remaining() const noexcept -> ice::String
+            {
+                return ice::String{
+                    reinterpret_cast<char const*>(ice::ptr_add(payload.location, ice::usize{ offset })),
+                    static_cast<ice::ucount>(payload.size.value - offset)
+                };
+            }
+        };
+
+        struct ShaderCacheWriter
+        {
+            ice::Memory payload;
+            ice::u64 offset = 0;
+
+            void write(void const* value, ice::u64 size) noexcept
+            {
+                ICE_ASSERT_CORE(offset + size <= payload.size.value);
+                ice::memcpy(ice::ptr_add(payload.location, ice::usize{ offset }), value, ice::usize{ size });
+                offset += size;
+            }
+        };
+
+    } // namespace detail
+
+    ShaderCache::ShaderCache(ice::Allocator& alloc, ice::native_file::HeapFilePath cache_dir) noexcept
+        : _allocator{ alloc }
+        , _cache_dir{ ice::move(cache_dir) }
+    {
+    }
+
+    auto ShaderCache::source_key(
+        ice::Data source,
+        ice::ShaderTargetPlatform target,
+        ice::render::ShaderStageFlags stage
+    ) const noexcept -> ice::u64
+    {
+        ice::String const contents{
+            reinterpret_cast<char const*>(source.location),
+            static_cast<ice::ucount>(source.size.value)
+        };
+        return detail::shader_cache_key(contents, target, stage, 0);
+    }
+
+    auto ShaderCache::binary_key(
+        ice::String source,
+        ice::ShaderTargetPlatform target,
+        ice::render::ShaderStageFlags stage
+    ) const noexcept -> ice::u64
+    {
+        return detail::shader_cache_key(source, target, stage, 1);
+    }
+
+    auto ShaderCache::load_source(
+        ice::u64 key,
+        ice::ResourceTracker& tracker,
+        ice::HeapString<>& out_source,
+        ice::HeapString<>& out_entry_point
+    ) noexcept -> ice::Task<bool>
+    {
+        IPT_ZONE_SCOPED;
+
+        ice::native_file::HeapFilePath const path = entry_path(key, detail::Constant_ShaderCacheExtension_Source);
+        ice::Memory const payload = detail::read_entry(path, key, _allocator);
+        if (payload.location == nullptr)
+        {
+            co_return false;
+        }
+
+        detail::ShaderCacheReader reader{ payload };
+
+        ice::u32 dependency_count = 0;
+        bool valid = reader.read(&dependency_count, sizeof(dependency_count));
+
+        ice::HeapString<> dependency_path{ _allocator };
+        for (ice::u32 idx = 0; valid && idx < dependency_count; ++idx)
+        {
+            ice::u64 content_hash;
+            ice::u32 path_size;
+            ice::String path_str;
+            valid = reader.read(&content_hash, sizeof(content_hash))
+                && reader.read(&path_size, sizeof(path_size))
+                && reader.read_string(path_str, path_size);
+
+            if (valid)
+            {
+                // URIs need zero terminated strings.
+                dependency_path = path_str;
+
+                ice::ResourceHandle const import_resource = tracker.find_resource(
+                    ice::URI{ ice::Scheme_URN, { ice::String{ dependency_path } } }
+                );
+                valid = import_resource != nullptr;
+                if (valid)
+                {
+                    // Same as the import loader, we keep imports loaded so other shaders can access them.
+                    ice::ResourceResult const import_result = co_await tracker.load_resource(import_resource);
+                    valid = import_result.resource_status == ResourceStatus::Loaded
+                        && detail::shader_cache_hash(import_result.data.location, import_result.data.size.value) == content_hash;
+                }
+            }
+        }
+
+        ice::u32 entry_point_size = 0;
+        ice::String entry_point;
+        valid = valid
+            && reader.read(&entry_point_size, sizeof(entry_point_size))
+            && reader.read_string(entry_point, entry_point_size);
+
+        if (valid)
+        {
+            out_entry_point = entry_point;
+            out_source = reader.remaining();
+        }
+
+        _allocator.deallocate(payload);
+        co_return valid && ice::string::any(out_source);
+    }
+
+    void ShaderCache::store_source(
+        ice::u64 key,
+        ice::Span<ice::ShaderCacheDependency const> dependencies,
+        ice::String source,
+        ice::String entry_point
+    ) noexcept
+    {
+        IPT_ZONE_SCOPED;
+
+        ice::u32 const dependency_count = ice::span::count(dependencies);
+        ice::u32 const entry_point_size = ice::size(entry_point);
+
+        ice::u64 payload_size = sizeof(dependency_count) + sizeof(entry_point_size) + entry_point_size + ice::size(source);
+        for (ice::ShaderCacheDependency const& dependency : dependencies)
+        {
+            payload_size += sizeof(dependency.content_hash) + sizeof(ice::u32) + ice::size(dependency.path);
+        }
+
+        detail::ShaderCacheWriter writer{ _allocator.allocate(ice::usize{ payload_size }) };
+        writer.write(&dependency_count, sizeof(dependency_count));
+        for (ice::ShaderCacheDependency const& dependency : dependencies)
+        {
+            ice::u32 const path_size = ice::size(dependency.path);
+            writer.write(&dependency.content_hash, sizeof(dependency.content_hash));
+            writer.write(&path_size, sizeof(path_size));
+            writer.write(ice::string::begin(dependency.path), path_size);
+        }
+        writer.write(&entry_point_size, sizeof(entry_point_size));
+        writer.write(ice::string::begin(entry_point), entry_point_size);
+        writer.write(ice::string::begin(source), ice::size(source));
+
+        detail::write_entry(
+            _allocator,
+            entry_path(key, detail::Constant_ShaderCacheExtension_Source),
+            key,
+            ice::Data{ writer.payload.location, writer.payload.size, writer.payload.alignment }
+        );
+        _allocator.deallocate(writer.payload);
+    }
+
+    auto ShaderCache::load_binary(ice::u64 key, ice::Allocator& alloc) noexcept -> ice::Memory
+    {
+        IPT_ZONE_SCOPED;
+        return detail::read_entry(entry_path(key, detail::Constant_ShaderCacheExtension_Binary), key, alloc);
+    }
+
+    void ShaderCache::store_binary(ice::u64 key, ice::Data binary) noexcept
+    {
+        IPT_ZONE_SCOPED;
+        if (binary.size > 0_B)
+        {
+            detail::write_entry(_allocator, entry_path(key, detail::Constant_ShaderCacheExtension_Binary), key, binary);
+        }
+    }
+
+    auto ShaderCache::entry_path(ice::u64 key, ice::String extension) const noexcept -> ice::native_file::HeapFilePath
+    {
+        ice::HeapString<> filename{ _allocator };
+        ice::string::push_format(filename, "{:016x}{}", key, extension);
+
+        ice::native_file::HeapFilePath result{ _allocator, _cache_dir };
+        ice::native_file::path_join_string(result, filename);
+        return result;
+    }
+
+    auto create_shader_cache(ice::Allocator& alloc, ice::String cache_dir) noexcept -> ice::ShaderCache*
+    {
+        ice::native_file::HeapFilePath cache_path{ alloc };
+        ice::native_file::path_from_string(cache_path, cache_dir);
+        if (ice::native_file::is_directory(cache_path) == false
+            && ice::native_file::create_directory(cache_path) == false)
+        {
+            ICE_LOG(
+                LogSeverity::Warning, LogTag::Tool,
+                "Failed to create shader cache directory '{}', shaders won't be cached.",
+                cache_dir
+            );
+            return nullptr;
+        }
+
+        return alloc.create<ice::ShaderCache>(alloc, ice::move(cache_path));
+    }
+
+} // namespace ice
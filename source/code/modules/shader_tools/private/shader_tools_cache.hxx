@@ -0,0 +1,92 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/shader_tools.hxx>
+#include <ice/render/render_shader.hxx>
+#include <ice/resource_tracker.hxx>
+#include <ice/container/array.hxx>
+#include <ice/string/heap_string.hxx>
+#include <ice/native_file.hxx>
+#include <ice/task.hxx>
+
+namespace ice
+{
+
+    //! \brief Version of the cached data, needs to be bumped each time the patchers, generators or compile options change
+    //!   the produced shaders. Entries created with a different version are ignored.
+    static constexpr ice::u32 Constant_ShaderCacheVersion = 1;
+
+    //! \brief A script imported while transpiling a shader.
+    struct ShaderCacheDependency
+    {
+        //! \brief The resource path of the imported script, including the '.asl' extension.
+        ice::HeapString<> path;
+
+        //! \brief Hash of the script contents at the time the shader was transpiled.
+        ice::u64 content_hash;
+    };
+
+    //! \brief Content-addressed on-disk cache for transpiled shader sources and compiled shader binaries.
+    //! \details Transpiled sources are keyed by the hash of the ASL source and the parameters affecting the generated code.
+    //!   Each entry also stores the hashes of all imported scripts, so changing an import invalidates the entry.
+    //!
+    //!   Binaries are keyed by the hash of the source they were compiled from. An ASL change that does not affect the
+    //!   generated code does not require the shader to be compiled again.
+    //!
+    //! \note Entries are written to a temporary file and moved into place, so multiple compilers can share the directory.
+    //!   Entries are also validated using a hash of their contents, any damaged file is treated as a miss.
+    class ShaderCache
+    {
+    public:
+        ShaderCache(ice::Allocator& alloc, ice::native_file::HeapFilePath cache_dir) noexcept;
+
+        //! \returns Key for the transpiled version of the given source.
+        auto source_key(
+            ice::Data source,
+            ice::ShaderTargetPlatform target,
+            ice::render::ShaderStageFlags stage
+        ) const noexcept -> ice::u64;
+
+        //! \returns Key for the compiled version of the given (transpiled) source.
+        auto binary_key(
+            ice::String source,
+            ice::ShaderTargetPlatform target,
+            ice::render::ShaderStageFlags stage
+        ) const noexcept -> ice::u64;
+
+        //! \brief Loads a transpiled source, if all scripts it imported are still unchanged.
+        //! \param[in] tracker Used to load imported scripts to validate their contents.
+        auto load_source(
+            ice::u64 key,
+            ice::ResourceTracker& tracker,
+            ice::HeapString<>& out_source,
+            ice::HeapString<>& out_entry_point
+        ) noexcept -> ice::Task<bool>;
+
+        //! \brief Stores a transpiled source together with all scripts it imported.
+        void store_source(
+            ice::u64 key,
+            ice::Span<ice::ShaderCacheDependency const> dependencies,
+            ice::String source,
+            ice::String entry_point
+        ) noexcept;
+
+        //! \returns The cached shader binary allocated using the given allocator, or empty memory if not found.
+        auto load_binary(ice::u64 key, ice::Allocator& alloc) noexcept -> ice::Memory;
+
+        void store_binary(ice::u64 key, ice::Data binary) noexcept;
+
+    private:
+        auto entry_path(ice::u64 key, ice::String extension) const noexcept -> ice::native_file::HeapFilePath;
+
+    private:
+        ice::Allocator& _allocator;
+        ice::native_file::HeapFilePath _cache_dir;
+    };
+
+    //! \brief Creates a shader cache in the given directory, creating the directory if necessary.
+    //! \returns The created cache or 'nullptr' if the directory could not be created.
+    auto create_shader_cache(ice::Allocator& alloc, ice::String cache_dir) noexcept -> ice::ShaderCache*;
+
+} // namespace ice
@@ -20,6 +20,7 @@
 #include "shader_tools_asl_importer.hxx"
 #include "shader_tools_asl_script.hxx"
 #include "shader_tools_asl_shader.hxx"
+#include "shader_tools_cache.hxx"
 #include "shader_tools_glsl_patcher.hxx"
 
 #if defined(VK_SHADERC)
@@ -497,6 +498,7 @@ namespace ice
             ice::ResourceTracker& tracker,
             ice::ResourceHandle const& source,
             ice::render::ShaderStageFlags shader_stage,
+            ice::ShaderCache* cache,
             ice::HeapString<>& out_result,
             ice::HeapString<>& out_entry_point
         ) noexcept -> ice::TaskExpected<ice::String, ice::ErrorCode>
@@ -506,7 +508,22 @@ namespace ice
 
             if (ice::path::extension(path) == ".asl")
             {
-                auto import_loader = ice::create_script_loader(alloc, tracker);
+                ice::u64 const cache_key = cache != nullptr
+                    ? cache->source_key(result.data, ShaderTargetPlatform::GLSL, shader_stage)
+                    : 0;
+
+                if (cache != nullptr)
+                {
+                    bool const cached = co_await cache->load_source(cache_key, tracker, out_result, out_entry_point);
+                    if (cached)
+                    {
+                        co_return out_result;
+                    }
+                }
+
+                // Imported scripts are only tracked if the result is going to be cached.
+                ice::Array<ice::ShaderCacheDependency> dependencies{ alloc };
+                auto import_loader = ice::create_script_loader(alloc, tracker, cache != nullptr ? &dependencies : nullptr);
 
                 out_result = transpile_shader_asl_to_glsl(
                     alloc,
@@ -521,6 +538,11 @@ namespace ice
                 {
                     co_return E_FailedToTranspileASLShaderToGLSL;
                 }
+
+                if (cache != nullptr)
+                {
+                    cache->store_source(cache_key, ice::array::slice(dependencies), out_result, out_entry_point);
+                }
                 co_return out_result;
             }
             else
@@ -556,7 +578,7 @@ namespace ice
             ice::HeapString<> transpiled_result{ alloc };
             ice::HeapString<> entry_point{ alloc };
             ice::Expected<ice::String, ice::ErrorCode> result = co_await glsl::load_shader_source(
-                alloc, tracker, source, shader_stage, transpiled_result, entry_point
+                alloc, tracker, source, shader_stage, sctx.cache, transpiled_result, entry_point
             );
 
             if (result.failed())
@@ -571,35 +593,53 @@ namespace ice
 #if defined(VK_SHADERC)
                 ice::String const glsl_source = result.value();
 
-                shaderc::CompileOptions compile_options{};
-
-                // We don't use optimization in runtime-baked shaders
-                compile_options.SetOptimizationLevel(shaderc_optimization_level_zero);
-                compile_options.SetTargetSpirv(shaderc_spirv_version_1_6); // TODO: take from the metadata / platform settings?
-                shaderc::Compiler compiler{};
-
-                shaderc::SpvCompilationResult const spv_result = compiler.CompileGlslToSpv(
-                    ice::string::begin(glsl_source),
-                    ice::string::size(glsl_source),
-                    is_vertex_shader ? shaderc_shader_kind::shaderc_vertex_shader : shaderc_shader_kind::shaderc_fragment_shader,
-                    ice::string::begin(path),
-                    ice::string::begin(entry_point),
-                    compile_options
-                );
+                ice::u64 const cache_key = sctx.cache != nullptr
+                    ? sctx.cache->binary_key(glsl_source, sctx.target, shader_stage)
+                    : 0;
 
-                // Check if we were successful
-                if (spv_result.GetCompilationStatus() != shaderc_compilation_status_success)
+                if (sctx.cache != nullptr)
                 {
-                    ICE_LOG(LogSeverity::Error, LogTag::System, "Failed to load shader '{}' with error '{}'", path, spv_result.GetErrorMessage());
+                    result_mem = sctx.cache->load_binary(cache_key, alloc);
                 }
-                else
+
+                if (result_mem.location == nullptr)
                 {
-                    // TODO List warnings
+                    shaderc::CompileOptions compile_options{};
+
+                    // We don't use optimization in runtime-baked shaders
+                    //  NOTE: Changing compile options requires bumping 'Constant_ShaderCacheVersion'.
+                    compile_options.SetOptimizationLevel(shaderc_optimization_level_zero);
+                    compile_options.SetTargetSpirv(shaderc_spirv_version_1_6); // TODO: take from the metadata / platform settings?
+                    shaderc::Compiler compiler{};
+
+                    shaderc::SpvCompilationResult const spv_result = compiler.CompileGlslToSpv(
+                        ice::string::begin(glsl_source),
+                        ice::string::size(glsl_source),
+                        is_vertex_shader ? shaderc_shader_kind::shaderc_vertex_shader : shaderc_shader_kind::shaderc_fragment_shader,
+                        ice::string::begin(path),
+                        ice::string::begin(entry_point),
+                        compile_options
+                    );
+
+                    // Check if we were successful
+                    if (spv_result.GetCompilationStatus() != shaderc_compilation_status_success)
+                    {
+                        ICE_LOG(LogSeverity::Error, LogTag::System, "Failed to load shader '{}' with error '{}'", path, spv_result.GetErrorMessage());
+                    }
+                    else
+                    {
+                        // TODO List warnings
+
+                        // Spv result is a 4byte BC table
+                        ice::usize const result_size = ice::size_of<ice::u32> *(spv_result.end() - spv_result.begin());
+                        result_mem = alloc.allocate(result_size);
+                        ice::memcpy(result_mem.location, spv_result.begin(), result_size);
 
-                    // Spv result is a 4byte BC table
-                    ice::usize const result_size = ice::size_of<ice::u32> *(spv_result.end() - spv_result.begin());
-                    result_mem = alloc.allocate(result_size);
-                    ice::memcpy(result_mem.location, spv_result.begin(), result_size);
+                        if (sctx.cache != nullptr)
+                        {
+                            sctx.cache->store_binary(cache_key, ice::Data{ result_mem.location, result_mem.size, result_mem.alignment });
+                        }
+                    }
                 }
 #else
                 ICE_LOG(LogSeverity::Error, LogTag::System, "This shader_tools build doesn't support compiling '.glsl' shaders to '.spv' bytecode!");
@@ -17,6 +17,7 @@
 #include "shader_tools_asl_importer.hxx"
 #include "shader_tools_asl_script.hxx"
 #include "shader_tools_asl_shader.hxx"
+#include "shader_tools_cache.hxx"
 #include "shader_tools_wgsl_patcher.hxx"
 
 namespace ice
@@ -399,6 +400,7 @@ namespace ice
             ice::ResourceTracker& tracker,
             ice::ResourceHandle const& source,
             ice::render::ShaderStageFlags shader_stage,
+            ice::ShaderCache* cache,
             ice::HeapString<>& out_result,
             ice::HeapString<>& out_entry_point
         ) noexcept -> ice::TaskExpected<ice::String, ice::ErrorCode>
@@ -408,7 +410,22 @@ namespace ice
 
             if (ice::path::extension(path) == ".asl")
             {
-                auto import_loader = ice::create_script_loader(alloc, tracker);
+                ice::u64 const cache_key = cache != nullptr
+                    ? cache->source_key(result.data, ShaderTargetPlatform::WGSL, shader_stage)
+                    : 0;
+
+                if (cache != nullptr)
+                {
+                    bool const cached = co_await cache->load_source(cache_key, tracker, out_result, out_entry_point);
+                    if (cached)
+                    {
+                        co_return out_result;
+                    }
+                }
+
+                // Imported scripts are only tracked if the result is going to be cached.
+                ice::Array<ice::ShaderCacheDependency> dependencies{ alloc };
+                auto import_loader = ice::create_script_loader(alloc, tracker, cache != nullptr ? &dependencies : nullptr);
 
                 out_result = transpile_shader_asl_to_wgsl(
                     alloc,
@@ -423,6 +440,11 @@ namespace ice
                 {
                     co_return E_FailedToTranspileASLShaderToWGSL;
                 }
+
+                if (cache != nullptr)
+                {
+                    cache->store_source(cache_key, ice::array::slice(dependencies), out_result, out_entry_point);
+                }
                 co_return out_result;
             }
             else
@@ -456,7 +478,7 @@ namespace ice
             ice::HeapString<> transpiled_result{ alloc };
             ice::HeapString<> entry_point{ alloc };
             ice::Expected<ice::String, ice::ErrorCode> result = co_await wgsl::load_shader_source(
-                alloc, tracker, source, shader_stage, transpiled_result, entry_point
+                alloc, tracker, source, shader_stage, sctx.cache, transpiled_result, entry_point
             );
 
             ICE_LOG(LogSeverity::Debug, LogTag::System, "WGSL: {}", transpiled_result);
@@ -0,0 +1,234 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/resource_provider.hxx>
+#include <ice/task_utils.hxx>
+
+// The cache is private to the shader_tools module, so it's compiled together with the tests.
+#include "../private/shader_tools_cache.cxx"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+
+    static constexpr ice::String Constant_ImportName = "common.asl";
+    static constexpr ice::String Constant_ImportContents = "fn common() {}";
+
+    struct TestCacheDirectory
+    {
+        std::filesystem::path root;
+
+        TestCacheDirectory() noexcept
+        {
+            std::error_code ec;
+            root = std::filesystem::temp_directory_path(ec) / "iceshard_shader_cache_tests";
+            std::filesystem::remove_all(root, ec);
+            std::filesystem::create_directories(root / "scripts", ec);
+        }
+
+        ~TestCacheDirectory() noexcept
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(root, ec);
+        }
+
+        auto cache_dir() const noexcept -> std::string
+        {
+            return (root / "cache").string();
+        }
+
+        auto script_path(ice::String name) const noexcept -> std::string
+        {
+            return (root / "scripts" / std::string_view{ name }).string();
+        }
+
+        void write_script(ice::String name, ice::String contents) const noexcept
+        {
+            std::ofstream file{ script_path(name), std::ios::binary | std::ios::trunc };
+            file.write(ice::string::begin(contents), ice::size(contents));
+        }
+
+        //! \returns Paths of all files created in the cache directory.
+        auto cache_files() const noexcept -> std::vector<std::filesystem::path>
+        {
+            std::vector<std::filesystem::path> result;
+            for (std::filesystem::directory_entry const& entry : std::filesystem::directory_iterator{ root / "cache" })
+            {
+                result.push_back(entry.path());
+            }
+            return result;
+        }
+    };
+
+    auto content_hash(ice::String contents) noexcept -> ice::u64
+    {
+        return ice::hash(std::string_view{ ice::string::begin(contents), ice::size(contents) });
+    }
+
+} // namespace
+
+SCENARIO("shader_tools 'ice::ShaderCache'", "[shader][cache]")
+{
+    using ice::render::ShaderStageFlags;
+
+    ice::HostAllocator alloc{ };
+    TestCacheDirectory const directory{ };
+    directory.write_script(Constant_ImportName, Constant_ImportContents);
+
+    ice::UniquePtr<ice::ResourceTracker> tracker = ice::create_resource_tracker(
+        alloc, { .predicted_resource_count = 4, .io_dedicated_threads = 0 }
+    );
+
+    std::string const scripts_dir = directory.script_path("");
+    std::string const import_path = directory.script_path(Constant_ImportName);
+    ice::ResourceFileEntry const files[]{
+        { .path = ice::String{ import_path }, .basepath = ice::String{ scripts_dir } }
+    };
+    tracker->attach_provider(ice::create_resource_provider_files(alloc, files));
+    tracker->sync_resources();
+
+    std::string const cache_dir = directory.cache_dir();
+    ice::ShaderCache* const cache = ice::create_shader_cache(alloc, ice::String{ cache_dir });
+    REQUIRE(cache != nullptr);
+
+    ice::String const asl_source = "import \"common\"; fn main() {}";
+    ice::String const glsl_source = "void main() { }";
+    ice::u8 const binary[]{ 0x03, 0x02, 0x23, 0x07, 0x00, 0x01 };
+
+    ice::u64 const source_key = cache->source_key(
+        ice::data_view(asl_source), ice::ShaderTargetPlatform::GLSL, ShaderStageFlags::VertexStage
+    );
+    ice::u64 const binary_key = cache->binary_key(glsl_source, ice::ShaderTargetPlatform::GLSL, ShaderStageFlags::VertexStage);
+
+    ice::HeapString<> loaded_source{ alloc };
+    ice::HeapString<> loaded_entry_point{ alloc };
+
+    GIVEN("an empty cache")
+    {
+        THEN("all lookups are a miss")
+        {
+            CHECK(ice::wait_for_result(cache->load_source(source_key, *tracker, loaded_source, loaded_entry_point)) == false);
+            CHECK(cache->load_binary(binary_key, alloc).location == nullptr);
+        }
+
+        THEN("keys depend on the target and the stage")
+        {
+            CHECK(source_key != cache->source_key(
+                ice::data_view(asl_source), ice::ShaderTargetPlatform::WGSL, ShaderStageFlags::VertexStage
+            ));
+            CHECK(source_key != cache->source_key(
+                ice::data_view(asl_source), ice::ShaderTargetPlatform::GLSL, ShaderStageFlags::FragmentStage
+            ));
+            CHECK(binary_key != cache->binary_key(glsl_source, ice::ShaderTargetPlatform::GLSL, ShaderStageFlags::FragmentStage));
+        }
+    }
+
+    GIVEN("a stored shader source with an unchanged import")
+    {
+        ice::ShaderCacheDependency const dependencies[]{
+            { .path = ice::HeapString<>{ alloc, Constant_ImportName }, .content_hash = content_hash(Constant_ImportContents) }
+        };
+        cache->store_source(source_key, dependencies, glsl_source, "main");
+
+        THEN("the source is loaded from the cache")
+        {
+            REQUIRE(ice::wait_for_result(cache->load_source(source_key, *tracker, loaded_source, loaded_entry_point)));
+            CHECK(ice::String{ loaded_source } == glsl_source);
+            CHECK(ice::String{ loaded_entry_point } == "main");
+        }
+
+        THEN("only the final entry is left in the cache directory")
+        {
+            std::vector<std::filesystem::path> const files = directory.cache_files();
+            REQUIRE(files.size() == 1);
+            CHECK(files[0].extension() == ".ssrc");
+        }
+
+        WHEN("the entry is truncated")
+        {
+            std::vector<std::filesystem::path> const files = directory.cache_files();
+            REQUIRE(files.size() == 1);
+            std::filesystem::resize_file(files[0], std::filesystem::file_size(files[0]) - 4);
+
+            THEN("the lookup is a miss")
+            {
+                CHECK(ice::wait_for_result(cache->load_source(source_key, *tracker, loaded_source, loaded_entry_point)) == false);
+            }
+        }
+
+        WHEN("the entry is overwritten")
+        {
+            cache->store_source(source_key, dependencies, "void main() { discard; }", "main");
+
+            THEN("the latest source is loaded")
+            {
+                REQUIRE(ice::wait_for_result(cache->load_source(source_key, *tracker, loaded_source, loaded_entry_point)));
+                CHECK(ice::String{ loaded_source } == "void main() { discard; }");
+                CHECK(directory.cache_files().size() == 1);
+            }
+        }
+    }
+
+    GIVEN("a stored shader source with a changed import")
+    {
+        ice::ShaderCacheDependency const dependencies[]{
+            { .path = ice::HeapString<>{ alloc, Constant_ImportName }, .content_hash = content_hash("fn common() { old }") }
+        };
+        cache->store_source(source_key, dependencies, glsl_source, "main");
+
+        THEN("the lookup is a miss")
+        {
+            CHECK(ice::wait_for_result(cache->load_source(source_key, *tracker, loaded_source, loaded_entry_point)) == false);
+        }
+    }
+
+    GIVEN("a stored shader source with a missing import")
+    {
+        ice::ShaderCacheDependency const dependencies[]{
+            { .path = ice::HeapString<>{ alloc, "missing.asl" }, .content_hash = content_hash(Constant_ImportContents) }
+        };
+        cache->store_source(source_key, dependencies, glsl_source, "main");
+
+        THEN("the lookup is a miss")
+        {
+            CHECK(ice::wait_for_result(cache->load_source(source_key, *tracker, loaded_source, loaded_entry_point)) == false);
+        }
+    }
+
+    GIVEN("a stored shader binary")
+    {
+        cache->store_binary(binary_key, ice::data_view(binary));
+
+        THEN("the binary is loaded from the cache")
+        {
+            ice::Memory const loaded = cache->load_binary(binary_key, alloc);
+            REQUIRE(loaded.location != nullptr);
+            REQUIRE(loaded.size == ice::size_of<ice::u8> * ice::count(binary));
+            CHECK(std::memcmp(loaded.location, binary, sizeof(binary)) == 0);
+            alloc.deallocate(loaded);
+        }
+
+        THEN("other keys are a miss")
+        {
+            CHECK(cache->load_binary(binary_key + 1, alloc).location == nullptr);
+        }
+
+        WHEN("the entry is truncated")
+        {
+            std::vector<std::filesystem::path> const files = directory.cache_files();
+            REQUIRE(files.size() == 1);
+            std::filesystem::resize_file(files[0], std::filesystem::file_size(files[0]) - 1);
+
+            THEN("the lookup is a miss")
+            {
+                CHECK(cache->load_binary(binary_key, alloc).location == nullptr);
+            }
+        }
+    }
+
+    alloc.destroy(cache);
+}
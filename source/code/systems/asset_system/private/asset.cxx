@@ -18,7 +18,8 @@ namespace ice
     Asset::Asset(ice::AssetHandle* handle) noexcept
         : _handle{ handle }
     {
-        _handle->_refcount.fetch_add(1, std::memory_order_relaxed);
+        // Needs to be ordered with the status checks in 'AssetHandle::release_data'.
+        _handle->_refcount.fetch_add(1, std::memory_order_seq_cst);
     }
 
     Asset::~Asset() noexcept
@@ -99,11 +100,12 @@ namespace ice
             return;
         }
 
-        ice::u32 const oldcount = _handle->_refcount.fetch_sub(1, std::memory_order_relaxed);
-        if (oldcount == 1)
+        ice::u32 const oldcount = _handle->_refcount.fetch_sub(1, std::memory_order_seq_cst);
+        // Shelves with a memory budget keep the data until it's evicted.
+        if (oldcount == 1 && _handle->_shelve->keeps_released_data() == false)
         {
-            // Release all data and metadata loaded
-            _handle->_data.reset();
+            // Release all data and metadata loaded, safe against concurrent binds.
+            _handle->release_data();
 
             // Unload the resource (if not yet done yet)
             // ice::wait_for(_info.resource_tracker.unload_resource(entry->_resource));
@@ -150,11 +152,20 @@ namespace ice
     {
         // This object might be unused (it's only alive for the request duration)
         ice::AssetStateTrackers* trackersptrs = nullptr;
-        if (_handle->_request_trackers.compare_exchange_strong(trackersptrs, ice::addressof(trackers), std::memory_order_relaxed))
+        if (_handle->_request_trackers.compare_exchange_strong(trackersptrs, ice::addressof(trackers), std::memory_order_seq_cst))
         {
             trackersptrs = ice::addressof(trackers);
         }
 
+        // Residency updates hold the entry while accessing its data chain, they either observe our trackers
+        //  and leave the data untouched or we wait here until they are done.
+        ice::AssetHandleStatus status = _handle->_status.load(std::memory_order_seq_cst);
+        while (status == AssetHandleStatus::Releasing)
+        {
+            _handle->_status.wait(status, std::memory_order_acquire);
+            status = _handle->_status.load(std::memory_order_seq_cst);
+        }
+
         return ice::AssetStateTransaction{
             state, _handle->_shelve->asset_allocator(), static_cast<ice::AssetEntry&>(*_handle), *trackersptrs
         };
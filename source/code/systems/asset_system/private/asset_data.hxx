@@ -147,6 +147,33 @@ namespace ice
         co_return result;
     }
 
+    //! \brief Removes allocated data entries for the given state, the first entry and metadata entries are always kept.
+    //! \returns The size of released memory.
+    inline auto asset_data_demote(ice::UniquePtr<ice::AssetData>& data, ice::AssetState state) noexcept -> ice::usize
+    {
+        ice::usize released = 0_B;
+        ice::UniquePtr<ice::AssetData>* link = ice::addressof(data->_next);
+        while (*link != nullptr)
+        {
+            ice::AssetData const* const entry = link->get();
+            if (entry->_state == state
+                && ice::has_all(entry->_flags, AssetDataFlags::Allocated)
+                && ice::has_none(entry->_flags, AssetDataFlags::Metadata))
+            {
+                released += entry->_size;
+
+                // Detach the entry first, assigning directly would destroy the remaining chain.
+                ice::UniquePtr<ice::AssetData> removed = ice::move(*link);
+                *link = ice::move(removed->_next);
+            }
+            else
+            {
+                link = ice::addressof((*link)->_next);
+            }
+        }
+        return released;
+    }
+
     template<typename T> requires (std::is_base_of_v<ice::AssetData, T>)
     inline void destroy_asset_data_entry(T* asset_data) noexcept
     {
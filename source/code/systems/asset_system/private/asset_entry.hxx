@@ -27,6 +27,17 @@ namespace ice
         std::atomic<ice::u8> runtime_awaiting;
     };
 
+    //! \brief Lifetime state of the data owned by an asset handle.
+    //! \details Transitions: Released -> Binding -> Bound -> Releasing -> Released.
+    //!   Only the thread that successfully moved the handle into 'Binding' or 'Releasing' is allowed to touch '_data'.
+    enum class AssetHandleStatus : ice::u8
+    {
+        Released,
+        Binding,
+        Bound,
+        Releasing,
+    };
+
     struct AssetHandle
     {
         inline AssetHandle() noexcept;
@@ -39,6 +50,16 @@ namespace ice
 
         inline auto data_for_state(ice::AssetState state) noexcept -> ice::Data;
 
+        //! \brief Ensures the handle holds data, needs to be called after the reference count was increased.
+        //! \details If the handle was released, the first caller creates new data using 'fn_create_data(_data)',
+        //!   while concurrent callers wait for it to finish. Callers also wait for an in-progress release.
+        template<typename Fn>
+        inline void acquire_data(Fn&& fn_create_data) noexcept;
+
+        //! \brief Releases the handle data, needs to be called after the reference count dropped to zero.
+        //! \note If the handle is acquired again during the release, the data is kept.
+        inline void release_data() noexcept;
+
         inline auto state() const noexcept -> ice::AssetState
         {
             return _data == nullptr ? AssetState::Exists : _data->_state;
@@ -48,10 +69,17 @@ namespace ice
         ice::StringID _identifier;
         ice::AssetShelve* _shelve;
         std::atomic<ice::u32> _refcount;
+        std::atomic<ice::AssetHandleStatus> _status;
+
+        //! \brief Residency tick of the last bind or data request, used to evict data in LRU order.
+        std::atomic<ice::u32> _last_access;
 
         // Data
         ice::UniquePtr<ice::AssetData> _data;
 
+        // Next handle in the same shelve bucket, immutable after the handle was published.
+        ice::AssetHandle* _shelve_next;
+
         // Loading
         std::atomic<ice::AssetStateTrackers*> _request_trackers;
     };
@@ -60,7 +88,10 @@ namespace ice
         : _identifier{ }
         , _shelve{ nullptr }
         , _refcount{ 0 }
+        , _status{ AssetHandleStatus::Released }
+        , _last_access{ 0 }
         , _data{ }
+        , _shelve_next{ nullptr }
         , _request_trackers{ }
     {
     }
@@ -73,7 +104,10 @@ namespace ice
         : _identifier{ id }
         , _shelve{ shelve }
         , _refcount{ 0 }
+        , _status{ resource != nullptr ? AssetHandleStatus::Bound : AssetHandleStatus::Released }
+        , _last_access{ 0 }
         , _data{ ice::move(resource) }
+        , _shelve_next{ nullptr }
         , _request_trackers{ }
     {
     }
@@ -82,7 +116,10 @@ namespace ice
         : _identifier{ other._identifier }
         , _shelve{ other._shelve }
         , _refcount{ other._refcount.load(std::memory_order_relaxed) }
+        , _status{ other._status.load(std::memory_order_relaxed) }
+        , _last_access{ other._last_access.load(std::memory_order_relaxed) }
         , _data{ ice::move(other._data) }
+        , _shelve_next{ other._shelve_next }
         , _request_trackers{ other._request_trackers.load(std::memory_order_relaxed) }
     {
 
@@ -93,6 +130,62 @@ namespace ice
         return ice::asset_data_find(_data, state);
     }
 
+    template<typename Fn>
+    inline void AssetHandle::acquire_data(Fn&& fn_create_data) noexcept
+    {
+        // Sequentially consistent operations are required, so 'release_data' always observes our reference
+        //  when we observe the 'Bound' state.
+        ice::AssetHandleStatus status = _status.load(std::memory_order_seq_cst);
+        while (status != AssetHandleStatus::Bound)
+        {
+            if (status == AssetHandleStatus::Released)
+            {
+                if (_status.compare_exchange_weak(status, AssetHandleStatus::Binding, std::memory_order_seq_cst))
+                {
+                    ice::forward<Fn>(fn_create_data)(_data);
+
+                    _status.store(AssetHandleStatus::Bound, std::memory_order_seq_cst);
+                    _status.notify_all();
+                    return;
+                }
+            }
+            else
+            {
+                // Another thread is binding or releasing the data, sleep until it's done.
+                _status.wait(status, std::memory_order_acquire);
+                status = _status.load(std::memory_order_seq_cst);
+            }
+        }
+    }
+
+    inline void AssetHandle::release_data() noexcept
+    {
+        ice::AssetHandleStatus expected = AssetHandleStatus::Bound;
+        while (_status.compare_exchange_strong(expected, AssetHandleStatus::Releasing, std::memory_order_seq_cst))
+        {
+            if (_refcount.load(std::memory_order_seq_cst) == 0)
+            {
+                // Release all data and metadata loaded
+                _data.reset();
+
+                _status.store(AssetHandleStatus::Released, std::memory_order_seq_cst);
+                _status.notify_all();
+                return;
+            }
+
+            // The handle was acquired again in the meantime, keep the data.
+            _status.store(AssetHandleStatus::Bound, std::memory_order_seq_cst);
+            _status.notify_all();
+
+            // ... unless the new reference was already dropped while we were holding the 'Releasing' state.
+            if (_refcount.load(std::memory_order_seq_cst) != 0)
+            {
+                return;
+            }
+            expected = AssetHandleStatus::Bound;
+        }
+    }
+
     template<bool IsDebug = true>
     struct AssetEntryFinal : AssetHandle
     {
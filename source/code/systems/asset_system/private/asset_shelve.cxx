@@ -6,7 +6,8 @@
 #include "asset_request_awaitable.hxx"
 
 #include <ice/assert.hxx>
-#include <ice/container/hashmap.hxx>
+#include <ice/container/array.hxx>
+#include <ice/sort.hxx>
 #include <ice/mem_allocator_utils.hxx>
 #include <ice/profiler.hxx>
 #include <ice/string/heap_string.hxx>
@@ -25,16 +26,21 @@ namespace ice
         , definition{ definition }
         , compiler{ compiler }
         , _allocator{ alloc }
-        , _asset_resources{ alloc }
+        , _buckets{ }
+        , _budgets{ }
+        , _usage{ }
     {
-        ice::hashmap::reserve(_asset_resources, 25);
     }
 
     AssetShelve::~AssetShelve() noexcept
     {
-        for (ice::AssetEntry* entry : _asset_resources)
+        for (std::atomic<ice::AssetEntry*>& bucket : _buckets)
         {
-            _allocator.destroy(entry);
+            ice::AssetEntry* entry = bucket.load(std::memory_order_relaxed);
+            while (entry != nullptr)
+            {
+                _allocator.destroy(ice::exchange(entry, static_cast<ice::AssetEntry*>(entry->_shelve_next)));
+            }
         }
     }
 
@@ -47,17 +53,19 @@ namespace ice
         ice::StringID_Arg name
     ) noexcept -> ice::AssetEntry*
     {
-        return ice::hashmap::get(_asset_resources, ice::hash(name), nullptr);
+        std::atomic<ice::AssetEntry*> const& bucket = _buckets[ice::hash(name) & (Constant_BucketCount - 1)];
+        return find_in_bucket(bucket.load(std::memory_order_acquire), nullptr, name);
     }
 
     auto AssetShelve::select(
         ice::StringID_Arg name
     ) const noexcept -> ice::AssetEntry const*
     {
-        ice::u64 const name_hash = ice::hash(name);
+        std::atomic<ice::AssetEntry*> const& bucket = _buckets[ice::hash(name) & (Constant_BucketCount - 1)];
 
         static ice::AssetEntry invalid_resource{ };
-        return ice::hashmap::get(_asset_resources, name_hash, &invalid_resource);
+        ice::AssetEntry const* const entry = find_in_bucket(bucket.load(std::memory_order_acquire), nullptr, name);
+        return entry != nullptr ? entry : &invalid_resource;
     }
 
     auto AssetShelve::store(
@@ -69,30 +77,18 @@ namespace ice
             _allocator, AssetState::Exists, resource
         );
 
-        ice::u64 const name_hash = ice::hash(ice::stringid(name));
+        ice::AssetEntry* entry;
         if constexpr (ice::AssetEntry::HoldsDebugData)
         {
             ice::HeapString<> asset_name{ _allocator, name };
-
-            ice::hashmap::set(
-                _asset_resources,
-                name_hash,
-                _allocator.create<ice::AssetEntry>(ice::move(asset_name), this, ice::move(resource_data))
-            );
+            entry = _allocator.create<ice::AssetEntry>(ice::move(asset_name), this, ice::move(resource_data));
         }
         else
         {
-            ice::hashmap::set(
-                _asset_resources,
-                name_hash,
-                _allocator.create<ice::AssetEntry>(ice::stringid(name), this, ice::move(resource_data))
-            );
+            entry = _allocator.create<ice::AssetEntry>(ice::stringid(name), this, ice::move(resource_data));
         }
 
-        ice::AssetEntry** entry = ice::hashmap::try_get(_asset_resources, name_hash);
-        ICE_ASSERT_CORE(entry != nullptr);
-        ICE_ASSERT_CORE(*entry != nullptr);
-        return *entry;
+        return insert(entry);
     }
 
     auto AssetShelve::store(
@@ -108,30 +104,222 @@ namespace ice
             data_binding.metadata
         );
 
-        ice::u64 const name_hash = ice::hash(ice::stringid(name));
+        ice::AssetEntry* entry;
         if constexpr (ice::AssetEntry::HoldsDebugData)
         {
             ice::HeapString<> asset_name{ _allocator, name };
-
-            ice::hashmap::set(
-                _asset_resources,
-                name_hash,
-                _allocator.create<ice::AssetEntry>(ice::move(asset_name), this, ice::move(resource_data))
-            );
+            entry = _allocator.create<ice::AssetEntry>(ice::move(asset_name), this, ice::move(resource_data));
         }
         else
         {
-            ice::hashmap::set(
-                _asset_resources,
-                name_hash,
-                _allocator.create<ice::AssetEntry>(ice::stringid(name), this, ice::move(resource_data))
-            );
+            entry = _allocator.create<ice::AssetEntry>(ice::stringid(name), this, ice::move(resource_data));
         }
 
-        ice::AssetEntry** entry = ice::hashmap::try_get(_asset_resources, name_hash);
-        ICE_ASSERT_CORE(entry != nullptr);
-        ICE_ASSERT_CORE(*entry != nullptr);
-        return *entry;
+        return insert(entry);
+    }
+
+    auto AssetShelve::find_in_bucket(
+        ice::AssetEntry* first,
+        ice::AssetEntry const* last,
+        ice::StringID_Arg name
+    ) const noexcept -> ice::AssetEntry*
+    {
+        ice::AssetEntry* entry = first;
+        while (entry != last && entry->_identifier != name)
+        {
+            entry = static_cast<ice::AssetEntry*>(entry->_shelve_next);
+        }
+        return entry != last ? entry : nullptr;
+    }
+
+    auto AssetShelve::insert(ice::AssetEntry* entry) noexcept -> ice::AssetEntry*
+    {
+        std::atomic<ice::AssetEntry*>& bucket = _buckets[ice::hash(entry->_identifier) & (Constant_BucketCount - 1)];
+
+        ice::AssetEntry* head = bucket.load(std::memory_order_acquire);
+        ice::AssetEntry const* checked_head = nullptr;
+        do
+        {
+            // Only entries pushed since the last attempt need to be checked for a duplicate.
+            ice::AssetEntry* const existing = find_in_bucket(head, checked_head, entry->_identifier);
+            if (existing != nullptr)
+            {
+                _allocator.destroy(entry);
+                return existing;
+            }
+
+            checked_head = head;
+            entry->_shelve_next = head;
+        } while (
+            bucket.compare_exchange_weak(
+                head,
+                entry,
+                std::memory_order_release,
+                std::memory_order_acquire
+            ) == false
+        );
+        return entry;
+    }
+
+    void AssetShelve::set_budget(
+        ice::AssetCategoryBudget const& budget
+    ) noexcept
+    {
+        _budgets[0] = budget.baked;
+        _budgets[1] = budget.loaded;
+        _budgets[2] = budget.runtime;
+    }
+
+    bool AssetShelve::keeps_released_data() const noexcept
+    {
+        return _budgets[0] > 0_B || _budgets[1] > 0_B || _budgets[2] > 0_B;
+    }
+
+    bool AssetShelve::lock_entry(ice::AssetEntry* entry) noexcept
+    {
+        // Blocks concurrent binds, releases and new requests while we are accessing the data chain.
+        ice::AssetHandleStatus expected = AssetHandleStatus::Bound;
+        return entry->_status.compare_exchange_strong(expected, AssetHandleStatus::Releasing, std::memory_order_seq_cst);
+    }
+
+    void AssetShelve::unlock_entry(ice::AssetEntry* entry) noexcept
+    {
+        entry->_status.store(AssetHandleStatus::Bound, std::memory_order_seq_cst);
+        entry->_status.notify_all();
+
+        // The last reference might have been dropped while we were holding the entry.
+        if (entry->_refcount.load(std::memory_order_seq_cst) == 0 && keeps_released_data() == false)
+        {
+            entry->release_data();
+        }
+    }
+
+    void AssetShelve::update_residency(
+        ice::Allocator& temp_alloc,
+        ice::u32 tick
+    ) noexcept
+    {
+        IPT_ZONE_SCOPED;
+
+        struct Candidate
+        {
+            ice::AssetEntry* entry;
+            ice::u32 last_access;
+            ice::u32 state_idx;
+            ice::usize size;
+        };
+
+        ice::u32 const state_base_idx = static_cast<ice::u32>(AssetState::Baked);
+
+        ice::usize usage[3]{ };
+        ice::Array<Candidate> candidates{ temp_alloc };
+
+        // Gather memory usage and all entries that could be demoted or evicted.
+        for (std::atomic<ice::AssetEntry*>& bucket : _buckets)
+        {
+            ice::AssetEntry* entry = bucket.load(std::memory_order_acquire);
+            for (; entry != nullptr; entry = static_cast<ice::AssetEntry*>(entry->_shelve_next))
+            {
+                // Hold the entry so the data chain is not released or modified while we walk it.
+                if (lock_entry(entry) == false)
+                {
+                    continue;
+                }
+
+                ice::u32 const last_access = entry->_last_access.load(std::memory_order_relaxed);
+                bool const unreferenced = entry->_refcount.load(std::memory_order_seq_cst) == 0;
+                bool const demotable = definition.allow_demotion
+                    && (tick - last_access) > Constant_DemoteAfterTicks
+                    && entry->_request_trackers.load(std::memory_order_seq_cst) == nullptr;
+
+                ice::AssetData const* const head = entry->_data.get();
+                for (ice::AssetData const* data = head; data != nullptr; data = data->_next.get())
+                {
+                    if (data->_state < AssetState::Baked
+                        || ice::has_none(data->_flags, AssetDataFlags::Allocated)
+                        || ice::has_any(data->_flags, AssetDataFlags::Metadata))
+                    {
+                        continue;
+                    }
+
+                    ice::u32 const state_idx = static_cast<ice::u32>(data->_state) - state_base_idx;
+                    usage[state_idx] += data->_size;
+
+                    // Unreferenced assets can be evicted, referenced ones can only lose data superseded by a higher state.
+                    bool const superseded = data != head && data->_state < head->_state;
+                    if (_budgets[state_idx] > 0_B && (unreferenced || (demotable && superseded)))
+                    {
+                        ice::array::push_back(candidates, Candidate{ entry, last_access, state_idx, data->_size });
+                    }
+                }
+
+                unlock_entry(entry);
+            }
+        }
+
+        // Oldest accesses first
+        ice::sort(
+            ice::array::slice(candidates),
+            [](Candidate const& left, Candidate const& right) noexcept
+            {
+                return left.last_access < right.last_access;
+            }
+        );
+
+        for (Candidate const& candidate : candidates)
+        {
+            ice::u32 const idx = candidate.state_idx;
+            if (usage[idx] <= _budgets[idx])
+            {
+                continue;
+            }
+
+            ice::AssetEntry* const entry = candidate.entry;
+            if (entry->_refcount.load(std::memory_order_seq_cst) == 0)
+            {
+                // Evicts all states at once, other candidates of this entry will be ignored.
+                if (entry->_status.load(std::memory_order_acquire) == AssetHandleStatus::Bound)
+                {
+                    entry->release_data();
+                }
+                usage[idx] = ice::usize::subtract(usage[idx], ice::min(usage[idx], candidate.size));
+            }
+            else if (lock_entry(entry))
+            {
+                // Requests might have started since the entry was gathered, loaders modify the data chain without
+                //  holding the entry, so we only demote while no request is running.
+                if (definition.allow_demotion
+                    && entry->_refcount.load(std::memory_order_seq_cst) != 0
+                    && entry->_request_trackers.load(std::memory_order_seq_cst) == nullptr)
+                {
+                    ice::usize const released = ice::asset_data_demote(entry->_data, static_cast<ice::AssetState>(idx + state_base_idx));
+                    usage[idx] = ice::usize::subtract(usage[idx], ice::min(usage[idx], released));
+                }
+
+                unlock_entry(entry);
+            }
+        }
+
+        for (ice::u32 idx = 0; idx < 3; ++idx)
+        {
+            _usage[idx].store(usage[idx].value, std::memory_order_relaxed);
+        }
+    }
+
+    auto AssetShelve::residency_usage(ice::AssetState state) const noexcept -> ice::usize
+    {
+        ice::u32 const state_base_idx = static_cast<ice::u32>(AssetState::Baked);
+        ice::u32 const state_idx = static_cast<ice::u32>(state);
+        ICE_ASSERT(state_idx >= state_base_idx, "Residency is only tracked for 'Baked' and higher states!");
+        return { _usage[state_idx - state_base_idx].load(std::memory_order_relaxed) };
+    }
+
+    auto AssetShelve::residency_budget(ice::AssetState state) const noexcept -> ice::usize
+    {
+        ice::u32 const state_base_idx = static_cast<ice::u32>(AssetState::Baked);
+        ice::u32 const state_idx = static_cast<ice::u32>(state);
+        ICE_ASSERT(state_idx >= state_base_idx, "Residency is only tracked for 'Baked' and higher states!");
+        return _budgets[state_idx - state_base_idx];
     }
 
     void AssetShelve::append_request(
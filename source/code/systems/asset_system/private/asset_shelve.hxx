@@ -27,6 +27,7 @@ namespace ice
 
         auto asset_allocator() noexcept -> ice::Allocator&;
 
+        //! \note Lock-free, can be called from any thread.
         auto select(
             ice::StringID_Arg name
         ) noexcept -> ice::AssetEntry*;
@@ -35,6 +36,9 @@ namespace ice
             ice::StringID_Arg name
         ) const noexcept -> ice::AssetEntry const*;
 
+        //! \brief Creates a new entry for the given name.
+        //! \note Lock-free, can be called from any thread. If another thread stored the same name concurrently
+        //!   the entry created by that thread is returned instead.
         auto store(
             ice::String name,
             ice::ResourceHandle const& resource_handle
@@ -54,6 +58,27 @@ namespace ice
             ice::AssetState state
         ) noexcept -> ice::AssetRequestAwaitable*;
 
+        void set_budget(
+            ice::AssetCategoryBudget const& budget
+        ) noexcept;
+
+        //! \returns 'true' if released assets keep their data, until evicted by 'update_residency'.
+        bool keeps_released_data() const noexcept;
+
+        //! \brief Updates memory usage and releases data of assets over budget in least-recently-used order.
+        //! \note Only called for shelves with a budget, see 'keeps_released_data'.
+        //! \param tick The current residency tick, compared against the last access tick of each asset.
+        void update_residency(
+            ice::Allocator& temp_alloc,
+            ice::u32 tick
+        ) noexcept;
+
+        //! \returns Memory used by allocated asset data of the given state, as calculated during the last update.
+        auto residency_usage(ice::AssetState state) const noexcept -> ice::usize;
+
+        //! \returns Memory budget for the given state, zero if not limited.
+        auto residency_budget(ice::AssetState state) const noexcept -> ice::usize;
+
         ice::DefaultAssetStorage& storage;
         ice::AssetCategoryDefinition const& definition;
         ice::ResourceCompiler const* compiler;
@@ -61,8 +86,36 @@ namespace ice
         class DevUI;
 
     private:
+        auto find_in_bucket(
+            ice::AssetEntry* first,
+            ice::AssetEntry const* last,
+            ice::StringID_Arg name
+        ) const noexcept -> ice::AssetEntry*;
+
+        auto insert(ice::AssetEntry* entry) noexcept -> ice::AssetEntry*;
+
+        //! \brief Moves a bound entry into the 'Releasing' state, giving exclusive access to its data chain.
+        //! \returns 'false' if the entry is not bound or is already held by another thread.
+        bool lock_entry(ice::AssetEntry* entry) noexcept;
+
+        //! \brief Moves the entry back into the 'Bound' state, releasing it if the last reference was dropped meanwhile.
+        void unlock_entry(ice::AssetEntry* entry) noexcept;
+
+    private:
+        //! \brief Number of residency ticks without a request after which lower state data can be dropped.
+        static constexpr ice::u32 Constant_DemoteAfterTicks = 8;
+
+        static constexpr ice::u32 Constant_BucketCount = 512;
+        static_assert((Constant_BucketCount & (Constant_BucketCount - 1)) == 0, "Bucket count needs to be a power of two!");
+
         ice::Allocator& _allocator;
-        ice::HashMap<ice::AssetEntry*> _asset_resources;
+
+        //! \brief Insert-only hash index, each bucket is a lock-free list with new entries pushed at the head.
+        std::atomic<ice::AssetEntry*> _buckets[Constant_BucketCount];
+
+        //! \brief Budgets and usage for the 'Baked', 'Loaded' and 'Runtime' states.
+        ice::usize _budgets[3];
+        std::atomic<ice::usize::base_type> _usage[3];
 
         std::atomic<ice::AssetRequestAwaitable*> _new_requests[3];
         std::atomic<ice::AssetRequestAwaitable*> _reversed_requests[3];
@@ -4,7 +4,6 @@
 #include "asset_shelve_devui.hxx"
 
 #include <ice/resource.hxx>
-#include <ice/container/hashmap.hxx>
 #include <imgui/imgui.h>
 #undef assert
 
@@ -35,6 +34,26 @@ namespace ice
             | ImGuiTableFlags_BordersV
             | ImGuiTableFlags_RowBg;
 
+        static constexpr ice::AssetState Constant_BudgetStates[]{ AssetState::Baked, AssetState::Loaded, AssetState::Runtime };
+        static constexpr char const* Constant_BudgetStateNames[]{ "Baked", "Loaded", "Runtime" };
+
+        // Memory usage as calculated during the last residency update, shelves without a budget are not updated.
+        for (ice::u32 idx = 0; idx < ice::count(Constant_BudgetStates); ++idx)
+        {
+            ice::f32 const usage_mib = ice::f32(_shelve.residency_usage(Constant_BudgetStates[idx]).value) / (1024.f * 1024.f);
+            ice::f32 const budget_mib = ice::f32(_shelve.residency_budget(Constant_BudgetStates[idx]).value) / (1024.f * 1024.f);
+            if (budget_mib > 0.f)
+            {
+                ImGui::ProgressBar(ice::min(usage_mib / budget_mib, 1.f), ImVec2{ 200.f, 0.f });
+                ImGui::SameLine();
+                ImGui::Text("%s: %.2f / %.2f MiB", Constant_BudgetStateNames[idx], usage_mib, budget_mib);
+            }
+            else
+            {
+                ImGui::Text("%s: no budget", Constant_BudgetStateNames[idx]);
+            }
+        }
+
         if (ImGui::BeginTable("AssetShelve:Assets", 3, flags))
         {
             ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_NoHide);
@@ -42,28 +61,32 @@ namespace ice
             ImGui::TableSetupColumn("Resource", ImGuiTableColumnFlags_DefaultHide);
             ImGui::TableHeadersRow();
 
-            for (ice::AssetEntry const* entry : ice::hashmap::values(_shelve._asset_resources))
+            for (std::atomic<ice::AssetEntry*> const& bucket : _shelve._buckets)
             {
-                ImGui::TableNextRow();
-                ImGui::TableNextColumn();
-                ImGui::TextUnformatted(ice::string::begin(entry->debug_name), ice::string::end(entry->debug_name));
-
-                if (ImGui::TableNextColumn()) // Status
+                ice::AssetEntry const* entry = bucket.load(std::memory_order_acquire);
+                for (; entry != nullptr; entry = static_cast<ice::AssetEntry const*>(entry->_shelve_next))
                 {
-                    static constexpr ice::String Constant_StateNames[]{
-                        "Invalid", "Unknown", "Exists", "Raw", "Baked", "Loaded", "Runtime"
-                    };
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(ice::string::begin(entry->debug_name), ice::string::end(entry->debug_name));
 
-                    ImGui::TextUnformatted(
-                        ice::string::begin(Constant_StateNames[static_cast<ice::u32>(entry->state())]),
-                        ice::string::end(Constant_StateNames[static_cast<ice::u32>(entry->state())])
-                    );
-                }
-                if (ImGui::TableNextColumn()) // Resource
-                {
-                    ice::ResourceHandle const handle = ice::asset_data_resource(entry->_data);
-                    ice::String const origin = handle != nullptr ? handle->origin() : "???";
-                    ImGui::TextUnformatted(ice::string::begin(origin), ice::string::end(origin));
+                    if (ImGui::TableNextColumn()) // Status
+                    {
+                        static constexpr ice::String Constant_StateNames[]{
+                            "Invalid", "Unknown", "Exists", "Raw", "Baked", "Loaded", "Runtime"
+                        };
+
+                        ImGui::TextUnformatted(
+                            ice::string::begin(Constant_StateNames[static_cast<ice::u32>(entry->state())]),
+                            ice::string::end(Constant_StateNames[static_cast<ice::u32>(entry->state())])
+                        );
+                    }
+                    if (ImGui::TableNextColumn()) // Resource
+                    {
+                        ice::ResourceHandle const handle = ice::asset_data_resource(entry->_data);
+                        ice::String const origin = handle != nullptr ? handle->origin() : "???";
+                        ImGui::TextUnformatted(ice::string::begin(origin), ice::string::end(origin));
+                    }
                 }
             }
 
@@ -10,6 +10,7 @@
 
 #include <ice/mem_allocator_utils.hxx>
 #include <ice/config.hxx>
+#include <ice/sort.hxx>
 
 namespace ice
 {
@@ -64,11 +65,12 @@ namespace ice
             ice::Allocator& alloc,
             ice::ResourceCompiler const& compiler,
             ice::ResourceTracker& resource_tracker,
+            ice::Span<ice::Shard const> compiler_params,
             ice::AssetStateTransaction& transaction
         ) noexcept -> ice::Task<bool>
         {
             ice::Array<ice::ResourceHandle> sources{ alloc };
-            ice::Array<ice::URI> dependencies{ alloc }; // Not used currently
+            ice::Array<ice::URI> dependencies{ alloc };
 
             ice::ResourceHandle resource = ice::asset_data_resource(transaction.asset._data);
 
@@ -77,7 +79,7 @@ namespace ice
             if (compiler.fn_prepare_context)
             {
                 ICE_ASSERT_CORE(compiler.fn_cleanup_context);
-                if (compiler.fn_prepare_context(alloc, ctx, {}) == false)
+                if (compiler.fn_prepare_context(alloc, ctx, compiler_params) == false)
                 {
                     co_return false;
                 }
@@ -186,6 +188,9 @@ namespace ice
             ice::ConfigBuilder meta{ alloc };
             if (ice::wait_for_result(compiler.fn_build_metadata(ctx, resource, resource_tracker, compiled_sources, dependencies, meta)))
             {
+                // Store dependency edges so the asset graph can be walked when preloading
+                ice::resource_compiler_write_dependencies(meta, dependencies);
+
                 // Finalize the asset
                 transaction.set_result_data(
                     alloc,
@@ -221,6 +226,46 @@ namespace ice
             co_return false;
         }
 
+        bool find_dependency_category(
+            ice::AssetCategoryArchive const& archive,
+            ice::String dependency,
+            ice::AssetCategory& out_category,
+            ice::String& out_name
+        ) noexcept
+        {
+            ice::u32 const dependency_size = ice::string::size(dependency);
+            for (ice::AssetCategory const& category : archive.categories())
+            {
+                ice::AssetCategoryDefinition const& definition = archive.find_definition(category);
+                for (ice::String const extension : definition.resource_extensions)
+                {
+                    ice::u32 const extension_size = ice::string::size(extension);
+                    if (dependency_size > extension_size
+                        && ice::string::substr(dependency, dependency_size - extension_size) == extension)
+                    {
+                        out_category = category;
+                        out_name = ice::string::substr(dependency, 0, dependency_size - extension_size);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        auto load_asset_metadata(ice::Asset const& asset, ice::Data& out_metadata) noexcept -> ice::Task<>
+        {
+            if (co_await asset.metadata(out_metadata) != S_Ok)
+            {
+                out_metadata = { };
+            }
+        }
+
+        auto asset_storage_order(ice::Asset const& asset) noexcept -> ice::u64
+        {
+            ice::Resource const* const resource = asset.resource();
+            return resource != nullptr ? resource->storage_order() : 0;
+        }
+
     } // namespace detail
 
     auto create_asset_storage_devui(
@@ -236,10 +281,17 @@ namespace ice
     ) noexcept
         : _allocator{ alloc }
         , _info{ create_info }
+        , _compiler_params{ _allocator }
         , _asset_archive{ ice::move(asset_archive) }
         , _asset_shelves{ _allocator }
+        , _residency_shelves{ _allocator }
+        , _residency_tick{ 0 }
+        , _residency_running{ false }
         , _devui_widget{ }
     {
+        ice::array::push_back(_compiler_params, create_info.compiler_params);
+        _info.compiler_params = _compiler_params;
+
         ice::Span<ice::AssetCategory const> categories = _asset_archive->categories();
         ice::hashmap::reserve(_asset_shelves, ice::count(categories));
 
@@ -254,6 +306,19 @@ namespace ice
             );
             ice::hashmap::set(_asset_shelves, category.identifier, shelve);
 
+            for (ice::AssetCategoryBudget const& budget : create_info.budgets)
+            {
+                if (budget.category.identifier == category.identifier)
+                {
+                    shelve->set_budget(budget);
+                }
+            }
+
+            if (shelve->keeps_released_data())
+            {
+                ice::array::push_back(_residency_shelves, shelve);
+            }
+
             if constexpr (ice::build::is_debug || ice::build::is_develop)
             {
                 ice::array::push_back(shelves, ice::make_unique<AssetShelve::DevUI>(_allocator, *shelve));
@@ -279,39 +344,10 @@ namespace ice
     ) noexcept -> ice::Asset
     {
         Asset result{ };
-        // CHECK: Always called from the same thread.
-        // OR TODO: Think of how to make it MT + lock-free
 
         ice::AssetShelve* shelve = nullptr;
         ice::AssetEntry* entry = nullptr;
-        if (find_shelve_and_entry(category, name, shelve, entry))
-        {
-            result = Asset{ entry };
-
-            // We need to ensure the previous count was higher else the asset might be released already
-            ice::u32 const curr_count = entry->_refcount.load(std::memory_order_relaxed);
-            if (curr_count == 1)
-            {
-                // Only keep metadata data
-                while (entry->_data != nullptr)
-                {
-                    // TODO: Add an sleep statement?
-                    //IPT_MESSAGE_C("Asset waiting for 'Release' operation to finish.", 0xEE8866);
-                }
-
-                // Assing a new data entry.
-                ice::ResourceHandle const resource_handle = ice::detail::find_resource(
-                    shelve->definition,
-                    _info.resource_tracker,
-                    name
-                );
-
-                entry->_data = ice::create_asset_data_entry(
-                    _allocator, AssetState::Exists, resource_handle
-                );
-            }
-        }
-        else if (shelve != nullptr)
+        if (find_shelve_and_entry(category, name, shelve, entry) == false && shelve != nullptr)
         {
             ice::ResourceHandle const resource_handle = ice::detail::find_resource(
                 shelve->definition,
@@ -321,15 +357,32 @@ namespace ice
 
             if (resource_handle.valid())
             {
-                // Create a new asset entry if the handle exists
+                // Create a new asset entry if the handle exists, might return an entry stored concurrently.
                 entry = shelve->store(name, resource_handle);
                 ICE_ASSERT_CORE(entry != nullptr);
+            }
+        }
 
-                //ice::u32 const prev_count = entry->_refcount.fetch_add(1, std::memory_order_relaxed);
-                //ICE_ASSERT(prev_count == 0, "Unexpected value!");
+        if (entry != nullptr)
+        {
+            result = Asset{ entry };
+            entry->_last_access.store(_residency_tick.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
-                result = Asset{ entry };
-            }
+            // If the asset was released before, we need to assign a new data entry.
+            entry->acquire_data(
+                [&, this](ice::UniquePtr<ice::AssetData>& out_data) noexcept
+                {
+                    ice::ResourceHandle const resource_handle = ice::detail::find_resource(
+                        shelve->definition,
+                        _info.resource_tracker,
+                        name
+                    );
+
+                    out_data = ice::create_asset_data_entry(
+                        _allocator, AssetState::Exists, resource_handle
+                    );
+                }
+            );
         }
         return result;
     }
@@ -341,8 +394,6 @@ namespace ice
     ) noexcept -> ice::Asset
     {
         Asset result{ };
-        // CHECK: Always called from the same thread.
-        // OR TODO: Think of how to make it MT + lock-free
 
         // TODO: Can we have empty assets?
         if (data_binding.content.location == nullptr)
@@ -352,40 +403,31 @@ namespace ice
 
         ice::AssetShelve* shelve = nullptr;
         ice::AssetEntry* entry = nullptr;
-        if (find_shelve_and_entry(category, name, shelve, entry))
+        if (find_shelve_and_entry(category, name, shelve, entry) == false && shelve != nullptr)
         {
-            result = Asset{ entry };
-
-            // We need to ensure the previous count was higher else the asset might be released already
-            ice::u32 const curr_count = entry->_refcount.load(std::memory_order_relaxed);
-            if (curr_count == 1)
-            {
-                // Only keep metadata data
-                while (entry->_data != nullptr)
-                {
-                    // TODO: Add an sleep statement?
-                    //IPT_MESSAGE_C("Asset waiting for 'Release' operation to finish.", 0xEE8866);
-                }
-
-                entry->_data = ice::create_asset_data_entry(
-                    _allocator,
-                    data_binding.state,
-                    _allocator,
-                    data_binding.content,
-                    data_binding.metadata
-                );
-            }
-        }
-        else if (shelve != nullptr)
-        {
-            // Create a new asset entry if the handle exists
+            // Create a new asset entry, might return an entry stored concurrently.
             entry = shelve->store(name, data_binding);
             ICE_ASSERT_CORE(entry != nullptr);
+        }
 
-            //ice::u32 const prev_count = entry->_refcount.fetch_add(1, std::memory_order_relaxed);
-            //ICE_ASSERT(prev_count == 0, "Unexpected value!");
-
+        if (entry != nullptr)
+        {
             result = Asset{ entry };
+            entry->_last_access.store(_residency_tick.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            // If the asset was released before, we need to assign a new data entry.
+            entry->acquire_data(
+                [&, this](ice::UniquePtr<ice::AssetData>& out_data) noexcept
+                {
+                    out_data = ice::create_asset_data_entry(
+                        _allocator,
+                        data_binding.state,
+                        _allocator,
+                        data_binding.content,
+                        data_binding.metadata
+                    );
+                }
+            );
         }
         return result;
     }
@@ -403,6 +445,118 @@ namespace ice
         }
     }
 
+    auto DefaultAssetStorage::collect_dependencies(
+        ice::Span<ice::AssetPreloadRoot const> roots,
+        ice::Array<ice::Asset>& out_assets
+    ) noexcept -> ice::Task<>
+    {
+        IPT_ZONE_SCOPED;
+
+        ice::HashMap<ice::u32> visited{ _allocator };
+
+        auto const fn_visit = [&](ice::AssetCategory_Arg category, ice::String name) noexcept
+        {
+            ice::Asset asset = this->bind(category, name);
+            ice::u64 const asset_hash = ice::hash_from_ptr(asset._handle);
+            if (asset.valid() && ice::hashmap::has(visited, asset_hash) == false)
+            {
+                ice::hashmap::set(visited, asset_hash, ice::array::count(out_assets));
+                ice::array::push_back(out_assets, ice::move(asset));
+            }
+        };
+
+        for (ice::AssetPreloadRoot const& root : roots)
+        {
+            fn_visit(root.category, root.name);
+        }
+
+        ice::Array<ice::Task<>> tasks{ _allocator };
+        ice::Array<ice::Data> level_metadata{ _allocator };
+        ice::Array<ice::String> dependencies{ _allocator };
+
+        // Walk the graph level by level, metadata for all assets on a single level is accessed in parallel.
+        ice::u32 level_begin = 0;
+        while (level_begin < ice::array::count(out_assets))
+        {
+            ice::u32 const level_end = ice::array::count(out_assets);
+            ice::array::resize(level_metadata, level_end - level_begin);
+
+            for (ice::u32 idx = level_begin; idx < level_end; ++idx)
+            {
+                ice::array::push_back(tasks, detail::load_asset_metadata(out_assets[idx], level_metadata[idx - level_begin]));
+            }
+
+            co_await ice::await_tasks(tasks);
+            ice::array::clear(tasks);
+
+            for (ice::Data const metadata : level_metadata)
+            {
+                if (metadata.location == nullptr)
+                {
+                    continue;
+                }
+
+                ice::array::clear(dependencies);
+                ice::config::get_array(ice::config::from_data(metadata), Constant_ResourceMeta_Dependencies, dependencies);
+
+                for (ice::String const dependency : dependencies)
+                {
+                    ice::AssetCategory category{ };
+                    ice::String name;
+                    if (detail::find_dependency_category(*_asset_archive, dependency, category, name))
+                    {
+                        fn_visit(category, name);
+                    }
+                    else
+                    {
+                        ICE_LOG(LogSeverity::Warning, LogTag::Asset, "Unable to find asset category for dependency: {}", dependency);
+                    }
+                }
+            }
+
+            level_begin = level_end;
+        }
+    }
+
+    auto DefaultAssetStorage::preload(
+        ice::Span<ice::AssetPreloadRoot const> roots,
+        ice::AssetState state,
+        ice::Array<ice::Asset>& out_assets
+    ) noexcept -> ice::Task<>
+    {
+        IPT_ZONE_SCOPED;
+
+        ice::Array<ice::Asset> closure{ _allocator };
+        co_await collect_dependencies(roots, closure);
+
+        ice::Array<ice::Task<>> tasks{ _allocator };
+
+        // Request the whole closure at once, issuing reads in storage order avoids seeking back and forth in packs.
+        ice::sort(
+            ice::array::slice(closure),
+            [](ice::Asset const& left, ice::Asset const& right) noexcept
+            {
+                return detail::asset_storage_order(left) < detail::asset_storage_order(right);
+            }
+        );
+
+        for (ice::Asset const& asset : closure)
+        {
+            if (asset.available(state) == false)
+            {
+                ice::array::push_back(tasks, asset.preload(state));
+            }
+        }
+
+        co_await ice::await_tasks(tasks);
+
+        // Dropping the last reference releases the data, so the caller needs to hold the closure until it's used.
+        for (ice::Asset& asset : closure)
+        {
+            ice::array::push_back(out_assets, ice::move(asset));
+        }
+    }
+
     auto DefaultAssetStorage::request(
         ice::Asset const& asset,
         ice::AssetState requested_state
@@ -415,6 +569,8 @@ namespace ice
         ice::AssetStateTransaction transaction = asset.start_transaction(requested_state, trackers);
         ICE_ASSERT(asset.valid(), "Invalid asset object");
 
+        transaction.asset._last_access.store(_residency_tick.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
         ice::Expected<ice::Data, ice::ErrorCode> result{ };
         switch (transaction.target_state)
         {
@@ -538,6 +694,7 @@ namespace ice
                         transaction.shelve.asset_allocator(),
                         *transaction.shelve.compiler,
                         _info.resource_tracker,
+                        _compiler_params,
                         transaction
                     );
                     if (task_success == false)
@@ -620,6 +777,31 @@ namespace ice
         co_return;
     }
 
+    auto DefaultAssetStorage::update_residency() noexcept -> ice::Task<>
+    {
+        // Without budgets released data is dropped with the last reference, so there is nothing to evict or demote.
+        if (ice::array::empty(_residency_shelves))
+        {
+            co_return;
+        }
+
+        if (_residency_running.exchange(true, std::memory_order_acquire))
+        {
+            co_return;
+        }
+
+        ice::u32 const tick = _residency_tick.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        co_await _info.task_scheduler;
+
+        for (ice::AssetShelve* shelve : _residency_shelves)
+        {
+            shelve->update_residency(_allocator, tick);
+        }
+
+        _residency_running.store(false, std::memory_order_release);
+    }
+
     bool DefaultAssetStorage::find_shelve_and_entry(
         ice::AssetCategory_Arg category,
         ice::String name,
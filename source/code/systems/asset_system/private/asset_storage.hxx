@@ -58,6 +58,19 @@ namespace ice
             ice::AssetState state
         ) noexcept -> ice::Task<> override;
 
+        auto preload(
+            ice::Span<ice::AssetPreloadRoot const> roots,
+            ice::AssetState state,
+            ice::Array<ice::Asset>& out_assets
+        ) noexcept -> ice::Task<> override;
+
+        //! \brief Binds the given assets and every asset they (indirectly) depend on, without requesting any data.
+        //! \details Each asset is added once to 'out_assets', in the order it was reached when walking the graph.
+        auto collect_dependencies(
+            ice::Span<ice::AssetPreloadRoot const> roots,
+            ice::Array<ice::Asset>& out_assets
+        ) noexcept -> ice::Task<>;
+
         auto request(
             ice::Asset const& asset,
             ice::AssetState requested_state
@@ -88,6 +101,8 @@ namespace ice
             ice::Asset const& asset
         ) noexcept -> ice::Task<> override;
 
+        auto update_residency() noexcept -> ice::Task<> override;
+
         class DevUI;
 
     protected:
@@ -101,9 +116,16 @@ namespace ice
     private:
         ice::Allocator& _allocator;
         ice::AssetStorageCreateInfo _info;
+        ice::Array<ice::Shard> _compiler_params;
         ice::UniquePtr<ice::AssetCategoryArchive> _asset_archive;
         ice::HashMap<ice::AssetShelve*> _asset_shelves;
 
+        //! \brief Shelves with at least one memory budget, only these are visited during residency updates.
+        ice::Array<ice::AssetShelve*> _residency_shelves;
+
+        std::atomic<ice::u32> _residency_tick;
+        std::atomic_bool _residency_running;
+
         ice::UniquePtr<ice::DevUIWidget> _devui_widget;
     };
 
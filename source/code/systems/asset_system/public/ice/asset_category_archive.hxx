@@ -42,6 +42,11 @@ namespace ice
         void* ud_asset_state;
         void* ud_asset_loader;
         void* ud_asset_extension;
+
+        //! \brief Allows residency updates to drop 'Baked' or 'Loaded' data of referenced assets once a higher state exists.
+        //! \note Loaders of most categories keep pointers into the data they were loaded from, so this is disabled by default.
+        //!   Only enable it if loaded and runtime data of the category is self-contained and users only access the highest state.
+        bool allow_demotion = false;
     };
 
     class AssetCategoryArchive
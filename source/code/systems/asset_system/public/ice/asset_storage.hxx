@@ -4,7 +4,10 @@
 #pragma once
 #include <ice/asset.hxx>
 #include <ice/asset_category.hxx>
+#include <ice/container_types.hxx>
 #include <ice/mem_unique_ptr.hxx>
+#include <ice/shard.hxx>
+#include <ice/span.hxx>
 
 namespace ice
 {
@@ -16,6 +19,25 @@ namespace ice
         ice::AssetState state;
     };
 
+    //! \brief Memory budgets for asset data allocated in a single category, a zero value disables the limit.
+    //! \details Categories with a budget keep the data of released assets resident until the budget is exceeded,
+    //!   after which assets are evicted in least-recently-used order. Data of lower states (ex.: 'Baked') can
+    //!   also be dropped for referenced assets if a higher state is available and wasn't requested recently.
+    struct AssetCategoryBudget
+    {
+        ice::AssetCategory category;
+        ice::usize baked;
+        ice::usize loaded;
+        ice::usize runtime;
+    };
+
+    //! \brief Asset from which a dependency closure is preloaded.
+    struct AssetPreloadRoot
+    {
+        ice::AssetCategory category;
+        ice::String name;
+    };
+
     struct AssetStorageCreateInfo
     {
         //! \brief Resource tracker associated with this asset storage.
@@ -26,6 +48,13 @@ namespace ice
 
         //! \brief Flags used to push work on task threads.
         ice::TaskFlags task_flags;
+
+        //! \brief Memory budgets for selected categories, categories not listed here are not limited.
+        ice::Span<ice::AssetCategoryBudget const> budgets = { };
+
+        //! \brief Parameters passed to resource compilers when assets are baked at runtime.
+        //! \note The parameters are copied, however data referenced by them (ex.: strings) needs to outlive the storage.
+        ice::Span<ice::Shard const> compiler_params = { };
     };
 
     class AssetStorage
@@ -37,6 +66,8 @@ namespace ice
 
         virtual auto resources() noexcept -> ice::ResourceTracker& = 0;
 
+        //! \brief Binds the asset with the given name, creating a new entry if necessary.
+        //! \note Can be called from any thread, same as releasing the returned asset object.
         virtual auto bind(
             ice::AssetCategory_Arg category,
             ice::String name
@@ -54,6 +85,17 @@ namespace ice
             ice::AssetState state
         ) noexcept -> ice::Task<> = 0;
 
+        //! \brief Preloads the given assets together with every asset they (indirectly) depend on.
+        //! \details Dependencies are read from asset metadata ('asset.dependencies') as written by the resource compiler.
+        //!   Once the whole closure is known all assets are requested in parallel, ordered by their position in storage.
+        //!   The preloaded assets are appended to 'out_assets', their data is only kept resident while they are referenced.
+        //! \note Assets baked at runtime only expose their dependencies after reaching the 'Baked' state.
+        virtual auto preload(
+            ice::Span<ice::AssetPreloadRoot const> roots,
+            ice::AssetState state,
+            ice::Array<ice::Asset>& out_assets
+        ) noexcept -> ice::Task<> = 0;
+
         virtual auto request(
             ice::Asset const& entry,
             ice::AssetState requested_state
@@ -67,6 +109,11 @@ namespace ice
         virtual auto release(
             ice::Asset const& asset
         ) noexcept -> ice::Task<> = 0;
+
+        //! \brief Demotes and evicts asset data in categories exceeding their memory budgets.
+        //! \note The work is done on the storage task scheduler, a call made while the previous one is still
+        //!   running returns immediately. Should be called regularly, for example once every frame.
+        virtual auto update_residency() noexcept -> ice::Task<> = 0;
     };
 
     auto create_asset_storage(
@@ -0,0 +1,166 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/asset_storage.hxx>
+#include <ice/asset_category_archive.hxx>
+#include <ice/resource_compiler.hxx>
+#include <ice/resource_tracker.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/task_queue.hxx>
+#include <ice/task_scheduler.hxx>
+#include <ice/task_utils.hxx>
+
+#include "../private/asset_storage.hxx"
+
+namespace
+{
+
+    static constexpr ice::AssetCategory AssetCategory_TestMap = ice::make_asset_category("ice/test/map");
+    static constexpr ice::AssetCategory AssetCategory_TestImage = ice::make_asset_category("ice/test/image");
+
+    static ice::String const Constant_TestMapExtensions[]{ ".map" };
+    static ice::String const Constant_TestImageExtensions[]{ ".img" };
+
+    auto bind_test_asset(
+        ice::Allocator& alloc,
+        ice::AssetStorage& storage,
+        ice::AssetCategory_Arg category,
+        ice::String name,
+        ice::Span<ice::URI const> dependencies
+    ) noexcept -> ice::Asset
+    {
+        static ice::u32 const content = 42;
+
+        ice::Memory metadata{ };
+        if (ice::span::any(dependencies))
+        {
+            ice::ConfigBuilder meta{ alloc };
+            ice::resource_compiler_write_dependencies(meta, dependencies);
+            metadata = meta.finalize(alloc);
+        }
+
+        ice::Asset result = storage.bind_data(
+            category,
+            name,
+            ice::AssetDataBinding{
+                .content = ice::data_view(content),
+                .metadata = ice::data_view(metadata),
+                .state = ice::AssetState::Loaded
+            }
+        );
+
+        if (metadata.location != nullptr)
+        {
+            alloc.deallocate(metadata);
+        }
+        return result;
+    }
+
+    bool contains_asset(ice::Span<ice::Asset const> assets, ice::Asset const& asset) noexcept
+    {
+        for (ice::Asset const& entry : assets)
+        {
+            if (entry._handle == asset._handle)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+} // namespace
+
+SCENARIO("asset_system 'ice/asset_storage.hxx' (preload)", "[asset][preload]")
+{
+    ice::HostAllocator alloc{ };
+
+    ice::UniquePtr<ice::AssetCategoryArchive> archive = ice::create_asset_category_archive(alloc);
+    archive->register_category(AssetCategory_TestMap, { .resource_extensions = Constant_TestMapExtensions });
+    archive->register_category(AssetCategory_TestImage, { .resource_extensions = Constant_TestImageExtensions });
+
+    ice::UniquePtr<ice::ResourceTracker> tracker = ice::create_resource_tracker(
+        alloc, { .predicted_resource_count = 16, .io_dedicated_threads = 0 }
+    );
+
+    ice::TaskQueue queue{ };
+    ice::TaskScheduler scheduler{ queue };
+
+    ice::UniquePtr<ice::AssetStorage> storage = ice::create_asset_storage(
+        alloc,
+        ice::move(archive),
+        ice::AssetStorageCreateInfo{ .resource_tracker = *tracker, .task_scheduler = scheduler, .task_flags = { } }
+    );
+
+    GIVEN("assets with dependencies stored in their metadata")
+    {
+        ice::URI const world_dependencies[]{
+            ice::URI{ ice::Scheme_URN, "maps/level.map" },
+        };
+        ice::URI const level_dependencies[]{
+            ice::URI{ ice::Scheme_URN, "images/tiles.img" },
+            ice::URI{ ice::Scheme_URN, "maps/world.map" }, // Cycle back to the root
+        };
+
+        ice::Asset world = bind_test_asset(alloc, *storage, AssetCategory_TestMap, "maps/world", world_dependencies);
+        ice::Asset level = bind_test_asset(alloc, *storage, AssetCategory_TestMap, "maps/level", level_dependencies);
+        ice::Asset tiles = bind_test_asset(alloc, *storage, AssetCategory_TestImage, "images/tiles", {});
+        ice::Asset const unused = bind_test_asset(alloc, *storage, AssetCategory_TestImage, "images/unused", {});
+        REQUIRE(world.valid());
+        REQUIRE(level.valid());
+        REQUIRE(tiles.valid());
+        REQUIRE(unused.valid());
+
+        ice::AssetPreloadRoot const roots[]{ { AssetCategory_TestMap, "maps/world" } };
+
+        WHEN("collecting the dependencies of the root")
+        {
+            ice::Array<ice::Asset> assets{ alloc };
+            ice::wait_for(static_cast<ice::DefaultAssetStorage&>(*storage).collect_dependencies(roots, assets));
+
+            THEN("the whole graph is visited once")
+            {
+                REQUIRE(ice::array::count(assets) == 3);
+                CHECK(assets[0]._handle == world._handle);
+                CHECK(contains_asset(assets, level));
+                CHECK(contains_asset(assets, tiles));
+                CHECK(contains_asset(assets, unused) == false);
+            }
+        }
+
+        WHEN("preloading the root")
+        {
+            // All assets are already loaded, so no requests are issued.
+            ice::Array<ice::Asset> preloaded{ alloc };
+            ice::wait_for(storage->preload(roots, ice::AssetState::Loaded, preloaded));
+
+            THEN("the whole closure is returned to the caller")
+            {
+                REQUIRE(ice::array::count(preloaded) == 3);
+                CHECK(contains_asset(preloaded, world));
+                CHECK(contains_asset(preloaded, level));
+                CHECK(contains_asset(preloaded, tiles));
+            }
+
+            THEN("the data stays resident while the caller holds the closure")
+            {
+                ice::AssetHandle* const handles[]{ world._handle, level._handle, tiles._handle };
+                world.release();
+                level.release();
+                tiles.release();
+
+                for (ice::AssetHandle* handle : handles)
+                {
+                    CHECK(handle->data_for_state(ice::AssetState::Loaded).location != nullptr);
+                }
+
+                // Categories without a budget release the data with the last reference.
+                ice::array::clear(preloaded);
+                for (ice::AssetHandle* handle : handles)
+                {
+                    CHECK(handle->data_for_state(ice::AssetState::Loaded).location == nullptr);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,190 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/asset_storage.hxx>
+#include <ice/asset_category_archive.hxx>
+#include <ice/resource_tracker.hxx>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/task_queue.hxx>
+#include <ice/task_scheduler.hxx>
+#include <ice/task_utils.hxx>
+
+#include "../private/asset_entry.hxx"
+#include "../private/asset_data.hxx"
+
+namespace
+{
+
+    static constexpr ice::AssetCategory AssetCategory_TestBudget = ice::make_asset_category("ice/test/budget");
+    static constexpr ice::AssetCategory AssetCategory_TestUnlimited = ice::make_asset_category("ice/test/unlimited");
+
+    static ice::String const Constant_TestBudgetExtensions[]{ ".bud" };
+    static ice::String const Constant_TestUnlimitedExtensions[]{ ".unl" };
+
+    auto bind_test_asset(
+        ice::AssetStorage& storage,
+        ice::AssetCategory_Arg category,
+        ice::String name
+    ) noexcept -> ice::Asset
+    {
+        static ice::u32 const content = 42;
+
+        return storage.bind_data(
+            category,
+            name,
+            ice::AssetDataBinding{ .content = ice::data_view(content), .state = ice::AssetState::Loaded }
+        );
+    }
+
+    //! \brief Stacks 'Runtime' data on top of the asset, as if it was requested by the user.
+    void push_runtime_data(ice::Allocator& alloc, ice::Asset const& asset) noexcept
+    {
+        static ice::u64 const content = 42;
+
+        ice::AssetEntry* const entry = static_cast<ice::AssetEntry*>(asset._handle);
+        ice::UniquePtr<ice::AssetData> runtime = ice::create_asset_data_entry(
+            alloc, ice::AssetState::Runtime, alloc, ice::data_view(content), {}
+        );
+        runtime->_next = ice::move(entry->_data);
+        entry->_data = ice::move(runtime);
+    }
+
+    void update_residency(ice::AssetStorage& storage, ice::TaskQueue& queue, ice::u32 count = 1) noexcept
+    {
+        for (ice::u32 idx = 0; idx < count; ++idx)
+        {
+            ice::execute_task(storage.update_residency());
+            queue.process_all();
+        }
+    }
+
+} // namespace
+
+SCENARIO("asset_system 'ice/asset_storage.hxx' (residency)", "[asset][residency]")
+{
+    ice::HostAllocator alloc{ };
+
+    ice::UniquePtr<ice::AssetCategoryArchive> archive = ice::create_asset_category_archive(alloc);
+    archive->register_category(
+        AssetCategory_TestBudget,
+        { .resource_extensions = Constant_TestBudgetExtensions, .allow_demotion = true }
+    );
+    archive->register_category(AssetCategory_TestUnlimited, { .resource_extensions = Constant_TestUnlimitedExtensions });
+
+    ice::UniquePtr<ice::ResourceTracker> tracker = ice::create_resource_tracker(
+        alloc, { .predicted_resource_count = 16, .io_dedicated_threads = 0 }
+    );
+
+    ice::TaskQueue queue{ };
+    ice::TaskScheduler scheduler{ queue };
+
+    GIVEN("a storage without budgets")
+    {
+        ice::UniquePtr<ice::AssetStorage> storage = ice::create_asset_storage(
+            alloc,
+            ice::move(archive),
+            ice::AssetStorageCreateInfo{ .resource_tracker = *tracker, .task_scheduler = scheduler, .task_flags = { } }
+        );
+
+        ice::Asset asset = bind_test_asset(*storage, AssetCategory_TestUnlimited, "unlimited/asset");
+        ice::AssetHandle* const handle = asset._handle;
+        REQUIRE(asset.valid());
+
+        THEN("residency updates finish without scheduling work")
+        {
+            ice::execute_task(storage->update_residency());
+            CHECK(queue.empty());
+        }
+
+        THEN("data is released with the last reference")
+        {
+            asset.release();
+            CHECK(handle->data_for_state(ice::AssetState::Loaded).location == nullptr);
+        }
+    }
+
+    GIVEN("a storage with a 'Loaded' budget for two assets")
+    {
+        ice::AssetCategoryBudget const budgets[]{
+            { .category = AssetCategory_TestBudget, .loaded = ice::size_of<ice::u32> * 2 },
+        };
+
+        ice::UniquePtr<ice::AssetStorage> storage = ice::create_asset_storage(
+            alloc,
+            ice::move(archive),
+            ice::AssetStorageCreateInfo{
+                .resource_tracker = *tracker,
+                .task_scheduler = scheduler,
+                .task_flags = { },
+                .budgets = budgets
+            }
+        );
+
+        // Each asset is accessed during a different residency tick.
+        ice::Asset oldest = bind_test_asset(*storage, AssetCategory_TestBudget, "budget/oldest");
+        update_residency(*storage, queue);
+        ice::Asset older = bind_test_asset(*storage, AssetCategory_TestBudget, "budget/older");
+        update_residency(*storage, queue);
+        ice::Asset newest = bind_test_asset(*storage, AssetCategory_TestBudget, "budget/newest");
+
+        ice::AssetHandle* const handles[]{ oldest._handle, older._handle, newest._handle };
+
+        WHEN("all assets are released")
+        {
+            oldest.release();
+            older.release();
+            newest.release();
+
+            THEN("their data stays resident until the next update")
+            {
+                for (ice::AssetHandle* handle : handles)
+                {
+                    CHECK(handle->data_for_state(ice::AssetState::Loaded).location != nullptr);
+                }
+            }
+
+            THEN("the least recently used asset is evicted")
+            {
+                update_residency(*storage, queue);
+                CHECK(queue.empty());
+
+                CHECK(handles[0]->data_for_state(ice::AssetState::Loaded).location == nullptr);
+                CHECK(handles[1]->data_for_state(ice::AssetState::Loaded).location != nullptr);
+                CHECK(handles[2]->data_for_state(ice::AssetState::Loaded).location != nullptr);
+            }
+        }
+
+        WHEN("all assets are still referenced")
+        {
+            THEN("nothing is evicted")
+            {
+                update_residency(*storage, queue);
+
+                for (ice::AssetHandle* handle : handles)
+                {
+                    CHECK(handle->data_for_state(ice::AssetState::Loaded).location != nullptr);
+                }
+            }
+        }
+
+        WHEN("a referenced asset holds superseded 'Loaded' data")
+        {
+            push_runtime_data(alloc, oldest);
+
+            THEN("the 'Loaded' data is demoted after it was not accessed for a while")
+            {
+                update_residency(*storage, queue, 2);
+                CHECK(handles[0]->data_for_state(ice::AssetState::Loaded).location != nullptr);
+
+                update_residency(*storage, queue, 8);
+                CHECK(handles[0]->data_for_state(ice::AssetState::Loaded).location == nullptr);
+                CHECK(handles[0]->data_for_state(ice::AssetState::Runtime).location != nullptr);
+
+                // Data without a higher state is never demoted.
+                CHECK(handles[1]->data_for_state(ice::AssetState::Loaded).location != nullptr);
+                CHECK(handles[2]->data_for_state(ice::AssetState::Loaded).location != nullptr);
+            }
+        }
+    }
+}
@@ -0,0 +1,167 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <ice/font_layout_cache.hxx>
+#include <ice/font_utils.hxx>
+#include <ice/font.hxx>
+#include <ice/hash.hxx>
+
+namespace ice
+{
+
+    namespace detail
+    {
+
+        auto text_layout_key(ice::Font const* font, ice::String text, ice::u32 font_size) noexcept -> ice::u64
+        {
+            ice::u64 key = ice::hash(text);
+            key = ice::hash_combine(key, ice::hash_from_ptr(font));
+            key = ice::hash_combine(key, ice::hash(font_size));
+            return key;
+        }
+
+    } // namespace detail
+
+    TextLayoutCache::TextLayoutCache(
+        ice::Allocator& alloc,
+        ice::u32 max_unused_frames
+    ) noexcept
+        : _allocator{ alloc }
+        , _max_unused_frames{ max_unused_frames }
+        , _frame{ 0 }
+        , _lookup{ alloc }
+        , _entries{ alloc }
+        , _text{ alloc }
+        , _vertices{ alloc }
+    {
+    }
+
+    auto TextLayoutCache::layout(
+        ice::Font const& font,
+        ice::String text,
+        ice::u32 font_size
+    ) noexcept -> ice::TextLayout
+    {
+        ice::u64 const key = detail::text_layout_key(ice::addressof(font), text, font_size);
+
+        // The key is only a hash, so every candidate is verified against the actual text, font and size.
+        Entry* entry = nullptr;
+        auto it = ice::multi_hashmap::find_first(_lookup, key);
+        while (it != nullptr && entry == nullptr)
+        {
+            Entry& candidate = _entries[it.value()];
+            if (candidate.font == ice::addressof(font)
+                && candidate.font_size == font_size
+                && entry_text(candidate) == text)
+            {
+                entry = ice::addressof(candidate);
+            }
+            it = ice::multi_hashmap::find_next(_lookup, it);
+        }
+
+        if (entry == nullptr)
+        {
+            ice::u32 const text_offset = ice::array::count(_text);
+            ice::array::push_back(_text, ice::Span<char const>{ ice::string::begin(text), ice::string::size(text) });
+
+            // Reserve the upper bound (six vertices per byte) and shrink to the actual count afterwards.
+            ice::u32 const vertex_offset = ice::array::count(_vertices);
+            ice::array::resize(_vertices, vertex_offset + ice::string::size(text) * 6);
+
+            ice::vec2f bounds{ };
+            ice::u32 const vertex_count = ice::font_text_vertices(
+                font,
+                text,
+                ice::f32(font_size),
+                ice::array::slice(_vertices, vertex_offset),
+                bounds
+            );
+            ice::array::resize(_vertices, vertex_offset + vertex_count);
+
+            ice::multi_hashmap::insert(_lookup, key, ice::array::count(_entries));
+            ice::array::push_back(_entries, Entry{
+                .font = ice::addressof(font),
+                .font_size = font_size,
+                .text_offset = text_offset,
+                .text_size = ice::string::size(text),
+                .vertex_offset = vertex_offset,
+                .vertex_count = vertex_count,
+                .last_used_frame = _frame,
+                .bounds = bounds,
+            });
+            entry = ice::addressof(ice::array::back(_entries));
+        }
+
+        entry->last_used_frame = _frame;
+        return TextLayout{
+            .vertices = ice::array::slice(_vertices, entry->vertex_offset, entry->vertex_count),
+            .bounds = entry->bounds,
+        };
+    }
+
+    void TextLayoutCache::next_frame() noexcept
+    {
+        _frame += 1;
+
+        bool has_stale_entries = false;
+        for (Entry const& entry : _entries)
+        {
+            has_stale_entries |= (_frame - entry.last_used_frame) > _max_unused_frames;
+        }
+
+        if (has_stale_entries == false)
+        {
+            return;
+        }
+
+        // Compact the text and vertex storage, keeping only entries that are still in use.
+        ice::HashMap<ice::u32> lookup{ _allocator };
+        ice::Array<Entry> entries{ _allocator };
+        ice::Array<char> text{ _allocator };
+        ice::Array<ice::vec4f> vertices{ _allocator };
+        ice::array::reserve(entries, ice::array::count(_entries));
+        ice::array::reserve(text, ice::array::count(_text));
+        ice::array::reserve(vertices, ice::array::count(_vertices));
+
+        ice::Array<char> const& old_text = _text;
+        ice::Array<ice::vec4f> const& old_vertices = _vertices;
+
+        for (Entry entry : _entries)
+        {
+            if ((_frame - entry.last_used_frame) > _max_unused_frames)
+            {
+                continue;
+            }
+
+            ice::String const entry_str = entry_text(entry);
+            ice::u64 const key = detail::text_layout_key(entry.font, entry_str, entry.font_size);
+
+            ice::u32 const text_offset = ice::array::count(text);
+            ice::array::push_back(text, ice::array::slice(old_text, entry.text_offset, entry.text_size));
+            entry.text_offset = text_offset;
+
+            ice::u32 const vertex_offset = ice::array::count(vertices);
+            ice::array::push_back(vertices, ice::array::slice(old_vertices, entry.vertex_offset, entry.vertex_count));
+            entry.vertex_offset = vertex_offset;
+
+            ice::multi_hashmap::insert(lookup, key, ice::array::count(entries));
+            ice::array::push_back(entries, entry);
+        }
+
+        _lookup = ice::move(lookup);
+        _entries = ice::move(entries);
+        _text = ice::move(text);
+        _vertices = ice::move(vertices);
+    }
+
+    auto TextLayoutCache::count() const noexcept -> ice::ucount
+    {
+        return ice::array::count(_entries);
+    }
+
+    auto TextLayoutCache::entry_text(Entry const& entry) const noexcept -> ice::String
+    {
+        return ice::String{ ice::array::begin(_text) + entry.text_offset, entry.text_size };
+    }
+
+} // namespace ice
@@ -4,8 +4,10 @@
 #include <ice/font_utils.hxx>
 #include <ice/math/common.hxx>
 #include <ice/span.hxx>
+#include <ice/sort.hxx>
 #include <ice/font.hxx>
 #include <ice/log.hxx>
+#include <ice/assert_core.hxx>
 
 namespace ice
 {
@@ -66,8 +68,172 @@ namespace ice
             return 0;
         }
 
+        constexpr bool glyph_fits_table(ice::u32 codepoint, ice::u32 glyph_index) noexcept
+        {
+            return codepoint <= 0xffff && glyph_index < ice::Constant_FontGlyphIndex_None;
+        }
+
+        constexpr bool compare_glyph_index(ice::FontGlyphIndex const& left, ice::FontGlyphIndex const& right) noexcept
+        {
+            return left.codepoint < right.codepoint;
+        }
+
     } // namespace detail
 
+    auto font_find_glyph(
+        ice::Font const& font,
+        ice::u32 codepoint
+    ) noexcept -> ice::Glyph const*
+    {
+        if (codepoint < ice::count(font.glyph_table))
+        {
+            ice::u16 const glyph_index = font.glyph_table[codepoint];
+            if (glyph_index != ice::Constant_FontGlyphIndex_None)
+            {
+                return ice::addressof(font.glyphs[glyph_index]);
+            }
+        }
+
+        if (ice::span::any(font.glyph_table_sparse))
+        {
+            ice::ucount const idx = ice::lower_bound(
+                font.glyph_table_sparse, ice::FontGlyphIndex{ .codepoint = codepoint }, detail::compare_glyph_index
+            );
+            if (idx < ice::count(font.glyph_table_sparse) && font.glyph_table_sparse[idx].codepoint == codepoint)
+            {
+                return ice::addressof(font.glyphs[font.glyph_table_sparse[idx].glyph_index]);
+            }
+        }
+        else if (ice::span::empty(font.glyph_table))
+        {
+            // Fonts baked before glyph tables were introduced.
+            for (ice::Glyph const& glyph : font.glyphs)
+            {
+                if (glyph.codepoint == codepoint)
+                {
+                    return ice::addressof(glyph);
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    auto font_glyph_table_info(
+        ice::Span<ice::Glyph const> glyphs
+    ) noexcept -> ice::FontGlyphTableInfo
+    {
+        ice::FontGlyphTableInfo result{ };
+        for (ice::u32 idx = 0; idx < ice::count(glyphs); ++idx)
+        {
+            ice::u32 const codepoint = glyphs[idx].codepoint;
+            if (detail::glyph_fits_table(codepoint, idx))
+            {
+                result.table_size = ice::max(result.table_size, codepoint + 1);
+            }
+            else
+            {
+                result.sparse_count += 1;
+            }
+        }
+        return result;
+    }
+
+    void font_build_glyph_table(
+        ice::Span<ice::Glyph const> glyphs,
+        ice::Span<ice::u16> out_table,
+        ice::Span<ice::FontGlyphIndex> out_sparse_table
+    ) noexcept
+    {
+        for (ice::u16& entry : out_table)
+        {
+            entry = ice::Constant_FontGlyphIndex_None;
+        }
+
+        ice::u32 sparse_idx = 0;
+        for (ice::u32 idx = 0; idx < ice::count(glyphs); ++idx)
+        {
+            ice::u32 const codepoint = glyphs[idx].codepoint;
+            if (detail::glyph_fits_table(codepoint, idx))
+            {
+                ICE_ASSERT_CORE(codepoint < ice::count(out_table));
+
+                // Keep the first glyph for duplicated codepoints, same as a linear search would.
+                if (out_table[codepoint] == ice::Constant_FontGlyphIndex_None)
+                {
+                    out_table[codepoint] = ice::u16(idx);
+                }
+            }
+            else
+            {
+                ICE_ASSERT_CORE(sparse_idx < ice::count(out_sparse_table));
+                out_sparse_table[sparse_idx++] = { .codepoint = codepoint, .glyph_index = idx };
+            }
+        }
+
+        std::stable_sort(
+            ice::span::begin(out_sparse_table),
+            ice::span::end(out_sparse_table),
+            detail::compare_glyph_index
+        );
+    }
+
+    auto font_text_vertices(
+        ice::Font const& font,
+        ice::String text,
+        ice::f32 font_size,
+        ice::Span<ice::vec4f> out_vertices,
+        ice::vec2f& out_bounds
+    ) noexcept -> ice::u32
+    {
+        char const* it = ice::string::begin(text);
+        char const* const end = ice::string::end(text);
+
+        ice::vec2f position{ 0.f };
+        ice::vec2f bounds{ 0.f };
+        ice::f32 last_advance_offset = 0.f;
+        ice::u32 vertex_count = 0;
+
+        while (it < end)
+        {
+            ice::u32 consumed_bytes = 0;
+            ice::u32 const codepoint = detail::consume_next_character(it, consumed_bytes);
+            it += ice::max(consumed_bytes, 1u);
+
+            ice::Glyph const* const glyph = ice::font_find_glyph(font, codepoint);
+            if (glyph == nullptr)
+            {
+                continue;
+            }
+
+            if (glyph->size.x > 0)
+            {
+                ICE_ASSERT_CORE(vertex_count + 6 <= ice::count(out_vertices));
+
+                ice::vec2f const pos{ position.x + (glyph->offset.x * font_size), -(glyph->offset.y * font_size) };
+                ice::vec2f const size{ glyph->size.x * font_size, glyph->size.y * font_size };
+                ice::vec2f const uv0{ glyph->atlas_x, glyph->atlas_y };
+                ice::vec2f const uv1{ glyph->atlas_x + glyph->atlas_w, glyph->atlas_y + glyph->atlas_h };
+
+                ice::vec4f* const vertices = ice::span::data(out_vertices) + vertex_count;
+                vertices[0] = { pos.x, pos.y, uv0.x, uv0.y };
+                vertices[1] = { pos.x, pos.y + size.y, uv0.x, uv1.y };
+                vertices[2] = { pos.x + size.x, pos.y + size.y, uv1.x, uv1.y };
+                vertices[3] = { pos.x, pos.y, uv0.x, uv0.y };
+                vertices[4] = { pos.x + size.x, pos.y + size.y, uv1.x, uv1.y };
+                vertices[5] = { pos.x + size.x, pos.y, uv1.x, uv0.y };
+                vertex_count += 6;
+            }
+
+            position.x += glyph->advance * font_size;
+            bounds.y = ice::max(-glyph->size.y * font_size, bounds.y);
+            last_advance_offset = (glyph->advance - glyph->size.x) * font_size;
+        }
+
+        bounds.x = position.x - last_advance_offset;
+        out_bounds = bounds;
+        return vertex_count;
+    }
+
     auto font_text_bounds(
         ice::Font const& font,
         ice::String text,
@@ -86,16 +252,14 @@ namespace ice
             ice::u32 consumed_bytes;
             ice::u32 const codepoint = detail::consume_next_character(text_it, consumed_bytes);
 
-            for (ice::Glyph const& glyph : font.glyphs)
+            ice::Glyph const* const glyph = ice::font_find_glyph(font, codepoint);
+            if (glyph != nullptr)
             {
-                if (glyph.codepoint == codepoint)
-                {
-                    result.x += glyph.advance;
-                    result.y = ice::max(-glyph.size.y, result.y);
-                    last_advance_offset = glyph.advance - glyph.size.x;
+                result.x += glyph->advance;
+                result.y = ice::max(-glyph->size.y, result.y);
+                last_advance_offset = glyph->advance - glyph->size.x;
 
-                    out_glyph_count += 1;
-                }
+                out_glyph_count += 1;
             }
 
             text_it += consumed_bytes;
@@ -5,6 +5,7 @@
 #include <ice/span.hxx>
 #include <ice/math.hxx>
 #include <ice/asset_category.hxx>
+#include <ice/shard.hxx>
 
 namespace ice
 {
@@ -12,6 +13,14 @@ namespace ice
     static constexpr ice::AssetCategory AssetCategory_Font = ice::make_asset_category("ice/font");
     static constexpr ice::AssetCategory AssetCategory_FontAtlas = ice::make_asset_category("ice/font_atlas");
 
+    //! \brief Compiler parameter used to provide a scheduler ('ice::TaskScheduler*') on which font glyphs are generated in parallel.
+    //! \note If not provided, glyphs are generated using threads created by the generator.
+    static constexpr ice::ShardID ShardID_FontGlyphScheduler = "font:scheduler"_shardid;
+
+    //! \brief Compiler parameter used to provide a directory where generated glyph bitmaps are cached between runs.
+    //! \note If not provided, all glyphs are generated from scratch.
+    static constexpr ice::ShardID ShardID_FontGlyphCache = "font:glyph-cache"_shardid;
+
     struct Glyph
     {
         ice::u32 codepoint;
@@ -46,6 +55,16 @@ namespace ice
         ice::u32 glyph_count;
     };
 
+    //! \brief Value stored in the BMP glyph table for codepoints not available in the font.
+    static constexpr ice::u16 Constant_FontGlyphIndex_None = 0xffff;
+
+    //! \brief Maps a codepoint outside of the BMP glyph table to an index in 'Font::glyphs'.
+    struct FontGlyphIndex
+    {
+        ice::u32 codepoint;
+        ice::u32 glyph_index;
+    };
+
     struct FontAtlas
     {
         ice::vec2u image_size;
@@ -58,6 +77,14 @@ namespace ice
         ice::Span<ice::FontAtlas const> atlases;
         ice::Span<ice::GlyphRange const> ranges;
         ice::Span<ice::Glyph const> glyphs;
+
+        //! \brief Direct lookup table for codepoints in the range [0, count), stores indices into 'glyphs'.
+        //! \note The table only spans up to the highest BMP codepoint available in the font.
+        ice::Span<ice::u16 const> glyph_table;
+
+        //! \brief Remaining codepoints, sorted by codepoint value.
+        ice::Span<ice::FontGlyphIndex const> glyph_table_sparse;
+
         void const* data_ptr;
     };
 
@@ -0,0 +1,75 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/math.hxx>
+#include <ice/span.hxx>
+#include <ice/string/string.hxx>
+#include <ice/container/array.hxx>
+#include <ice/container/hashmap.hxx>
+
+namespace ice
+{
+
+    struct Font;
+
+    struct TextLayout
+    {
+        //! \brief Vertices as returned from 'ice::font_text_vertices', positions are relative to the text origin.
+        ice::Span<ice::vec4f const> vertices;
+        ice::vec2f bounds;
+    };
+
+    //! \brief Keeps vertex runs of recently drawn text, so unchanged strings are not laid out again every frame.
+    //! \details Layouts are keyed on the text hash, the font and font size. Each entry keeps a copy of its text, which is
+    //!   compared on every hit, so hash collisions never return the layout of a different string.
+    //!   Entries not requested for more than 'max_unused_frames' frames are evicted in 'next_frame'.
+    class TextLayoutCache
+    {
+    public:
+        TextLayoutCache(
+            ice::Allocator& alloc,
+            ice::u32 max_unused_frames = 4
+        ) noexcept;
+
+        //! \brief Returns the cached layout or builds a new one.
+        //! \note Returned vertices are valid until the next call to 'layout' or 'next_frame'.
+        auto layout(
+            ice::Font const& font,
+            ice::String text,
+            ice::u32 font_size
+        ) noexcept -> ice::TextLayout;
+
+        //! \brief Advances the frame counter and evicts layouts that were not used recently.
+        void next_frame() noexcept;
+
+        //! \returns Number of cached layouts.
+        auto count() const noexcept -> ice::ucount;
+
+    private:
+        struct Entry
+        {
+            ice::Font const* font;
+            ice::u32 font_size;
+            ice::u32 text_offset;
+            ice::u32 text_size;
+            ice::u32 vertex_offset;
+            ice::u32 vertex_count;
+            ice::u32 last_used_frame;
+            ice::vec2f bounds;
+        };
+
+        auto entry_text(Entry const& entry) const noexcept -> ice::String;
+
+        ice::Allocator& _allocator;
+        ice::u32 const _max_unused_frames;
+        ice::u32 _frame;
+
+        //! \brief Maps layout keys to indices in '_entries', colliding keys are stored as multiple values.
+        ice::HashMap<ice::u32> _lookup;
+        ice::Array<Entry> _entries;
+        ice::Array<char> _text;
+        ice::Array<ice::vec4f> _vertices;
+    };
+
+} // namespace ice
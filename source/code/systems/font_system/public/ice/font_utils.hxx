@@ -3,12 +3,55 @@
 
 #pragma once
 #include <ice/math.hxx>
+#include <ice/span.hxx>
 #include <ice/string/string.hxx>
 
 namespace ice
 {
 
     struct Font;
+    struct Glyph;
+    struct FontGlyphIndex;
+
+    struct FontGlyphTableInfo
+    {
+        //! \brief Number of entries in the direct lookup table.
+        ice::u32 table_size;
+
+        //! \brief Number of codepoints that need to be stored in the sparse table.
+        ice::u32 sparse_count;
+    };
+
+    //! \returns The glyph for the given codepoint or 'nullptr' if the font does not provide it.
+    //! \note Fonts without glyph tables fall back to a linear search.
+    auto font_find_glyph(
+        ice::Font const& font,
+        ice::u32 codepoint
+    ) noexcept -> ice::Glyph const*;
+
+    //! \brief Calculates the size of glyph tables required to index the given glyphs.
+    auto font_glyph_table_info(
+        ice::Span<ice::Glyph const> glyphs
+    ) noexcept -> ice::FontGlyphTableInfo;
+
+    //! \brief Fills glyph tables for the given glyphs, the spans need to be sized by 'font_glyph_table_info'.
+    void font_build_glyph_table(
+        ice::Span<ice::Glyph const> glyphs,
+        ice::Span<ice::u16> out_table,
+        ice::Span<ice::FontGlyphIndex> out_sparse_table
+    ) noexcept;
+
+    //! \brief Builds two triangles for each visible glyph in the text.
+    //! \details Each vertex stores the position (relative to the text origin) in 'xy' and atlas coordinates in 'zw'.
+    //! \param out_vertices Needs to hold at least six vertices for each codepoint in the text.
+    //! \returns Number of vertices written.
+    auto font_text_vertices(
+        ice::Font const& font,
+        ice::String text,
+        ice::f32 font_size,
+        ice::Span<ice::vec4f> out_vertices,
+        ice::vec2f& out_bounds
+    ) noexcept -> ice::u32;
 
     auto font_text_bounds(
         ice::Font const& font,
@@ -0,0 +1,148 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/font.hxx>
+#include <ice/font_utils.hxx>
+#include <ice/font_layout_cache.hxx>
+#include <ice/container/array.hxx>
+#include <ice/mem_allocator_host.hxx>
+
+namespace
+{
+
+    auto test_glyph(ice::u32 codepoint) noexcept -> ice::Glyph
+    {
+        return ice::Glyph{
+            .codepoint = codepoint,
+            .offset = { 0.f, 0.f },
+            .size = { 0.5f, -1.f },
+            .advance = 0.75f,
+            .atlas_x = ice::f32(codepoint % 16) / 16.f,
+            .atlas_y = ice::f32(codepoint / 16 % 16) / 16.f,
+            .atlas_w = 1.f / 16.f,
+            .atlas_h = 1.f / 16.f,
+        };
+    }
+
+} // namespace
+
+SCENARIO("font_system 'ice/font_utils.hxx'", "[font][glyph_table]")
+{
+    ice::HostAllocator alloc{ };
+
+    // ASCII letters, a CJK character and an emoji from outside of the BMP.
+    ice::Array<ice::Glyph> glyphs{ alloc };
+    for (ice::u32 codepoint = 'A'; codepoint <= 'z'; ++codepoint)
+    {
+        ice::array::push_back(glyphs, test_glyph(codepoint));
+    }
+    ice::array::push_back(glyphs, test_glyph(0x6F22)); // '漢'
+    ice::array::push_back(glyphs, test_glyph(0x1F600)); // '😀'
+
+    ice::FontGlyphTableInfo const info = ice::font_glyph_table_info(glyphs);
+    CHECK(info.table_size == 0x6F23);
+    CHECK(info.sparse_count == 1);
+
+    ice::Array<ice::u16> table{ alloc };
+    ice::Array<ice::FontGlyphIndex> sparse_table{ alloc };
+    ice::array::resize(table, info.table_size);
+    ice::array::resize(sparse_table, info.sparse_count);
+    ice::font_build_glyph_table(glyphs, table, sparse_table);
+
+    ice::Font const font{
+        .glyphs = glyphs,
+        .glyph_table = table,
+        .glyph_table_sparse = sparse_table,
+    };
+
+    GIVEN("a font with glyph tables")
+    {
+        THEN("all glyphs can be found")
+        {
+            for (ice::Glyph const& glyph : glyphs)
+            {
+                ice::Glyph const* const found = ice::font_find_glyph(font, glyph.codepoint);
+                REQUIRE(found != nullptr);
+                CHECK(found->codepoint == glyph.codepoint);
+            }
+        }
+
+        THEN("missing codepoints are not found")
+        {
+            CHECK(ice::font_find_glyph(font, ' ') == nullptr);
+            CHECK(ice::font_find_glyph(font, 0x6F21) == nullptr);
+            CHECK(ice::font_find_glyph(font, 0xFFFF) == nullptr);
+            CHECK(ice::font_find_glyph(font, 0x1F601) == nullptr);
+        }
+
+        THEN("results match a font without glyph tables")
+        {
+            ice::Font const font_linear{ .glyphs = glyphs };
+            for (ice::u32 codepoint = 0; codepoint < 0x7000; ++codepoint)
+            {
+                CHECK(ice::font_find_glyph(font, codepoint) == ice::font_find_glyph(font_linear, codepoint));
+            }
+        }
+    }
+
+    GIVEN("a text layout cache")
+    {
+        ice::TextLayoutCache cache{ alloc, 2 };
+
+        ice::TextLayout const first = cache.layout(font, "Hello", 16);
+        CHECK(ice::count(first.vertices) == 5 * 6);
+        CHECK(first.bounds.x > 0.f);
+
+        WHEN("the same text is requested again")
+        {
+            ice::TextLayout const second = cache.layout(font, "Hello", 16);
+
+            THEN("the cached vertex run is returned")
+            {
+                CHECK(cache.count() == 1);
+                CHECK(ice::span::data(second.vertices) == ice::span::data(first.vertices));
+            }
+        }
+
+        WHEN("a different font size is requested")
+        {
+            ice::TextLayout const second = cache.layout(font, "Hello", 32);
+
+            THEN("a new layout is created")
+            {
+                CHECK(cache.count() == 2);
+                CHECK(second.bounds.x > first.bounds.x);
+            }
+        }
+
+        WHEN("a text buffer is reused for a different string")
+        {
+            char buffer[]{ "Hello" };
+            cache.layout(font, ice::String{ buffer }, 16);
+            buffer[0] = 'J';
+            ice::TextLayout const second = cache.layout(font, ice::String{ buffer }, 16);
+
+            THEN("the cached text is compared and a new layout is created")
+            {
+                CHECK(cache.count() == 2);
+                CHECK(ice::span::data(second.vertices) != ice::span::data(first.vertices));
+            }
+        }
+
+        WHEN("the text is not used for a few frames")
+        {
+            cache.next_frame();
+            ice::TextLayout const kept = cache.layout(font, "World", 16);
+            cache.next_frame();
+            cache.next_frame();
+
+            THEN("it's evicted while recently used text is kept")
+            {
+                CHECK(cache.count() == 1);
+                CHECK(ice::count(cache.layout(font, "World", 16).vertices) == ice::count(kept.vertices));
+                CHECK(cache.count() == 1);
+            }
+        }
+    }
+}
@@ -2,41 +2,80 @@
 /// SPDX-License-Identifier: MIT
 
 #include <ice/input_action.hxx>
+#include <ice/input_action_layer.hxx>
 
 #include <ice/module.hxx>
 #include <ice/module_register.hxx>
 #include <ice/resource_compiler_api.hxx>
 #include <ice/asset_module.hxx>
 #include <ice/asset_category_archive.hxx>
+#include <ice/resource_tracker.hxx>
+#include <ice/container/array.hxx>
 #include <ice/log_module.hxx>
 
 namespace ice
 {
 
+    //! \brief Parses an input action script and bakes all defined layers into their compiled binary form.
+    auto ias_compile_source(
+        ice::ResourceCompilerCtx& ctx,
+        ice::ResourceHandle const& resource_handle,
+        ice::ResourceTracker& resource_tracker,
+        ice::Span<ice::ResourceHandle const> sources,
+        ice::Span<ice::URI const> dependencies,
+        ice::Allocator& result_alloc
+    ) noexcept -> ice::Task<ice::ResourceCompilerResult>
+    {
+        ice::ResourceResult const res = co_await resource_tracker.load_resource(resource_handle);
+        if (res.resource_status != ice::ResourceStatus::Loaded)
+        {
+            co_return { };
+        }
+
+        ice::Array<ice::UniquePtr<ice::InputActionLayer>> const layers = ice::parse_input_action_layer(
+            result_alloc, ice::string::from_data(res.data)
+        );
+        if (ice::array::empty(layers))
+        {
+            co_return { };
+        }
+
+        ice::Expected<ice::Memory> const baked_layers = ice::save_input_action_layers(result_alloc, layers);
+        if (baked_layers.succeeded() == false)
+        {
+            co_return { };
+        }
+        co_return ice::ResourceCompilerResult{ .result = baked_layers.value() };
+    }
+
+    auto ias_compiler_supported_resources(
+        ice::Span<ice::Shard const> params
+    ) noexcept -> ice::Span<ice::String const>
+    {
+        static ice::String ext[]{ ".ias" };
+        return ext;
+    }
+
     void asset_category_shader_definition(
         ice::AssetCategoryArchive& asset_category_archive,
         ice::ModuleQuery const& module_query
     ) noexcept
     {
-        static ice::String ext[]{ ".ias" };
+        // The archive only adopts compilers reporting at least one of the category extensions.
+        static ice::ResourceCompiler const compiler{
+            .fn_supported_resources = ias_compiler_supported_resources,
+            .fn_compile_source = ias_compile_source,
+        };
         static ice::AssetCategoryDefinition const definition{
-            .resource_extensions = ext
+            .resource_extensions = ias_compiler_supported_resources({})
         };
-        asset_category_archive.register_category(ice::AssetCategory_InputActionsScript, definition);
+        asset_category_archive.register_category(ice::AssetCategory_InputActionsScript, definition, &compiler);
     }
 
     struct InputActionsModule : public ice::Module<InputActionsModule>
     {
 
 #if 0
-        auto ias_compiler_supported_resources(
-            ice::Span<ice::Shard const> params
-        ) noexcept -> ice::Span<ice::String const>
-        {
-            static ice::String ext[]{ ".ias" };
-            return ext;
-        }
-
         static void v1_compiler_api(ice::api::resource_compiler::v1::ResourceCompilerAPI& api) noexcept
         {
             api.id_category = "ice/ias-script-resource"_sid;
@@ -38,6 +38,13 @@ namespace ice
         layer.load_constants(_constants);
     }
 
+    auto InputActionExecutor::constant(
+        ice::InputActionConstant constant
+    ) const noexcept -> ice::f32
+    {
+        return constant_at(constant, _constants);
+    }
+
     bool InputActionExecutor::execute_condition(
         ice::InputActionCondition condition,
         ice::InputActionSource const& val,
@@ -137,9 +144,9 @@ namespace ice
         switch(modifier)
         {
             using enum InputActionModifier;
-        case Add: action_value += param;
-        case Sub: action_value -= param;
-        case Mul: action_value *= param;
+        case Add: action_value += param; break;
+        case Sub: action_value -= param; break;
+        case Mul: action_value *= param; break;
         case Div:
             ICE_ASSERT_CORE(param != 0.0f);
             action_value /= param;
@@ -8,20 +8,24 @@
 namespace ice
 {
 
+    //! \brief Version of the binary layer format, bumped every time the header or the program encoding changes.
+    static constexpr ice::u16 Constant_InputActionLayerBinaryVersion = 4;
+
     //! \brief Header-like structure for binarized version of an InputActionLayer.
-    //! \note This structure will be used for storing input actions in binary format for release builds.
+    //! \note This structure is used for storing input actions in binary format for release builds.
     struct InputActionLayerInfoHeader
     {
+        ice::u16 version;
         ice::u8 size_name;
         ice::u8 count_constants;
         ice::u16 count_sources;
         ice::u16 count_actions;
-        ice::u16 count_conditions;
-        ice::u16 count_steps;
-        ice::u16 count_modifiers;
+        ice::u32 count_instructions;
         ice::u32 offset_strings;
     };
 
+    static_assert(sizeof(InputActionLayerInfoHeader) == 16);
+
     struct InputActionIndex
     {
         static constexpr ice::u16 SelfIndex = 8191;
@@ -32,25 +36,78 @@ namespace ice
 
     static_assert(sizeof(ice::InputActionIndex) == sizeof(ice::u16));
 
-    struct InputActionConditionData
+    //! \brief Operations of a compiled input action program.
+    //! \details Each action is lowered by the layer builder into a linear sequence of instructions. Conditions,
+    //!   steps and modifiers are fused with their parameters, so the runtime only needs a single switch to execute them.
+    //!   Axis conditions are lowered to simple comparisons if the layer defines the 'axis.deadzone' constant. Otherwise the
+    //!   deadzone is inherited from layers above it on the stack and read from the executor when the program runs.
+    enum class InputActionOpCode : ice::u8
     {
-        ice::InputActionIndex source;
-        ice::InputActionCondition id;
-        ice::InputActionConditionFlags flags;
-        ice::ref16 steps;
-        ice::f32 param;
-    };
+        Invalid = 0,
+
+        // Source conditions, the result is 'false' if the source was not updated this frame.
+        SourceActive,
+        SourcePressed,
+        SourceReleased,
+        SourceTrigger,
+        //! \brief Compares against the deadzone constant of the executor, only emitted if the layer does not define it.
+        SourceAxis,
+        //! \copydoc SourceAxis
+        SourceAxisDeadzone,
+        SourceGreater,
+        SourceGreaterOrEqual,
+        SourceLower,
+        SourceLowerOrEqual,
+        SourceEqual,
+        SourceNotEqual,
+
+        // Action conditions, the source index references an action in the same layer or 'SelfIndex'.
+        ActionEnabled,
+        ActionToggleActive,
+        ActionToggleInactive,
+        AlwaysTrue,
+
+        // Steps, only executed if the preceding condition enabled them.
+        StepActivate,
+        StepDeactivate,
+        StepToggle,
+        StepReset,
+        StepTime,
+        StepSet,
+        StepAdd,
+        StepSub,
 
-    static_assert(sizeof(InputActionConditionData) % 4 == 0);
+        //! \brief Finishes a condition series, for 'Final' series skips all remaining conditions if successful.
+        SeriesFinish,
 
-    struct InputActionStepData
+        //! \brief Applies action behavior and publishes the raw value, stops the program if the action is not active.
+        ActionEnd,
+
+        // Modifiers, applied on the published action value.
+        ModifierAdd,
+        ModifierSub,
+        ModifierMul,
+        ModifierDiv,
+        ModifierMaxOf,
+        ModifierMinOf,
+    };
+
+    //! \brief Single instruction of a compiled input action program.
+    struct InputActionInstruction
     {
+        ice::InputActionOpCode op;
+
+        //! \brief Condition flags for conditions and series, destination axis for steps and modifiers.
+        ice::u8 flags;
+
+        //! \brief Source (or action) the instruction reads from.
         ice::InputActionIndex source;
-        ice::InputActionStep id;
-        ice::u8 dst_axis;
+
+        //! \brief User parameter, with any layer constants already resolved.
+        ice::f32 param;
     };
 
-    static_assert(sizeof(InputActionStepData) % 4 == 0);
+    static_assert(sizeof(InputActionInstruction) == 8);
 
     struct InputActionModifierData
     {
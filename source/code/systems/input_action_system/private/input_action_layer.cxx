@@ -26,9 +26,7 @@ namespace ice
         ice::String name;
         ice::Span<ice::InputActionSourceInputInfo const> sources;
         ice::Span<ice::InputActionInfo const> actions;
-        ice::Span<ice::InputActionConditionData const> conditions;
-        ice::Span<ice::InputActionStepData const> steps;
-        ice::Span<ice::InputActionModifierData const> modifiers;
+        ice::Span<ice::InputActionInstruction const> program;
         ice::Span<ice::InputActionConstantInfo const> constants;
         ice::Span<ice::f32 const> constant_values;
         ice::String strings;
@@ -48,19 +46,42 @@ namespace ice
             return E_NullPointerData;
         }
 
+        if (data.size < ice::size_of<ice::InputActionLayerInfoHeader>)
+        {
+            return E_InvalidArgument;
+        }
+
         ice::InputActionLayerInfoHeader const& header = *reinterpret_cast<ice::InputActionLayerInfoHeader const*>(data.location);
+        if (header.version != Constant_InputActionLayerBinaryVersion || data.size.value < header.offset_strings)
+        {
+            // Data was baked with an older version of the layer builder and needs to be compiled again.
+            return E_InvalidArgument;
+        }
+
         ice::usize offset = ice::size_of<ice::InputActionLayerInfoHeader>;
 
         ice::InputActionLayerInfo result{};
         offset += load_field_from_data(result.sources, data, offset, header.count_sources);
         offset += load_field_from_data(result.actions, data, offset, header.count_actions);
-        offset += load_field_from_data(result.conditions, data, offset, header.count_conditions);
-        offset += load_field_from_data(result.steps, data, offset, header.count_steps);
-        offset += load_field_from_data(result.modifiers, data, offset, header.count_modifiers);
+        offset += load_field_from_data(result.program, data, offset, header.count_instructions);
         offset += load_field_from_data(result.constant_values, data, offset, header.count_constants);
         offset += load_field_from_data(result.constants, data, offset, header.count_constants);
 
-        ICE_ASSERT_CORE(offset == ice::usize{ header.offset_strings });
+        // A corrupted header could point any field outside of the data, so we validate instead of asserting.
+        if (offset != ice::usize{ header.offset_strings })
+        {
+            return E_InvalidArgument;
+        }
+
+        for (ice::InputActionInfo const& action : result.actions)
+        {
+            if (action.program.offset + action.program.size > header.count_instructions
+                || action.program_conditions_end >= action.program.size)
+            {
+                return E_InvalidArgument;
+            }
+        }
+
         result.strings = ice::string::from_data(
             data,
             ice::usize{ header.offset_strings },
@@ -83,9 +104,7 @@ namespace ice
             , _name{ info.name }
             , _sources{ info.sources }
             , _actions{ info.actions }
-            , _conditions{ info.conditions }
-            , _steps{ info.steps }
-            , _modifiers{ info.modifiers }
+            , _program{ info.program }
             , _constants{ info.constants }
             , _constant_values{ info.constant_values }
             , _strings{ info.strings }
@@ -121,6 +140,11 @@ namespace ice
             return ice::string::substr(_strings, action.name);
         }
 
+        auto binary_data() const noexcept -> ice::Data override
+        {
+            return ice::data_view(_rawdata);
+        }
+
         auto load_constants(ice::Span<ice::f32> constants_span) const noexcept -> ice::ucount override
         {
             ICE_ASSERT_CORE(ice::count(constants_span) >= Constant_CountInputActionConstants);
@@ -249,173 +273,251 @@ namespace ice
         ) const noexcept override
         {
             IPT_ZONE_SCOPED;
-            using enum ice::InputActionConditionFlags;
 
             for (ice::InputActionInfo const& action : _actions)
             {
                 ice::String const action_name = ice::string::substr(_strings, action.name);
 
                 ice::InputActionRuntime* const runtime = ice::hashmap::try_get(actions, ice::hash(action_name));
-                // TODO: Check if we need this
-                //if (action.behavior != InputActionBehavior::Accumulated)
-                {
-                    runtime->raw_value = {};
-                }
+                ICE_ASSERT_CORE(runtime != nullptr);
+
+                execute_program(executor, source_values, actions, action, *runtime);
+            }
+            return false;
+        }
 
-                bool series_success = false;
-                ice::Span const conditions = ice::span::subspan(_conditions, action.conditions);
-                for (ice::InputActionConditionData const& cond : conditions)
+    private:
+        auto action_runtime(
+            ice::HashMap<ice::InputActionRuntime>& actions,
+            ice::InputActionRuntime& self,
+            ice::InputActionIndex index
+        ) const noexcept -> ice::InputActionRuntime const&
+        {
+            if (index.source_index == InputActionIndex::SelfIndex)
+            {
+                return self;
+            }
+
+            ice::String const action_name = ice::string::substr(_strings, _actions[index.source_index].name);
+            ice::InputActionRuntime const* const runtime = ice::hashmap::try_get(actions, ice::hash(action_name));
+            ICE_ASSERT_CORE(runtime != nullptr);
+            return *runtime;
+        }
+
+        void execute_program(
+            ice::InputActionExecutor const& executor,
+            ice::Span<ice::InputActionSource* const> source_values,
+            ice::HashMap<ice::InputActionRuntime>& actions,
+            ice::InputActionInfo const& action,
+            ice::InputActionRuntime& runtime
+        ) const noexcept
+        {
+            using enum InputActionOpCode;
+            static constexpr ice::u8 Flag_SeriesAnd = ice::u8(InputActionConditionFlags::SeriesAnd);
+            static constexpr ice::u8 Flag_SeriesCheck = ice::u8(InputActionConditionFlags::SeriesCheck);
+            static constexpr ice::u8 Flag_RunSteps = ice::u8(InputActionConditionFlags::RunSteps);
+            static constexpr ice::u8 Flag_Final = ice::u8(InputActionConditionFlags::Final);
+
+            // TODO: Check if we need this
+            //if (action.behavior != InputActionBehavior::Accumulated)
+            {
+                runtime.raw_value = {};
+            }
+
+            ice::InputActionInstruction const* const program = ice::span::data(_program) + action.program.offset;
+            ice::InputActionInstruction const* it = program;
+            ice::InputActionInstruction const* const end = program + action.program.size;
+
+            bool series_success = false;
+            bool run_steps = false;
+            while (it != end)
+            {
+                ice::InputActionInstruction const& instr = *it++;
+
+                bool cond_result = false;
+                switch (instr.op)
+                {
+                // Source conditions, only evaluated if the source was updated.
+                case SourceActive:
+                case SourcePressed:
+                case SourceReleased:
+                case SourceTrigger:
+                case SourceAxis:
+                case SourceAxisDeadzone:
+                case SourceGreater:
+                case SourceGreaterOrEqual:
+                case SourceLower:
+                case SourceLowerOrEqual:
+                case SourceEqual:
+                case SourceNotEqual:
                 {
-                    bool cond_result = false;
-                    if (cond.id >= ice::InputActionCondition::ActionEnabled)
+                    ICE_ASSERT_CORE(source_values[instr.source.source_index] != nullptr);
+                    ice::InputActionSource const& value = source_values[instr.source.source_index][0];
+                    if (value.event != InputActionSourceEvent::None)
                     {
-                        ice::InputActionRuntime const* checked_action = runtime; // Seft (by-default)
-                        if (cond.source.source_index != InputActionIndex::SelfIndex)
+                        switch (instr.op)
                         {
-                            ice::InputActionInfo const checked_action_info = _actions[cond.source.source_index];
-                            ice::String const checked_action_name = ice::string::substr(_strings, checked_action_info.name);
-                            checked_action = ice::hashmap::try_get(actions, ice::hash(checked_action_name));
+                        case SourceActive: cond_result = true; break;
+                        case SourcePressed: cond_result = value.event == InputActionSourceEvent::KeyPress; break;
+                        case SourceReleased: cond_result = value.event == InputActionSourceEvent::KeyRelease; break;
+                        case SourceTrigger: cond_result = value.event == InputActionSourceEvent::Trigger; break;
+                        case SourceAxis: cond_result = value.value >= executor.constant(InputActionConstant::ControllerAxisDeadzone); break;
+                        case SourceAxisDeadzone: cond_result = value.value < executor.constant(InputActionConstant::ControllerAxisDeadzone); break;
+                        case SourceGreater: cond_result = value.value > instr.param; break;
+                        case SourceGreaterOrEqual: cond_result = value.value >= instr.param; break;
+                        case SourceLower: cond_result = value.value < instr.param; break;
+                        case SourceLowerOrEqual: cond_result = value.value <= instr.param; break;
+                        case SourceEqual: cond_result = value.value == instr.param; break;
+                        case SourceNotEqual: cond_result = value.value != instr.param; break;
+                        default: break;
                         }
-                        ICE_ASSERT_CORE(checked_action != nullptr);
-                        cond_result = executor.execute_condition(
-                            cond.id,
-                            *checked_action,
-                            cond.param
-                        );
                     }
-                    else
+                    break;
+                }
+                // Action conditions
+                case ActionEnabled:
+                    cond_result = action_runtime(actions, runtime, instr.source).enabled;
+                    break;
+                case ActionToggleActive:
+                    cond_result = action_runtime(actions, runtime, instr.source).toggle_enabled;
+                    break;
+                case ActionToggleInactive:
+                    cond_result = action_runtime(actions, runtime, instr.source).toggle_enabled == false;
+                    break;
+                case AlwaysTrue:
+                    cond_result = true;
+                    break;
+                // Steps
+                case StepActivate:
+                    if (run_steps)
                     {
-                        ICE_ASSERT_CORE(source_values[cond.source.source_index] != nullptr);
-                        ice::InputActionSource& value = source_values[cond.source.source_index][0];
-
-                        if (value.event != InputActionSourceEvent::None)
+                        runtime.state = runtime.state * 2 + 1;
+                        runtime.active = true;
+                    }
+                    continue;
+                case StepDeactivate:
+                    if (run_steps)
+                    {
+                        runtime.state = 0;
+                        runtime.active = false;
+                        runtime.toggle_enabled = false;
+                    }
+                    continue;
+                case StepToggle:
+                    if (run_steps)
+                    {
+                        runtime.state = runtime.state * 2 + 1;
+                        if (runtime.state == 1)
                         {
-                            cond_result = executor.execute_condition(cond.id, value, cond.param);
+                            runtime.toggle_enabled = !runtime.toggle_enabled;
                         }
                     }
-
-                    // Can't check for 'SeriesOr' since it's just a zero value
-                    if (ice::has_all(cond.flags, InputActionConditionFlags::SeriesAnd))
+                    continue;
+                case StepReset:
+                    if (run_steps)
                     {
-                        series_success &= cond_result;
+                        runtime.value = ice::vec2f{};
+                        runtime.raw_value = ice::vec3f{};
                     }
-                    else
+                    continue;
+                case StepTime:
+                    if (run_steps)
                     {
-                        series_success |= cond_result;
+                        runtime.raw_value.x = (float) Ts(ice::clock::elapsed(runtime.timestamp, ice::clock::now())).value;
                     }
+                    continue;
+                case StepSet:
+                case StepAdd:
+                case StepSub:
+                    if (run_steps)
+                    {
+                        ICE_ASSERT_CORE(source_values[instr.source.source_index] != nullptr);
+                        ice::f32 const src = source_values[instr.source.source_index][instr.source.source_axis].value;
+                        ice::f32& dst = runtime.raw_value.v[0][instr.flags];
 
-                    bool const check_success = ice::has_all(cond.flags, SeriesCheck)
-                        ? series_success
-                        : cond_result;
-
-                    if (ice::has_all(cond.flags, RunSteps) && check_success)
+                        if (instr.op == StepSet) dst = src;
+                        else if (instr.op == StepAdd) dst += src;
+                        else dst -= src;
+                    }
+                    continue;
+                // Series
+                case SeriesFinish:
+                    // If the series is not successful, just continue
+                    if (series_success == false || runtime.enabled == false)
+                    {
+                        // If the action finaly fails, we reset the state so we can again start counting from 0
+                        runtime.state = 0;
+                        runtime.active = false;
+                    }
+                    else
                     {
-                        ice::Span const steps = ice::span::subspan(_steps, cond.steps);
-                        for (ice::InputActionStepData const& step : steps)
+                        series_success = false;
+
+                        // Stop checking futher conditions, we are in the final condition
+                        if ((instr.flags & Flag_Final) == Flag_Final)
                         {
-                            if (step.id < InputActionStep::Set)
-                            {
-                                executor.execute_step(step.id, *runtime);
-                            }
-                            else
-                            {
-                                ICE_ASSERT_CORE(source_values[step.source.source_index] != nullptr);
-                                ice::InputActionSource& value = source_values[step.source.source_index][step.source.source_axis];
-
-                                executor.execute_step(step.id, value, runtime->raw_value.v[0][step.dst_axis]);
-                            }
+                            it = program + action.program_conditions_end;
                         }
                     }
-
-                    // If this is not 'series finish', continue
-                    if (ice::has_none(cond.flags, SeriesFinish))
+                    continue;
+                // Finish action and apply modifiers
+                case ActionEnd:
+                    // Handles 'Toggle'. We only activate of the first press, which is `state == 1`.
+                    if (action.behavior == InputActionBehavior::Toggled)
                     {
-                        continue;
+                        runtime.active |= runtime.toggle_enabled;
                     }
-
-                    // // If the condition should activate/deactivate implicitly
-                    // // TODO: Move before the final check to allow activating on regular checks?
-                    // if (ice::has_all(cond.flags, Activate) && runtime->enabled)
-                    // {
-                    //     // This small operation allows use to implement 'Once' logic.
-                    //     // Initial state == 1, unless deactivated from now on we will always be above 1
-                    //     //   since we purposefully loosing bits due to overflow but always set the MSB again.
-                    //     runtime->state = runtime->state * 2 + 1;
-                    //     runtime->active = check_success;
-                    // }
-                    // else if (ice::has_all(cond.flags, Deactivate))
-                    // {
-                    //     runtime->state = 0;
-                    //     runtime->active = false;
-                    // }
-
-                    // If the series is not successful, just continue
-                    if (series_success == false || runtime->enabled == false)
+                    // Handles 'Once'. Once state is bigger than `1` we always deactivate the action.
+                    else if (action.behavior == InputActionBehavior::ActiveOnce && runtime.state > 1)
                     {
-                        // If the action finaly fails, we reset the state so we can again start counting from 0
-                        runtime->state = 0;
-                        runtime->active = false;
-                        continue;
+                        runtime.active = false;
                     }
 
-                    series_success = false;
-
-                    // continue, if it's not a final condition
-                    if (ice::has_none(cond.flags, Final))
+                    if (runtime.active == false)
                     {
-                        continue;
+                        runtime.was_active = false;
+                        return;
                     }
 
-                    // Stop checking futher conditions, we are in the final  condition
-                    break;
-                }
-            }
-
-            for (ice::InputActionInfo const& action : _actions)
-            {
-                ice::String const action_name = ice::string::substr(_strings, action.name);
-                ice::InputActionRuntime* const runtime = ice::hashmap::try_get(actions, ice::hash(action_name));
+                    if (runtime.was_active == false)
+                    {
+                        runtime.was_active = true;
+                        runtime.timestamp = ice::clock::now();
+                    }
 
-                // Handles 'Toggle'. We only activate of the first press, which is `state == 1`.
-                if (action.behavior == InputActionBehavior::Toggled)
-                {
-                    runtime->active |= runtime->toggle_enabled;
-                    //if (runtime->state == 1)
-                    //{
-                    //    runtime->toggle_enabled = !runtime->toggle_enabled;
-                    //}
-                    //else
-                    //{
-                    //}
-                }
-                // Handles 'Once'. Once state is bigger than `1` we always deactivate the action.
-                else if (action.behavior == InputActionBehavior::ActiveOnce && runtime->state > 1)
-                {
-                    runtime->active = false;
+                    // Update the final value, modifiers are applied by the following instructions.
+                    runtime.value = { runtime.raw_value.x, runtime.raw_value.y };
+                    continue;
+                case ModifierAdd: runtime.value.v[0][instr.flags] += instr.param; continue;
+                case ModifierSub: runtime.value.v[0][instr.flags] -= instr.param; continue;
+                case ModifierMul: runtime.value.v[0][instr.flags] *= instr.param; continue;
+                case ModifierDiv:
+                    ICE_ASSERT_CORE(instr.param != 0.0f);
+                    runtime.value.v[0][instr.flags] /= instr.param;
+                    continue;
+                case ModifierMaxOf: runtime.value.v[0][instr.flags] = ice::max(runtime.value.v[0][instr.flags], instr.param); continue;
+                case ModifierMinOf: runtime.value.v[0][instr.flags] = ice::min(runtime.value.v[0][instr.flags], instr.param); continue;
+                default:
+                    ICE_ASSERT_CORE(false);
+                    continue;
                 }
 
-                if (runtime->active == false)
+                // Only conditions reach this point, update the series state.
+                if ((instr.flags & Flag_SeriesAnd) == Flag_SeriesAnd)
                 {
-                    runtime->was_active = false;
-                    continue;
+                    series_success &= cond_result;
                 }
-
-                if (runtime->was_active == false)
+                else
                 {
-                    runtime->was_active = true;
-                    runtime->timestamp = ice::clock::now();
+                    series_success |= cond_result;
                 }
 
-                // Update the final value and run modifiers over it.
-                runtime->value = { runtime->raw_value.x, runtime->raw_value.y };
+                bool const check_success = (instr.flags & Flag_SeriesCheck) == Flag_SeriesCheck
+                    ? series_success
+                    : cond_result;
 
-                ice::Span const mods = ice::span::subspan(_modifiers, action.mods);
-                for (ice::InputActionModifierData const& mod : mods)
-                {
-                    executor.execute_modifier(mod.id, runtime->value.v[0][mod.axis], mod.param);
-                }
+                run_steps = (instr.flags & Flag_RunSteps) == Flag_RunSteps && check_success;
             }
-            return false;
         }
 
     private:
@@ -425,9 +527,7 @@ namespace ice
         ice::String _name;
         ice::Span<ice::InputActionSourceInputInfo const> _sources;
         ice::Span<ice::InputActionInfo const> _actions;
-        ice::Span<ice::InputActionConditionData const> _conditions;
-        ice::Span<ice::InputActionStepData const> _steps;
-        ice::Span<ice::InputActionModifierData const> _modifiers;
+        ice::Span<ice::InputActionInstruction const> _program;
         ice::Span<ice::InputActionConstantInfo const> _constants;
         ice::Span<ice::f32 const> _constant_values;
         ice::String _strings;
@@ -495,7 +595,95 @@ namespace ice
         ice::InputActionLayer const& action_layer
     ) noexcept -> ice::Expected<ice::Memory>
     {
-        return {};
+        ice::Data const layer_data = action_layer.binary_data();
+        if (layer_data.location == nullptr)
+        {
+            return E_NullPointerData;
+        }
+
+        ice::Memory result = alloc.allocate({ layer_data.size, layer_data.alignment });
+        ice::memcpy(result, layer_data);
+        return result;
+    }
+
+    auto save_input_action_layers(
+        ice::Allocator& alloc,
+        ice::Span<ice::UniquePtr<ice::InputActionLayer> const> action_layers
+    ) noexcept -> ice::Expected<ice::Memory>
+    {
+        // Layout: [u32 count] followed by [u32 size, layer data] entries, each field starting at an 8 byte boundary.
+        ice::meminfo minfo{ ice::size_of<ice::u32>, ice::ualign::b_8 };
+        for (ice::UniquePtr<ice::InputActionLayer> const& layer : action_layers)
+        {
+            minfo += ice::meminfo{ ice::size_of<ice::u32>, ice::ualign::b_8 };
+            minfo += ice::meminfo{ layer->binary_data().size, ice::ualign::b_8 };
+        }
+
+        ice::Memory const result = alloc.allocate(minfo);
+        ice::memset(result, 0);
+        *reinterpret_cast<ice::u32*>(result.location) = ice::count(action_layers);
+
+        ice::usize offset = ice::size_of<ice::u32>;
+        for (ice::UniquePtr<ice::InputActionLayer> const& layer : action_layers)
+        {
+            ice::Data const layer_data = layer->binary_data();
+
+            offset = ice::align_to(offset, ice::ualign::b_8).value;
+            *reinterpret_cast<ice::u32*>(ice::ptr_add(result.location, offset)) = ice::u32(layer_data.size.value);
+
+            offset = ice::align_to(offset + ice::size_of<ice::u32>, ice::ualign::b_8).value;
+            ice::memcpy(ice::ptr_add(result.location, offset), layer_data.location, layer_data.size);
+            offset += layer_data.size;
+        }
+        return result;
+    }
+
+    auto load_input_action_layers(
+        ice::Allocator& alloc,
+        ice::Data layers_data
+    ) noexcept -> ice::Array<UniquePtr<ice::InputActionLayer>>
+    {
+        ice::Array<UniquePtr<ice::InputActionLayer>> result{ alloc };
+        if (layers_data.location == nullptr || layers_data.size < ice::size_of<ice::u32>)
+        {
+            return result;
+        }
+
+        ice::u32 const count = *reinterpret_cast<ice::u32 const*>(layers_data.location);
+        ice::array::reserve(result, count);
+
+        ice::usize offset = ice::size_of<ice::u32>;
+        for (ice::u32 idx = 0; idx < count; ++idx)
+        {
+            offset = ice::align_to(offset, ice::ualign::b_8).value;
+            if (offset + ice::size_of<ice::u32> > layers_data.size)
+            {
+                ice::array::clear(result);
+                break;
+            }
+
+            ice::usize const size{ *reinterpret_cast<ice::u32 const*>(ice::ptr_add(layers_data.location, offset)) };
+            offset = ice::align_to(offset + ice::size_of<ice::u32>, ice::ualign::b_8).value;
+            if (offset + size > layers_data.size)
+            {
+                ice::array::clear(result);
+                break;
+            }
+
+            // The layer creates it's own copy of the data, so the baked blob can be released afterwards.
+            ice::UniquePtr<ice::InputActionLayer> layer = ice::create_input_action_layer(
+                alloc, ice::Data{ .location = ice::ptr_add(layers_data.location, offset), .size = size, .alignment = ice::ualign::b_8 }
+            );
+            if (layer == nullptr)
+            {
+                ice::array::clear(result);
+                break;
+            }
+
+            ice::array::push_back(result, ice::move(layer));
+            offset += size;
+        }
+        return result;
     }
 
 } // namespace ice
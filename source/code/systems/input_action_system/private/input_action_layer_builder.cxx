@@ -7,6 +7,7 @@
 #include <ice/container/hashmap.hxx>
 #include <ice/string/heap_string.hxx>
 #include <ice/sort.hxx>
+#include <ice/log.hxx>
 
 namespace ice
 {
@@ -28,6 +29,64 @@ namespace ice
             return { ice::string::substr(source, 0, source_size), read_from };
         }
 
+        auto lower_condition(ice::InputActionCondition condition, bool has_axis_deadzone) noexcept -> ice::InputActionOpCode
+        {
+            switch (condition)
+            {
+                using enum InputActionCondition;
+            case Active: return InputActionOpCode::SourceActive;
+            case Pressed: return InputActionOpCode::SourcePressed;
+            case Released: return InputActionOpCode::SourceReleased;
+            case Trigger: return InputActionOpCode::SourceTrigger;
+                // With a known deadzone, axis checks are simple comparisons.
+            case Axis: return has_axis_deadzone ? InputActionOpCode::SourceGreaterOrEqual : InputActionOpCode::SourceAxis;
+            case AxisDeadzone: return has_axis_deadzone ? InputActionOpCode::SourceLower : InputActionOpCode::SourceAxisDeadzone;
+            case Greater: return InputActionOpCode::SourceGreater;
+            case GreaterOrEqual: return InputActionOpCode::SourceGreaterOrEqual;
+            case Lower: return InputActionOpCode::SourceLower;
+            case LowerOrEqual: return InputActionOpCode::SourceLowerOrEqual;
+            case Equal: return InputActionOpCode::SourceEqual;
+            case NotEqual: return InputActionOpCode::SourceNotEqual;
+            case ActionEnabled: return InputActionOpCode::ActionEnabled;
+            case ActionToggleActive: return InputActionOpCode::ActionToggleActive;
+            case ActionToggleInactive: return InputActionOpCode::ActionToggleInactive;
+            case AlwaysTrue: return InputActionOpCode::AlwaysTrue;
+            default: ICE_ASSERT_CORE(false); return InputActionOpCode::Invalid;
+            }
+        }
+
+        auto lower_step(ice::InputActionStep step) noexcept -> ice::InputActionOpCode
+        {
+            switch (step)
+            {
+                using enum InputActionStep;
+            case Activate: return InputActionOpCode::StepActivate;
+            case Deactivate: return InputActionOpCode::StepDeactivate;
+            case Toggle: return InputActionOpCode::StepToggle;
+            case Reset: return InputActionOpCode::StepReset;
+            case Time: return InputActionOpCode::StepTime;
+            case Set: return InputActionOpCode::StepSet;
+            case Add: return InputActionOpCode::StepAdd;
+            case Sub: return InputActionOpCode::StepSub;
+            default: ICE_ASSERT_CORE(false); return InputActionOpCode::Invalid;
+            }
+        }
+
+        auto lower_modifier(ice::InputActionModifier modifier) noexcept -> ice::InputActionOpCode
+        {
+            switch (modifier)
+            {
+                using enum InputActionModifier;
+            case Add: return InputActionOpCode::ModifierAdd;
+            case Sub: return InputActionOpCode::ModifierSub;
+            case Mul: return InputActionOpCode::ModifierMul;
+            case Div: return InputActionOpCode::ModifierDiv;
+            case MaxOf: return InputActionOpCode::ModifierMaxOf;
+            case MinOf: return InputActionOpCode::ModifierMinOf;
+            default: ICE_ASSERT_CORE(false); return InputActionOpCode::Invalid;
+            }
+        }
+
     } // namespace detail
 
     class SimpleInputActionLayerBuilder;
@@ -260,18 +319,42 @@ namespace ice
 
             ice::HeapString<> strings{ _allocator };
             ice::Array<ice::InputActionSourceInputInfo> final_sources{ _allocator };
-            ice::Array<ice::InputActionStepData> final_steps{ _allocator };
-            ice::Array<ice::InputActionConditionData> final_conditions{ _allocator };
-            ice::Array<ice::InputActionModifierData> final_modifiers{ _allocator };
+            ice::Array<ice::InputActionInstruction> final_program{ _allocator };
             ice::Array<ice::InputActionInfo> final_actions{ _allocator };
 
             // Insert layer name as the first string
             ice::string::push_back(strings, _name);
             ice::string::push_back(strings, '\0');
 
+            // All offsets and counts are narrowed to 16 (or 8) bits in the binary format, so we check them before narrowing.
+            //  Source values and actions are also referenced by the 13 bit 'InputActionIndex', which reserves the last value.
+            auto const fits_format = [this](ice::ucount value, ice::ucount max_value, char const* what) noexcept -> bool
+            {
+                ICE_LOG_IF(
+                    value > max_value,
+                    LogSeverity::Error, LogTag::Engine,
+                    "Input action layer '{}' exceeds the limit of {} {}.",
+                    _name, max_value, what
+                );
+                return value <= max_value;
+            };
+
+            if (fits_format(ice::size(_name), ice::u8_max, "name characters") == false
+                || fits_format(ice::count(_constants), ice::u8_max, "constants") == false)
+            {
+                return {};
+            }
+
             // Prepare data of all sources
             for (Internal<InputActionBuilder::Source> const& source : _sources)
             {
+                if (fits_format(ice::size(strings) + ice::size(source.name), ice::u16_max, "string bytes") == false
+                    || fits_format(count_storage_values + 2u, InputActionIndex::SelfIndex, "source values") == false
+                    || fits_format(ice::count(final_sources) + ice::hashmap::count(source.events) + 1, ice::u16_max, "source inputs") == false)
+                {
+                    return {};
+                }
+
                 if (ice::hashmap::empty(source.events))
                 {
                     ice::array::push_back(final_sources,
@@ -359,101 +442,142 @@ namespace ice
                 action.finalize();
             }
 
-            // Prepare data of all actions
-            ice::u16 step_offset = 0, step_count = 0;
-            ice::u16 condition_offset = 0, condition_count = 0;
-            ice::u8 modifier_offset = 0, modifier_count = 0;
+            // Constants defined by this layer are resolved directly into instruction parameters.
+            //  Undefined constants are inherited from layers above on the stack, so they are read from the executor at runtime.
+            bool has_axis_deadzone = false;
+            ice::f32 axis_deadzone = 0.0f;
+            for (auto [constant, value] : _constants)
+            {
+                if (constant == InputActionConstant::ControllerAxisDeadzone)
+                {
+                    has_axis_deadzone = true;
+                    axis_deadzone = value;
+                }
+            }
 
+            // Lower all actions into linear programs.
             for (Internal<InputActionBuilder::Action> const& action : _actions)
             {
+                ICE_ASSERT_CORE(action.type != InputActionDataType::Invalid);
+                ice::ucount const program_offset = ice::count(final_program);
+
+                // Series finishing with 'Final' need to know where condition checks end, so we patch them afterwards.
                 for (Internal<InputActionBuilder::ConditionSeries> const& series : action.cond_series)
                 {
                     for (ActionBuilderCondition const& condition : series.conditions)
                     {
+                        ice::InputActionInstruction instruction{
+                            .op = detail::lower_condition(condition.condition, has_axis_deadzone),
+                            .flags = ice::u8(condition.flags),
+                            .source = { .source_index = 0, .source_axis = 0 },
+                            .param = condition.param
+                        };
+
+                        if (condition.from_action || condition.condition >= InputActionCondition::ActionEnabled)
+                        {
+                            // If we are empty, it's a "self reference"
+                            if (ice::string::any(condition.source))
+                            {
+                                instruction.source.source_index = find_action_storage_index(condition.source);
+                                instruction.source.source_axis = condition.axis;
+                            }
+                            else
+                            {
+                                instruction.source.source_index = InputActionIndex::SelfIndex;
+                            }
+                        }
+                        else
+                        {
+                            instruction.source.source_index = find_source_storage_index(condition.source);
+                            instruction.source.source_axis = condition.axis;
+
+                            bool const is_axis_check = condition.condition == InputActionCondition::Axis
+                                || condition.condition == InputActionCondition::AxisDeadzone;
+                            if (is_axis_check && has_axis_deadzone)
+                            {
+                                instruction.param = axis_deadzone;
+                            }
+                        }
+                        ice::array::push_back(final_program, instruction);
+
                         for (ActionBuilderStep const& step : condition.steps)
                         {
                             if (step.step < InputActionStep::Set)
                             {
-                                ice::array::push_back(final_steps,
-                                    InputActionStepData{
+                                ice::array::push_back(final_program,
+                                    InputActionInstruction{
+                                        .op = detail::lower_step(step.step),
+                                        .flags = 0,
                                         .source = { 0, 0 },
-                                        .id = step.step,
-                                        .dst_axis = 0
+                                        .param = 0.0f
                                     }
                                 );
                             }
                             else
                             {
-                                ice::array::push_back(final_steps,
-                                    InputActionStepData{
+                                ice::array::push_back(final_program,
+                                    InputActionInstruction{
+                                        .op = detail::lower_step(step.step),
+                                        .flags = step.axis.y,
                                         .source = {
                                             .source_index = find_source_storage_index(step.source),
                                             .source_axis = step.axis.x
                                         },
-                                        .id = step.step,
-                                        .dst_axis = step.axis.y
+                                        .param = 0.0f
                                     }
                                 );
                             }
-
-                            step_count += 1;
                         }
 
-                        ICE_ASSERT_CORE(action.type != InputActionDataType::Invalid);
-                        ice::InputActionIndex source_index = { .source_index = 0,.source_axis = 0 };
-                        if (condition.from_action)
+                        if (ice::has_all(condition.flags, InputActionConditionFlags::SeriesFinish))
                         {
-                            // If we are empty, it's a "self reference"
-                            if (ice::string::any(condition.source))
-                            {
-                                source_index.source_index = find_action_storage_index(condition.source);
-                                source_index.source_axis = condition.axis;
-                            }
-                            else
-                            {
-                                source_index.source_index = InputActionIndex::SelfIndex;
-                            }
-                        }
-                        else /*if (condition.condition != InputActionCondition::AlwaysTrue
-                            && condition.condition != InputActionCondition::ActionActive
-                            && condition.condition != InputActionCondition::ActionInactive)*/
-                        {
-                            source_index.source_index = find_source_storage_index(condition.source);
-                            source_index.source_axis = condition.axis;
+                            ice::array::push_back(final_program,
+                                InputActionInstruction{
+                                    .op = InputActionOpCode::SeriesFinish,
+                                    .flags = ice::u8(condition.flags),
+                                    .source = { 0, 0 },
+                                    .param = 0.0f
+                                }
+                            );
                         }
-
-                        ice::array::push_back(final_conditions,
-                            InputActionConditionData{
-                                .source = source_index,
-                                .id = condition.condition,
-                                .flags = condition.flags,
-                                .steps = { step_offset, step_count },
-                                .param = condition.param
-                            }
-                        );
-
-                        step_offset += ice::exchange(step_count, ice::u16_0);
-                        condition_count += 1;
                     }
                 } // for (ConditionSeries& series : ...)
 
-                modifier_count = ice::u8(ice::count(action.modifiers));
-                ice::array::push_back(final_modifiers, action.modifiers);
+                ice::ucount const program_conditions_end = ice::count(final_program) - program_offset;
+                ice::array::push_back(final_program,
+                    InputActionInstruction{ .op = InputActionOpCode::ActionEnd, .flags = 0, .source = { 0, 0 }, .param = 0.0f }
+                );
+
+                for (ice::ActionBuilderModifier const& modifier : action.modifiers)
+                {
+                    ice::array::push_back(final_program,
+                        InputActionInstruction{
+                            .op = detail::lower_modifier(modifier.id),
+                            .flags = modifier.axis,
+                            .source = { 0, 0 },
+                            .param = modifier.param
+                        }
+                    );
+                }
+
+                if (fits_format(ice::count(final_program), ice::u16_max, "instructions") == false
+                    || fits_format(ice::size(strings) + ice::size(action.name), ice::u16_max, "string bytes") == false
+                    || fits_format(ice::count(final_actions) + 1, InputActionIndex::SelfIndex, "actions") == false)
+                {
+                    return {};
+                }
 
                 ice::array::push_back(final_actions,
                     InputActionInfo{
                         .name = { ice::u16(ice::size(strings)), ice::u16(ice::size(action.name)) },
                         .type = action.type,
                         .behavior = action.behavior,
-                        .conditions = { condition_offset, condition_count },
-                        .mods = { modifier_offset, modifier_count }
+                        .program = { ice::u16(program_offset), ice::u16(ice::count(final_program) - program_offset) },
+                        .program_conditions_end = ice::u16(program_conditions_end)
                     }
                 );
 
                 ice::string::push_back(strings, action.name);
-
-                modifier_offset += modifier_count;
-                condition_offset += ice::exchange(condition_count, ice::u16_0);
             }
 
             ice::Array<ice::f32> final_constant_values{ alloc };
@@ -466,13 +590,12 @@ namespace ice
             }
 
             ice::InputActionLayerInfoHeader final_info{
+                .version = Constant_InputActionLayerBinaryVersion,
                 .size_name = ice::u8(ice::size(_name)),
                 .count_constants = ice::u8(ice::count(final_constants)),
                 .count_sources = ice::u16(ice::count(final_sources)),
                 .count_actions = ice::u16(ice::count(final_actions)),
-                .count_conditions = ice::u16(ice::count(final_conditions)),
-                .count_steps = ice::u16(ice::count(final_steps)),
-                .count_modifiers = ice::u16(ice::count(final_modifiers)),
+                .count_instructions = ice::count(final_program),
                 .offset_strings = 0,
             };
 
@@ -480,9 +603,7 @@ namespace ice
             ice::meminfo minfo_layer = ice::meminfo_of<ice::InputActionLayerInfoHeader>;
             ice::usize const offset_sources = minfo_layer += ice::array::meminfo(final_sources);
             ice::usize const offset_actions = minfo_layer += ice::array::meminfo(final_actions);
-            ice::usize const offset_conditions = minfo_layer += ice::array::meminfo(final_conditions);
-            ice::usize const offset_steps = minfo_layer += ice::array::meminfo(final_steps);
-            ice::usize const offset_modifiers = minfo_layer += ice::array::meminfo(final_modifiers);
+            ice::usize const offset_program = minfo_layer += ice::array::meminfo(final_program);
             ice::usize const offset_constant_values = minfo_layer += ice::meminfo_of<ice::f32> * ice::count(final_constant_values);
             ice::usize const offset_constants = minfo_layer += ice::array::meminfo(final_constants);
             ice::usize const offset_strings = minfo_layer += ice::string::meminfo(ice::String{strings});
@@ -492,9 +613,7 @@ namespace ice
             ice::memcpy(final_memory, ice::data_view(final_info));
             ice::memcpy(ice::ptr_add(final_memory, offset_sources), ice::array::data_view(final_sources));
             ice::memcpy(ice::ptr_add(final_memory, offset_actions), ice::array::data_view(final_actions));
-            ice::memcpy(ice::ptr_add(final_memory, offset_conditions), ice::array::data_view(final_conditions));
-            ice::memcpy(ice::ptr_add(final_memory, offset_steps), ice::array::data_view(final_steps));
-            ice::memcpy(ice::ptr_add(final_memory, offset_modifiers), ice::array::data_view(final_modifiers));
+            ice::memcpy(ice::ptr_add(final_memory, offset_program), ice::array::data_view(final_program));
             ice::memcpy(ice::ptr_add(final_memory, offset_constant_values), ice::array::data_view(final_constant_values));
             ice::memcpy(ice::ptr_add(final_memory, offset_constants), ice::array::data_view(final_constants));
             ice::memcpy(ice::ptr_add(final_memory, offset_strings), ice::string::data_view(strings));
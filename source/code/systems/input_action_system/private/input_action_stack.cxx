@@ -29,7 +29,9 @@ namespace ice
             , _layers{ _allocator }
             , _layers_active{ _allocator }
             , _layers_sources_indices{ _allocator }
+            , _layers_sources{ _allocator }
             , _sources_runtime_values{ _allocator }
+            , _events{ _allocator }
             , _sources{ _allocator }
             , _actions{ _allocator }
             , _action_names{ _allocator }
@@ -106,6 +108,9 @@ namespace ice
         struct ActiveStackLayer
         {
             ice::u32 index;
+
+            //! \brief Executor holding constants of this layer and the ones inherited from layers above it.
+            ice::InputActionExecutor executor;
         };
 
         struct StackSourceIdx
@@ -119,6 +124,14 @@ namespace ice
             return slayer.layer == layer;
         }
 
+        //! \brief Resolves source indices of all registered layers into pointers to runtime values.
+        //! \note Needs to be called every time the runtime values array might have been reallocated.
+        void update_layers_sources() noexcept;
+
+        //! \brief Resolves constants of all active layers, starting from the top of the stack.
+        //! \note Needs to be called every time the active layers change.
+        void update_active_constants() noexcept;
+
     private:
         ice::Allocator& _allocator;
         ice::HeapString<> _idprefix;
@@ -126,8 +139,12 @@ namespace ice
         ice::Array<StackLayer> _layers;
         ice::Array<ActiveStackLayer> _layers_active;
         ice::Array<ice::u32> _layers_sources_indices;
+        ice::Array<ice::InputActionSource*> _layers_sources;
         ice::Array<ice::InputActionSource> _sources_runtime_values;
 
+        //! \brief Scratch buffer for incoming events, reused between frames so processing does not allocate.
+        ice::Array<ice::input::InputEvent> _events;
+
         ice::HashMap<StackSourceIdx> _sources;
         ice::HashMap<InputActionRuntime> _actions;
         ice::HashMap<HeapString<>> _action_names;
@@ -250,9 +267,40 @@ namespace ice
             _layers,
             StackLayer{ layer, { ice::u16(layer_sources_offset), ice::u16(ice::count(_layers_sources_indices) - layer_sources_offset) } }
         );
+
+        // Runtime values could have been reallocated, so we need to resolve all source pointers again.
+        update_layers_sources();
         return S_Ok;
     }
 
+    void SimpleInputActionStack::update_layers_sources() noexcept
+    {
+        ice::array::resize(_layers_sources, ice::count(_layers_sources_indices));
+
+        ice::u32 idx = 0;
+        for (ice::u32 offset : _layers_sources_indices)
+        {
+            _layers_sources[idx] = ice::addressof(_sources_runtime_values[offset]);
+            idx += 1;
+        }
+    }
+
+    void SimpleInputActionStack::update_active_constants() noexcept
+    {
+        // Layers inherit constants from layers above them, so we go from the top of the stack and carry over the values.
+        ice::InputActionExecutor executor{};
+
+        ice::ucount active_idx = ice::count(_layers_active);
+        while (active_idx > 0)
+        {
+            active_idx -= 1;
+
+            ActiveStackLayer& active_layer = _layers_active[active_idx];
+            executor.prepare_constants(*_layers[active_layer.index].layer);
+            active_layer.executor = executor;
+        }
+    }
+
     auto SimpleInputActionStack::active_layers(
         ice::Array<ice::InputActionLayer const*>& out_layers
     ) const noexcept -> ice::ucount
@@ -287,6 +335,7 @@ namespace ice
 
         // Push back the new active layer.
         ice::array::push_back(_layers_active, { idx });
+        update_active_constants();
     }
 
     void SimpleInputActionStack::pop_layer(
@@ -296,9 +345,19 @@ namespace ice
         ice::ucount idx;
         if (ice::search(ice::Span{ _layers }, layer, compare_layers, idx))
         {
-            // We just cut anything below this index, because we want to pop everything up to this layer
-            ice::array::resize(_layers, idx);
-            ice::array::pop_back(_layers); // And pop the item itself
+            // Find the top-most occurrence of the layer on the active stack.
+            ice::ucount active_idx = ice::count(_layers_active);
+            while (active_idx > 0 && _layers_active[active_idx - 1].index != idx)
+            {
+                active_idx -= 1;
+            }
+
+            // We just cut anything above this index, because we want to pop everything up to this layer, including the item itself.
+            if (active_idx > 0)
+            {
+                ice::array::resize(_layers_active, active_idx - 1);
+                update_active_constants();
+            }
         }
     }
 
@@ -404,51 +463,34 @@ namespace ice
         IPT_ZONE_SCOPED;
         using Iterator = ice::Array<ActiveStackLayer>::ConstReverseIterator;
 
-        ice::ucount remaining_events = ice::count(events);
-        ice::Array<ice::input::InputEvent> events_copy{ _allocator, events };
-        ice::Array<ice::InputActionSource*> source_values{ _allocator };
+        // Reuse the scratch buffer, after the first few frames this never allocates.
+        ice::array::clear(_events);
+        ice::array::push_back(_events, events);
+
+        ice::ucount remaining_events = ice::count(_events);
 
         // We go in reverse order since, the recently pushed layers should be processed first as they might override inputs.
         Iterator const start = ice::array::rbegin(_layers_active);
         Iterator const end = ice::array::rend(_layers_active);
 
-        for (Iterator it = start; it != end; ++it)
+        // Events are consumed by layers in a single pass, each layer only sees the events not processed by the layers above.
+        for (Iterator it = start; it != end && remaining_events > 0; ++it)
         {
             StackLayer const& layer = _layers[it->index];
-            for (ice::u32 offset : ice::array::slice(_layers_sources_indices, layer.sources_indices))
-            {
-                ice::array::push_back(source_values, ice::addressof(_sources_runtime_values[offset]));
-            }
 
             ice::ucount const processed_events = layer.layer->process_inputs(
-                ice::array::slice(events_copy, 0, remaining_events),
-                source_values
+                ice::array::slice(_events, 0, remaining_events),
+                ice::array::slice(_layers_sources, layer.sources_indices)
             );
             ICE_ASSERT_CORE(processed_events <= remaining_events);
             remaining_events -= processed_events;
-
-            ice::array::clear(source_values);
-
-            // TODO: Should we change how this loop is finishing?
-            if (remaining_events == 0)
-            {
-                break;
-            }
         }
 
-        ice::InputActionExecutor ex{};
+        // Actions are updated after all events are processed, as sources can be shared between layers.
         for (Iterator it = start; it != end; ++it)
         {
             StackLayer const& layer = _layers[it->index];
-            for (ice::u32 offset : ice::array::slice(_layers_sources_indices, layer.sources_indices))
-            {
-                ice::array::push_back(source_values, ice::addressof(_sources_runtime_values[offset]));
-            }
-
-            ex.prepare_constants(*layer.layer);
-            layer.layer->update_actions(ex, source_values, _actions);
-
-            ice::array::clear(source_values);
+            layer.layer->update_actions(it->executor, ice::array::slice(_layers_sources, layer.sources_indices), _actions);
         }
     }
 
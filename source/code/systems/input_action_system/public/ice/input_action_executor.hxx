@@ -9,8 +9,9 @@ namespace ice
 
     //! \brief Helper object to execute conditions, steps and modifiers on action objects and values.
     //! \details This class was introduced to properly handle some specific conditions / input sources (ex.: Axis) where
-    //!   we need to check the value against a provided deadzone. Because this value might be set on a subsequent layer, the
-    //!   `InputActionStack` object will prepare the executor before using on each action in each currently activated layer.
+    //!   we need to check the value against a provided deadzone. The `InputActionStack` prepares one executor for each
+    //!   active layer when layers are pushed or popped, so a layer inherits constants from the layers above it, unless it
+    //!   defines them itself.
     //!
     //! \note Additional context specific features might be added. One of the current ideas would be custom constants,
     //!   that could be set by the a user and applied on a different layer.
@@ -26,6 +27,11 @@ namespace ice
             ice::InputActionLayer const& layer
         ) noexcept;
 
+        //! \return Value of the given constant, as prepared from the most recent layer defining it.
+        auto constant(
+            ice::InputActionConstant constant
+        ) const noexcept -> ice::f32;
+
         //! \brief Checks given condition against the input source and provided user value.
         //! \details This method is only called for conditions that are called on input sources.
         //! \param[in] condition ID of the condition to be executed.
@@ -83,7 +89,7 @@ namespace ice
         ) const noexcept;
 
     private:
-        ice::f32 _constants[Constant_CountInputActionConstants];
+        ice::f32 _constants[Constant_CountInputActionConstants]{};
     };
 
 } // namespace ice
@@ -107,11 +107,12 @@ namespace ice
         //!   for additional readability, however the '.toggle' step is only allowed in 'toggled' input actions.
         ice::InputActionBehavior behavior;
 
-        //! \brief Offset and count of conditions this action has defined.
-        ice::ref16 conditions;
+        //! \brief Offset and count of instructions the compiled action program consists of.
+        //! \details The program contains all conditions, steps and modifiers defined for this action.
+        ice::ref16 program;
 
-        //! \brief Offset and count of modifiers this action has defined.
-        ice::ref8 mods;
+        //! \brief Program relative offset of the instruction finishing condition checks, used to skip remaining conditions.
+        ice::u16 program_conditions_end;
     };
 
     static_assert(sizeof(InputActionInfo) % 4 == 0);
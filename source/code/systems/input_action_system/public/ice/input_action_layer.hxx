@@ -14,7 +14,8 @@ namespace ice
     //! \details Each layer may define any number of sources (or none) and any number of actions (or none).
     //!   When evaluated during runtime using an action stack, it will overshadow input source events on layers below the top one,
     //!   which in turn allows to have multiple input contexts depending on the game state. Pushing or popping a layer can be done
-    //!   at the end of each frame to prepare input processing for the next frame.
+    //!   at the end of each frame to prepare input processing for the next frame. Constants not defined by a layer are
+    //!   inherited from the closest layer above it that defines them.
     //!
     //! \note The layer contains only the definitions of it's sources and actions. It does not contain runtime data
     //!   that is used. The runtime values are owned and handled by InputActionStack object, which is also responsible to
@@ -39,6 +40,10 @@ namespace ice
         //! \return Fetches the name of the given action, based on it's definition.
         virtual auto action_name(ice::InputActionInfo const& action) const noexcept -> ice::String = 0;
 
+        //! \return Binary representation of this layer, containing compiled action programs. Can be stored and loaded
+        //!   again using `ice::create_input_action_layer`.
+        virtual auto binary_data() const noexcept -> ice::Data = 0;
+
         //! \brief Loads all defined constants into the given span.
         //! \note The span needs to hold at least `ice::Constant_CountInputActionConstants` number of entries.
         //! \param[in,out] constants_span The span into which individual constant values will be loaded.
@@ -57,6 +62,7 @@ namespace ice
 
         //! \brief Runs updates on all defined actions by this layer.
         //! \param[in] executor Executor object with context data, used to execute conditions, steps and modifiers.
+        //!   Holds constants of this layer, or the values inherited from layers above it on the stack.
         //! \param[in] source_values List of storage objects for each defined input source.
         //! \param[in,out] actions List of runtime objects for each action defined by this layer.
         //! \return `true`
@@ -106,4 +112,22 @@ namespace ice
         ice::InputActionLayer const& action_layer
     ) noexcept -> ice::Expected<ice::Memory>;
 
+    //! \brief Creates a single binary blob from multiple InputActionLayer objects, used to bake input action scripts.
+    //! \param alloc Allocator used to allocate the final Memory object.
+    //! \param action_layers Layers to be saved in binary form.
+    //! \return Allocated Memory object if operation was successful, empty if no data was saved.
+    auto save_input_action_layers(
+        ice::Allocator& alloc,
+        ice::Span<ice::UniquePtr<ice::InputActionLayer> const> action_layers
+    ) noexcept -> ice::Expected<ice::Memory>;
+
+    //! \brief Creates input action layers from a binary blob created with `ice::save_input_action_layers`.
+    //! \param alloc Allocator used to create the objects and any other required objects.
+    //! \param layers_data Binary definitions of multiple action layers.
+    //! \return List of `InputActionLayer` objects, empty if the data is invalid or was baked with an older version.
+    auto load_input_action_layers(
+        ice::Allocator& alloc,
+        ice::Data layers_data
+    ) noexcept -> ice::Array<UniquePtr<ice::InputActionLayer>>;
+
 } // namespace ice
@@ -30,9 +30,8 @@ namespace ice
     struct InputActionSource;
     struct InputActionSourceInputInfo;
 
-    struct InputActionConditionData;
+    struct InputActionInstruction;
     struct InputActionModifierData;
-    struct InputActionStepData;
 
     class InputActionExecutor;
     class InputActionLayer;
@@ -0,0 +1,337 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <ice/input_action_stack.hxx>
+#include <ice/input_action_layer.hxx>
+#include <ice/input_action_layer_builder.hxx>
+#include <ice/input/input_event.hxx>
+#include <ice/input/input_keyboard.hxx>
+#include <ice/input/input_mouse.hxx>
+#include <ice/container/array.hxx>
+#include <ice/mem_allocator_host.hxx>
+
+#include "../private/input_action_internal_types.hxx"
+
+namespace
+{
+
+    constexpr ice::String test_script = R"(
+layer Movement:
+    source button Jump: kb.Space
+    source button Left: kb.A
+    source button Right: kb.D
+
+    action Jump: float1
+        when Jump.pressed
+            .activate
+
+    action Move: float2
+        when Left.pressed
+            .x - Left.x
+            or Right.pressed
+            .x + Right.x
+            .activate
+        when .true
+            .reset
+
+layer Pointer:
+    source axis2d Pos: mouse.pos
+    source button Click: mouse.lbutton
+
+    action Click: float2
+        when Click.pressed
+            .x = Pos.x
+            .y = Pos.y
+            .activate
+)";
+
+    auto button_event(ice::input::InputID identifier, bool released) noexcept -> ice::input::InputEvent
+    {
+        ice::input::InputEvent event{ .identifier = identifier };
+        event.axis_idx = 0;
+        event.value_type = ice::input::InputValueType::Button;
+        event.value.button.state.pressed = released == false;
+        event.value.button.state.released = released;
+        return event;
+    }
+
+    auto axis_event(ice::input::InputID identifier, ice::u8 axis_idx, ice::i32 value) noexcept -> ice::input::InputEvent
+    {
+        ice::input::InputEvent event{ .identifier = identifier };
+        event.axis_idx = axis_idx;
+        event.value_type = ice::input::InputValueType::AxisInt;
+        event.value.axis.value_i32 = value;
+        return event;
+    }
+
+    //! \brief Records a deterministic input stream, similar to what devices publish over a few seconds of gameplay.
+    void record_input_stream(
+        ice::u32 frame_count,
+        ice::Array<ice::input::InputEvent>& out_events,
+        ice::Array<ice::u32>& out_frames
+    ) noexcept
+    {
+        using namespace ice::input;
+        InputID const id_space = input_identifier(DeviceType::Keyboard, KeyboardKey::Space, key_identifier_base_value);
+        InputID const id_left = input_identifier(DeviceType::Keyboard, KeyboardKey::KeyA, key_identifier_base_value);
+        InputID const id_posx = input_identifier(DeviceType::Mouse, MouseInput::PositionX);
+        InputID const id_posy = input_identifier(DeviceType::Mouse, MouseInput::PositionY);
+        InputID const id_click = input_identifier(DeviceType::Mouse, MouseInput::ButtonLeft);
+
+        for (ice::u32 frame = 0; frame < frame_count; ++frame)
+        {
+            ice::array::push_back(out_frames, ice::count(out_events));
+
+            // Mouse position is published every frame.
+            ice::array::push_back(out_events, axis_event(id_posx, 0, ice::i32(frame % 1920)));
+            ice::array::push_back(out_events, axis_event(id_posy, 1, ice::i32(frame % 1080)));
+
+            if ((frame % 8) == 0)
+            {
+                ice::array::push_back(out_events, button_event(id_space, false));
+            }
+            else if ((frame % 8) == 4)
+            {
+                ice::array::push_back(out_events, button_event(id_space, true));
+            }
+
+            if ((frame % 64) >= 16 && (frame % 64) < 48)
+            {
+                ice::array::push_back(out_events, button_event(id_left, (frame % 64) == 47));
+            }
+
+            if ((frame % 32) == 0 || (frame % 32) == 1)
+            {
+                ice::array::push_back(out_events, button_event(id_click, (frame % 32) == 1));
+            }
+        }
+        ice::array::push_back(out_frames, ice::count(out_events));
+    }
+
+    void replay_input_stream(
+        ice::InputActionStack& stack,
+        ice::Span<ice::input::InputEvent const> events,
+        ice::Span<ice::u32 const> frames
+    ) noexcept
+    {
+        for (ice::u32 frame = 0; frame + 1 < ice::count(frames); ++frame)
+        {
+            stack.process_inputs(ice::span::subspan(events, frames[frame], frames[frame + 1] - frames[frame]));
+        }
+    }
+
+    //! \brief Builds a layer with a single action, activated if the mouse X position is outside of the 'axis.deadzone'.
+    //! \note Axis conditions can't be defined in scripts, so the layer is created using the builder.
+    auto create_axis_layer(ice::Allocator& alloc, ice::String name, ice::String action) noexcept
+        -> ice::UniquePtr<ice::InputActionBuilder::Layer>
+    {
+        using ice::InputActionConditionFlags;
+
+        ice::UniquePtr<ice::InputActionBuilder::Layer> builder = ice::create_input_action_layer_builder(alloc, name);
+        builder->define_source("Pos", ice::InputActionSourceType::Axis2d).add_axis(ice::input::MouseInput::PositionX);
+        builder->define_action(action, ice::InputActionDataType::Bool)
+            .add_condition_series()
+            .add_condition("Pos", ice::InputActionCondition::Axis, InputActionConditionFlags::RunSteps | InputActionConditionFlags::SeriesOr)
+            .add_step(ice::InputActionStep::Activate)
+            .set_finished();
+        return builder;
+    }
+
+    void process_axis_value(ice::InputActionStack& stack, ice::i32 value) noexcept
+    {
+        using namespace ice::input;
+        ice::input::InputEvent const event = axis_event(input_identifier(DeviceType::Mouse, MouseInput::PositionX), 0, value);
+        stack.process_inputs({ &event, 1 });
+    }
+
+} // namespace
+
+SCENARIO("input_action_system 'ice/input_action_stack.hxx'", "[input][action_stack]")
+{
+    ice::HostAllocator alloc{ };
+
+    ice::Array<ice::UniquePtr<ice::InputActionLayer>> layers = ice::parse_input_action_layer(alloc, test_script);
+    REQUIRE(ice::count(layers) == 2);
+
+    ice::UniquePtr<ice::InputActionStack> stack = ice::create_input_action_stack(alloc, "test.");
+    for (ice::UniquePtr<ice::InputActionLayer> const& layer : layers)
+    {
+        CHECK(stack->register_layer(layer.get()) == ice::S_Ok);
+        stack->push_layer(layer.get());
+    }
+
+    ice::Array<ice::InputActionLayer const*> active_layers{ alloc };
+    CHECK(stack->active_layers(active_layers) == 2);
+
+    WHEN("layers are baked into a single binary blob")
+    {
+        ice::Expected<ice::Memory> baked = ice::save_input_action_layers(alloc, layers);
+        REQUIRE(baked.succeeded());
+
+        ice::Memory const baked_memory = baked.value();
+        ice::Array<ice::UniquePtr<ice::InputActionLayer>> loaded = ice::load_input_action_layers(alloc, ice::data_view(baked_memory));
+
+        THEN("they can be loaded again with the same definitions")
+        {
+            REQUIRE(ice::count(loaded) == ice::count(layers));
+            for (ice::u32 idx = 0; idx < ice::count(layers); ++idx)
+            {
+                CHECK(loaded[idx]->name() == layers[idx]->name());
+                CHECK(ice::count(loaded[idx]->sources()) == ice::count(layers[idx]->sources()));
+                CHECK(ice::count(loaded[idx]->actions()) == ice::count(layers[idx]->actions()));
+                CHECK(loaded[idx]->binary_data().size == layers[idx]->binary_data().size);
+            }
+        }
+
+        THEN("truncated data is rejected")
+        {
+            // Find the middle of the first layers program, using the same layout as the layer builder.
+            ice::Data const layer_data = layers[0]->binary_data();
+            ice::InputActionLayerInfoHeader const& header = *reinterpret_cast<ice::InputActionLayerInfoHeader const*>(layer_data.location);
+            REQUIRE(header.count_instructions > 1);
+
+            ice::meminfo layer_layout = ice::meminfo_of<ice::InputActionLayerInfoHeader>;
+            layer_layout += ice::meminfo_of<ice::InputActionSourceInputInfo> * header.count_sources;
+            layer_layout += ice::meminfo_of<ice::InputActionInfo> * header.count_actions;
+            ice::usize const offset_program = layer_layout += ice::meminfo_of<ice::InputActionInstruction> * header.count_instructions;
+            ice::usize const offset_mid_program = offset_program + ice::usize{ sizeof(ice::InputActionInstruction) * (header.count_instructions / 2) };
+
+            // The first layer is stored after the layer count and its size, both aligned to 8 bytes.
+            ice::Data const truncated_blob{
+                .location = baked_memory.location,
+                .size = ice::usize{ 16 } + offset_mid_program,
+                .alignment = baked_memory.alignment
+            };
+            CHECK(ice::array::empty(ice::load_input_action_layers(alloc, truncated_blob)));
+
+            ice::Data const truncated_layer{
+                .location = layer_data.location,
+                .size = offset_mid_program,
+                .alignment = layer_data.alignment
+            };
+            CHECK(ice::create_input_action_layer(alloc, truncated_layer) == nullptr);
+        }
+
+        alloc.deallocate(baked_memory);
+    }
+
+    GIVEN("a recorded input stream")
+    {
+        ice::Array<ice::input::InputEvent> events{ alloc };
+        ice::Array<ice::u32> frames{ alloc };
+        record_input_stream(256, events, frames);
+
+        THEN("replaying it updates actions")
+        {
+            CHECK(stack->action_check("Jump", ice::InputActionCheck::Exists));
+            CHECK(stack->action_check("test.Move", ice::InputActionCheck::Exists));
+
+            // Replaying the first frame again ends the stream on a 'Jump' press.
+            replay_input_stream(*stack, events, frames);
+            replay_input_stream(*stack, ice::array::slice(events, 0, frames[1]), ice::array::slice(frames, 0, 2));
+            CHECK(stack->action_check("Jump", ice::InputActionCheck::Active));
+        }
+
+        THEN("popping a layer removes it and all layers above from the active stack")
+        {
+            stack->pop_layer(layers[0].get());
+
+            ice::array::clear(active_layers);
+            CHECK(stack->active_layers(active_layers) == 0);
+
+            // Processing without active layers consumes nothing and should not fail.
+            replay_input_stream(*stack, events, frames);
+
+            stack->push_layer(layers[0].get());
+            ice::array::clear(active_layers);
+            CHECK(stack->active_layers(active_layers) == 1);
+        }
+
+        BENCHMARK("replay 256 frames of recorded input")
+        {
+            replay_input_stream(*stack, events, frames);
+            return stack->action_check("Jump", ice::InputActionCheck::Active);
+        };
+    }
+}
+
+SCENARIO("input_action_system 'ice/input_action_stack.hxx' (constants)", "[input][action_stack][constants]")
+{
+    ice::HostAllocator alloc{ };
+
+    ice::UniquePtr<ice::InputActionBuilder::Layer> constants_builder = ice::create_input_action_layer_builder(alloc, "Constants");
+    constants_builder->set_constant(ice::InputActionConstant::ControllerAxisDeadzone, 100.0f);
+    ice::UniquePtr<ice::InputActionLayer> const constants_layer = constants_builder->finalize(alloc);
+    REQUIRE(constants_layer != nullptr);
+
+    ice::UniquePtr<ice::InputActionLayer> const axis_layer = create_axis_layer(alloc, "Axis", "Moved")->finalize(alloc);
+    REQUIRE(axis_layer != nullptr);
+
+    ice::UniquePtr<ice::InputActionStack> stack = ice::create_input_action_stack(alloc, "test.");
+    CHECK(stack->register_layer(axis_layer.get()) == ice::S_Ok);
+    CHECK(stack->register_layer(constants_layer.get()) == ice::S_Ok);
+    stack->push_layer(axis_layer.get());
+
+    GIVEN("a layer without constants")
+    {
+        THEN("axis conditions use the default deadzone")
+        {
+            process_axis_value(*stack, 10);
+            CHECK(stack->action_check("Moved", ice::InputActionCheck::Active));
+        }
+    }
+
+    GIVEN("a layer defining constants above it")
+    {
+        stack->push_layer(constants_layer.get());
+
+        THEN("axis conditions use the inherited deadzone")
+        {
+            process_axis_value(*stack, 10);
+            CHECK(stack->action_check("Moved", ice::InputActionCheck::Active) == false);
+
+            process_axis_value(*stack, 150);
+            CHECK(stack->action_check("Moved", ice::InputActionCheck::Active));
+        }
+
+        WHEN("the constants layer is popped")
+        {
+            stack->pop_layer(constants_layer.get());
+
+            THEN("the inherited deadzone is no longer used")
+            {
+                process_axis_value(*stack, 10);
+                CHECK(stack->action_check("Moved", ice::InputActionCheck::Active));
+            }
+        }
+    }
+
+    GIVEN("a layer defining it's own constants below the constants layer")
+    {
+        ice::UniquePtr<ice::InputActionBuilder::Layer> builder = create_axis_layer(alloc, "AxisDeadzone", "MovedFar");
+        builder->set_constant(ice::InputActionConstant::ControllerAxisDeadzone, 20.0f);
+        ice::UniquePtr<ice::InputActionLayer> const deadzone_layer = builder->finalize(alloc);
+        REQUIRE(deadzone_layer != nullptr);
+
+        CHECK(stack->register_layer(deadzone_layer.get()) == ice::S_Ok);
+        stack->push_layer(deadzone_layer.get());
+        stack->push_layer(constants_layer.get());
+
+        THEN("the layers own constants take precedence")
+        {
+            process_axis_value(*stack, 50);
+            CHECK(stack->action_check("MovedFar", ice::InputActionCheck::Active));
+
+            process_axis_value(*stack, 10);
+            CHECK(stack->action_check("MovedFar", ice::InputActionCheck::Active) == false);
+        }
+
+        THEN("layers below inherit constants from the closest layer defining them")
+        {
+            process_axis_value(*stack, 50);
+            CHECK(stack->action_check("Moved", ice::InputActionCheck::Active));
+        }
+    }
+}
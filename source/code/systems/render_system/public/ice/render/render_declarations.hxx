@@ -29,6 +29,7 @@ namespace ice::render
     struct ImageBarrier;
     struct SamplerInfo;
     struct BufferUpdateInfo;
+    struct RenderStats;
 
     enum class [[nodiscard]] Framebuffer : ice::uptr;
     enum class [[nodiscard]] Renderpass : ice::uptr;
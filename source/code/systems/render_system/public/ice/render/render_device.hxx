@@ -135,6 +135,15 @@ namespace ice::render
         virtual auto get_commands() noexcept -> ice::render::RenderCommands& = 0;
 
         virtual void wait_idle() const noexcept = 0;
+
+        //! \brief Queries statistics of the last presented frame.
+        //! \returns 'false' if the device does not track frame statistics.
+        virtual bool query_frame_stats(
+            ice::render::RenderStats& out_stats
+        ) const noexcept
+        {
+            return false;
+        }
     };
 
 } // namespace ice::render
@@ -5,6 +5,7 @@
 #include <ice/mem_data.hxx>
 #include <ice/span.hxx>
 #include <ice/asset_category.hxx>
+#include <ice/shard.hxx>
 
 namespace ice::render
 {
@@ -61,4 +62,8 @@ namespace ice::render
 
     static constexpr ice::AssetCategory AssetCategory_Shader = ice::make_asset_category("ice/render_system/shader");
 
+    //! \brief Shader compiler parameter, providing a directory where transpiled and compiled shaders are cached between runs.
+    //! \note If not provided, shaders are always transpiled and compiled from scratch.
+    static constexpr ice::ShardID ShardID_ShaderCacheDirectory = "shader:cache-dir"_shardid;
+
 } // namespace ice::render
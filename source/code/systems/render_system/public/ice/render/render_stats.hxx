@@ -0,0 +1,45 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/mem_size_types.hxx>
+#include <ice/render/render_declarations.hxx>
+
+namespace ice::render
+{
+
+    //! \brief Statistics of all work submitted during a single frame.
+    //! \note Frames are separated by 'RenderQueue::present' calls. Available trough 'RenderDevice::query_frame_stats'.
+    struct RenderStats
+    {
+        ice::u32 frame_index;
+
+        ice::u32 submits;
+        ice::u32 command_buffers;
+        ice::u32 commands;
+
+        ice::u32 renderpasses;
+        ice::u32 draws;
+        ice::u32 vertices;
+        ice::u32 instances;
+
+        ice::u32 pipeline_binds;
+        ice::u32 resource_set_binds;
+        ice::u32 buffer_binds;
+        ice::u32 push_constants;
+        ice::u32 image_barriers;
+
+        //! \brief Number of live driver objects (buffers, images, pipelines, etc.) at the end of the frame.
+        ice::u32 objects_alive;
+
+        //! \brief Bytes uploaded from the host during the frame, includes buffer updates, image data and push constants.
+        ice::usize bytes_uploaded;
+
+        //! \brief Bytes allocated for buffers and images at the end of the frame.
+        ice::usize bytes_resident;
+
+        //! \brief Size of all recorded command streams submitted during the frame.
+        ice::usize command_stream_size;
+    };
+
+} // namespace ice::render
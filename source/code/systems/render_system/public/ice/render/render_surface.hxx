@@ -21,7 +21,9 @@ namespace ice::render
         Wayland_Window,
         X11_Window,
         Android_NativeWindow,
-        HTML5_DOMCanvas
+        HTML5_DOMCanvas,
+        //! \brief Surface without a backing window, only supported by drivers rendering off-screen.
+        Headless,
     };
 
     struct SurfaceInfo
@@ -63,6 +65,12 @@ namespace ice::render
                 unsigned long window;
                 void* display;
             } x11;
+
+            struct
+            {
+                ice::u32 width;
+                ice::u32 height;
+            } headless;
         };
     };
 
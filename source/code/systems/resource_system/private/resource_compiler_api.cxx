@@ -1,7 +1,7 @@
 /// Copyright 2024 - 2025, Dandielo <dandielo@iceshard.net>
 /// SPDX-License-Identifier: MIT
 
-#include <ice/resource_compiler_api.hxx>
+#include <ice/resource_compiler.hxx>
 #include <ice/config.hxx>
 
 namespace ice::api::resource_compiler::v1
@@ -100,3 +100,22 @@ namespace ice::api::resource_compiler::v1
     }
 
 } // namespace ice::api::resource_compiler::v1
+
+namespace ice
+{
+
+    void resource_compiler_write_dependencies(
+        ice::ConfigBuilder& out_metadata,
+        ice::Span<ice::URI const> dependencies
+    ) noexcept
+    {
+        ice::ConfigBuilderValue dependency_list = out_metadata["asset"]["dependencies"];
+
+        ice::u32 idx = 0;
+        for (ice::URI const& dependency : dependencies)
+        {
+            dependency_list[idx++] = dependency.path();
+        }
+    }
+
+} // namespace ice
@@ -28,6 +28,12 @@ namespace ice
         }
         virtual auto origin() const noexcept -> ice::String override { return _uri.path(); }
 
+        //! \brief Chunks are stored in index order, so chunk index and offset map directly to the position in the pack.
+        virtual auto storage_order() const noexcept -> ice::u64 override
+        {
+            return (ice::u64{ _handle.chunk } << 32) | ice::u64{ _handle.offset };
+        }
+
         hailstorm::HailstormResource const& _handle;
 
     protected:
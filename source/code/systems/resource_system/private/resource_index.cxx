@@ -0,0 +1,162 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "resource_index.hxx"
+#include <ice/mem_utils.hxx>
+#include <ice/assert.hxx>
+
+#include <bit>
+
+namespace ice
+{
+
+    ResourceIndex::ResourceIndex(ice::Allocator& alloc, ice::ucount predicted_count) noexcept
+        : _allocator{ alloc }
+        , _shards{ }
+    {
+        ice::u32 const shard_capacity = ice::max((predicted_count + Constant_ShardCount - 1) / Constant_ShardCount, 16u);
+        for (Shard& shard : _shards)
+        {
+            shard.table.store(create_table(shard_capacity, nullptr), std::memory_order_relaxed);
+            shard.count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ResourceIndex::~ResourceIndex() noexcept
+    {
+        for (Shard& shard : _shards)
+        {
+            destroy_table(shard.table.load(std::memory_order_relaxed));
+        }
+    }
+
+    void ResourceIndex::insert(ice::u64 hash, ice::Resource* resource) noexcept
+    {
+        ICE_ASSERT_CORE(resource != nullptr);
+
+        Shard& target = shard(hash);
+        std::lock_guard<std::mutex> lk{ target.mutex };
+
+        Table* table = target.table.load(std::memory_order_relaxed);
+        if (table->entry_count == table->entry_capacity)
+        {
+            grow_shard(target);
+            table = target.table.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<Entry*>& bucket = table->buckets[hash & (table->bucket_count - 1)];
+        Entry* const entry = new (table->entries + table->entry_count) Entry{
+            .hash = hash,
+            .resource = resource,
+            .next = bucket.load(std::memory_order_relaxed),
+        };
+        table->entry_count += 1;
+
+        // Publishing the entry, after this point it's visible to lookups.
+        bucket.store(entry, std::memory_order_release);
+        target.count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto ResourceIndex::find_first(ice::u64 hash) const noexcept -> ice::Resource*
+    {
+        Table const* const table = shard(hash).table.load(std::memory_order_acquire);
+        Entry const* entry = table->buckets[hash & (table->bucket_count - 1)].load(std::memory_order_acquire);
+
+        // Entries are pushed to the front, so we need to return the last matching entry to keep insertion order.
+        ice::Resource* result = nullptr;
+        for (; entry != nullptr; entry = entry->next)
+        {
+            if (entry->hash == hash)
+            {
+                result = entry->resource;
+            }
+        }
+        return result;
+    }
+
+    auto ResourceIndex::find(ice::u64 hash, ice::Resource const* resource) const noexcept -> ice::Resource*
+    {
+        Table const* const table = shard(hash).table.load(std::memory_order_acquire);
+        Entry const* entry = table->buckets[hash & (table->bucket_count - 1)].load(std::memory_order_acquire);
+        for (; entry != nullptr; entry = entry->next)
+        {
+            if (entry->hash == hash && entry->resource == resource)
+            {
+                return const_cast<ice::Resource*>(resource);
+            }
+        }
+        return nullptr;
+    }
+
+    auto ResourceIndex::count() const noexcept -> ice::ucount
+    {
+        ice::ucount result = 0;
+        for (Shard const& shard : _shards)
+        {
+            result += shard.count.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    auto ResourceIndex::create_table(ice::u32 capacity, Table* previous) noexcept -> Table*
+    {
+        ice::u32 const bucket_count = std::bit_ceil(capacity);
+
+        ice::meminfo table_meminfo = ice::meminfo_of<Table>;
+        ice::usize const offset_buckets = table_meminfo += ice::meminfo_of<std::atomic<Entry*>> * bucket_count;
+        ice::usize const offset_entries = table_meminfo += ice::meminfo_of<Entry> * capacity;
+
+        ice::Memory const memory = _allocator.allocate(table_meminfo);
+        Table* const table = new (memory.location) Table{
+            .bucket_count = bucket_count,
+            .entry_capacity = capacity,
+            .entry_count = 0,
+            .buckets = reinterpret_cast<std::atomic<Entry*>*>(ice::ptr_add(memory.location, offset_buckets)),
+            .entries = reinterpret_cast<Entry*>(ice::ptr_add(memory.location, offset_entries)),
+            .previous = previous,
+        };
+
+        for (ice::u32 idx = 0; idx < bucket_count; ++idx)
+        {
+            new (table->buckets + idx) std::atomic<Entry*>{ nullptr };
+        }
+        return table;
+    }
+
+    void ResourceIndex::destroy_table(Table* table) noexcept
+    {
+        // Release the table and all tables it replaced.
+        while (table != nullptr)
+        {
+            Table* const previous = table->previous;
+            _allocator.deallocate(table);
+            table = previous;
+        }
+    }
+
+    void ResourceIndex::grow_shard(Shard& shard) noexcept
+    {
+        Table* const old_table = shard.table.load(std::memory_order_relaxed);
+
+        // Doubling the capacity keeps the memory of all replaced tables below the size of the new one.
+        Table* const new_table = create_table(old_table->entry_capacity * 2, old_table);
+
+        // Keep the relative order of entries in each bucket, by moving them from the oldest entry to the newest.
+        for (ice::u32 idx = 0; idx < old_table->entry_count; ++idx)
+        {
+            Entry const& old_entry = old_table->entries[idx];
+            std::atomic<Entry*>& bucket = new_table->buckets[old_entry.hash & (new_table->bucket_count - 1)];
+            Entry* const entry = new (new_table->entries + new_table->entry_count) Entry{
+                .hash = old_entry.hash,
+                .resource = old_entry.resource,
+                .next = bucket.load(std::memory_order_relaxed),
+            };
+            bucket.store(entry, std::memory_order_relaxed);
+            new_table->entry_count += 1;
+        }
+
+        // Lookups started before this point might still access the old table, which is kept alive until destruction.
+        shard.table.store(new_table, std::memory_order_release);
+    }
+
+} // namespace ice
@@ -0,0 +1,134 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/resource.hxx>
+#include <ice/mem_allocator.hxx>
+
+#include <atomic>
+#include <mutex>
+
+namespace ice
+{
+
+    //! \brief Concurrent insert-only multi-map of resource name hashes to resource objects.
+    //! \details Entries are split into shards, each guarded by it's own mutex for inserts.
+    //!   Lookups never lock and can happen at any time, even while resources are added.
+    //!
+    //! \note Tables replaced while growing a shard are only released when the index is destroyed, so pointers read by
+    //!   concurrent lookups stay valid. Each table has twice the capacity of the one it replaced, so the replaced tables
+    //!   never use more memory than the current ones.
+    class ResourceIndex
+    {
+    public:
+        //! \brief Number of shards, needs to be a power of two.
+        static constexpr ice::u32 Constant_ShardCount = 16;
+
+        ResourceIndex(ice::Allocator& alloc, ice::ucount predicted_count) noexcept;
+        ~ResourceIndex() noexcept;
+
+        void insert(ice::u64 hash, ice::Resource* resource) noexcept;
+
+        //! \returns The first resource stored under the given hash or 'nullptr'.
+        auto find_first(ice::u64 hash) const noexcept -> ice::Resource*;
+
+        //! \returns The first resource stored under the given hash accepted by the predicate or 'nullptr'.
+        //! \note Allows to verify the resource against the full key, in case different keys have the same hash.
+        template<typename Fn>
+        auto find_first_if(ice::u64 hash, Fn&& fn) const noexcept -> ice::Resource*;
+
+        //! \returns The given resource object if it's stored under the given hash or 'nullptr'.
+        auto find(ice::u64 hash, ice::Resource const* resource) const noexcept -> ice::Resource*;
+
+        //! \returns Number of resources stored in the index.
+        auto count() const noexcept -> ice::ucount;
+
+        //! \brief Calls the given function for each resource stored in the index.
+        template<typename Fn>
+        void for_each(Fn&& fn) const noexcept;
+
+    private:
+        struct Entry
+        {
+            ice::u64 hash;
+            ice::Resource* resource;
+            Entry* next;
+        };
+
+        struct Table
+        {
+            ice::u32 bucket_count;
+            ice::u32 entry_capacity;
+            ice::u32 entry_count;
+            std::atomic<Entry*>* buckets;
+            Entry* entries;
+
+            //! \brief Tables replaced by this one, kept alive because lookups might still access them.
+            Table* previous;
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            std::atomic<Table*> table;
+            std::atomic<ice::ucount> count;
+        };
+
+        auto shard(ice::u64 hash) const noexcept -> Shard const&
+        {
+            return _shards[(hash >> 32) & (Constant_ShardCount - 1)];
+        }
+
+        auto shard(ice::u64 hash) noexcept -> Shard&
+        {
+            return _shards[(hash >> 32) & (Constant_ShardCount - 1)];
+        }
+
+        auto create_table(ice::u32 capacity, Table* previous) noexcept -> Table*;
+        void destroy_table(Table* table) noexcept;
+
+        //! \brief Replaces the table of a shard with a copy of twice the capacity.
+        //! \note Needs to be called with the shard mutex locked.
+        void grow_shard(Shard& shard) noexcept;
+
+    private:
+        ice::Allocator& _allocator;
+        Shard _shards[Constant_ShardCount];
+    };
+
+    template<typename Fn>
+    inline auto ResourceIndex::find_first_if(ice::u64 hash, Fn&& fn) const noexcept -> ice::Resource*
+    {
+        Table const* const table = shard(hash).table.load(std::memory_order_acquire);
+        Entry const* entry = table->buckets[hash & (table->bucket_count - 1)].load(std::memory_order_acquire);
+
+        // Entries are pushed to the front, so we need to return the last accepted entry to keep insertion order.
+        ice::Resource* result = nullptr;
+        for (; entry != nullptr; entry = entry->next)
+        {
+            if (entry->hash == hash && fn(entry->resource))
+            {
+                result = entry->resource;
+            }
+        }
+        return result;
+    }
+
+    template<typename Fn>
+    inline void ResourceIndex::for_each(Fn&& fn) const noexcept
+    {
+        for (Shard const& shard : _shards)
+        {
+            Table const* const table = shard.table.load(std::memory_order_acquire);
+            for (ice::u32 idx = 0; idx < table->bucket_count; ++idx)
+            {
+                Entry const* entry = table->buckets[idx].load(std::memory_order_acquire);
+                for (; entry != nullptr; entry = entry->next)
+                {
+                    fn(entry->resource);
+                }
+            }
+        }
+    }
+
+} // namespace ice
@@ -1,7 +1,6 @@
 /// Copyright 2024 - 2025, Dandielo <dandielo@iceshard.net>
 /// SPDX-License-Identifier: MIT
 
-#include "resource_aio_request.hxx"
 #include "resource_provider_hailstorm.hxx"
 
 namespace ice
@@ -45,10 +44,10 @@ namespace ice
     HailstormChunkLoader_Persistent::HailstormChunkLoader_Persistent(
         ice::Allocator& alloc,
         hailstorm::v1::HailstormChunk const& chunk,
-        ice::native_file::File const& file
+        ice::ResourceReadScheduler& read_scheduler
     ) noexcept
         : HailstormChunkLoader{ alloc, chunk }
-        , _file{ file }
+        , _read_scheduler{ read_scheduler }
         , _awaiting_tasks{ }
         , _awaitcount{ 0 }
         , _refcount{ 0 }
@@ -73,8 +72,7 @@ namespace ice
 
     auto HailstormChunkLoader_Persistent::request_slice(
         ice::u32 offset,
-        ice::u32 size,
-        ice::native_aio::AIOPort aioport
+        ice::u32 size
     ) noexcept -> ice::Task<ice::Data>
     {
         if (_refcount.fetch_add(1u, std::memory_order_relaxed) > 0)
@@ -92,8 +90,9 @@ namespace ice
         if (_memory.location == nullptr)
         {
             ice::Memory const res_memory = _allocator.allocate({ { size_t(_chunk.size) }, (ice::ualign) _chunk.align });
-            ice::detail::AsyncReadRequest request{ aioport, _file, ice::usize{static_cast<ice::usize::base_type>(_chunk.size)}, ice::usize{static_cast<ice::usize::base_type>(_chunk.offset)}, res_memory };
-            ice::usize const bytes_read = co_await request;
+            ice::usize const bytes_read = co_await _read_scheduler.read(
+                ice::usize{ static_cast<ice::usize::base_type>(_chunk.offset) }, res_memory
+            );
 
             // Clear memory if failed to load the file chunk
             if (bytes_read == 0_B)
@@ -130,10 +129,10 @@ namespace ice
     HailstormChunkLoader_Regular::HailstormChunkLoader_Regular(
         ice::Allocator& alloc,
         hailstorm::v1::HailstormChunk const& chunk,
-        ice::native_file::File const& file
+        ice::ResourceReadScheduler& read_scheduler
     ) noexcept
         : HailstormChunkLoader{ alloc, chunk }
-        , _file{ file }
+        , _read_scheduler{ read_scheduler }
         , _offset_map{ _allocator }
         , _pointers{ _allocator }
     {
@@ -172,8 +171,7 @@ namespace ice
 
     auto HailstormChunkLoader_Regular::request_slice(
         ice::u32 offset,
-        ice::u32 size,
-        ice::native_aio::AIOPort aioport
+        ice::u32 size
     ) noexcept -> ice::Task<ice::Data>
     {
         ice::u32 const ptr_idx = ice::hashmap::get_or_set(
@@ -183,8 +181,9 @@ namespace ice
         {
             // TODO: See if we could use large page allocations if files size < 1kib
             ice::Memory const memory = _allocator.allocate({ { size }, (ice::ualign)_chunk.align });
-            ice::detail::AsyncReadRequest request{ aioport, _file, ice::usize{static_cast<ice::usize::base_type>(_chunk.size)}, ice::usize{static_cast<ice::usize::base_type>(_chunk.offset)}, memory };
-            ice::usize const bytes_read = co_await request;
+            ice::usize const bytes_read = co_await _read_scheduler.read(
+                ice::usize{ static_cast<ice::usize::base_type>(_chunk.offset + offset) }, memory
+            );
 
             ICE_ASSERT_CORE(bytes_read == ice::usize{ size });
             _pointers[ptr_idx] = memory.location;
@@ -201,6 +200,8 @@ namespace ice
         , _data_allocator{ alloc, "Data" }
         , _aioport{ aioport }
         , _hspack_path{ _allocator }
+        , _hspack_file{ }
+        , _read_scheduler{ _data_allocator, _hspack_file, _aioport }
         , _packname{ _allocator, ice::path::filename(path) }
         , _header_memory{ }
         , _paths_memory{ }
@@ -315,13 +316,13 @@ namespace ice
                 if (_pack.chunks[idx].persistance >= 2)
                 {
                     _loaders[idx] = _allocator.create<ice::HailstormChunkLoader_Persistent>(
-                        _allocator, _pack.chunks[idx], _hspack_file
+                        _allocator, _pack.chunks[idx], _read_scheduler
                     );
                 }
                 else
                 {
                     _loaders[idx] = _allocator.create<ice::HailstormChunkLoader_Regular>(
-                        _allocator, _pack.chunks[idx], _hspack_file
+                        _allocator, _pack.chunks[idx], _read_scheduler
                     );
                 }
             }
@@ -417,11 +418,11 @@ namespace ice
         hailstorm::HailstormResource const& hsres = static_cast<ice::HailstormResource const*>(resource)->_handle;
         if (ice::string::size(fragment) && fragment == "meta")
         {
-            co_return co_await _loaders[hsres.meta_chunk]->request_slice(hsres.meta_offset, hsres.meta_size, _aioport);
+            co_return co_await _loaders[hsres.meta_chunk]->request_slice(hsres.meta_offset, hsres.meta_size);
         }
         else
         {
-            co_return co_await _loaders[hsres.chunk]->request_slice(hsres.offset, hsres.size, _aioport);
+            co_return co_await _loaders[hsres.chunk]->request_slice(hsres.offset, hsres.size);
         }
     }
 
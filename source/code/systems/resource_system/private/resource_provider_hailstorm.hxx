@@ -20,6 +20,7 @@
 #include <ice/devui_widget.hxx>
 
 #include "resource_hailstorm_entry.hxx"
+#include "resource_read_scheduler.hxx"
 
 #include <hailstorm/hailstorm_operations.hxx>
 #include <atomic>
@@ -49,8 +50,7 @@ namespace ice
 
         virtual auto request_slice(
             ice::u32 offset,
-            ice::u32 size,
-            ice::native_aio::AIOPort aioport
+            ice::u32 size
         ) noexcept -> ice::Task<ice::Data> = 0;
 
         virtual void release_slice_refcount() noexcept { }
@@ -96,7 +96,7 @@ namespace ice
         HailstormChunkLoader_Persistent(
             ice::Allocator& alloc,
             hailstorm::v1::HailstormChunk const& chunk,
-            ice::native_file::File const& file
+            ice::ResourceReadScheduler& read_scheduler
         ) noexcept;
 
         ~HailstormChunkLoader_Persistent() noexcept override;
@@ -108,14 +108,13 @@ namespace ice
 
         auto request_slice(
             ice::u32 offset,
-            ice::u32 size,
-            ice::native_aio::AIOPort aioport
+            ice::u32 size
         ) noexcept -> ice::Task<ice::Data> override;
 
         void release_slice_refcount() noexcept override;
 
     private:
-        ice::native_file::File const& _file;
+        ice::ResourceReadScheduler& _read_scheduler;
         ice::TaskQueue _awaiting_tasks;
         std::atomic_int32_t _awaitcount;
         std::atomic_int32_t _refcount;
@@ -128,7 +127,7 @@ namespace ice
         HailstormChunkLoader_Regular(
             ice::Allocator& alloc,
             hailstorm::v1::HailstormChunk const& chunk,
-            ice::native_file::File const& file
+            ice::ResourceReadScheduler& read_scheduler
         ) noexcept;
 
         ~HailstormChunkLoader_Regular() noexcept override;
@@ -142,12 +141,11 @@ namespace ice
 
         auto request_slice(
             ice::u32 offset,
-            ice::u32 size,
-            ice::native_aio::AIOPort aioport
+            ice::u32 size
         ) noexcept -> ice::Task<ice::Data> override;
 
     private:
-        ice::native_file::File const& _file;
+        ice::ResourceReadScheduler& _read_scheduler;
         ice::HashMap<ice::u32> _offset_map;
         ice::Array<void*> _pointers;
     };
@@ -198,6 +196,7 @@ namespace ice
         ice::native_aio::AIOPort _aioport;
         ice::native_file::HeapFilePath _hspack_path;
         ice::native_file::File _hspack_file;
+        ice::ResourceReadScheduler _read_scheduler;
         ice::HeapString<> _packname;
 
         ice::Memory _header_memory;
@@ -131,6 +131,18 @@ namespace ice
         }
         ImGui::EndChild();
 
+        ice::ResourceReadStats const read_stats = _provider._read_scheduler.stats();
+        if (ImGui::BeginChild("Read Stats", {}, ImGuiChildFlags_Border | ImGuiChildFlags_AutoResizeY))
+        {
+            ImGui::Text("Queue depth: %u (max: %u)", read_stats.queue_depth, read_stats.queue_depth_max);
+            ImGui::SetItemTooltip("Number of read requests waiting for the current batch to finish.");
+            ImGui::Text("Requests: %u, Reads: %u (merge ratio: %.2f)", read_stats.requests, read_stats.reads, read_stats.merge_ratio());
+            ImGui::SetItemTooltip("Number of requested resource slices and the number of actual reads issued to the pack file.");
+            ImGui::TextT("Requested: {:p}, Read: {:p}", read_stats.bytes_requested, read_stats.bytes_read);
+            ImGui::SetItemTooltip("Bytes read include gaps between merged requests.");
+        }
+        ImGui::EndChild();
+
         build_chunk_table();
 
         ImGui::TextUnformatted("Resources");
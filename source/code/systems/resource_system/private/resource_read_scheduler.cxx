@@ -0,0 +1,248 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include "resource_read_scheduler.hxx"
+#include "resource_aio_request.hxx"
+
+#include <ice/task_utils.hxx>
+#include <ice/mem_utils.hxx>
+#include <ice/profiler.hxx>
+#include <ice/assert.hxx>
+#include <ice/sort.hxx>
+
+namespace ice
+{
+
+    struct ResourceReadScheduler::Request
+    {
+        ice::usize offset;
+        ice::Memory memory;
+        ice::usize bytes_read;
+        ice::coroutine_handle<> coroutine;
+
+        //! \brief Set if the coroutine owning this request needs to dispatch the next batch.
+        bool dispatch;
+    };
+
+    struct ResourceReadScheduler::RequestAwaitable
+    {
+        ice::ResourceReadScheduler& scheduler;
+        ice::ResourceReadScheduler::Request& request;
+
+        inline bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        inline bool await_suspend(ice::coroutine_handle<> coro) noexcept
+        {
+            request.coroutine = coro;
+
+            std::lock_guard<std::mutex> lk{ scheduler._mutex };
+            ice::array::push_back(scheduler._pending, &request);
+
+            ice::u32 const queue_depth = ice::array::count(scheduler._pending);
+            scheduler._stat_queue_depth.store(queue_depth, std::memory_order_relaxed);
+            if (scheduler._stat_queue_depth_max.load(std::memory_order_relaxed) < queue_depth)
+            {
+                scheduler._stat_queue_depth_max.store(queue_depth, std::memory_order_relaxed);
+            }
+
+            // If nothing is being read, we dispatch the batch ourselfs without suspending.
+            if (scheduler._dispatching == false)
+            {
+                scheduler._dispatching = true;
+                request.dispatch = true;
+                return false;
+            }
+            return true;
+        }
+
+        inline bool await_resume() const noexcept
+        {
+            return request.dispatch;
+        }
+    };
+
+    ResourceReadScheduler::ResourceReadScheduler(
+        ice::Allocator& alloc,
+        ice::native_file::File const& file,
+        ice::native_aio::AIOPort aioport
+    ) noexcept
+        : _allocator{ alloc }
+        , _file{ file }
+        , _aioport{ aioport }
+        , _mutex{ }
+        , _pending{ _allocator }
+        , _dispatching{ false }
+        , _stat_queue_depth{ 0 }
+        , _stat_queue_depth_max{ 0 }
+        , _stat_requests{ 0 }
+        , _stat_reads{ 0 }
+        , _stat_bytes_requested{ 0 }
+        , _stat_bytes_read{ 0 }
+    {
+    }
+
+    ResourceReadScheduler::~ResourceReadScheduler() noexcept
+    {
+        ICE_ASSERT_CORE(_dispatching == false && ice::array::empty(_pending));
+    }
+
+    auto ResourceReadScheduler::read(
+        ice::usize offset,
+        ice::Memory memory
+    ) noexcept -> ice::Task<ice::usize>
+    {
+        _stat_requests.fetch_add(1, std::memory_order_relaxed);
+        _stat_bytes_requested.fetch_add(memory.size.value, std::memory_order_relaxed);
+
+        Request request{ .offset = offset, .memory = memory, .bytes_read = 0_B, .coroutine = nullptr, .dispatch = false };
+        if (co_await RequestAwaitable{ *this, request })
+        {
+            // Our own request is part of the dispatched batch.
+            co_await dispatch();
+        }
+        co_return request.bytes_read;
+    }
+
+    auto ResourceReadScheduler::stats() const noexcept -> ice::ResourceReadStats
+    {
+        return ResourceReadStats{
+            .queue_depth = _stat_queue_depth.load(std::memory_order_relaxed),
+            .queue_depth_max = _stat_queue_depth_max.load(std::memory_order_relaxed),
+            .requests = _stat_requests.load(std::memory_order_relaxed),
+            .reads = _stat_reads.load(std::memory_order_relaxed),
+            .bytes_requested = { _stat_bytes_requested.load(std::memory_order_relaxed) },
+            .bytes_read = { _stat_bytes_read.load(std::memory_order_relaxed) },
+        };
+    }
+
+    auto ResourceReadScheduler::dispatch() noexcept -> ice::Task<>
+    {
+        IPT_ZONE_SCOPED;
+
+        ice::Array<Request*> batch{ _allocator };
+        {
+            std::lock_guard<std::mutex> lk{ _mutex };
+            ice::array::push_back(batch, _pending);
+            ice::array::clear(_pending);
+            _stat_queue_depth.store(0, std::memory_order_relaxed);
+        }
+
+        ice::sort(
+            ice::array::slice(batch),
+            [](Request const* left, Request const* right) noexcept
+            {
+                return left->offset < right->offset;
+            }
+        );
+
+        // Merge requests into ranges if the gap between them is small enough.
+        ice::Array<ice::Task<>> reads{ _allocator };
+        ice::u32 const request_count = ice::array::count(batch);
+
+        ice::u32 range_begin = 0;
+        ice::usize range_end = batch[0]->offset + batch[0]->memory.size;
+        for (ice::u32 idx = 1; idx <= request_count; ++idx)
+        {
+            bool split_range = idx == request_count;
+            if (split_range == false)
+            {
+                Request const* const next = batch[idx];
+                ice::usize const next_end = ice::max(range_end, next->offset + next->memory.size);
+
+                split_range = next->offset > range_end + Constant_MaxMergeGap
+                    || ice::usize::subtract(next_end, batch[range_begin]->offset) > Constant_MaxMergedReadSize;
+
+                range_end = split_range ? next->offset + next->memory.size : next_end;
+            }
+
+            if (split_range)
+            {
+                ice::array::push_back(reads, read_range(ice::array::slice(batch, range_begin, idx - range_begin)));
+                range_begin = idx;
+            }
+        }
+
+        co_await ice::await_tasks(reads);
+
+        // Requests gathered while we where reading are dispatched by one of the waiting coroutines.
+        Request* next_dispatcher = nullptr;
+        {
+            std::lock_guard<std::mutex> lk{ _mutex };
+            if (ice::array::any(_pending))
+            {
+                next_dispatcher = _pending[0];
+                next_dispatcher->dispatch = true;
+            }
+            else
+            {
+                _dispatching = false;
+            }
+        }
+
+        for (Request* request : batch)
+        {
+            // The dispatching request is owned by the current coroutine and continues after we return.
+            if (request->dispatch == false)
+            {
+                request->coroutine.resume();
+            }
+        }
+
+        if (next_dispatcher != nullptr)
+        {
+            next_dispatcher->coroutine.resume();
+        }
+    }
+
+    auto ResourceReadScheduler::read_range(
+        ice::Span<ice::ResourceReadScheduler::Request*> requests
+    ) noexcept -> ice::Task<>
+    {
+        IPT_ZONE_SCOPED;
+
+        ice::usize const range_offset = requests[0]->offset;
+        ice::usize range_end = range_offset;
+        for (Request const* request : requests)
+        {
+            range_end = ice::max(range_end, request->offset + request->memory.size);
+        }
+
+        ice::usize const range_size = ice::usize::subtract(range_end, range_offset);
+        _stat_reads.fetch_add(1, std::memory_order_relaxed);
+
+        // A single request is read directly into it's own memory.
+        if (ice::span::count(requests) == 1)
+        {
+            Request* const request = requests[0];
+            request->bytes_read = co_await ice::detail::AsyncReadRequest{
+                _aioport, _file, request->memory.size, request->offset, request->memory
+            };
+
+            _stat_bytes_read.fetch_add(request->bytes_read.value, std::memory_order_relaxed);
+            co_return;
+        }
+
+        ice::Memory const staging = _allocator.allocate(range_size);
+        ice::usize const bytes_read = co_await ice::detail::AsyncReadRequest{
+            _aioport, _file, range_size, range_offset, staging
+        };
+        _stat_bytes_read.fetch_add(bytes_read.value, std::memory_order_relaxed);
+
+        // Scatter the data, requests not fully covered by the read only receive what was available.
+        for (Request* const request : requests)
+        {
+            ice::usize const request_offset = ice::usize::subtract(request->offset, range_offset);
+            if (bytes_read > request_offset)
+            {
+                request->bytes_read = ice::min(request->memory.size, ice::usize::subtract(bytes_read, request_offset));
+                ice::memcpy(request->memory.location, ice::ptr_add(staging.location, request_offset), request->bytes_read);
+            }
+        }
+
+        _allocator.deallocate(staging);
+    }
+
+} // namespace ice
@@ -0,0 +1,102 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ice/container/array.hxx>
+#include <ice/mem_allocator.hxx>
+#include <ice/native_aio.hxx>
+#include <ice/native_file.hxx>
+#include <ice/task.hxx>
+
+#include <atomic>
+#include <mutex>
+
+namespace ice
+{
+
+    //! \brief Statistics gathered by a read scheduler since it was created.
+    struct ResourceReadStats
+    {
+        //! \brief Number of requests currently waiting to be dispatched.
+        ice::u32 queue_depth;
+
+        //! \brief Highest number of requests that where waiting at the same time.
+        ice::u32 queue_depth_max;
+
+        //! \brief Number of requests made by users.
+        ice::u32 requests;
+
+        //! \brief Number of reads issued to the file, lower than 'requests' if reads where merged.
+        ice::u32 reads;
+
+        //! \brief Sum of all requested bytes.
+        ice::usize bytes_requested;
+
+        //! \brief Sum of all bytes read from the file, including gaps between merged requests.
+        ice::usize bytes_read;
+
+        //! \returns Average number of requests served by a single file read.
+        constexpr auto merge_ratio() const noexcept -> ice::f32
+        {
+            return reads == 0 ? 1.0f : ice::f32(requests) / ice::f32(reads);
+        }
+    };
+
+    //! \brief Schedules reads from a single file, so concurrent requests are served in file order.
+    //! \details Requests made while a batch is in-flight are gathered, sorted by their offset and merged into
+    //!   larger reads if close enough to each other. Once a batch is read the data is scattered to each request and the
+    //!   next batch is dispatched by one of the waiting requests.
+    class ResourceReadScheduler
+    {
+    public:
+        //! \brief Maximum number of unrequested bytes between two requests that are still merged into a single read.
+        static constexpr ice::usize Constant_MaxMergeGap = 64_KiB;
+
+        //! \brief Maximum size of a single merged read, requests larger than this are still read in one go.
+        static constexpr ice::usize Constant_MaxMergedReadSize = 4_MiB;
+
+        ResourceReadScheduler(
+            ice::Allocator& alloc,
+            ice::native_file::File const& file,
+            ice::native_aio::AIOPort aioport
+        ) noexcept;
+
+        ~ResourceReadScheduler() noexcept;
+
+        //! \brief Reads data at the given file offset into the provided memory block.
+        //! \returns Number of bytes read, which might be lower than the memory size if the read failed.
+        auto read(
+            ice::usize offset,
+            ice::Memory memory
+        ) noexcept -> ice::Task<ice::usize>;
+
+        auto stats() const noexcept -> ice::ResourceReadStats;
+
+    private:
+        struct Request;
+        struct RequestAwaitable;
+
+        auto dispatch() noexcept -> ice::Task<>;
+
+        auto read_range(
+            ice::Span<ice::ResourceReadScheduler::Request*> requests
+        ) noexcept -> ice::Task<>;
+
+    private:
+        ice::Allocator& _allocator;
+        ice::native_file::File const& _file;
+        ice::native_aio::AIOPort _aioport;
+
+        std::mutex _mutex;
+        ice::Array<ice::ResourceReadScheduler::Request*> _pending;
+        bool _dispatching;
+
+        std::atomic<ice::u32> _stat_queue_depth;
+        std::atomic<ice::u32> _stat_queue_depth_max;
+        std::atomic<ice::u32> _stat_requests;
+        std::atomic<ice::u32> _stat_reads;
+        std::atomic<ice::usize::base_type> _stat_bytes_requested;
+        std::atomic<ice::usize::base_type> _stat_bytes_read;
+    };
+
+} // namespace ice
@@ -31,6 +31,25 @@ namespace ice
         co_return out_metadata.location == nullptr;
     }
 
+    namespace detail
+    {
+
+        //! \returns 'true' if the resource is identified by the given URI, ignoring the query and fragment parts.
+        bool resource_matches_uri(ice::Resource const* resource, ice::URI const& uri) noexcept
+        {
+            if (uri.scheme() == ice::stringid_hash(ice::Scheme_URN))
+            {
+                return resource->name() == uri.path();
+            }
+
+            ice::URI const& resource_uri = resource->uri();
+            return resource_uri.scheme() == uri.scheme()
+                && resource_uri.host() == uri.host()
+                && resource_uri.path() == uri.path();
+        }
+
+    } // namespace detail
+
     // Might need to be moved somewhere else?
     auto get_loose_resource(ice::ResourceHandle const& handle) noexcept -> ice::LooseResource const*
     {
@@ -47,7 +66,8 @@ namespace ice
         , _allocator{ alloc }
         , _allocator_data{ _allocator, "Data" }
         , _info{ info }
-        , _resources{ _allocator }
+        , _resources{ _allocator, info.predicted_resource_count }
+        , _resource_ids{ _allocator, info.predicted_resource_count * 2 }
         , _resource_providers{ _allocator }
         , _resource_writers{ _allocator }
         , _devui_widget{ }
@@ -57,15 +77,11 @@ namespace ice
             "Invalid value ({}) provided for 'predicted_resource_count'. Value needs to be a positive integer."
         );
 
-        ice::hashmap::reserve(_resources, _info.predicted_resource_count);
         ice::hashmap::reserve(_resource_providers, 12);
         ice::hashmap::reserve(_resource_writers, 4);
     }
 
-    ResourceTrackerImplementation::~ResourceTrackerImplementation() noexcept
-    {
-        ice::hashmap::clear(_resources);
-    }
+    ResourceTrackerImplementation::~ResourceTrackerImplementation() noexcept = default;
 
     auto ResourceTrackerImplementation::attach_provider(
         ice::UniquePtr<ice::ResourceProvider> provider
@@ -123,14 +139,32 @@ namespace ice
         ice::ResourceFlags flags
     ) const noexcept -> ice::ResourceHandle
     {
-        if (resource_uri.scheme() == ice::stringid_hash(ice::Scheme_URN))
+        // Identifiers are verified against the URI, so a different URI with the same identifier is never returned.
+        ice::Resource* const interned = _resource_ids.find_first_if(
+            ice::u64(ice::uri_id(resource_uri)),
+            [&resource_uri](ice::Resource const* resource) noexcept
+            {
+                return detail::resource_matches_uri(resource, resource_uri);
+            }
+        );
+        if (interned != nullptr)
         {
-            return find_resource_by_urn(resource_uri, flags);
+            return ice::ResourceHandle{ interned };
         }
-        else
+
+        // Non-normalized URIs are resolved each time, since we can't verify them when looking them up by identifier.
+        if (resource_uri.scheme() == ice::stringid_hash(ice::Scheme_URN))
         {
-            return find_resource_by_uri(resource_uri, flags);
+            return find_resource_by_urn(resource_uri, flags);
         }
+        return find_resource_by_uri(resource_uri, flags);
+    }
+
+    auto ResourceTrackerImplementation::find_resource(
+        ice::URIID uri_id
+    ) const noexcept -> ice::ResourceHandle
+    {
+        return ice::ResourceHandle{ _resource_ids.find_first(ice::u64(uri_id)) };
     }
 
     auto ResourceTrackerImplementation::find_resource_relative(
@@ -140,6 +174,7 @@ namespace ice
     {
         ICE_ASSERT(handle != nullptr, "Trying to set resource from invalid handle!");
 
+        // Relative URIs can't be verified without resolving them, only the resolved URI is looked up by identifier.
         ice::ResourceHandle result;
         ice::Resource const* resource = ice::internal_provider(handle)->resolve_relative_resource(uri, handle);
         if (resource != nullptr)
@@ -303,7 +338,7 @@ namespace ice
             );
 
             // TODO: Only save the new resource if it's not yet there.
-            ice::multi_hashmap::insert(_resources, ice::hash(resource->name()), resource);
+            track_resource(resource);
         }
 
         co_return ice::ResourceHandle{ resource };
@@ -346,24 +381,32 @@ namespace ice
             return;
         }
 
-        ice::ucount const new_count = ice::hashmap::count(_resources) + ice::array::count(out_resources);
-        ICE_ASSERT(
-            new_count <= _info.predicted_resource_count,
-            "Maximum resource capacity of {} entiries reached!",
-            _info.predicted_resource_count
+        ice::ucount const new_count = _resources.count() + ice::array::count(out_resources);
+        ICE_LOG_IF(
+            new_count > _info.predicted_resource_count,
+            LogSeverity::Warning, LogTag::Engine,
+            "Predicted resource count of {} exceeded, the resource index will grow to fit {} entries.",
+            _info.predicted_resource_count, new_count
         );
 
-        ice::hashmap::reserve(_resources, new_count);
-
-        // Store all resource handles
+        // Store all resource handles, lookups can happen at the same time.
         IPT_ZONE_SCOPED_NAMED("create_hash_entries");
         for (ice::Resource* resource : out_resources)
         {
-            ice::multi_hashmap::insert(
-                _resources,
-                ice::hash(resource->name()),
-                resource
-            );
+            track_resource(resource);
+        }
+    }
+
+    void ResourceTrackerImplementation::track_resource(ice::Resource* resource) noexcept
+    {
+        ice::URIID const uri_id = ice::uri_id(resource->uri());
+        ice::URIID const urn_id = ice::uri_id(ice::URI{ ice::Scheme_URN, resource->name() });
+
+        _resources.insert(ice::hash(resource->name()), resource);
+        _resource_ids.insert(ice::u64(uri_id), resource);
+        if (urn_id != uri_id)
+        {
+            _resource_ids.insert(ice::u64(urn_id), resource);
         }
     }
 
@@ -378,16 +421,8 @@ namespace ice
             resource_urn.scheme()
         );
 
-        ice::ResourceHandle result;
-        ice::u64 const hash_resouce = ice::hash(resource_urn.path());
-
         // Just grab the first for now
-        auto it = ice::multi_hashmap::find_first(_resources, hash_resouce);
-        if (it != nullptr)
-        {
-            result = ice::ResourceHandle{ it.value() };
-        }
-        return result;
+        return ice::ResourceHandle{ _resources.find_first(ice::hash(resource_urn.path())) };
     }
 
     auto ResourceTrackerImplementation::find_resource_by_uri(
@@ -395,7 +430,6 @@ namespace ice
         ice::ResourceFlags flags
     ) const noexcept -> ice::ResourceHandle
     {
-        ice::ResourceHandle handle;
         ice::Resource const* resource = nullptr;
         ice::ResourceProvider const* provider = nullptr;
 
@@ -404,22 +438,8 @@ namespace ice
             return {};
         }
 
-        // TODO: Remove this abomination, we only need to remove the const'ness in the 'find' functions for the resource object.
-        ice::u64 const hash_resouce = ice::hash(resource->name());
-        auto it = ice::multi_hashmap::find_first(_resources, hash_resouce);
-        while (it != nullptr && handle == nullptr)
-        {
-            if ((*it) == resource)
-            {
-                handle = ice::ResourceHandle{ *it };
-            }
-            else
-            {
-                it = ice::multi_hashmap::find_next(_resources, it);
-            }
-        }
-
-        return handle;
+        // The index returns the non-const resource object if the provider resource is tracked.
+        return ice::ResourceHandle{ _resources.find(ice::hash(resource->name()), resource) };
     }
 
     bool ResourceTrackerImplementation::find_resource_and_provider(
@@ -19,6 +19,7 @@
 #include <ice/devui_widget.hxx>
 
 #include "resource_internal.hxx"
+#include "resource_index.hxx"
 
 namespace ice
 {
@@ -144,6 +145,10 @@ namespace ice
             ice::ResourceFlags flags = ice::ResourceFlags::None
         ) const noexcept -> ice::ResourceHandle override;
 
+        auto find_resource(
+            ice::URIID uri_id
+        ) const noexcept -> ice::ResourceHandle override;
+
         auto find_resource_relative(
             ice::URI const& uri,
             ice::ResourceHandle const& resource_handle
@@ -205,6 +210,9 @@ namespace ice
             ice::ResourceProvider& provider
         ) noexcept;
 
+        //! \brief Stores the resource in the name index and interns both its URI and URN.
+        void track_resource(ice::Resource* resource) noexcept;
+
         auto find_resource_by_urn(
             ice::URI const& resoure_uri,
             ice::ResourceFlags flags
@@ -226,7 +234,10 @@ namespace ice
         ice::ProxyAllocator _allocator_data;
         ice::ResourceTrackerCreateInfo _info;
 
-        ice::HashMap<ice::Resource*> _resources;
+        ice::ResourceIndex _resources;
+
+        //! \brief Identifiers of the URI and URN of each tracked resource, assigned when resources are synchronized.
+        ice::ResourceIndex _resource_ids;
         ice::HashMap<ice::UniquePtr<ice::ResourceProvider>, ContainerLogic::Complex> _resource_providers;
         ice::HashMap<ice::ResourceWriter*> _resource_writers;
 
@@ -75,18 +75,19 @@ namespace ice
             ImGui::TableHeadersRow();
 
             ice::StaticString<64> temp_str{};
-            for (ice::Resource* handle : _tracker._resources)
-            {
-                ImGui::TableNextRow();
-                ImGui::TableNextColumn();
-                ImGui::TextUnformatted(ice::string::begin(handle->name()), ice::string::end(handle->name()));
-
-                if (ImGui::TableNextColumn())
+            _tracker._resources.for_each([&temp_str](ice::Resource* handle) noexcept
                 {
-                    detail::status_flags_string(ice::internal_status(handle), temp_str);
-                    ImGui::Text(ice::string::begin(temp_str), ice::string::end(temp_str));
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(ice::string::begin(handle->name()), ice::string::end(handle->name()));
+
+                    if (ImGui::TableNextColumn())
+                    {
+                        detail::status_flags_string(ice::internal_status(handle), temp_str);
+                        ImGui::Text(ice::string::begin(temp_str), ice::string::end(temp_str));
+                    }
                 }
-            }
+            );
 
             ImGui::EndTable();
         }
@@ -21,6 +21,11 @@ namespace ice
 
         virtual auto name() const noexcept -> ice::String = 0;
         virtual auto origin() const noexcept -> ice::String = 0;
+
+        //! \brief Key describing where the resource is placed in its storage, reading resources in ascending order
+        //!   avoids seeking back and forth in packed files.
+        //! \note Resources without a meaningful storage order (ex.: loose files) return '0'.
+        virtual auto storage_order() const noexcept -> ice::u64 { return 0; }
     };
 
     //! \todo Rethink how loose resources and their named parts can be accessed.
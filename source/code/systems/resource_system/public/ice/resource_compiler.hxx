@@ -9,4 +9,14 @@ namespace ice
 
     using ResourceCompiler = ice::api::resource_compiler::v1::ResourceCompilerAPI;
 
+    //! \brief Metadata key under which dependency edges of a compiled resource are stored.
+    static constexpr ice::String Constant_ResourceMeta_Dependencies = "asset.dependencies";
+
+    //! \brief Stores the paths of all dependencies collected for a resource in its metadata.
+    //! \details Allows the runtime to walk the dependency graph of baked assets without running the compiler again.
+    void resource_compiler_write_dependencies(
+        ice::ConfigBuilder& out_metadata,
+        ice::Span<ice::URI const> dependencies
+    ) noexcept;
+
 } // namespace ice
@@ -172,3 +172,7 @@ namespace ice
     } // namespace api::resource_compiler::v1
 
 } // namespace ice
+
+//! \brief Allows to pass schedulers as compiler parameters, so compilers can split their work into tasks.
+template<>
+constexpr inline ice::ShardPayloadID ice::Constant_ShardPayloadID<ice::TaskScheduler*> = ice::shard_payloadid("ice::TaskScheduler*");
@@ -31,10 +31,10 @@ namespace ice
     {
         //! \brief The number of resources that should be tracked.
         //!
-        //! \detail To avoid locking and complex mutli-threading logic this tracker pre-allocates a hashmap used to store resource handles.
-        //!     This comes with a small up-front cost in memory but is generally neglible compared to the gains in simplicity and performance.
-        //!     This value can be generous during development and can be toned down later. I
-        //!     If you have trackers that update or provide new resources during the application lifetime, please increase the count for them.
+        //! \detail Resources are stored in a sharded index which allows lookups while providers add or remove resources.
+        //!     The index is pre-allocated for the given number of resources and grows if more resources are added,
+        //!     growing is cheap but replaced storage is only released with the tracker. Storage is doubled on each growth,
+        //!     so replaced storage never takes more memory than the current one.
         //!
         //! \note Setting this value is required and can be easily overestimated during development. Later it can be toned down.
         ice::u32 predicted_resource_count = 10'000;
@@ -77,6 +77,13 @@ namespace ice
             ice::ResourceFlags flags = ice::ResourceFlags::None
         ) const noexcept -> ice::ResourceHandle = 0;
 
+        //! \brief Finds a resource using an interned URI identifier, created with 'ice::uri_id'.
+        //! \note Only the URI and URN of each resource synchronized by the tracker are known.
+        //! \note The identifier can't be verified against the full URI, prefer passing the URI if it's available.
+        virtual auto find_resource(
+            ice::URIID uri_id
+        ) const noexcept -> ice::ResourceHandle = 0;
+
         virtual auto find_resource_relative(
             ice::URI const& uri,
             ice::ResourceHandle const& resource_handle
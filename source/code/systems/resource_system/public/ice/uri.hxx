@@ -15,6 +15,14 @@ namespace ice
 
     static constexpr ice::StringID Scheme_Invalid = "<invalid>"_sid;
 
+    //! \brief Interned identifier of an URI, calculated from it's scheme, host and path.
+    //! \details Identifiers are stable between runs, so they can be calculated at compile time and stored in data.
+    //!   Lookups using identifiers don't need to parse, normalize or allocate any strings.
+    enum class URIID : ice::u64
+    {
+        Invalid = 0
+    };
+
     struct URI
     {
         constexpr URI() noexcept;
@@ -314,6 +322,17 @@ namespace ice
     }
 
     // Helpers
+    constexpr auto uri_id(ice::URI const& uri) noexcept -> ice::URIID
+    {
+        // Combine the values, so the same path with different schemes or hosts results in different identifiers.
+        ice::u64 result = ice::hash_combine(ice::hash(uri.path()), ice::hash(uri.scheme()));
+        if (uri._authority > 0)
+        {
+            result = ice::hash_combine(result, ice::hash(uri.host()));
+        }
+        return result == 0 ? ice::URIID{ 1 } : ice::URIID{ result };
+    }
+
     constexpr auto operator""_uri(char const* raw_uri, std::size_t length) noexcept -> ice::URI
     {
         return URI{ ice::String{ raw_uri, ice::ucount(length) } };
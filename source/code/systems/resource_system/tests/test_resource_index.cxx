@@ -0,0 +1,65 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/mem_allocator_host.hxx>
+
+#include "../private/resource_index.hxx"
+
+SCENARIO("resource_system 'resource index'", "[resource][index]")
+{
+    ice::HostAllocator alloc{ };
+    ice::ResourceIndex index{ alloc, 16 };
+
+    // The index never accesses the resource objects, so we can use fake pointers.
+    auto const fake_resource = [](ice::uptr value) noexcept
+    {
+        return reinterpret_cast<ice::Resource*>(value * 16);
+    };
+
+    GIVEN("multiple resources stored under the same hash")
+    {
+        index.insert(42, fake_resource(1));
+        index.insert(42, fake_resource(2));
+        index.insert(42, fake_resource(3));
+
+        THEN("the first inserted resource is returned")
+        {
+            CHECK(index.find_first(42) == fake_resource(1));
+            CHECK(index.find_first(24) == nullptr);
+        }
+
+        THEN("resources rejected by the predicate are skipped")
+        {
+            ice::Resource* const result = index.find_first_if(
+                42, [&](ice::Resource const* resource) noexcept { return resource != fake_resource(1); }
+            );
+            CHECK(result == fake_resource(2));
+            CHECK(index.find_first_if(42, [](ice::Resource const*) noexcept { return false; }) == nullptr);
+        }
+    }
+
+    GIVEN("more resources than the index was created for")
+    {
+        for (ice::u64 idx = 1; idx <= 1000; ++idx)
+        {
+            index.insert(idx << 32 | idx, fake_resource(idx));
+        }
+        index.insert(1ull << 32 | 1, fake_resource(1001));
+
+        THEN("all resources can be found")
+        {
+            CHECK(index.count() == 1001);
+            for (ice::u64 idx = 1; idx <= 1000; ++idx)
+            {
+                CHECK(index.find(idx << 32 | idx, fake_resource(idx)) == fake_resource(idx));
+            }
+        }
+
+        THEN("the insertion order is kept")
+        {
+            CHECK(index.find_first(1ull << 32 | 1) == fake_resource(1));
+            CHECK(index.find(1ull << 32 | 1, fake_resource(1001)) == fake_resource(1001));
+        }
+    }
+}
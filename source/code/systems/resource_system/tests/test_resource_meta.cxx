@@ -6,6 +6,7 @@
 #include <ice/config/config_builder.hxx>
 #include <ice/container/hashmap.hxx>
 #include <ice/mem_allocator_host.hxx>
+#include <ice/resource_compiler.hxx>
 
 namespace Catch
 {
@@ -150,6 +151,27 @@ SCENARIO("resource_system 'ice/resource_meta.hxx'", "[resource][metadata]")
             alloc.deallocate(configmem);
         }
 
+        THEN("we can store resource dependencies")
+        {
+            ice::URI const test_dependencies[]{
+                ice::URI{ ice::Scheme_URN, "tiles/grass.png" },
+                ice::URI{ ice::Scheme_URN, "shaders/color.vert" },
+            };
+
+            ice::resource_compiler_write_dependencies(meta, test_dependencies);
+
+            ice::Memory configmem = meta.finalize(alloc);
+            ice::Config const cfg = ice::config::from_data(ice::data_view(configmem));
+
+            ice::Array<ice::String> meta_dependencies{ alloc };
+            CHECK(ice::config::get_array(cfg, ice::Constant_ResourceMeta_Dependencies, meta_dependencies) == ice::S_Ok);
+            REQUIRE(ice::array::count(meta_dependencies) == 2);
+            CHECK(meta_dependencies[0] == "tiles/grass.png");
+            CHECK(meta_dependencies[1] == "shaders/color.vert");
+
+            alloc.deallocate(configmem);
+        }
+
 #if 0
         THEN("we can set array values")
         {
@@ -0,0 +1,272 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/mem_allocator_host.hxx>
+#include <ice/task_utils.hxx>
+
+#include "../private/resource_read_scheduler.hxx"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+
+    using ice::operator""_B;
+    using ice::operator""_KiB;
+    using ice::operator""_MiB;
+
+    static constexpr ice::usize Constant_TestFileSize = 12_MiB;
+
+    //! \returns Value of the byte stored at the given offset of the test file.
+    //! \note Uses a prime modulo, so data at different offsets rarely matches by accident.
+    constexpr auto test_byte(ice::usize::base_type offset) noexcept -> ice::u8
+    {
+        return ice::u8(offset % 251);
+    }
+
+    struct TestFile
+    {
+        std::string path;
+
+        TestFile() noexcept
+        {
+            std::error_code ec;
+            path = (std::filesystem::temp_directory_path(ec) / "iceshard_read_scheduler_tests.bin").string();
+
+            std::vector<char> data(Constant_TestFileSize.value);
+            for (ice::usize::base_type idx = 0; idx < data.size(); ++idx)
+            {
+                data[idx] = char(test_byte(idx));
+            }
+
+            std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+            file.write(data.data(), data.size());
+        }
+
+        ~TestFile() noexcept
+        {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+    };
+
+    struct TestRead
+    {
+        ice::usize offset;
+        ice::usize size;
+    };
+
+    struct TestReadResult
+    {
+        ice::Memory memory;
+        ice::usize bytes_read;
+        bool completed;
+    };
+
+    auto read_request(
+        ice::ResourceReadScheduler& scheduler,
+        ice::usize offset,
+        TestReadResult& result
+    ) noexcept -> ice::Task<>
+    {
+        result.bytes_read = co_await scheduler.read(offset, result.memory);
+        result.completed = true;
+    }
+
+    //! \brief Issues all reads while the scheduler is busy with a first read, so they are dispatched as a single batch.
+    //! \returns Statistics of the batch, without the first read.
+    auto read_batch(
+        ice::Allocator& alloc,
+        ice::native_aio::AIOPort aioport,
+        ice::ResourceReadScheduler& scheduler,
+        ice::Span<TestRead const> reads
+    ) noexcept -> ice::ResourceReadStats
+    {
+        std::vector<TestReadResult> results(ice::count(reads) + 1);
+        for (ice::u32 idx = 0; idx < ice::count(reads); ++idx)
+        {
+            results[idx + 1].memory = alloc.allocate(reads[idx].size);
+        }
+
+        // The first read is dispatched immediately and keeps the scheduler busy until we process the AIO port.
+        results[0].memory = alloc.allocate(16_B);
+        ice::execute_task(read_request(scheduler, 0_B, results[0]));
+        for (ice::u32 idx = 0; idx < ice::count(reads); ++idx)
+        {
+            ice::execute_task(read_request(scheduler, reads[idx].offset, results[idx + 1]));
+        }
+
+        // All other requests are waiting for the first read to complete.
+        ice::ResourceReadStats const pending_stats = scheduler.stats();
+        CHECK(pending_stats.reads == 1);
+        CHECK(pending_stats.queue_depth == ice::count(reads));
+
+        ice::u32 remaining_steps = 128;
+        auto const is_completed = [](TestReadResult const& result) noexcept { return result.completed; };
+        while (std::all_of(results.begin(), results.end(), is_completed) == false && remaining_steps > 0)
+        {
+            ice::native_aio::aio_process_events(aioport, { .timeout_ms = 10, .events_max = 1 });
+            remaining_steps -= 1;
+        }
+        bool const all_completed = std::all_of(results.begin(), results.end(), is_completed);
+        CHECK(all_completed);
+        if (all_completed == false)
+        {
+            return { }; // The memory is still referenced by pending requests, so we can't release it.
+        }
+
+        CHECK(results[0].bytes_read == results[0].memory.size);
+        alloc.deallocate(results[0].memory);
+
+        for (ice::u32 idx = 0; idx < ice::count(reads); ++idx)
+        {
+            TestReadResult const& result = results[idx + 1];
+            CHECK(result.bytes_read == reads[idx].size);
+
+            ice::u8 const* const data = reinterpret_cast<ice::u8 const*>(result.memory.location);
+            ice::u32 mismatches = 0;
+            for (ice::usize::base_type byte = 0; byte < reads[idx].size.value; ++byte)
+            {
+                mismatches += ice::u32(data[byte] != test_byte(reads[idx].offset.value + byte));
+            }
+            CHECK(mismatches == 0);
+
+            alloc.deallocate(result.memory);
+        }
+
+        ice::ResourceReadStats stats = scheduler.stats();
+        stats.requests -= 1;
+        stats.reads -= 1;
+        stats.bytes_requested = ice::usize::subtract(stats.bytes_requested, results[0].memory.size);
+        stats.bytes_read = ice::usize::subtract(stats.bytes_read, results[0].bytes_read);
+        return stats;
+    }
+
+} // namespace
+
+SCENARIO("resource_system 'resource read scheduler'", "[resource][read_scheduler]")
+{
+    using ice::ResourceReadScheduler;
+
+    ice::HostAllocator alloc{ };
+    TestFile const test_file{ };
+
+    ice::native_aio::AIOPort const aioport = ice::native_aio::aio_open(alloc, { .worker_limit = 1, .debug_name = "read_scheduler_tests" });
+    REQUIRE(aioport != nullptr);
+
+    ice::Expected<ice::native_file::File> file = ice::native_file::open_file(aioport, ice::String{ test_file.path });
+    REQUIRE(file.succeeded());
+
+    ice::ResourceReadScheduler scheduler{ alloc, file.value(), aioport };
+
+    GIVEN("a single request")
+    {
+        TestRead const reads[]{ { 1_MiB, 4_KiB } };
+
+        THEN("it's read directly")
+        {
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.requests == 1);
+            CHECK(stats.reads == 1);
+            CHECK(stats.bytes_read == 4_KiB);
+        }
+    }
+
+    GIVEN("adjacent requests in reverse file order")
+    {
+        TestRead const reads[]{ { 1_MiB + 8_KiB, 4_KiB }, { 1_MiB + 4_KiB, 4_KiB }, { 1_MiB, 4_KiB } };
+
+        THEN("they are merged into a single read")
+        {
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.requests == 3);
+            CHECK(stats.reads == 1);
+            CHECK(stats.bytes_requested == 12_KiB);
+            CHECK(stats.bytes_read == 12_KiB);
+            CHECK(stats.queue_depth == 0);
+            CHECK(stats.queue_depth_max == 3);
+        }
+    }
+
+    GIVEN("overlapping requests")
+    {
+        TestRead const reads[]{ { 1_MiB, 8_KiB }, { 1_MiB + 2_KiB, 4_KiB }, { 1_MiB + 6_KiB, 6_KiB } };
+
+        THEN("the overlapping bytes are only read once")
+        {
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.reads == 1);
+            CHECK(stats.bytes_requested == 18_KiB);
+            CHECK(stats.bytes_read == 12_KiB);
+        }
+    }
+
+    GIVEN("requests with gaps between them")
+    {
+        ice::usize const max_gap = ResourceReadScheduler::Constant_MaxMergeGap;
+
+        THEN("requests separated by the maximum gap are merged")
+        {
+            TestRead const reads[]{ { 1_MiB, 4_KiB }, { 1_MiB + 4_KiB + max_gap, 4_KiB } };
+
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.reads == 1);
+            CHECK(stats.bytes_read == 8_KiB + max_gap);
+        }
+
+        THEN("requests separated by a larger gap are read separately")
+        {
+            TestRead const reads[]{ { 1_MiB, 4_KiB }, { 1_MiB + 4_KiB + max_gap + 1_B, 4_KiB } };
+
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.reads == 2);
+            CHECK(stats.bytes_read == 8_KiB);
+        }
+
+        THEN("only requests close to each other are merged")
+        {
+            TestRead const reads[]{ { 1_MiB, 4_KiB }, { 1_MiB + 8_KiB, 4_KiB }, { 4_MiB, 4_KiB }, { 4_MiB + 4_KiB, 4_KiB } };
+
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.reads == 2);
+            CHECK(stats.bytes_read == 20_KiB);
+        }
+    }
+
+    GIVEN("requests exceeding the maximum merged read size")
+    {
+        ice::usize const max_read = ResourceReadScheduler::Constant_MaxMergedReadSize;
+
+        THEN("a single oversized request is still read in one go")
+        {
+            TestRead const reads[]{ { 1_MiB, max_read + 1_MiB } };
+
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.reads == 1);
+            CHECK(stats.bytes_read == max_read + 1_MiB);
+        }
+
+        THEN("requests after an oversized request are not merged with it")
+        {
+            TestRead const reads[]{ { 1_MiB, max_read + 1_MiB }, { 1_MiB + max_read + 1_MiB, 4_KiB } };
+
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.reads == 2);
+        }
+
+        THEN("adjacent requests are split once the merged read would be too large")
+        {
+            TestRead const reads[]{ { 1_MiB, 2_MiB }, { 3_MiB, 2_MiB }, { 5_MiB, 2_MiB } };
+
+            ice::ResourceReadStats const stats = read_batch(alloc, aioport, scheduler, reads);
+            CHECK(stats.reads == 2);
+            CHECK(stats.bytes_read == 6_MiB);
+        }
+    }
+
+    ice::native_aio::aio_close(aioport);
+}
@@ -0,0 +1,49 @@
+/// Copyright 2025 - 2025, Dandielo <dandielo@iceshard.net>
+/// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_test_macros.hpp>
+#include <ice/uri.hxx>
+
+SCENARIO("resource_system 'ice/uri.hxx' (identifiers)", "[resource][uri]")
+{
+    using ice::operator""_uri;
+
+    GIVEN("a URN and a file URI with the same path")
+    {
+        constexpr ice::URI urn = "urn:models/box.glb"_uri;
+        constexpr ice::URI file = "file:models/box.glb"_uri;
+
+        THEN("identifiers can be calculated at compile time")
+        {
+            constexpr ice::URIID urn_id = ice::uri_id(urn);
+            STATIC_REQUIRE(urn_id != ice::URIID::Invalid);
+        }
+
+        THEN("identifiers are stable")
+        {
+            CHECK(ice::uri_id(urn) == ice::uri_id("urn:models/box.glb"_uri));
+            CHECK(ice::uri_id(urn) == ice::uri_id(ice::URI{ ice::Scheme_URN, "models/box.glb" }));
+        }
+
+        THEN("schemes are part of the identifier")
+        {
+            CHECK(ice::uri_id(urn) != ice::uri_id(file));
+        }
+    }
+
+    GIVEN("two file URIs with different hosts")
+    {
+        constexpr ice::URI first = "file://first/data/box.glb"_uri;
+        constexpr ice::URI second = "file://second/data/box.glb"_uri;
+
+        THEN("hosts are part of the identifier")
+        {
+            CHECK(ice::uri_id(first) != ice::uri_id(second));
+        }
+
+        THEN("query and fragment parts are ignored")
+        {
+            CHECK(ice::uri_id(first) == ice::uri_id("file://first/data/box.glb?lod=1#mesh"_uri));
+        }
+    }
+}
@@ -51,16 +51,31 @@ namespace ice
         _stack = ice::addressof(world_update.engine.actions());
 
         ice::AssetStorage& assets = world_update.assets;
+
+        // Bakes the script together with all assets it depends on, before we access it.
+        //  The preloaded assets are kept until we are done, so their data isn't released in the meantime.
+        ice::AssetPreloadRoot const preload_roots[]{
+            { ice::AssetCategory_InputActionsScript, "core/example_input_actions" }
+        };
+        ice::Array<ice::Asset> preloaded{ _allocator };
+        co_await assets.preload(preload_roots, AssetState::Baked, preloaded);
+
         ice::Asset script = assets.bind(ice::AssetCategory_InputActionsScript, "core/example_input_actions");
         if (script.valid() == false)
         {
             co_return;
         }
 
-        ice::Data const data = co_await script[AssetState::Raw];
-        if (data.location != nullptr)
+        // Prefer the baked layers, falling back to parsing the script if they are not available.
+        ice::Data const baked_data = co_await script[AssetState::Baked];
+        _layers = ice::load_input_action_layers(_allocator, baked_data);
+        if (ice::array::empty(_layers))
         {
-            _layers = ice::parse_input_action_layer(_allocator, ice::string::from_data(data));
+            ice::Data const data = co_await script[AssetState::Raw];
+            if (data.location != nullptr)
+            {
+                _layers = ice::parse_input_action_layer(_allocator, ice::string::from_data(data));
+            }
         }
 
 
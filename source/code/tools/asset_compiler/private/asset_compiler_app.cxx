@@ -373,6 +373,9 @@ public:
                 return 1;
             }
 
+            // Store dependency edges so the asset graph can be walked when preloading
+            ice::resource_compiler_write_dependencies(meta, dependencies);
+
             // Build the final asset object
             ice::Memory const final_asset_data = resource_compiler->fn_finalize(ctx, res, results, dependencies, _allocator);
             if (final_asset_data.location == nullptr)
@@ -8,18 +8,22 @@
 #include <ice/task_thread_utils.hxx>
 #include <ice/task_thread_pool.hxx>
 #include <ice/task_utils.hxx>
+#include <ice/task_queue.hxx>
 #include <ice/tool_app.hxx>
 #include <ice/config.hxx>
 #include <ice/config/config_builder.hxx>
+#include <ice/container/hashmap.hxx>
 #include <ice/sort.hxx>
 #include <ice/uri.hxx>
 
 #include <hailstorm/hailstorm_operations.hxx>
+#include <cstring>
 
 #include "hsc_packer_app.hxx"
 #include "hsc_packer_aiostream.hxx"
 
 using ice::operator""_sid;
+using ice::operator""_B;
 using hailstorm::v1::HailstormChunk;
 using hailstorm::v1::HailstormWriteChunkRef;
 
@@ -37,6 +41,14 @@ auto create_chunk_loose_resource(
     return base_chunk;
 }
 
+//! \brief Last selected chunks, so we don't need to search all chunks for every resource.
+struct HSCPChunkSelection
+{
+    ice::u16 data_chunk = ice::u16_max;
+    ice::u16 meta_chunk = ice::u16_max;
+    ice::u32 checked_chunks = 0;
+};
+
 auto select_chunk_loose_resource(
     hailstorm::Data resource_meta,
     hailstorm::Data resource_data,
@@ -46,43 +58,80 @@ auto select_chunk_loose_resource(
     void* userdata
 ) noexcept -> HailstormWriteChunkRef
 {
-    HailstormWriteChunkRef result{
-        .data_chunk = ice::u16_max,
-        .meta_chunk = ice::u16_max,
-    };
+    HSCPChunkSelection& selection = *reinterpret_cast<HSCPChunkSelection*>(userdata);
 
-    auto it = chunks.rbegin();
-    auto const end = chunks.rend();
-    while (it != end && (result.data_chunk == ice::u16_max || result.meta_chunk == ice::u16_max))
+    // Chunks are only ever appended, so we only need to check the ones created since the last call.
+    //  Later chunks of the same type always take precedence.
+    ice::u32 const chunk_count = ice::u32(chunks.size());
+    for (ice::u32 idx = selection.checked_chunks; idx < chunk_count; ++idx)
     {
-        if (it->type == 1 && result.meta_chunk == ice::u16_max)
+        if (chunks[idx].type == 1)
         {
-            result.meta_chunk = ice::u16(std::distance(it, end) - 1);
+            selection.meta_chunk = ice::u16(idx);
         }
-        else if (it->type == 2 && result.data_chunk == ice::u16_max)
+        else if (chunks[idx].type == 2)
         {
-            result.data_chunk = ice::u16(std::distance(it, end) - 1);
+            selection.data_chunk = ice::u16(idx);
         }
-
-        it += 1;
     }
+    selection.checked_chunks = chunk_count;
 
-    ICE_ASSERT_CORE(result.data_chunk != ice::u16_max && result.meta_chunk != ice::u16_max);
-    return result;
+    ICE_ASSERT_CORE(selection.data_chunk != ice::u16_max && selection.meta_chunk != ice::u16_max);
+    return HailstormWriteChunkRef{
+        .data_chunk = selection.data_chunk,
+        .meta_chunk = selection.meta_chunk,
+    };
 }
 
-auto read_resource_size(
+//! \brief Maximum size of resource data loaded and waiting to be deduplicated at the same time.
+static constexpr ice::usize Constant_MaxInflightData = 64_MiB;
+
+//! \brief Maximum size of loaded resource data kept in memory until it's written.
+//! \note Resources over this limit are unloaded after deduplication and loaded again by the writer.
+static constexpr ice::usize Constant_MaxRetainedData = 256_MiB;
+
+auto read_resource_payload(
+    ice::ResourceTracker& tracker,
     ice::ResourceHandle const& resource_handle,
-    hailstorm::Data& out_data,
-    std::atomic_uint32_t& out_processed
+    ice::TaskScheduler& completion_scheduler,
+    ice::Data& out_payload,
+    ice::u64& out_hash,
+    bool& out_finished
 ) noexcept -> ice::Task<>
 {
-    ice::LooseResource const* const resource = ice::get_loose_resource(resource_handle);
-    out_data.size = resource->size().value;
-    out_data.align = 8;
-    out_data.location = nullptr;
-    out_processed.fetch_add(1, std::memory_order_relaxed);
-    co_return;
+    ice::ResourceResult const load_result = co_await tracker.load_resource(resource_handle);
+    if (load_result.resource_status == ice::ResourceStatus::Loaded)
+    {
+        out_payload = load_result.data;
+        out_hash = ice::hash(std::string_view{ (char const*)out_payload.location, out_payload.size.value });
+    }
+
+    // Results are processed on the packer thread, which is waiting on the completion queue.
+    co_await completion_scheduler;
+    out_finished = true;
+}
+
+//! \brief Compares the payload with the one of an already processed resource, loading it again if it was not retained.
+bool is_same_payload(
+    ice::ResourceTracker& tracker,
+    ice::ResourceHandle const& original_handle,
+    ice::Data original_payload,
+    ice::Data payload
+) noexcept
+{
+    if (original_payload.location != nullptr)
+    {
+        return std::memcmp(original_payload.location, payload.location, payload.size.value) == 0;
+    }
+
+    bool result = false;
+    ice::ResourceResult const load_result = ice::wait_for_result(tracker.load_resource(original_handle));
+    if (load_result.resource_status == ice::ResourceStatus::Loaded && load_result.data.size == payload.size)
+    {
+        result = std::memcmp(load_result.data.location, payload.location, payload.size.value) == 0;
+    }
+    ice::wait_for_result(tracker.unload_resource(original_handle));
+    return result;
 }
 
 inline auto hsdata_view(ice::Memory mem) noexcept -> hailstorm::Data
@@ -282,11 +331,17 @@ public:
         ice::Array<ice::u32> resource_metamap{ _allocator };
         ice::Array<ice::ResourceHandle> resource_handles{ _allocator };
         ice::Array<std::string_view> resource_paths{ _allocator };
+        ice::Array<ice::u64> resource_hashes{ _allocator };
+        ice::Array<ice::u32> resource_duplicates{ _allocator };
 
         ice::array::resize(resource_data, ice::count(resources));
         ice::array::resize(resource_metamap, ice::count(resources));
         ice::array::resize(resource_handles, ice::count(resources));
         ice::array::resize(resource_paths, ice::count(resources));
+        ice::array::resize(resource_hashes, ice::count(resources));
+
+        // Maps metadata hashes to indices in the 'resource_metas' array.
+        ice::HashMap<ice::u32> unique_metas{ _allocator };
 
         // We serialize an empty meta object
         ice::ConfigBuilder meta{ _allocator };
@@ -294,7 +349,76 @@ public:
 
         //ice::array::push_back(resource_metas, hsdata_view(metamem));
 
-        std::atomic_uint32_t res_count = 0;
+        // Loads report back through this queue, so results are deduplicated in order on the packer thread.
+        ice::TaskQueue completion_queue{ };
+        ice::TaskScheduler completion_scheduler{ completion_queue };
+
+        ice::Array<ice::Data> resource_payloads{ _allocator };
+        ice::Array<bool> resource_finished{ _allocator };
+        ice::array::resize(resource_payloads, ice::count(resources));
+        ice::array::resize(resource_finished, ice::count(resources));
+        ice::array::resize(resource_duplicates, ice::count(resources));
+
+        // Maps payload hashes to the first resource with that payload.
+        ice::HashMap<ice::u32> unique_payloads{ _allocator };
+
+        ice::usize inflight_size = 0_B;
+        ice::usize retained_size = 0_B;
+        ice::u32 duplicate_count = 0;
+        ice::usize duplicate_size = 0_B;
+        ice::u32 processed_idx = 0;
+
+        auto const fn_process_finished = [&](ice::u32 end_idx) noexcept
+        {
+            completion_queue.wait_any();
+            completion_queue.process_all();
+
+            // Resources are processed in order, so the same input always results in the same pack.
+            for (; processed_idx < end_idx && resource_finished[processed_idx]; ++processed_idx)
+            {
+                ice::u32 const idx = processed_idx;
+                ice::Data const payload = resource_payloads[idx];
+                resource_duplicates[idx] = idx;
+                inflight_size = ice::usize::subtract(inflight_size, ice::usize{ resource_data[idx].size });
+
+                // Resources we failed to load are never treated as duplicates.
+                if (payload.location == nullptr || payload.size == 0_B)
+                {
+                    continue;
+                }
+
+                ice::u32 const original_idx = ice::hashmap::get(unique_payloads, resource_hashes[idx], ice::u32_max);
+                bool const duplicate = original_idx != ice::u32_max
+                    && resource_data[original_idx].size == payload.size.value
+                    && is_same_payload(tracker, resource_handles[original_idx], resource_payloads[original_idx], payload);
+
+                if (duplicate)
+                {
+                    resource_duplicates[idx] = original_idx;
+                    duplicate_size += payload.size;
+                    duplicate_count += 1;
+
+                    // No space will be reserved for this resource, the header entry is patched during writing.
+                    resource_data[idx].size = 0;
+                }
+                else if (original_idx == ice::u32_max)
+                {
+                    ice::hashmap::set(unique_payloads, resource_hashes[idx], idx);
+                }
+
+                // Unique payloads are kept for the writer, as long as they fit into the budget.
+                if (duplicate == false && retained_size + payload.size <= Constant_MaxRetainedData)
+                {
+                    retained_size += payload.size;
+                }
+                else
+                {
+                    resource_payloads[idx] = { };
+                    ice::wait_for_result(tracker.unload_resource(resource_handles[idx]));
+                }
+            }
+        };
+
         ice::u32 res_idx = 0;
         for (ice::Resource* resource : resources)
         {
@@ -303,32 +427,74 @@ public:
                 //ice::Metadata m = ice::meta_load(md);
 
                 resource_paths[res_idx] = resource->name();
-                resource_metamap[res_idx] = res_idx;
                 resource_handles[res_idx] = tracker.find_resource(resource->uri());
 
                 ice::Data md;
                 ice::wait_for_result(ice::resource_meta(resource_handles[res_idx], md));
-                ice::array::push_back(resource_metas, hsdata_view(md));
+
+                // Identical metadata is only stored once.
+                ice::u64 const meta_hash = ice::hash(std::string_view{ (char const*)md.location, md.size.value });
+                ice::u32 const meta_idx = ice::hashmap::get(unique_metas, meta_hash, ice::u32_max);
+                bool const same_meta = meta_idx != ice::u32_max
+                    && resource_metas[meta_idx].size == md.size.value
+                    && std::memcmp(resource_metas[meta_idx].location, md.location, md.size.value) == 0;
+                if (same_meta == false)
+                {
+                    resource_metamap[res_idx] = ice::array::count(resource_metas);
+                    ice::hashmap::set(unique_metas, meta_hash, resource_metamap[res_idx]);
+                    ice::array::push_back(resource_metas, hsdata_view(md));
+                }
+                else
+                {
+                    resource_metamap[res_idx] = meta_idx;
+                }
+
+                ice::usize const resource_size = ice::get_loose_resource(resource_handles[res_idx])->size();
+                resource_data[res_idx] = { nullptr, resource_size.value, 8 };
+
+                // Don't load more data than allowed at the same time.
+                while (inflight_size > 0_B && inflight_size + resource_size > Constant_MaxInflightData)
+                {
+                    fn_process_finished(res_idx);
+                }
+                inflight_size += resource_size;
 
                 ice::schedule_task(
-                    read_resource_size(resource_handles[res_idx], resource_data[res_idx], res_count),
+                    read_resource_payload(
+                        tracker,
+                        resource_handles[res_idx],
+                        completion_scheduler,
+                        resource_payloads[res_idx],
+                        resource_hashes[res_idx],
+                        resource_finished[res_idx]
+                    ),
                     _tsched
                 );
                 res_idx += 1;
             }
         }
 
-        // Once the task is scheduled we are now going to iterate over the queue untill
-        //  the event is signalled which means all required resources where loaded.
-        while (res_count.load(std::memory_order_relaxed) != res_idx)
+        while (processed_idx < res_idx)
         {
-            using ice::operator""_Tms;
-            ice::current_thread::sleep(1_Tms);
+            fn_process_finished(res_idx);
         }
 
         ice::array::resize(resource_paths, res_idx);
         ice::array::resize(resource_data, res_idx);
         ice::array::resize(resource_metamap, res_idx);
+        ice::array::resize(resource_payloads, res_idx);
+        ice::array::resize(resource_duplicates, res_idx);
+
+        HSCP_LOG_IF(
+            duplicate_count > 0,
+            "Deduplicated {} resources, saving {} bytes.",
+            duplicate_count, duplicate_size.value
+        );
+        HSCP_LOG_IF(
+            ice::array::count(resource_metas) < res_idx,
+            "Deduplicated {} resource metadata entries.",
+            res_idx - ice::array::count(resource_metas)
+        );
 
         hailstorm::v1::HailstormWriteData const hsdata{
             .paths = resource_paths,
@@ -340,12 +506,17 @@ public:
 
         ice::native_file::HeapFilePath output{ _allocator };
         ice::native_file::path_from_string(output, _param_output);
+        HSCPChunkSelection chunk_selection{ };
         HSCPWriteParams const write_params{
             .filename = output,
             .aioport = _aioport,
             .task_scheduler = _tsched,
             .fn_chunk_selector = select_chunk_loose_resource,
             .fn_chunk_create = create_chunk_loose_resource,
+            .ud_chunk_selector = &chunk_selection,
+            .max_inflight_data = Constant_MaxInflightData,
+            .resource_duplicates = duplicate_count > 0 ? ice::Span<ice::u32 const>{ resource_duplicates } : ice::Span<ice::u32 const>{ },
+            .resource_payloads = resource_payloads,
         };
         bool const success = hscp_write_hailstorm_file(_allocator, write_params, hsdata, tracker, resource_handles);
 
@@ -6,10 +6,13 @@
 
 #include <ice/task.hxx>
 #include <ice/task_utils.hxx>
-#include <ice/task_thread_utils.hxx>
+#include <ice/task_queue.hxx>
+#include <ice/task_scheduler.hxx>
 #include <ice/resource_tracker.hxx>
+#include <ice/mem_utils.hxx>
 
 using ice::LogSeverity;
+using ice::operator""_B;
 
 struct HailstormAllocator final : hailstorm::Allocator
 {
@@ -33,6 +36,7 @@ struct HailstormAllocator final : hailstorm::Allocator
 
 struct HailstormAIOWriter
 {
+    ice::Allocator& _allocator;
     ice::native_file::FilePath _filepath{};
     ice::native_file::File _file{};
     ice::native_aio::AIOPort _aioport;
@@ -40,23 +44,36 @@ struct HailstormAIOWriter
 
     ice::ResourceTracker& _resource_tracker;
     ice::Span<ice::ResourceHandle> _resources;
+    ice::Span<ice::u32 const> _duplicates;
+    ice::Span<ice::Data const> _payloads;
 
-    std::atomic_uint32_t _started_writes;
-    std::atomic_uint32_t _finished_loads;
-    std::atomic_uint32_t _finished_writes;
+    ice::usize _max_inflight_data;
+
+    //! \brief Finished writes are resumed on this queue, so the counters below are only accessed from the writing thread.
+    ice::TaskQueue _completions{ };
+    ice::TaskScheduler _completion_scheduler{ _completions };
+
+    ice::usize _inflight_data = 0_B;
+    ice::u32 _started_writes = 0;
+    ice::u32 _finished_writes = 0;
+
+    //! \brief Patched copy of the header, only used if resources where deduplicated.
+    ice::Memory _header_copy{ };
 
     ~HailstormAIOWriter() noexcept = default;
 
     inline bool open_and_resize(ice::usize total_size) noexcept;
     inline bool write_header(hailstorm::Data data, ice::usize offset) noexcept;
     inline bool write_metadata(hailstorm::Data data, ice::usize offset) noexcept;
-    inline bool write_resource(ice::u32 idx, ice::usize offset) noexcept;
+    inline bool write_resource(ice::u32 idx, ice::usize size, ice::usize offset) noexcept;
     inline bool close() noexcept;
 
 private:
+    inline void process_completions() noexcept;
+
     inline auto async_write_header(hailstorm::Data data, ice::usize offset) noexcept -> ice::Task<>;
     inline auto async_write_metadata(hailstorm::Data data, ice::usize offset) noexcept -> ice::Task<>;
-    inline auto async_write_resource(ice::u32 idx, ice::usize offset) noexcept -> ice::Task<>;
+    inline auto async_write_resource(ice::u32 idx, ice::usize load_size, ice::usize offset) noexcept -> ice::Task<>;
 
     inline auto async_write(
         ice::usize write_offset,
@@ -158,7 +175,11 @@ auto stream_write_resource(
     HailstormAIOWriter* writer
 ) noexcept -> bool
 {
-    return writer->write_resource(write_info.resource_index, offset);
+    return writer->write_resource(
+        write_info.resource_index,
+        ice::usize{ write_data.data[write_info.resource_index].size },
+        offset
+    );
 }
 
 bool hscp_write_hailstorm_file(
@@ -190,7 +211,18 @@ bool hscp_write_hailstorm_file(
     };
 
     HailstormAllocator hsalloc{ alloc };
-    HailstormAIOWriter writer{ params.filename, {}, params.aioport, params.task_scheduler, tracker, resources };
+    HailstormAIOWriter writer{
+        alloc,
+        params.filename,
+        {},
+        params.aioport,
+        params.task_scheduler,
+        tracker,
+        resources,
+        params.resource_duplicates,
+        params.resource_payloads,
+        params.max_inflight_data
+    };
     HailstormAsyncWriteParams const hsparams{
         .base_params = HailstormWriteParams{
             .temp_alloc = hsalloc,
@@ -238,19 +270,73 @@ inline bool HailstormAIOWriter::write_header(
     ice::usize write_offset
 ) noexcept
 {
+    if (ice::span::any(_duplicates))
+    {
+        ICE_ASSERT_CORE(_header_copy.location == nullptr);
+        _header_copy = _allocator.allocate({ ice::usize{ header_data.size }, (ice::ualign)header_data.align });
+        ice::memcpy(_header_copy.location, header_data.location, _header_copy.size);
+
+        // Duplicates had no space reserved, so we point them to the data of the original resource.
+        hailstorm::v1::HailstormData header_view;
+        hailstorm::Data const header_copy_data{ _header_copy.location, _header_copy.size.value, (size_t)_header_copy.alignment };
+        if (hailstorm::v1::read_header(header_copy_data, header_view) == hailstorm::Result::Success)
+        {
+            hailstorm::v1::HailstormResource* const resources = reinterpret_cast<hailstorm::v1::HailstormResource*>(
+                ice::ptr_add(
+                    _header_copy.location,
+                    ice::ptr_distance(_header_copy.location, header_view.resources.data())
+                )
+            );
+
+            ice::u32 const resource_count = ice::u32(header_view.resources.size());
+            for (ice::u32 idx = 0; idx < resource_count; ++idx)
+            {
+                ice::u32 const original_idx = _duplicates[idx];
+                if (original_idx != idx)
+                {
+                    resources[idx].chunk = resources[original_idx].chunk;
+                    resources[idx].offset = resources[original_idx].offset;
+                    resources[idx].size = resources[original_idx].size;
+                }
+            }
+
+            header_data = header_copy_data;
+        }
+    }
+
+    _started_writes += 1;
     ice::schedule_task(async_write_header(header_data, write_offset), _scheduler);
     return true;
 }
 
 inline bool HailstormAIOWriter::write_metadata(hailstorm::Data meta, ice::usize offset) noexcept
 {
+    _started_writes += 1;
     ice::schedule_task(async_write_metadata(meta, offset), _scheduler);
     return true;
 }
 
-inline bool HailstormAIOWriter::write_resource(ice::u32 idx, ice::usize offset) noexcept
+inline bool HailstormAIOWriter::write_resource(ice::u32 idx, ice::usize size, ice::usize offset) noexcept
 {
-    ice::schedule_task(async_write_resource(idx, offset), _scheduler);
+    // The payload is already written by the original resource.
+    if (ice::span::any(_duplicates) && _duplicates[idx] != idx)
+    {
+        return true;
+    }
+
+    // Payloads retained by the packer are already in memory, so only data we load ourselves is limited.
+    bool const retained = ice::span::any(_payloads) && _payloads[idx].location != nullptr;
+    ice::usize const load_size = retained ? 0_B : size;
+
+    // Wait for earlier writes to finish, so we don't keep the whole pack in memory.
+    while (_inflight_data > 0_B && _inflight_data + load_size > _max_inflight_data)
+    {
+        process_completions();
+    }
+
+    _inflight_data += load_size;
+    _started_writes += 1;
+    ice::schedule_task(async_write_resource(idx, load_size, offset), _scheduler);
     return true;
 }
 
@@ -258,27 +344,35 @@ inline bool HailstormAIOWriter::close() noexcept
 {
     while (_finished_writes != _started_writes)
     {
-        using ice::operator""_Tms;
-        ice::current_thread::sleep(5_Tms);
+        process_completions();
     }
 
+    _allocator.deallocate(_header_copy);
     return true;
 }
 
+inline void HailstormAIOWriter::process_completions() noexcept
+{
+    _completions.wait_any();
+    _completions.process_all();
+}
+
 inline auto HailstormAIOWriter::async_write_header(hailstorm::Data data, ice::usize offset) noexcept -> ice::Task<>
 {
-    _started_writes.fetch_add(1, std::memory_order_relaxed);
     bool const success = co_await async_write(offset, data);
     ICE_ASSERT(success, "Failed to write header data!");
-    _finished_writes.fetch_add(1, std::memory_order_relaxed);
+
+    co_await _completion_scheduler;
+    _finished_writes += 1;
 }
 
 inline auto HailstormAIOWriter::async_write_metadata(hailstorm::Data data, ice::usize offset) noexcept -> ice::Task<>
 {
-    _started_writes.fetch_add(1, std::memory_order_relaxed);
     bool const success = co_await async_write(offset, data);
     ICE_ASSERT(success, "Failed to write header data!");
-    _finished_writes.fetch_add(1, std::memory_order_relaxed);
+
+    co_await _completion_scheduler;
+    _finished_writes += 1;
 }
 
 inline auto data_to_hsdata(ice::Data data) noexcept -> hailstorm::Data
@@ -286,11 +380,19 @@ inline auto data_to_hsdata(ice::Data data) noexcept -> hailstorm::Data
     return { data.location, data.size.value, (size_t)data.alignment };
 }
 
-inline auto HailstormAIOWriter::async_write_resource(ice::u32 idx, ice::usize offset) noexcept -> ice::Task<>
+inline auto HailstormAIOWriter::async_write_resource(ice::u32 idx, ice::usize load_size, ice::usize offset) noexcept -> ice::Task<>
 {
-    _started_writes.fetch_add(1, std::memory_order_relaxed);
-    ice::ResourceResult const load_result = co_await _resource_tracker.load_resource(_resources[idx]);
-    _finished_loads.fetch_add(1, std::memory_order_relaxed);
+    // Retained payloads are still loaded, the tracker only needs to be asked for the remaining ones.
+    ice::ResourceResult load_result{ .resource_status = ice::ResourceStatus::Loaded, .resource = _resources[idx] };
+    if (ice::span::any(_payloads) && _payloads[idx].location != nullptr)
+    {
+        load_result.data = _payloads[idx];
+    }
+    else
+    {
+        load_result = co_await _resource_tracker.load_resource(_resources[idx]);
+    }
+
     if (load_result.resource_status == ice::ResourceStatus::Loaded)
     {
         bool const success = co_await async_write(offset, data_to_hsdata(load_result.data));
@@ -303,5 +405,8 @@ inline auto HailstormAIOWriter::async_write_resource(ice::u32 idx, ice::usize of
         // Release the resource now
         co_await _resource_tracker.unload_resource(_resources[idx]);
     }
-    _finished_writes.fetch_add(1, std::memory_order_relaxed);
+
+    co_await _completion_scheduler;
+    _inflight_data = ice::usize::subtract(_inflight_data, load_size);
+    _finished_writes += 1;
 }
@@ -5,6 +5,7 @@
 #include <ice/task_types.hxx>
 #include <ice/resource_types.hxx>
 #include <ice/native_file.hxx>
+#include <ice/span.hxx>
 #include <hailstorm/hailstorm.hxx>
 #include <hailstorm/hailstorm_operations.hxx>
 
@@ -34,6 +35,19 @@ struct HSCPWriteParams
 
     //! \brief Userdata passed to selector function.
     void* ud_chunk_selector;
+
+    //! \brief Maximum size of resource data loaded by the writer and waiting to be written at the same time.
+    //! \note A single resource larger than this value is still written.
+    //! \note Payloads passed in 'resource_payloads' are not counted against this limit.
+    ice::usize max_inflight_data = 256_MiB;
+
+    //! \brief Index of the resource holding the same payload, for each resource.
+    //! \details Duplicated resources are not written, their header entries are patched to point to the original data.
+    ice::Span<ice::u32 const> resource_duplicates = { };
+
+    //! \brief Payloads already loaded by the packer, written directly and unloaded afterwards.
+    //! \note Resources without a payload are loaded by the writer.
+    ice::Span<ice::Data const> resource_payloads = { };
 };
 
 bool hscp_write_hailstorm_file(